@@ -661,6 +661,61 @@ battle_context battle_context::choose_defender_weapon(nonempty_unit_const_ptr at
 	return best_choice ? std::move(*best_choice) : no_weapon();
 }
 
+/**
+ * A stamp of the state of @a u that a battle_context depends on, so that a
+ * cached entry stops matching when the unit is damaged, cured, slowed etc.
+ * Abilities of other units are covered by the cache's unit map version check.
+ */
+static std::size_t unit_combat_stamp(const unit& u)
+{
+	std::size_t stamp = u.hitpoints();
+	stamp = stamp * 97 + u.experience();
+	stamp = stamp * 2 + (u.get_state(unit::STATE_SLOWED) ? 1 : 0);
+	stamp = stamp * 2 + (u.get_state(unit::STATE_POISONED) ? 1 : 0);
+	stamp = stamp * 2 + (u.get_state(unit::STATE_PETRIFIED) ? 1 : 0);
+	stamp = stamp * 2 + (u.get_state(unit::STATE_INVULNERABLE) ? 1 : 0);
+	return stamp;
+}
+
+battle_context& battle_context_cache::get(const unit_map& units,
+		std::size_t turn,
+		const map_location& attacker_loc,
+		const map_location& defender_loc,
+		int attacker_weapon,
+		int defender_weapon,
+		unit_const_ptr attacker)
+{
+	if(units.version() != map_version_ || turn != turn_) {
+		entries_.clear();
+		map_version_ = units.version();
+		turn_ = turn;
+	}
+
+	if(!attacker) {
+		attacker = units.find(attacker_loc).get_shared_ptr();
+	}
+	unit_const_ptr defender = units.find(defender_loc).get_shared_ptr();
+
+	// The same units battle_context itself would resolve; it asserts on
+	// missing ones, so do the same rather than caching a bad lookup.
+	assert(attacker);
+	assert(defender);
+
+	const key_type key(attacker->underlying_id(), defender->underlying_id(),
+		attacker_loc, defender_loc, attacker_weapon, defender_weapon,
+		unit_combat_stamp(*attacker), unit_combat_stamp(*defender));
+
+	const auto it = entries_.find(key);
+	if(it != entries_.end()) {
+		return it->second;
+	}
+
+	return entries_
+		.emplace(key,
+			battle_context(units, attacker_loc, defender_loc, attacker_weapon, defender_weapon, 0.0, nullptr, attacker))
+		.first->second;
+}
+
 
 // ==================================================================================
 // HELPERS
@@ -764,6 +819,17 @@ private:
 	bool update_display_;
 	bool OOS_error_;
 
+	/**
+	 * Set when unit state that feeds battle_context_unit_stats changed since
+	 * the stats were last rebuilt. Changes made by WML handlers are covered
+	 * separately, through the pump's processed event count, so strikes where
+	 * nothing relevant happened can skip the rebuild in refresh_bc().
+	 */
+	bool bc_dirty_;
+
+	/** pump().processed_event_count() when the stats were last rebuilt. */
+	unsigned long long bc_event_stamp_;
+
 	bool use_prng_;
 
 	std::vector<bool> prng_attacker_;
@@ -838,6 +904,8 @@ attack::attack(const map_location& attacker,
 	, errbuf_()
 	, update_display_(update_display)
 	, OOS_error_(false)
+	, bc_dirty_(true)
+	, bc_event_stamp_(0)
 
 	//new experimental prng mode.
 	, use_prng_(resources::classification->random_mode == "biased" && randomness::generator->is_networked() == false)
@@ -889,7 +957,7 @@ void attack::fire_event(const std::string& n)
 
 	if(n == "attack_end") {
 		// We want to fire attack_end event in any case! Even if one of units was removed by WML.
-		resources::game_events->pump().fire(n, a_.loc_, d_.loc_, ev_data);
+		resources::game_events->pump().fire(n, a_.loc_, d_.loc_, std::move(ev_data));
 		return;
 	}
 
@@ -904,7 +972,7 @@ void attack::fire_event(const std::string& n)
 	bool wml_aborted;
 	std::tie(std::ignore, wml_aborted) = resources::game_events->pump().fire(n,
 		game_events::entity_location(a_.loc_, a_.id_),
-		game_events::entity_location(d_.loc_, d_.id_), ev_data);
+		game_events::entity_location(d_.loc_, d_.id_), std::move(ev_data));
 
 	// The event could have killed either the attacker or
 	// defender, so we have to make sure they still exist.
@@ -926,6 +994,19 @@ void attack::fire_event(const std::string& n)
 
 void attack::refresh_bc()
 {
+	// Rebuilding the stats re-evaluates every weapon special and ability
+	// through its WML filters. Most calls here follow a strike where no
+	// handler ran and no unit state changed, and the previous stats are
+	// then still exact.
+	const unsigned long long event_stamp = resources::game_events->pump().processed_event_count();
+
+	if(!bc_dirty_ && event_stamp == bc_event_stamp_) {
+		return;
+	}
+
+	bc_dirty_ = false;
+	bc_event_stamp_ = event_stamp;
+
 	// Fix index of weapons.
 	if(a_.valid()) {
 		refresh_weapon_index(a_.weapon_, a_.weap_id_, a_.get_unit().attacks());
@@ -1087,6 +1168,10 @@ bool attack::perform_hit(bool attacker_turn, statistics::attack_context& stats)
 	bool dies = defender.get_unit().take_hit(damage);
 	LOG_NG << "defender took " << damage << (dies ? " and died\n" : "\n");
 
+	if(damage != 0) {
+		bc_dirty_ = true;
+	}
+
 	if(attacker_turn) {
 		stats.attack_result(hits
 			? (dies
@@ -1123,6 +1208,7 @@ bool attack::perform_hit(bool attacker_turn, statistics::attack_context& stats)
 		// Set hitpoints to 0 so later checks don't invalidate the death.
 		if(results_dies) {
 			defender.get_unit().set_hitpoints(0);
+			bc_dirty_ = true;
 		}
 
 		OOS_error_ = true;
@@ -1150,8 +1236,10 @@ bool attack::perform_hit(bool attacker_turn, statistics::attack_context& stats)
 
 	if(drains_damage > 0) {
 		attacker.get_unit().heal(drains_damage);
+		bc_dirty_ = true;
 	} else if(drains_damage < 0) {
 		attacker_dies = attacker.get_unit().take_hit(-drains_damage);
+		bc_dirty_ = true;
 	}
 
 	if(dies) {
@@ -1174,11 +1262,13 @@ bool attack::perform_hit(bool attacker_turn, statistics::attack_context& stats)
 
 		if(attacker_stats->poisons && !defender_unit.get_state(unit::STATE_POISONED)) {
 			defender_unit.set_state(unit::STATE_POISONED, true);
+			bc_dirty_ = true;
 			LOG_NG << "defender poisoned";
 		}
 
 		if(attacker_stats->slows && !defender_unit.get_state(unit::STATE_SLOWED)) {
 			defender_unit.set_state(unit::STATE_SLOWED, true);
+			bc_dirty_ = true;
 			update_fog = true;
 			defender.damage_ = defender_stats->slow_damage;
 			LOG_NG << "defender slowed";
@@ -1187,6 +1277,7 @@ bool attack::perform_hit(bool attacker_turn, statistics::attack_context& stats)
 		// If the defender is petrified, the fight stops immediately
 		if(attacker_stats->petrifies) {
 			defender_unit.set_state(unit::STATE_PETRIFIED, true);
+			bc_dirty_ = true;
 			update_fog = true;
 			attacker.n_attacks_ = 0;
 			defender.n_attacks_ = -1; // Petrified.
@@ -1276,7 +1367,7 @@ void attack::unit_killed(unit_info& attacker,
 		);
 	}
 
-	resources::game_events->pump().fire("die", death_loc, attacker_loc, dat);
+	resources::game_events->pump().fire("die", death_loc, attacker_loc, std::move(dat));
 	refresh_bc();
 
 	if(!defender.valid() || defender.get_unit().hitpoints() > 0) {
@@ -1286,6 +1377,7 @@ void attack::unit_killed(unit_info& attacker,
 
 	units_.erase(defender.loc_);
 	resources::whiteboard->on_kill_unit();
+	bc_dirty_ = true;
 
 	// Plague units make new units on the target hex.
 	if(attacker.valid() && attacker_stats->plagues && !drain_killed) {
@@ -1311,6 +1403,7 @@ void attack::unit_killed(unit_info& attacker,
 
 			newunit->set_location(death_loc);
 			units_.insert(newunit);
+			bc_dirty_ = true;
 
 			game_events::entity_location reanim_loc(defender.loc_, newunit->underlying_id());
 			resources::game_events->pump().fire("unit_placed", reanim_loc);
@@ -1362,6 +1455,7 @@ void attack::perform()
 
 	a_.get_unit().set_facing(a_.loc_.get_relative_dir(d_.loc_));
 	d_.get_unit().set_facing(d_.loc_.get_relative_dir(a_.loc_));
+	bc_dirty_ = true;
 
 	try {
 		fire_event("pre_attack");
@@ -1380,6 +1474,7 @@ void attack::perform()
 
 	// If the attacker was invisible, she isn't anymore!
 	a_.get_unit().set_state(unit::STATE_UNCOVERED, true);
+	bc_dirty_ = true;
 
 	if(a_stats_->disable) {
 		LOG_NG << "attack::perform(): tried to attack with a disabled attack.";
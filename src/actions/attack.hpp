@@ -24,9 +24,12 @@
 
 #include "ai/lua/aspect_advancements.hpp"
 #include "attack_prediction.hpp"
+#include "map/location.hpp"
 #include "units/ptr.hpp"
 #include "units/unit_alignments.hpp"
 
+#include <map>
+#include <tuple>
 #include <vector>
 
 struct map_location;
@@ -250,6 +253,58 @@ private:
 	std::unique_ptr<combatant> defender_combatant_;
 };
 
+/**
+ * Caches battle_context instances for the damage preview UI.
+ *
+ * The sidebar weapon reports request the same attacker/defender pairs again
+ * every time the mouse moves, and computing the stats re-runs all ability
+ * and weapon special filters. Entries are keyed by both units' underlying
+ * ids, the involved hexes, the weapon pair and a stamp of each unit's
+ * combat-relevant state; everything is dropped when the unit map mutates or
+ * a new turn (and thus time of day) begins.
+ */
+class battle_context_cache
+{
+public:
+	battle_context_cache()
+		: entries_()
+		, map_version_(0)
+		, turn_(0)
+	{
+	}
+
+	/**
+	 * Returns the context for the given matchup, creating it on first use.
+	 * Both units must exist: the defender at @a defender_loc, the attacker
+	 * either at @a attacker_loc or passed explicitly via @a attacker (for
+	 * previews from a hex the unit has not actually reached).
+	 */
+	battle_context& get(const unit_map& units,
+			std::size_t turn,
+			const map_location& attacker_loc,
+			const map_location& defender_loc,
+			int attacker_weapon = -1,
+			int defender_weapon = -1,
+			unit_const_ptr attacker = unit_const_ptr());
+
+	/** Drops all cached contexts. */
+	void clear()
+	{
+		entries_.clear();
+	}
+
+private:
+	typedef std::tuple<std::size_t, std::size_t, map_location, map_location,
+		int, int, std::size_t, std::size_t> key_type;
+
+	std::map<key_type, battle_context> entries_;
+
+	/** unit_map::version() the entries were computed against. */
+	unsigned long long map_version_;
+	/** Turn number the entries were computed on. */
+	std::size_t turn_;
+};
+
 /** Performs an attack. */
 void attack_unit(const map_location& attacker,
 		const map_location& defender,
@@ -827,6 +827,9 @@ namespace { // Private helpers for move_unit()
 	 */
 	void unit_mover::pump_sighted(const route_iterator & from)
 	{
+		// WML gets to look at the screen, so the display work deferred by
+		// the invalidation batch has to land first.
+		clearer_.commit_invalidations();
 		game_events::pump_result_t pump_res = clearer_.fire_events();
 		post_wml(pump_res, from);
 	}
@@ -943,6 +946,10 @@ namespace { // Private helpers for move_unit()
 			unit_display::unit_mover animator(route_, show);
 			animator.start(move_it_.get_shared_ptr());
 
+			// One batch of display invalidations covers the whole
+			// traversal; each step's fog clearing only marks them pending.
+			clearer_.begin_invalidation_batch();
+
 			// Traverse the route to the hex where we need to stop.
 			// Each iteration performs the move from real_end_-1 to real_end_.
 			for ( real_end_ = begin_+1; real_end_ != ambush_limit_; ++real_end_ ) {
@@ -989,6 +996,7 @@ namespace { // Private helpers for move_unit()
 			}//for
 			// Make sure any remaining sighted events get fired.
 			pump_sighted(real_end_-1);
+			clearer_.end_invalidation_batch();
 
 			if ( move_it_.valid() ) {
 				// Finish animating.
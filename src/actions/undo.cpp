@@ -56,6 +56,7 @@
 #include <cassert>                      // for assert
 #include <ostream>                      // for operator<<, basic_ostream, etc
 #include <set>                          // for set
+#include <tuple>                        // for tuple
 
 static lg::log_domain log_engine("engine");
 #define ERR_NG LOG_STREAM(err, log_engine)
@@ -156,7 +157,7 @@ void undo_list::add_dummy()
 /**
  * Adds a dismissal to the undo stack.
  */
-void undo_list::add_dismissal(const unit_const_ptr u)
+void undo_list::add_dismissal(const unit_ptr& u)
 {
 	add(new undo::dismiss_action(u));
 }
@@ -450,6 +451,10 @@ bool undo_list::apply_shroud_changes() const
 	shroud_clearer clearer;
 	bool cleared_shroud = false;
 	const std::size_t list_size = undos_.size();
+	// A unit that walked back and forth occupies the same hex in several
+	// actions; clearing the same sight footprint again reveals nothing new,
+	// so remember what has been done already.
+	std::set<std::tuple<std::size_t, int, bool, map_location>> done;
 
 
 	// Loop through the list of undo_actions.
@@ -461,6 +466,10 @@ bool undo_list::apply_shroud_changes() const
 			// the action.
 			std::vector<map_location>::const_iterator step;
 			for (step = action->route.begin(); step != action->route.end(); ++step) {
+				if ( !done.emplace(action->view_info.underlying_id, action->view_info.sight_range,
+				                   action->view_info.slowed, *step).second ) {
+					continue;
+				}
 				// Clear the shroud, collecting new sighted events.
 				// (This can be made gradual by changing "true" to "false".)
 				if ( clearer.clear_unit(*step, tm, action->view_info, true) ) {
@@ -56,8 +56,8 @@ public:
 	void add_auto_shroud(bool turned_on);
 	/** Adds an auto-shroud toggle to the undo stack. */
 	void add_dummy();
-	/** Adds a dismissal to the undo stack. */
-	void add_dismissal(const unit_const_ptr u);
+	/** Adds a dismissal to the undo stack. Takes shared ownership of @a u. */
+	void add_dismissal(const unit_ptr& u);
 	/** Adds a move to the undo stack. */
 	void add_move(const unit_const_ptr u,
 	              const std::vector<map_location>::const_iterator & begin,
@@ -27,10 +27,12 @@ struct dismiss_action : undo_action
 	unit_ptr dismissed_unit;
 
 
-	explicit dismiss_action(const unit_const_ptr dismissed)
+	explicit dismiss_action(const unit_ptr& dismissed)
 		: undo_action()
-		, dismissed_unit(make_unit_ptr(*dismissed))
+		, dismissed_unit(dismissed)
 	{
+		// The caller is about to remove the unit from the recall list, so
+		// this shared reference becomes its owner; no copy is needed.
 	}
 	explicit dismiss_action(const config & cfg, const config & unit_cfg)
 		: undo_action(cfg)
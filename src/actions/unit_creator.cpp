@@ -234,7 +234,11 @@ void unit_creator::post_create(const map_location &loc, const unit &new_unit, bo
 
 	// Only fire the events if it's safe; it's not if we're in the middle of play_controller::reset_gamestate()
 	if (fire_event && resources::lua_kernel != nullptr) {
-		resources::game_events->pump().fire("unit_placed", loc);
+		if (board_->in_unit_placement_batch()) {
+			board_->defer_unit_placed_event(loc);
+		} else {
+			resources::game_events->pump().fire("unit_placed", loc);
+		}
 	}
 
 	if (display::get_singleton()!=nullptr) {
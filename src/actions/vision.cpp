@@ -164,7 +164,12 @@ inline void shroud_clearer::record_sighting(
 /**
  * Default constructor.
  */
-shroud_clearer::shroud_clearer() : jamming_(), sightings_(), view_team_(nullptr)
+shroud_clearer::shroud_clearer()
+	: jamming_()
+	, sightings_()
+	, view_team_(nullptr)
+	, batching_invalidations_(false)
+	, invalidations_pending_(false)
 {}
 
 
@@ -178,6 +183,13 @@ shroud_clearer::~shroud_clearer()
 	if ( !sightings_.empty() ) {
 		ERR_NG << sightings_.size() << " sighted events were ignored.";
 	}
+
+	// Whoever started a batch should have committed it, but do not let an
+	// interrupted move leave the display stale.
+	if ( invalidations_pending_ ) {
+		batching_invalidations_ = false;
+		invalidate_after_clear();
+	}
 }
 
 /**
@@ -325,6 +337,7 @@ bool shroud_clearer::clear_loc(team &tm, const map_location &loc,
  * @param friend_count     Incremented for each friend uncovered (excluding known_units).
  * @param spectator        Will be told of uncovered units (excluding known_units).
  * @param instant          If false, then drawing delays (used to make movement look better) are allowed.
+ * @param seen_locs        If non-null, receives every hex within the viewer's sight.
  *
  * @return whether or not information was uncovered (i.e. returns true if any
  *         locations in visual range were fogged/shrouded under shared vision/maps).
@@ -335,7 +348,8 @@ bool shroud_clearer::clear_unit(const map_location &view_loc, team &view_team,
                                 const map_location & real_loc,
                                 const std::set<map_location>* known_units,
                                 std::size_t * enemy_count, std::size_t * friend_count,
-                                move_unit_spectator * spectator, bool /*instant*/)
+                                move_unit_spectator * spectator, bool /*instant*/,
+                                std::set<map_location> * seen_locs)
 {
 	bool cleared_something = false;
 	// Dummy variables to make some logic simpler.
@@ -355,6 +369,8 @@ bool shroud_clearer::clear_unit(const map_location &view_loc, team &view_team,
 
 	// Clear the fog.
 	for (const pathfind::paths::step &dest : sight.destinations) {
+		if ( seen_locs )
+			seen_locs->insert(dest.curr);
 		bool known = known_units  &&  known_units->count(dest.curr) != 0;
 		if ( clear_loc(view_team, dest.curr, view_loc, real_loc, viewer_id, !known,
 		               *enemy_count, *friend_count, spectator) )
@@ -362,6 +378,8 @@ bool shroud_clearer::clear_unit(const map_location &view_loc, team &view_team,
 	}
 	//TODO guard with game_config option
 	for (const map_location &dest : sight.edges) {
+		if ( seen_locs )
+			seen_locs->insert(dest);
 		bool known = known_units  &&  known_units->count(dest) != 0;
 		if ( clear_loc(view_team, dest, view_loc, real_loc, viewer_id, !known,
 		               *enemy_count, *friend_count, spectator) )
@@ -389,6 +407,7 @@ bool shroud_clearer::clear_unit(const map_location &view_loc, team &view_team,
  * @param friend_count     Incremented for each friend uncovered (excluding known_units).
  * @param spectator        Will be told of uncovered units (excluding known_units).
  * @param instant          If false, then drawing delays (used to make movement look better) are allowed.
+ * @param seen_locs        If non-null, receives every hex within the viewer's sight.
  *
  * @return whether or not information was uncovered (i.e. returns true if any
  *         locations in visual range were fogged/shrouded under shared vision/maps).
@@ -397,14 +416,16 @@ bool shroud_clearer::clear_unit(const map_location &view_loc,
                                 const unit &viewer, team &view_team,
                                 const std::set<map_location>* known_units,
                                 std::size_t * enemy_count, std::size_t * friend_count,
-                                move_unit_spectator * spectator, bool instant)
+                                move_unit_spectator * spectator, bool instant,
+                                std::set<map_location> * seen_locs)
 {
 	// This is just a translation to the more general interface. It is
 	// not inlined so that vision.hpp does not have to include unit.hpp.
 	return clear_unit(view_loc, view_team, viewer.underlying_id(),
 	                  viewer.vision(), viewer.get_state(unit::STATE_SLOWED),
 	                  viewer.movement_type().get_vision(), viewer.get_location(),
-	                  known_units, enemy_count, friend_count, spectator, instant);
+	                  known_units, enemy_count, friend_count, spectator, instant,
+	                  seen_locs);
 }
 
 
@@ -577,14 +598,39 @@ game_events::pump_result_t shroud_clearer::fire_events()
  */
 void shroud_clearer::invalidate_after_clear()
 {
+	if ( batching_invalidations_ ) {
+		invalidations_pending_ = true;
+		return;
+	}
+
 	display::get_singleton()->invalidate_game_status();
-	display::get_singleton()->recalculate_minimap();
+	// The cleared tiles were invalidated as they were cleared, so the
+	// minimap only needs patching for those, not a full recomposition.
+	display::get_singleton()->update_minimap();
 	display::get_singleton()->labels().recalculate_shroud();
 	// The tiles are invalidated as they are cleared, so no need
 	// to invalidate them here.
 }
 
 
+/**
+ * Performs the display invalidations a batch has accumulated, if any.
+ * The batch stays open; see begin_invalidation_batch().
+ */
+void shroud_clearer::commit_invalidations()
+{
+	if ( !invalidations_pending_ )
+		return;
+
+	invalidations_pending_ = false;
+
+	const bool was_batching = batching_invalidations_;
+	batching_invalidations_ = false;
+	invalidate_after_clear();
+	batching_invalidations_ = was_batching;
+}
+
+
 /**
  * Returns the sides that cannot currently see @a target.
  * (Used to cache visibility before a move.)
@@ -706,6 +752,8 @@ void recalculate_fog(int side)
 	if (!tm.uses_fog())
 		return;
 
+	const gamemap &map = resources::gameboard->map();
+
 	// Exclude currently seen units from sighted events.
 	std::set<map_location> visible_locs;
 	for (const unit &u : resources::gameboard->units()) {
@@ -715,17 +763,45 @@ void recalculate_fog(int side)
 			visible_locs.insert(u_location);
 	}
 
-	tm.refog();
-	// Invalidate the screen before clearing the shroud.
-	// This speeds up the invalidations within clear_shroud_unit().
-	display::get_singleton()->invalidate_all();
-
+	// Clear the hexes within the side's current sightlines, recording their
+	// union as we go. Hexes that are already clear cost almost nothing in
+	// clear_loc(), so unlike the old refog-and-reclear approach this only
+	// does real work (including screen invalidation) where a hex actually
+	// becomes visible.
+	std::set<map_location> seen;
 	shroud_clearer clearer;
 	for (const unit &u : resources::gameboard->units())
 	{
 		if ( u.side() == side )
-			clearer.clear_unit(u.get_location(), u, tm, &visible_locs);
+			clearer.clear_unit(u.get_location(), u, tm, &visible_locs,
+			                   nullptr, nullptr, nullptr, true, &seen);
 	}
+
+	// clear_loc() clears these corner hexes alongside specific board hexes
+	// (sightlines never reach them directly), so keep them in step with
+	// their board hex instead of treating them as out of sight.
+	if ( seen.count(map_location(0, map.h()-1)) != 0 )
+		seen.insert(map_location(-1, map.h()));
+	if ( is_odd(map.w())  &&  seen.count(map_location(map.w()-1, map.h()-1)) != 0 )
+		seen.insert(map_location(map.w(), map.h()));
+	if ( is_even(map.w())  &&  seen.count(map_location(map.w()-1, 0)) != 0 )
+		seen.insert(map_location(map.w(), -1));
+
+	// Refog the hexes that fell out of every sightline.
+	for ( int x = -1; x <= map.w(); ++x )
+		for ( int y = -1; y <= map.h(); ++y ) {
+			const map_location loc(x, y);
+			if ( tm.fog_value(loc)  ||  seen.count(loc) != 0 )
+				continue;
+
+			tm.place_fog(loc);
+			display::get_singleton()->invalidate(loc);
+			// Also invalidate the neighbors, for the "fog edge" graphics.
+			for (const map_location &adj : get_adjacent_tiles(loc)) {
+				display::get_singleton()->invalidate(adj);
+			}
+		}
+
 	// Update the screen.
 	clearer.invalidate_after_clear();
 
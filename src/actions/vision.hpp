@@ -100,7 +100,8 @@ public:
 	                const map_location & real_loc,
 					const std::set<map_location>* known_units = nullptr,
 	                std::size_t * enemy_count = nullptr, std::size_t * friend_count = nullptr,
-	                move_unit_spectator * spectator = nullptr, bool instant = true);
+	                move_unit_spectator * spectator = nullptr, bool instant = true,
+	                std::set<map_location> * seen_locs = nullptr);
 	/**
 	 * Clears shroud (and fog) around the provided location for @a view_team
 	 * as if @a viewer was standing there.
@@ -109,7 +110,8 @@ public:
 	                const unit &viewer, team &view_team,
 	                const std::set<map_location>* known_units = nullptr,
 	                std::size_t * enemy_count = nullptr, std::size_t * friend_count = nullptr,
-	                move_unit_spectator * spectator = nullptr, bool instant = true);
+	                move_unit_spectator * spectator = nullptr, bool instant = true,
+	                std::set<map_location> * seen_locs = nullptr);
 	/**
 	 * Clears shroud (and fog) around the provided location for @a view_team
 	 * as if @a viewer was standing there. Setting @a instant to false
@@ -144,6 +146,27 @@ public:
 	/** The invalidations that should occur after invoking clear_unit(). */
 	void invalidate_after_clear();
 
+	/**
+	 * Starts batching display invalidations.
+	 *
+	 * While batching, invalidate_after_clear() only records that display
+	 * work is owed; commit_invalidations() pays it off in one go. A
+	 * multi-hex move clears fog once per step, and the game status, the
+	 * minimap and the shroud labels only need refreshing once per batch,
+	 * not once per hex entered.
+	 */
+	void begin_invalidation_batch() { batching_invalidations_ = true; }
+
+	/** Performs any pending display invalidations, staying in batch mode. */
+	void commit_invalidations();
+
+	/** Leaves batch mode, committing whatever is still pending. */
+	void end_invalidation_batch()
+	{
+		commit_invalidations();
+		batching_invalidations_ = false;
+	}
+
 private:
 	/** A record of a sighting event. */
 	struct sight_data;
@@ -166,6 +189,10 @@ private: // data
 	std::vector<sight_data> sightings_;
 	/** Keeps track of the team associated with jamming_. */
 	const team * view_team_;
+	/** Whether invalidate_after_clear() defers its work; see begin_invalidation_batch(). */
+	bool batching_invalidations_;
+	/** Whether a batched invalidation is owed to the display. */
+	bool invalidations_pending_;
 };
 
 
@@ -132,6 +132,33 @@ bool addons_client::request_addons_list(config& cfg)
 	return !update_last_error(response_buf);
 }
 
+bool addons_client::request_addons_list_page(config& cfg, std::size_t offset, std::size_t limit, bool quiet)
+{
+	cfg.clear();
+
+	config request_buf;
+	config& request_body = request_buf.add_child("request_campaign_list");
+
+	request_body["offset"] = offset;
+	request_body["limit"] = limit;
+
+	config response_buf;
+
+	send_request(request_buf, response_buf);
+
+	if(quiet) {
+		// Pages are small transfers; run them to completion without the
+		// modal progress dialog so the add-ons manager stays in front.
+		conn_->run();
+	} else {
+		wait_for_transfer_done(_("Downloading list of add-ons..."));
+	}
+
+	std::swap(cfg, response_buf.mandatory_child("campaigns"));
+
+	return !update_last_error(response_buf);
+}
+
 bool addons_client::request_distribution_terms(std::string& terms)
 {
 	if(!license_notice_.empty()) {
@@ -92,6 +92,24 @@ public:
 	 */
 	bool request_addons_list(config& cfg);
 
+	/**
+	 * Request one page of the add-ons list from the server.
+	 *
+	 * Requires a server that advertises the "list:paging" capability; see
+	 * server_supports_list_paging().
+	 *
+	 * @return @a true on success, @a false on failure. Retrieve the error message with @a get_last_server_error.
+	 *
+	 * @param cfg    A config object whose contents are replaced with the
+	 *               requested page if available, cleared otherwise. Its
+	 *               "total" attribute holds the full match count.
+	 * @param offset Index of the first add-on to return.
+	 * @param limit  Maximum number of add-ons to return, 0 for no limit.
+	 * @param quiet  Skip the progress dialog; used for background pages
+	 *               fetched while the add-ons manager is already usable.
+	 */
+	bool request_addons_list_page(config& cfg, std::size_t offset, std::size_t limit, bool quiet = false);
+
 	/**
 	 * Retrieves the add-ons server web URL if available.
 	 */
@@ -202,6 +220,14 @@ public:
 		return server_supports("delta");
 	}
 
+	/**
+	 * Returns whether the server supports paged add-ons list requests.
+	 */
+	bool server_supports_list_paging() const
+	{
+		return server_supports("list:paging");
+	}
+
 	/**
 	 * Returns whether the server supports passphrase authentication on an add-on basis.
 	 */
@@ -25,6 +25,10 @@
 
 #include <boost/algorithm/string.hpp>
 
+#include <atomic>
+#include <mutex>
+#include <thread>
+
 static lg::log_domain log_config("config");
 #define ERR_CFG LOG_STREAM(err , log_config)
 #define LOG_CFG LOG_STREAM(info, log_config)
@@ -302,12 +306,14 @@ void archive_addon(const std::string& addon_name, config& cfg)
 	archive_dir(parentd, addon_name, cfg.add_child("dir"), ignore_patterns);
 }
 
-static void unarchive_file(const std::string& path, const config& cfg)
+/** A file write queued by unarchive_addon(). */
+struct unarchive_job
 {
-	filesystem::write_file(path + '/' + cfg["name"].str(), unencode_binary(cfg["contents"]));
-}
+	std::string path;
+	std::string contents;
+};
 
-static void unarchive_dir(const std::string& path, const config& cfg, std::function<void()> file_callback = {})
+static void collect_unarchive_jobs(const std::string& path, config& cfg, std::vector<unarchive_job>& jobs)
 {
 	std::string dir;
 	if (cfg["name"].empty())
@@ -317,37 +323,83 @@ static void unarchive_dir(const std::string& path, const config& cfg, std::funct
 
 	filesystem::make_directory(dir);
 
-	for(const config &d : cfg.child_range("dir")) {
-		unarchive_dir(dir, d, file_callback);
+	for(config &d : cfg.child_range("dir")) {
+		collect_unarchive_jobs(dir, d, jobs);
 	}
 
-	for(const config &f : cfg.child_range("file")) {
-		unarchive_file(dir, f);
-		if(file_callback) {
-			file_callback();
-		}
+	for(config &f : cfg.child_range("file")) {
+		unarchive_job job;
+		job.path = dir + '/' + f["name"].str();
+		job.contents = f["contents"].str();
+
+		// Release the archive's copy right away, so at most one file is
+		// held twice at any moment rather than the whole add-on.
+		f["contents"] = "";
+
+		jobs.push_back(std::move(job));
 	}
 }
 
-static unsigned count_pack_files(const config& cfg)
+void unarchive_addon(config& cfg, std::function<void(unsigned)> progress_callback)
 {
-	unsigned count = 0;
+	const std::string parentd = filesystem::get_addons_dir();
+
+	// Directories are created here, on the main thread; the workers below
+	// only ever write regular files, each to a distinct path.
+	std::vector<unarchive_job> jobs;
+	collect_unarchive_jobs(parentd, cfg, jobs);
 
-	for(const config& d : cfg.child_range("dir")) {
-		count += count_pack_files(d);
+	if(jobs.empty()) {
+		return;
 	}
 
-	return count + cfg.child_count("file");
-}
+	const unsigned worker_count = std::min<unsigned>(
+		{4u, std::max(1u, std::thread::hardware_concurrency()), static_cast<unsigned>(jobs.size())});
+
+	std::atomic<unsigned> done{0};
+	std::exception_ptr error;
+	std::mutex error_mutex;
+
+	// Decoding and writing are independent per file; split the jobs by
+	// stride. The main thread takes a share too and is the only one that
+	// reports progress, since the callback touches the GUI.
+	auto write_some = [&](unsigned first, bool report) {
+		try {
+			for(std::size_t i = first; i < jobs.size(); i += worker_count) {
+				filesystem::write_file(jobs[i].path, unencode_binary(jobs[i].contents));
+				std::string().swap(jobs[i].contents);
+				++done;
+
+				if(report && progress_callback) {
+					progress_callback(done * 100.0 / jobs.size());
+				}
+			}
+		} catch(...) {
+			std::lock_guard<std::mutex> lock(error_mutex);
+			if(!error) {
+				error = std::current_exception();
+			}
+		}
+	};
 
-void unarchive_addon(const config& cfg, std::function<void(unsigned)> progress_callback)
-{
-	const std::string parentd = filesystem::get_addons_dir();
-	unsigned file_count = progress_callback ? count_pack_files(cfg) : 0, done = 0;
-	auto file_callback = progress_callback
-		? [&]() { progress_callback(++done * 100.0 / file_count); }
-		: std::function<void()>{};
-	unarchive_dir(parentd, cfg, file_callback);
+	std::vector<std::thread> workers;
+	for(unsigned t = 1; t < worker_count; ++t) {
+		workers.emplace_back(write_some, t, false);
+	}
+
+	write_some(0, true);
+
+	for(std::thread& worker : workers) {
+		worker.join();
+	}
+
+	if(error) {
+		std::rethrow_exception(error);
+	}
+
+	if(progress_callback) {
+		progress_callback(100);
+	}
 }
 
 static void purge_dir(const std::string& path, const config& removelist)
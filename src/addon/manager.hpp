@@ -154,8 +154,14 @@ bool is_addon_installed(const std::string& addon_name);
 /** Archives an add-on into a config object for campaignd transactions. */
 void archive_addon(const std::string& addon_name, class config& cfg);
 
-/** Unarchives an add-on from campaignd's retrieved config object. */
-void unarchive_addon(const class config& cfg, std::function<void(unsigned)> progress_callback = {});
+/**
+ * Unarchives an add-on from campaignd's retrieved config object.
+ *
+ * File contents are moved out of @a cfg as they are queued for writing, so
+ * the archive's memory is released while the install progresses instead of
+ * being held until the end.
+ */
+void unarchive_addon(class config& cfg, std::function<void(unsigned)> progress_callback = {});
 
 /** Removes the listed files from the addon. */
 void purge_addon(const config& removelist);
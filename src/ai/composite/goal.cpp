@@ -261,16 +261,19 @@ void protect_goal::add_targets(std::back_insert_iterator< std::vector< target >>
 	}
 	DBG_AI_GOAL << "side " << get_side() << ": searching for threats in "+goal_type+" goal";
 	// Look for directions to protect a specific location or specific unit.
+	if (radius_ <= 0) {
+		return;
+	}
 	for (const map_location &loc : items)
 	{
-		for (const unit &u : units)
+		for (const unit_map::const_unit_iterator &u : units.find_in_radius(loc, radius_ - 1))
 		{
-			int distance = distance_between(u.get_location(), loc);
-			if (current_team().is_enemy(u.side()) && distance < radius_ &&
-			    !u.invisible(u.get_location()))
+			int distance = distance_between(u->get_location(), loc);
+			if (current_team().is_enemy(u->side()) &&
+			    !u->invisible(u->get_location()))
 			{
-				DBG_AI_GOAL << "side " << get_side() << ": in " << goal_type << ": found threat target. " << u.get_location() << " is a threat to "<< loc;
-				*target_list = target(u.get_location(),
+				DBG_AI_GOAL << "side " << get_side() << ": in " << goal_type << ": found threat target. " << u->get_location() << " is a threat to "<< loc;
+				*target_list = target(u->get_location(),
 					value_ * static_cast<double>(radius_ - distance) /
 					radius_, ai_target::type::threat);
 			}
@@ -59,6 +59,7 @@
 #include <cmath>                       // for sqrt
 #include <cstdlib>                     // for abs
 #include <ctime>                       // for time
+#include <deque>                        // for deque
 #include <iterator>                     // for back_inserter
 #include <ostream>                      // for operator<<, basic_ostream, etc
 
@@ -176,6 +177,8 @@ readonly_context_impl::readonly_context_impl(side_context &context, const config
 	dstsrc_(),enemy_dstsrc_(),
 	enemy_possible_moves_(),
 	enemy_srcdst_(),
+	fullmove_dstsrc_(),
+	fullmove_srcdst_(),
 	grouping_(),
 	goals_(),
 	keeps_(),
@@ -184,6 +187,7 @@ readonly_context_impl::readonly_context_impl(side_context &context, const config
 	leader_ignores_keep_(),
 	leader_value_(),
 	move_maps_enemy_valid_(false),
+	move_maps_fullmove_valid_(false),
 	move_maps_valid_(false),
 	dst_src_valid_lua_(false),
 	dst_src_enemy_valid_lua_(false),
@@ -337,6 +341,12 @@ void readonly_context_impl::calculate_moves(const unit_map& units, std::map<map_
 	) const
 {
 
+	// Collect the units to handle first, so their paths can be computed as
+	// one batch. The movement resetters have to stay alive until the batch
+	// is done; they only touch their own unit, so overlapping them is fine.
+	std::vector<const unit*> batch_units;
+	std::deque<unit_movement_resetter> move_resetters;
+
 	for(unit_map::const_iterator un_it = units.begin(); un_it != units.end(); ++un_it) {
 		// If we are looking for the movement of enemies, then this unit must be an enemy unit.
 		// If we are looking for movement of our own units, it must be on our side.
@@ -357,7 +367,7 @@ void readonly_context_impl::calculate_moves(const unit_map& units, std::map<map_
 			continue;
 		}
 		// If it's an enemy unit, reset its moves while we do the calculations.
-		const unit_movement_resetter move_resetter(*un_it,enemy || assume_full_movement);
+		move_resetters.emplace_back(*un_it, enemy || assume_full_movement);
 
 		// Insert the trivial moves of staying on the same map location.
 		if (un_it->movement_left() > 0) {
@@ -365,21 +375,31 @@ void readonly_context_impl::calculate_moves(const unit_map& units, std::map<map_
 			srcdst.insert(trivial_mv);
 			dstsrc.insert(trivial_mv);
 		}
-		/**
-		 * TODO: This is where support for a speculative unit map is incomplete.
-		 *       There are several places (deep) within the paths constructor
-		 *       where resources::gameboard->units() is assumed to be the unit map. Rather
-		 *       than introduce a new parameter to numerous functions, a better
-		 *       solution may be for the creator of the speculative map (if one
-		 *       is used in the future) to cause resources::gameboard->units() to point to
-		 *       that map (and restore the "real" pointer when the speculating
-		 *       is completed). If that approach is adopted, calculate_moves()
-		 *       and calculate_possible_moves() become redundant, and one of
-		 *       them should probably be eliminated.
-		 */
-		res.emplace(un_it->get_location(), pathfind::paths(*un_it, false, true, current_team(), 0, see_all));
+
+		batch_units.push_back(&*un_it);
+	}
+
+	/**
+	 * TODO: This is where support for a speculative unit map is incomplete.
+	 *       There are several places (deep) within the paths constructor
+	 *       where resources::gameboard->units() is assumed to be the unit map. Rather
+	 *       than introduce a new parameter to numerous functions, a better
+	 *       solution may be for the creator of the speculative map (if one
+	 *       is used in the future) to cause resources::gameboard->units() to point to
+	 *       that map (and restore the "real" pointer when the speculating
+	 *       is completed). If that approach is adopted, calculate_moves()
+	 *       and calculate_possible_moves() become redundant, and one of
+	 *       them should probably be eliminated.
+	 */
+	std::vector<pathfind::paths> batch_paths =
+		pathfind::find_paths_batch(batch_units, false, true, current_team(), 0, see_all);
+
+	for(std::size_t i = 0; i < batch_units.size(); ++i) {
+		res.emplace(batch_units[i]->get_location(), std::move(batch_paths[i]));
 	}
 
+	move_resetters.clear();
+
 	// deactivate terrain filtering if it's just the dummy 'matches nothing'
 	static const config only_not_tag("not");
 	if(remove_destinations && remove_destinations->to_config() == only_not_tag) {
@@ -603,6 +623,22 @@ const move_map& readonly_context_impl::get_enemy_srcdst() const
 	return enemy_srcdst_;
 }
 
+const move_map& readonly_context_impl::get_fullmove_dstsrc() const
+{
+	if (!move_maps_fullmove_valid_) {
+		recalculate_move_maps_fullmove();
+	}
+	return fullmove_dstsrc_;
+}
+
+const move_map& readonly_context_impl::get_fullmove_srcdst() const
+{
+	if (!move_maps_fullmove_valid_) {
+		recalculate_move_maps_fullmove();
+	}
+	return fullmove_srcdst_;
+}
+
 engine_ptr readonly_context_impl::get_engine_by_cfg(const config& cfg)
 {
 	std::string engine_name = cfg["engine"];
@@ -873,6 +909,7 @@ void readonly_context_impl::invalidate_move_maps() const
 {
 	move_maps_valid_ = false;
 	move_maps_enemy_valid_ = false;
+	move_maps_fullmove_valid_ = false;
 
 	dst_src_valid_lua_ = false;
 	dst_src_enemy_valid_lua_ = false;
@@ -1139,6 +1176,15 @@ void readonly_context_impl::recalculate_move_maps_enemy() const
 	src_dst_enemy_valid_lua_ = false;
 }
 
+void readonly_context_impl::recalculate_move_maps_fullmove() const
+{
+	fullmove_dstsrc_ = move_map();
+	fullmove_srcdst_ = move_map();
+	moves_map dummy_possible_moves;
+	calculate_possible_moves(dummy_possible_moves, fullmove_srcdst_, fullmove_dstsrc_, false, true, &get_avoid());
+	move_maps_fullmove_valid_ = true;
+}
+
 void readonly_context_impl::set_dst_src_valid_lua()
 {
 	dst_src_valid_lua_ = true;
@@ -235,6 +235,12 @@ public:
 
 	virtual std::vector<engine_ptr>& get_engines() = 0;
 
+	/** Like get_dstsrc(), but assuming own units have their full movement available. */
+	virtual const move_map& get_fullmove_dstsrc() const = 0;
+
+	/** Like get_srcdst(), but assuming own units have their full movement available. */
+	virtual const move_map& get_fullmove_srcdst() const = 0;
+
 	virtual std::string get_grouping() const = 0;
 
 	virtual const std::vector<goal_ptr>& get_goals() const = 0;
@@ -635,6 +641,16 @@ public:
 		return target_->get_engines();
 	}
 
+	virtual const move_map& get_fullmove_dstsrc() const override
+	{
+		return target_->get_fullmove_dstsrc();
+	}
+
+	virtual const move_map& get_fullmove_srcdst() const override
+	{
+		return target_->get_fullmove_srcdst();
+	}
+
 	virtual std::string get_grouping() const override
 	{
 		return target_->get_grouping();
@@ -1172,6 +1188,10 @@ public:
 
 	virtual std::vector<engine_ptr>& get_engines() override;
 
+	virtual const move_map& get_fullmove_dstsrc() const override;
+
+	virtual const move_map& get_fullmove_srcdst() const override;
+
 	virtual std::string get_grouping() const override;
 
 	virtual const std::vector<goal_ptr>& get_goals() const override;
@@ -1280,6 +1300,8 @@ private:
 
 	bool applies_to_leader(const utils::variant<bool, std::vector<std::string>> &aspect_value, const std::string &id) const;
 
+	void recalculate_move_maps_fullmove() const;
+
 	const config cfg_;
 
 	/**
@@ -1301,6 +1323,8 @@ private:
 	mutable move_map enemy_dstsrc_;
 	mutable moves_map enemy_possible_moves_;
 	mutable move_map enemy_srcdst_;
+	mutable move_map fullmove_dstsrc_;
+	mutable move_map fullmove_srcdst_;
 	typesafe_aspect_ptr<std::string> grouping_;
 	std::vector< goal_ptr > goals_;
 	mutable keeps_cache keeps_;
@@ -1309,6 +1333,7 @@ private:
 	typesafe_aspect_ptr<utils::variant<bool, std::vector<std::string>>> leader_ignores_keep_;
 	typesafe_aspect_ptr<double> leader_value_;
 	mutable bool move_maps_enemy_valid_;
+	mutable bool move_maps_fullmove_valid_;
 	mutable bool move_maps_valid_;
 	mutable bool dst_src_valid_lua_;
 	mutable bool dst_src_enemy_valid_lua_;
@@ -96,9 +96,8 @@ std::shared_ptr<attacks_vector> aspect_attacks_base::analyze_targets() const
 	std::array<bool, 6> used_locations;
 	used_locations.fill(false);
 
-	moves_map dummy_moves;
-	move_map fullmove_srcdst, fullmove_dstsrc;
-	calculate_possible_moves(dummy_moves, fullmove_srcdst, fullmove_dstsrc, false, true);
+	const move_map& fullmove_srcdst = get_fullmove_srcdst();
+	const move_map& fullmove_dstsrc = get_fullmove_dstsrc();
 
 	unit_stats_cache().clear();
 
@@ -120,6 +119,7 @@ std::shared_ptr<attacks_vector> aspect_attacks_base::analyze_targets() const
 				enemy_dstsrc, adjacent, used_locations, unit_locs, *res, analysis, current_team());
 		}
 	}
+
 	return res;
 }
 
@@ -140,6 +140,7 @@ void aspect_attacks_base::do_attack_analysis(const map_location& loc,
 	// This function is called fairly frequently, so interact with the user here.
 
 	ai::manager::get_singleton().raise_user_interact();
+
 	const int max_attack_depth = 5;
 	if(cur_analysis.movements.size() >= std::size_t(max_attack_depth)) {
 		return;
@@ -1406,12 +1406,9 @@ double retreat_phase::evaluate()
 
 	//unit_map::const_iterator leader = units_.find_leader(get_side());
 	std::vector<unit_map::const_iterator> leaders = units_.find_leaders(get_side());
-	std::map<map_location,pathfind::paths> dummy_possible_moves;
 
-	move_map fullmove_srcdst;
-	move_map fullmove_dstsrc;
-	calculate_possible_moves(dummy_possible_moves, fullmove_srcdst, fullmove_dstsrc,
-			false, true, &get_avoid());
+	const move_map& fullmove_srcdst = get_fullmove_srcdst();
+	const move_map& fullmove_dstsrc = get_fullmove_dstsrc();
 
 	std::vector<map_location> leaders_adj_v;
 	for (unit_map::const_iterator leader : leaders) {
@@ -451,10 +451,8 @@ std::pair<map_location,map_location> move_to_targets_phase::choose_move(std::vec
 		}
 	}
 
-	std::map<map_location,pathfind::paths> dummy_possible_moves;
-	move_map fullmove_srcdst;
-	move_map fullmove_dstsrc;
-	calculate_possible_moves(dummy_possible_moves,fullmove_srcdst,fullmove_dstsrc,false,true);
+	const move_map& fullmove_srcdst = get_fullmove_srcdst();
+	const move_map& fullmove_dstsrc = get_fullmove_dstsrc();
 
 	bool dangerous = false;
 
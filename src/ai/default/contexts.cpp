@@ -172,6 +172,11 @@ std::vector<target> default_ai_context_impl::find_targets(const move_map& enemy_
 		calculate_possible_moves(friends_possible_moves, friends_srcdst, friends_dstsrc, false, true);
 
 		const std::vector<map_location>& villages = map_.villages();
+
+		// Measure every village against the leader in one batch.
+		std::vector<std::size_t> leader_distances;
+		distances_between(leader->get_location(), villages, leader_distances);
+
 		for(std::vector<map_location>::const_iterator t =
 				villages.begin(); t != villages.end(); ++t) {
 
@@ -202,7 +207,7 @@ std::vector<target> default_ai_context_impl::find_targets(const move_map& enemy_
 			}
 			else
 			{
-				double leader_distance = distance_between(*t, leader->get_location());
+				double leader_distance = leader_distances[t - villages.begin()];
 				double value = village_value * (1.0 - leader_distance / corner_distance);
 				LOG_AI << "found village target... " << *t
 					<< " with value: " << value
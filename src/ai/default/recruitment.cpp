@@ -122,6 +122,7 @@ recruitment::recruitment(rca_context& context, const config& cfg)
 	own_units_in_combat_counter_(0),
 	average_local_cost_(),
 	cheapest_unit_costs_(),
+	cost_map_cache_(),
 	combat_cache_(),
 	recruit_situation_change_observer_(),
 	average_lawful_bonus_(0.0),
@@ -705,17 +706,36 @@ double recruitment::get_average_defense(const std::string& u_type) const {
 	return average_defense;
 }
 
+/** A full_cost_map together with the game state versions it was built from. */
+struct recruitment::stamped_cost_map {
+	unsigned long long unit_map_version;
+	unsigned long long terrain_version;
+	pathfind::full_cost_map cost_map;
+};
+
 /**
  * For Map Analysis.
  * Creates cost maps for a side. Each hex is map to
  * a) the summed movecost and
  * b) how many units can reach this hex
  * for all units of side.
+ * The maps are cached between calls: since a summed multi-unit map cannot
+ * be patched up locally when a unit leaves, any unit or terrain delta
+ * (detected through the unit_map and gamemap version counters) triggers a
+ * full rebuild of the affected side's map.
  */
-const  pathfind::full_cost_map recruitment::get_cost_map_of_side(int side) const {
+const pathfind::full_cost_map& recruitment::get_cost_map_of_side(int side) const {
 	const unit_map& units = resources::gameboard->units();
+	const gamemap& map = resources::gameboard->map();
 	const team& team = resources::gameboard->get_team(side);
 
+	const auto cached = cost_map_cache_.find(side);
+	if (cached != cost_map_cache_.end() &&
+			cached->second->unit_map_version == units.version() &&
+			cached->second->terrain_version == map.version()) {
+		return cached->second->cost_map;
+	}
+
 	pathfind::full_cost_map cost_map(true, true, team, true, true);
 
 	// First add all existing units to cost_map.
@@ -744,7 +764,11 @@ const  pathfind::full_cost_map recruitment::get_cost_map_of_side(int side) const
 			}
 		}
 	}
-	return cost_map;
+
+	std::shared_ptr<stamped_cost_map>& entry = cost_map_cache_[side];
+	entry = std::make_shared<stamped_cost_map>(
+			stamped_cost_map{units.version(), map.version(), std::move(cost_map)});
+	return entry->cost_map;
 }
 
 /**
@@ -774,7 +798,13 @@ void recruitment::update_average_lawful_bonus() {
 		++counter;
 	}
 	if (counter > 0) {
-		average_lawful_bonus_ = std::round(static_cast<double>(sum) / counter);
+		const double new_bonus = std::round(static_cast<double>(sum) / counter);
+		if (new_bonus != average_lawful_bonus_) {
+			// The simulated attacks bake this bonus into their damage, so
+			// results scored under another schedule can't be reused.
+			combat_cache_.clear();
+			average_lawful_bonus_ = new_bonus;
+		}
 	}
 }
 
@@ -846,10 +876,10 @@ void recruitment::update_important_hexes() {
 	// for all units of the team.
 	// The important hexes are those where my value on the cost map is
 	// similar to a enemies one.
-	const pathfind::full_cost_map my_cost_map = get_cost_map_of_side(get_side());
+	const pathfind::full_cost_map& my_cost_map = get_cost_map_of_side(get_side());
 	for (const team& team : resources::gameboard->teams()) {
 		if (current_team().is_enemy(team.side())) {
-			const pathfind::full_cost_map enemy_cost_map = get_cost_map_of_side(team.side());
+			const pathfind::full_cost_map& enemy_cost_map = get_cost_map_of_side(team.side());
 
 			compare_cost_maps_and_update_important_hexes(my_cost_map, enemy_cost_map);
 		}
@@ -933,11 +963,11 @@ double recruitment::compare_unit_types(const std::string& a, const std::string&
 		double value_of_b = damage_to_a / (a_max_hp * b_cost);
 
 		if (value_of_a > value_of_b) {
-			return value_of_a / value_of_b;
+			retval = value_of_a / value_of_b;
 		} else if (value_of_a < value_of_b) {
-			return -value_of_b / value_of_a;
+			retval = -value_of_b / value_of_a;
 		} else {
-			return 0.;
+			retval = 0.;
 		}
 	}
 
@@ -26,6 +26,7 @@
 #include "units/map.hpp"
 
 #include <iomanip>
+#include <memory>
 
 namespace pathfind {
 
@@ -188,7 +189,7 @@ private:
 			const pathfind::full_cost_map& my_cost_map,
 			const pathfind::full_cost_map& enemy_cost_map);
 	double get_average_defense(const std::string& unit_type) const;
-	const pathfind::full_cost_map get_cost_map_of_side(int side) const;
+	const pathfind::full_cost_map& get_cost_map_of_side(int side) const;
 	void show_important_hexes() const;  //Debug only
 	void update_average_lawful_bonus();
 	void update_average_local_cost();
@@ -257,6 +258,14 @@ private:
 	int own_units_in_combat_counter_;
 	std::map<map_location, double> average_local_cost_;
 	std::map<std::size_t, int> cheapest_unit_costs_;
+
+	/**
+	 * Cost maps built by get_cost_map_of_side(), keyed by side and stamped
+	 * with the unit_map and terrain versions they were computed from. A map
+	 * is only rebuilt when one of its stamps no longer matches.
+	 */
+	struct stamped_cost_map;
+	mutable std::map<int, std::shared_ptr<stamped_cost_map>> cost_map_cache_;
 	cache_table combat_cache_;
 	enum states {NORMAL, SAVE_GOLD, SPEND_ALL_GOLD, LEADER_IN_DANGER};
 	states state_;
@@ -575,15 +575,11 @@ DEFINE_FAI_FUNCTION(close_enemies, 2, 2)
 		range_s = 0;
 	}
 	std::size_t range = static_cast<std::size_t>(range_s);
-	unit_map::const_iterator un = resources::gameboard->units().begin();
-	unit_map::const_iterator end = resources::gameboard->units().end();
-	while (un != end) {
-		if (distance_between(loc, un->get_location()) <= range) {
-			if (un->side() != ai_.get_side()) {//fixme: ignores allied units
-				vars.emplace_back(std::make_shared<unit_callable>(*un));
-			}
+	const unit_map& units = resources::gameboard->units();
+	for (const unit_map::const_unit_iterator& un : units.find_in_radius(loc, range)) {
+		if (un->side() != ai_.get_side()) {//fixme: ignores allied units
+			vars.emplace_back(std::make_shared<unit_callable>(*un));
 		}
-		++un;
 	}
 	return variant(vars);
 }
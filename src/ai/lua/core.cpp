@@ -41,6 +41,7 @@
 #include "units/unit.hpp"
 #include "ai/actions.hpp"
 #include "ai/lua/engine_lua.hpp"
+#include "ai/simulated_actions.hpp"
 #include "ai/composite/contexts.hpp"
 #include "ai/default/aspect_attacks.hpp"
 
@@ -315,6 +316,13 @@ static int cfun_ai_fallback_human(lua_State*)
 	throw fallback_ai_to_human_exception();
 }
 
+// Identifies the current (simulated) game state; see simulated_state_hash().
+static int cfun_ai_get_state_hash(lua_State *L)
+{
+	lua_pushinteger(L, static_cast<lua_Integer>(simulated_state_hash()));
+	return 1;
+}
+
 // Goals and targets
 
 static int cfun_ai_get_targets(lua_State *L)
@@ -942,6 +950,7 @@ static void generate_and_push_ai_table(lua_State* L, ai::engine_lua* engine) {
 		{ "check_stopunit", &cfun_ai_check_stopunit },
 		{ "check_attack", &cfun_ai_check_attack },
 		{ "check_recruit", &cfun_ai_check_recruit },
+		{ "get_state_hash", &cfun_ai_get_state_hash },
 		{ nullptr, nullptr }
 	};
 	for (const luaL_Reg* p = callbacks; p->name; ++p) {
@@ -21,6 +21,7 @@
 #include "ai/manager.hpp"
 
 #include "config.hpp"             // for config, etc
+#include "draw_manager.hpp"       // for get_frame_length
 #include "game_events/pump.hpp"
 #include "log.hpp"
 #include "map/location.hpp"       // for map_location
@@ -423,7 +424,10 @@ void manager::raise_user_interact() {
 		return;
 	}
 
-	const int interact_time = 30;
+	// Interleave one UI slice per display frame, so the screen and input
+	// keep up with the monitor while the AI is thinking; heavy AI turns
+	// then cost more interact slices instead of a choppier interface.
+	const int interact_time = draw_manager::get_frame_length();
 	const int time_since_interact = SDL_GetTicks() - last_interact_;
 	if(time_since_interact < interact_time) {
 		return;
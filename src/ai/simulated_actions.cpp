@@ -180,6 +180,42 @@ bool simulated_synced_command(){
 	return false;
 }
 
+namespace {
+
+// Finalizer of splitmix64; turns structured field values into well-mixed keys.
+uint64_t mix64(uint64_t x){
+	x += 0x9e3779b97f4a7c15ull;
+	x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+	x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+	return x ^ (x >> 31);
+}
+
+} // namespace
+
+uint64_t simulated_state_hash(){
+	uint64_t hash = 0;
+
+	for(const unit& u : resources::gameboard->units()){
+		uint64_t key = mix64(u.underlying_id());
+		key = mix64(key ^ std::hash<std::string>()(u.type_id()));
+		key = mix64(key ^ (static_cast<uint64_t>(u.get_location().x) << 32 | static_cast<uint32_t>(u.get_location().y)));
+		key = mix64(key ^ (static_cast<uint64_t>(u.side()) << 48
+			| static_cast<uint64_t>(static_cast<uint16_t>(u.hitpoints())) << 32
+			| static_cast<uint32_t>(u.experience())));
+		key = mix64(key ^ (static_cast<uint64_t>(u.movement_left()) << 32 | static_cast<uint32_t>(u.attacks_left())));
+		hash ^= key;
+	}
+
+	for(const team& t : resources::gameboard->teams()){
+		hash ^= mix64(mix64(t.side()) ^ static_cast<uint64_t>(t.gold()));
+		for(const map_location& v : t.villages()){
+			hash ^= mix64(mix64(t.side() * 0x51ull) ^ (static_cast<uint64_t>(v.x) << 32 | static_cast<uint32_t>(v.y)));
+		}
+	}
+
+	return hash;
+}
+
 // Helper functions.
 void helper_check_village(const map_location& loc, int side){
 	std::vector<team> &teams = resources::gameboard->teams();
@@ -24,6 +24,8 @@
 
 #include "lua/aspect_advancements.hpp"
 
+#include <cstdint>
+
 class unit_type;
 
 namespace ai{
@@ -40,4 +42,15 @@ bool simulated_stopunit(const map_location& unit_location, bool remove_movement,
 
 bool simulated_synced_command();
 
+/**
+ * Hash of everything the simulated actions can change: unit positions,
+ * sides, hitpoints, experience, movement and attack state, plus village
+ * ownership and team gold. Units and villages contribute independent
+ * keys folded together with XOR, so the hash is order-independent and
+ * two interleavings of the same moves reaching the same state collide
+ * on purpose. Lua AIs exploring move orderings can key memoization
+ * tables on it to prune states they already expanded.
+ */
+uint64_t simulated_state_hash();
+
 }
@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include <climits>
 #include <map>
 #include <string>
 #include <vector>
@@ -52,12 +53,14 @@ public:
 	void pause_animation()
 	{
 		started_ = false;
+		recompute_next_update_tick();
 	}
 
 	void restart_animation()
 	{
 		if(start_tick_)
 			started_ = true;
+		recompute_next_update_tick();
 	}
 
 	int get_begin_time() const;
@@ -68,6 +71,14 @@ public:
 	int tick_to_time(int animation_tick) const;
 
 	void update_last_draw_time(double acceleration = 0);
+
+	/**
+	 * Whether the animation should be redrawn.
+	 *
+	 * This is called for every animation on the map every frame, so it is a
+	 * single comparison against a precomputed tick; all the real work happens
+	 * when the animation state actually changes.
+	 */
 	bool need_update() const;
 
 	bool cycles() const
@@ -97,6 +108,7 @@ public:
 	void force_change()
 	{
 		does_not_change_ = false;
+		recompute_next_update_tick();
 	}
 
 	bool does_not_change() const
@@ -115,6 +127,9 @@ protected:
 	int starting_frame_time_;
 
 private:
+	/** Recomputes the tick of the next frame change; see need_update(). */
+	void recompute_next_update_tick();
+
 	struct frame
 	{
 		frame(int duration, const T& value, int start_time)
@@ -152,6 +167,12 @@ private:
 	double acceleration_;
 	int last_update_tick_;
 	int current_frame_key_;
+
+	/**
+	 * The tick at which the current frame ends, precomputed so need_update()
+	 * is a single comparison. INT_MAX when no frame change can occur.
+	 */
+	int next_update_tick_;
 };
 
 // NOTE: this needs to be down here or the templates won't build.
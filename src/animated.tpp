@@ -35,6 +35,7 @@ inline animated<T>::animated(int start_time)
 	, acceleration_(1)
 	, last_update_tick_(0)
 	, current_frame_key_(0)
+	, next_update_tick_(INT_MAX)
 {
 }
 
@@ -51,6 +52,7 @@ inline animated<T>::animated(const std::vector<std::pair<int, T>>& cfg, int star
 	, acceleration_(1)
 	, last_update_tick_(0)
 	, current_frame_key_(0)
+	, next_update_tick_(INT_MAX)
 
 {
 	for(const auto& config_pair : cfg) {
@@ -70,6 +72,7 @@ inline void animated<T>::add_frame(int duration, const T& value, bool force_chan
 		does_not_change_ = false;
 		frames_.push_back(frame(duration, value, frames_.back().start_time_ + frames_.back().duration_));
 	}
+	recompute_next_update_tick();
 }
 
 template<typename T>
@@ -82,6 +85,7 @@ inline void animated<T>::start_animation(int start_time, bool cycles)
 	cycles_ = cycles;
 	current_frame_key_ = 0;
 	force_next_update_ = !frames_.empty();
+	recompute_next_update_tick();
 }
 
 template<typename T>
@@ -101,20 +105,24 @@ inline void animated<T>::update_last_draw_time(double acceleration)
 	last_update_tick_ = get_current_animation_tick();
 	if(force_next_update_) {
 		force_next_update_ = false;
+		recompute_next_update_tick();
 		return;
 	}
 
 	if(does_not_change_) {
+		recompute_next_update_tick();
 		return;
 	}
 
 	// Always update last_update_tick_, for the animation_time functions to work.
 	if(!started_) {
+		recompute_next_update_tick();
 		return;
 	}
 
 	if(frames_.empty()) {
 		does_not_change_ = true;
+		recompute_next_update_tick();
 		return;
 	}
 
@@ -130,6 +138,7 @@ inline void animated<T>::update_last_draw_time(double acceleration)
 	if(current_frame_end_time < get_animation_time() && current_frame_end_time < get_end_time()) {
 		current_frame_key_++;
 	}
+	recompute_next_update_tick();
 }
 
 template<typename T>
@@ -139,23 +148,20 @@ inline bool animated<T>::need_update() const
 		return true;
 	}
 
-	if(does_not_change_) {
-		return false;
-	}
-
-	if(frames_.empty()) {
-		return false;
-	}
-
-	if(!started_ && start_tick_ == 0) {
-		return false;
-	}
+	return get_current_animation_tick() > next_update_tick_;
+}
 
-	if(get_current_animation_tick() > static_cast<int>(get_current_frame_end_time() / acceleration_ + start_tick_)) {
-		return true;
+template<typename T>
+inline void animated<T>::recompute_next_update_tick()
+{
+	// These are the cases where the old per-call checks returned false;
+	// the sentinel makes the comparison in need_update() come out the same.
+	if(does_not_change_ || frames_.empty() || (!started_ && start_tick_ == 0)) {
+		next_update_tick_ = INT_MAX;
+		return;
 	}
 
-	return false;
+	next_update_tick_ = static_cast<int>(get_current_frame_end_time() / acceleration_ + start_tick_);
 }
 
 template<typename T>
@@ -233,6 +239,7 @@ inline void animated<T>::set_animation_time(int time)
 
 	current_frame_key_ = 0;
 	force_next_update_ = true;
+	recompute_next_update_tick();
 }
 
 template<typename T>
@@ -377,6 +384,7 @@ void animated<T>::remove_frames_until(int new_starting_time)
 		starting_frame_time_ += frames_[0].duration_;
 		frames_.erase(frames_.begin());
 	}
+	recompute_next_update_tick();
 }
 
 template<typename T>
@@ -393,6 +401,7 @@ inline void animated<T>::set_end_time(int new_ending_time)
 	// or set to frames_.end()
 	frames_.erase(current_frame, frames_.end());
 	frames_.back().duration_ += new_ending_time - last_start_time;
+	recompute_next_update_tick();
 }
 
 template<typename T>
@@ -403,4 +412,5 @@ inline void animated<T>::set_begin_time(int new_begin_time)
 	for(auto& frame : frames_) {
 		frame.start_time_ += variation;
 	}
+	recompute_next_update_tick();
 }
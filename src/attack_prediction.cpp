@@ -31,6 +31,7 @@
 #include "attack_prediction.hpp"
 
 #include "actions/attack.hpp"
+#include "frame_profiler.hpp"
 #include "game_config.hpp"
 #include "log.hpp"
 #include "preferences/general.hpp"
@@ -40,9 +41,11 @@
 #include <array>
 #include <cfloat>
 #include <cmath>
+#include <list>
 #include <memory>
 #include <numeric>
 #include <sstream>
+#include <tuple>
 
 #if defined(BENCHMARK) || defined(CHECK)
 #include <chrono>
@@ -356,6 +359,10 @@ private:
 			int drain_constant,
 			int drain_percent);
 
+	// Dense whole-row kernels for the drain-free case.
+	void shift_cols_dense(unsigned dst, unsigned src, unsigned damage, double prob);
+	void shift_rows_dense(unsigned dst, unsigned src, unsigned damage, double prob);
+
 private: // data
 	const unsigned int rows_, cols_;
 	std::array<std::unique_ptr<double[]>, NUM_PLANES> plane_;
@@ -363,6 +370,9 @@ private: // data
 	// For optimization, we keep track of the rows and columns with data.
 	// (The matrices are likely going to be rather sparse, with data on a grid.)
 	std::array<std::set<unsigned>, NUM_PLANES> used_rows_, used_cols_;
+
+	// Per-row staging area for the dense shift kernels.
+	std::vector<double> scratch_;
 };
 
 /**
@@ -391,6 +401,7 @@ prob_matrix::prob_matrix(unsigned int a_max,
 	, plane_()
 	, used_rows_()
 	, used_cols_()
+	, scratch_(cols_, 0.0)
 {
 	// Make sure we do not access the matrix in invalid positions.
 	a_cur = std::min<unsigned int>(a_cur, rows_ - 1);
@@ -657,6 +668,154 @@ void prob_matrix::shift_cols_in_row(unsigned dst,
 	}
 }
 
+/**
+ * Dense counterpart of the shift_cols() inner loops for the drain-free case.
+ *
+ * Without drain the row never moves, so each used row can be handled as two
+ * contiguous spans over the plane arrays — columns below @a damage pool into
+ * column 0, the rest slide down by @a damage — instead of per-entry xfer()
+ * calls with their used-index bookkeeping. The plain loops over consecutive
+ * doubles are what the compiler's vectorizer wants to see; this is the
+ * hottest code of the attack prediction.
+ */
+void prob_matrix::shift_cols_dense(unsigned dst, unsigned src, unsigned damage, double prob)
+{
+	if(dst == src && damage == 0) {
+		// Every entry would transfer onto itself. Nothing to do.
+		return;
+	}
+
+	// Snapshot the source extents before touching any tracking, exactly like
+	// the sparse version caches its index lists.
+	const std::vector<unsigned> rows(used_rows_[src].begin(), used_rows_[src].end());
+	const auto lo_it = used_cols_[src].lower_bound(1);
+	if(lo_it == used_cols_[src].end()) {
+		return;
+	}
+
+	const unsigned lo = *lo_it;
+	const unsigned hi = *used_cols_[src].rbegin() + 1;
+
+	// Update the used-index tracking up front. Entries that turn out to hold
+	// zero only cost a little extra work later, so supersets are fine; when
+	// the plane and the columns both stay put there is nothing to track.
+	if(dst != src) {
+		for(const unsigned row : rows) {
+			if(row != 0) {
+				used_rows_[dst].insert(row);
+			}
+		}
+	}
+
+	if(dst != src || damage > 0) {
+		if(lo < damage) {
+			used_cols_[dst].insert(0);
+		}
+
+		for(auto col_it = used_cols_[src].lower_bound(damage); col_it != used_cols_[src].end(); ++col_it) {
+			used_cols_[dst].insert(*col_it - damage);
+		}
+	}
+
+	const unsigned first = std::max(damage, lo);
+	double* t = scratch_.data();
+
+	// rows[x] == 0 is excluded since that represents already dead.
+	for(const unsigned row : rows) {
+		if(row == 0) {
+			continue;
+		}
+
+		double* s = &plane_[src][row * cols_];
+		double* d = &plane_[dst][row * cols_];
+
+		// Killing blows all pool in column 0. Accumulating there directly
+		// keeps the same summation order as the sparse transfers.
+		for(unsigned col = lo; col < damage && col < hi; ++col) {
+			const double diff = s[col] * prob;
+			s[col] -= diff;
+			d[0] += diff;
+		}
+
+		// The surviving columns slide down by the damage dealt. Splitting
+		// the move into two passes over a scratch row keeps the loops free
+		// of overlap between reads and writes, so they vectorize; since the
+		// mass only ever moves towards column 0, the result matches the
+		// ascending one-pass transfers exactly.
+		for(unsigned col = first; col < hi; ++col) {
+			t[col] = s[col] * prob;
+			s[col] -= t[col];
+		}
+
+		for(unsigned col = first; col < hi; ++col) {
+			d[col - damage] += t[col];
+		}
+	}
+}
+
+/**
+ * Dense counterpart of the shift_rows() inner loops for the drain-free case.
+ *
+ * Mirrors shift_cols_dense(), but iterates row-major so the inner loop still
+ * runs over consecutive doubles while whole rows slide towards row 0.
+ */
+void prob_matrix::shift_rows_dense(unsigned dst, unsigned src, unsigned damage, double prob)
+{
+	if(dst == src && damage == 0) {
+		// Every entry would transfer onto itself. Nothing to do.
+		return;
+	}
+
+	const std::vector<unsigned> rows(used_rows_[src].begin(), used_rows_[src].end());
+	const auto lo_it = used_cols_[src].lower_bound(1);
+	if(lo_it == used_cols_[src].end()) {
+		return;
+	}
+
+	const unsigned lo = *lo_it;
+	const unsigned hi = *used_cols_[src].rbegin() + 1;
+
+	if(dst != src || damage > 0) {
+		bool kills = false;
+		for(const unsigned row : rows) {
+			if(row == 0) {
+				continue;
+			}
+
+			if(row < damage) {
+				kills = true;
+			} else {
+				used_rows_[dst].insert(row - damage);
+			}
+		}
+
+		if(kills) {
+			used_rows_[dst].insert(0);
+		}
+	}
+
+	if(dst != src) {
+		used_cols_[dst].insert(lo_it, used_cols_[src].end());
+	}
+
+	// Ascending order writes behind the reads, which keeps src == dst safe.
+	// rows[x] == 0 is excluded since that represents already dead.
+	for(const unsigned row : rows) {
+		if(row == 0) {
+			continue;
+		}
+
+		double* s = &plane_[src][row * cols_];
+		double* d = &plane_[dst][(row < damage ? 0 : row - damage) * cols_];
+
+		for(unsigned col = lo; col < hi; ++col) {
+			const double diff = s[col] * prob;
+			s[col] -= diff;
+			d[col] += diff;
+		}
+	}
+}
+
 /**
  * Transfers a portion (value * prob) of each column in a plane to another.
  * Each column in the @a src plane gets shifted @a damage columns towards 0, and
@@ -666,6 +825,11 @@ void prob_matrix::shift_cols_in_row(unsigned dst,
 void prob_matrix::shift_cols(
 		unsigned dst, unsigned src, unsigned damage, double prob, int drain_constant, int drain_percent)
 {
+	if(drain_constant == 0 && drain_percent == 0) {
+		shift_cols_dense(dst, src, damage, prob);
+		return;
+	}
+
 	int drainmax = (drain_percent * (static_cast<signed>(damage)) / 100 + drain_constant);
 
 	if(drain_constant || drain_percent) {
@@ -739,6 +903,11 @@ void prob_matrix::shift_rows_in_col(unsigned dst,
 void prob_matrix::shift_rows(
 		unsigned dst, unsigned src, unsigned damage, double prob, int drain_constant, int drain_percent)
 {
+	if(drain_constant == 0 && drain_percent == 0) {
+		shift_rows_dense(dst, src, damage, prob);
+		return;
+	}
+
 	int drainmax = (drain_percent * (static_cast<signed>(damage)) / 100 + drain_constant);
 
 	if(drain_constant || drain_percent) {
@@ -2288,6 +2457,77 @@ void merge_slice_summary(std::vector<double>& dst, const std::vector<double>& sr
 	}
 }
 
+/** The fields of battle_context_unit_stats that feed the combat calculation, in comparable form. */
+typedef std::tuple<bool, bool, bool, bool, bool, bool, bool, bool,
+		unsigned, unsigned, unsigned, unsigned, unsigned, unsigned, unsigned,
+		int, int, int, int,
+		unsigned, unsigned, unsigned> fight_stats_tuple;
+
+fight_stats_tuple fight_stats_key(const battle_context_unit_stats& u)
+{
+	return fight_stats_tuple(u.is_poisoned, u.is_slowed, u.slows, u.drains, u.petrifies, u.poisons, u.swarm,
+			u.firststrike, u.experience, u.max_experience, u.level, u.rounds, u.hp, u.max_hp, u.chance_to_hit,
+			u.damage, u.slow_damage, u.drain_percent, u.drain_constant, u.num_blows, u.swarm_min, u.swarm_max);
+}
+
+/** Both sides' stats plus the levelup flag identify a first fight completely. */
+typedef std::tuple<fight_stats_tuple, fight_stats_tuple, bool> fight_key;
+
+/** One cached matchup: the full outcome of fight() for both sides. */
+struct fight_result
+{
+	summary_t summary, opp_summary;
+	std::vector<double> hp_dist, opp_hp_dist;
+	double untouched, opp_untouched;
+	double poisoned, opp_poisoned;
+	double slowed, opp_slowed;
+};
+
+/**
+ * Bounded memoization of fights between combatants that haven't fought yet.
+ * The AI's attack analysis evaluates the same matchup from many candidate
+ * hexes, and many units share a stat line, so repeated first fights reduce
+ * to a lookup. The least recently used entries are dropped at the bound.
+ */
+class fight_cache
+{
+public:
+	const fight_result* lookup(const fight_key& key)
+	{
+		const auto found = entries_.find(key);
+		if(found == entries_.end()) {
+			return nullptr;
+		}
+
+		// Freshen the entry in the eviction order.
+		order_.splice(order_.begin(), order_, found->second.first);
+		return &found->second.second;
+	}
+
+	void store(const fight_key& key, fight_result&& result)
+	{
+		const auto found = entries_.find(key);
+		if(found != entries_.end()) {
+			order_.splice(order_.begin(), order_, found->second.first);
+			return;
+		}
+
+		order_.push_front(key);
+		entries_.emplace(key, std::pair(order_.begin(), std::move(result)));
+
+		while(entries_.size() > max_entries) {
+			entries_.erase(order_.back());
+			order_.pop_back();
+		}
+	}
+
+private:
+	static const std::size_t max_entries = 512;
+
+	std::list<fight_key> order_;
+	std::map<fight_key, std::pair<std::list<fight_key>::iterator, fight_result>> entries_;
+};
+
 } // end anon namespace
 
 // Two man enter.  One man leave!
@@ -2303,6 +2543,36 @@ void combatant::fight(combatant& opponent, bool levelup_considered)
 		return;
 	}
 
+	// Below the reversal, so a reversed fight is only timed once.
+	frame_profiler::scope profile(frame_profiler::subsystem::combat);
+
+	// A first fight between fresh combatants is fully described by the two
+	// stat lines, so its outcome can be memoized. Fights after previous
+	// combat carry their history in the summaries and are not cacheable.
+	static thread_local fight_cache cache;
+
+	const bool cache_usable = summary[0].empty() && summary[1].empty()
+			&& opponent.summary[0].empty() && opponent.summary[1].empty();
+	fight_key cache_key;
+
+	if(cache_usable) {
+		cache_key = fight_key(fight_stats_key(u_), fight_stats_key(opponent.u_), levelup_considered);
+
+		if(const fight_result* hit = cache.lookup(cache_key)) {
+			summary = hit->summary;
+			opponent.summary = hit->opp_summary;
+			hp_dist = hit->hp_dist;
+			opponent.hp_dist = hit->opp_hp_dist;
+			untouched = hit->untouched;
+			opponent.untouched = hit->opp_untouched;
+			poisoned = hit->poisoned;
+			opponent.poisoned = hit->opp_poisoned;
+			slowed = hit->slowed;
+			opponent.slowed = hit->opp_slowed;
+			return;
+		}
+	}
+
 #ifdef ATTACK_PREDICTION_DEBUG
 	printf("A:\n");
 	dump(u_);
@@ -2459,6 +2729,13 @@ void combatant::fight(combatant& opponent, bool levelup_considered)
 
 	untouched *= self_not_hit;
 	opponent.untouched *= opp_not_hit;
+
+	// Simulated outcomes vary with the RNG and must not be replayed.
+	if(cache_usable && !use_monte_carlo_simulation) {
+		cache.store(std::move(cache_key),
+			fight_result{summary, opponent.summary, hp_dist, opponent.hp_dist, untouched,
+				opponent.untouched, poisoned, opponent.poisoned, slowed, opponent.slowed});
+	}
 }
 
 double combatant::average_hp(unsigned int healing) const
@@ -2626,6 +2903,38 @@ void combatant::reset()
 	summary[1] = std::vector<double>();
 }
 
+#ifdef CHECK
+/**
+ * Fights every pairing twice with fresh combatants: the first fight is
+ * computed and stored, the second replays from the fight cache. Both must
+ * agree bit for bit, or the cache is corrupting predictions.
+ */
+static void verify_fight_cache(battle_context_unit_stats* const* stats)
+{
+	for(unsigned i = 0; i < NUM_UNITS; ++i) {
+		for(unsigned j = 0; j < NUM_UNITS; ++j) {
+			if(i == j) {
+				continue;
+			}
+
+			combatant att_fresh(*stats[j]), def_fresh(*stats[i]);
+			att_fresh.fight(def_fresh);
+
+			combatant att_cached(*stats[j]), def_cached(*stats[i]);
+			att_cached.fight(def_cached);
+
+			if(att_fresh.hp_dist != att_cached.hp_dist || def_fresh.hp_dist != def_cached.hp_dist
+					|| att_fresh.untouched != att_cached.untouched || def_fresh.untouched != def_cached.untouched
+					|| att_fresh.poisoned != att_cached.poisoned || def_fresh.poisoned != def_cached.poisoned
+					|| att_fresh.slowed != att_cached.slowed || def_fresh.slowed != def_cached.slowed) {
+				PLAIN_LOG << "fight cache replay diverged for matchup " << j << " vs " << i;
+				exit(1);
+			}
+		}
+	}
+}
+#endif
+
 static void run(unsigned specific_battle)
 {
 	using std::chrono::duration_cast;
@@ -2657,6 +2966,12 @@ static void run(unsigned specific_battle)
 		list_combatant(*stats[i], i + 1);
 	}
 
+#ifdef CHECK
+	// Silent on success; the corpus output below stays comparable across
+	// builds with and without this pass.
+	verify_fight_cache(stats);
+#endif
+
 	start = std::chrono::high_resolution_clock::now();
 	// Go through all fights with two attackers (j and k attacking i).
 	for(i = 0; i < NUM_UNITS; ++i) {
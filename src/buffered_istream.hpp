@@ -96,6 +96,39 @@ public:
 		}
 	}
 
+	/**
+	 * Gets a pointer to the not yet consumed part of the buffer.
+	 *
+	 * Together with @ref buffer_available() and @ref consume() this allows
+	 * a caller to scan whole runs of characters directly in the buffer,
+	 * instead of paying the branching of @ref get() for every single byte.
+	 *
+	 * @returns                   Pointer to the current character.
+	 * @retval nullptr            The end of input has been read.
+	 */
+	const char* buffer_data()
+	{
+		fill_buffer();
+
+		return eof_ ? nullptr : buffer_ + buffer_offset_;
+	}
+
+	/** The number of characters @ref buffer_data() points at. */
+	unsigned buffer_available() const
+	{
+		return buffer_offset_ < buffer_size_ ? buffer_size_ - buffer_offset_ : 0;
+	}
+
+	/**
+	 * Consumes @a count characters from the buffer.
+	 *
+	 * @pre count <= @ref buffer_available()
+	 */
+	void consume(unsigned count)
+	{
+		buffer_offset_ += count;
+	}
+
 	/** Is the end of input reached? */
 	bool eof() const
 	{
@@ -25,6 +25,11 @@ static lg::log_domain log_engine("engine");
 #define ERR_NG LOG_STREAM(err, log_engine)
 
 carryover::carryover(const config& side)
+		: carryover(config(side))
+{
+}
+
+carryover::carryover(config&& side)
 		: add_(!side["carryover_add"].empty() ? side["carryover_add"].to_bool() : side["add"].to_bool())
 		, current_player_(side["current_player"])
 		, gold_(!side["carryover_gold"].empty() ? side["carryover_gold"].to_int() : side["gold"].to_int())
@@ -32,10 +37,14 @@ carryover::carryover(const config& side)
 		, previous_recruits_(side.has_attribute("recruit") ? utils::set_split(side["recruit"]) :utils::set_split(side["previous_recruits"]))
 		, recall_list_()
 		, save_id_(side["save_id"])
-		, variables_(side.child_or_empty("variables"))
+		, variables_()
 {
-	for(const config& u : side.child_range("unit")) {
-		recall_list_.push_back(u);
+	if(auto vars = side.optional_child("variables")) {
+		variables_.swap(*vars);
+	}
+
+	for(config& u : side.child_range("unit")) {
+		recall_list_.push_back(std::move(u));
 		config& u_back = recall_list_.back();
 		u_back.remove_attributes("side", "goto_x", "goto_y", "x", "y", "hidden");
 	}
@@ -70,8 +79,8 @@ void carryover::transfer_all_recruits_to(config& side_cfg){
 }
 
 void carryover::transfer_all_recalls_to(config& side_cfg){
-	for(const config & u_cfg : recall_list_) {
-		side_cfg.add_child("unit", u_cfg);
+	for(config & u_cfg : recall_list_) {
+		side_cfg.add_child("unit", std::move(u_cfg));
 	}
 	recall_list_.clear();
 }
@@ -102,21 +111,32 @@ void carryover::to_config(config& cfg){
 	side["add"] = add_;
 	side["current_player"] = current_player_;
 	side["previous_recruits"] = get_recruits(false);
-	side.add_child("variables", variables_);
-	for(const config & u_cfg : recall_list_) {
-		side.add_child("unit", u_cfg);
+	side.add_child("variables", std::move(variables_));
+	for(config & u_cfg : recall_list_) {
+		side.add_child("unit", std::move(u_cfg));
 	}
+	recall_list_.clear();
+	variables_.clear();
 }
 
 carryover_info::carryover_info(const config& cfg, bool from_snpashot)
+	: carryover_info(config(cfg), from_snpashot)
+{
+}
+
+carryover_info::carryover_info(config&& cfg, bool from_snpashot)
 	: carryover_sides_()
-	, variables_(cfg.child_or_empty("variables"))
+	, variables_()
 	, rng_(cfg)
 	, wml_menu_items_()
 	, next_scenario_(cfg["next_scenario"])
 	, next_underlying_unit_id_(cfg["next_underlying_unit_id"].to_int(0))
 {
-	for(const config& side : cfg.child_range("side"))
+	if(auto vars = cfg.optional_child("variables")) {
+		variables_.swap(*vars);
+	}
+
+	for(config& side : cfg.child_range("side"))
 	{
 		if(side["lost"].to_bool(false) || !side["persistent"].to_bool(true) || side["save_id"].empty())
 		{
@@ -126,12 +146,12 @@ carryover_info::carryover_info(const config& cfg, bool from_snpashot)
 			}
 			continue;
 		}
-		this->carryover_sides_.emplace_back(side);
+		this->carryover_sides_.emplace_back(std::move(side));
 	}
-	for(const config& item : cfg.child_range("menu_item"))
+	for(config& item : cfg.child_range("menu_item"))
 	{
 		if(item["persistent"].to_bool(true)) {
-			wml_menu_items_.push_back(item);
+			wml_menu_items_.push_back(std::move(item));
 		}
 	}
 }
@@ -168,7 +188,10 @@ struct save_id_equals
 
 void carryover_info::transfer_all_to(config& side_cfg){
 	if(side_cfg["save_id"].empty()){
-		side_cfg["save_id"] = side_cfg["id"];
+		// Copy before assigning: operator[] on the left may insert into the
+		// flat attribute map and invalidate a reference returned on the right.
+		const config::attribute_value id = side_cfg["id"];
+		side_cfg["save_id"] = id;
 	}
 	std::vector<carryover>::iterator iside = std::find_if(
 		carryover_sides_.begin(),
@@ -234,11 +257,13 @@ const config carryover_info::to_config()
 	cfg["random_seed"] = rng_.get_random_seed_str();
 	cfg["random_calls"] = rng_.get_random_calls();
 
-	cfg.add_child("variables", variables_);
-	for(const config& item : wml_menu_items_)
+	cfg.add_child("variables", std::move(variables_));
+	for(config& item : wml_menu_items_)
 	{
-		cfg.add_child("menu_item", item);
+		cfg.add_child("menu_item", std::move(item));
 	}
+	variables_.clear();
+	wml_menu_items_.clear();
 	return cfg;
 }
 
@@ -252,9 +277,9 @@ carryover* carryover_info::get_side(const std::string& save_id){
 }
 
 
-void carryover_info::merge_old_carryover(const carryover_info& old_carryover)
+void carryover_info::merge_old_carryover(carryover_info&& old_carryover)
 {
-	for(const carryover & old_side : old_carryover.carryover_sides_)
+	for(carryover & old_side : old_carryover.carryover_sides_)
 	{
 		std::vector<carryover>::iterator iside = std::find_if(
 			carryover_sides_.begin(),
@@ -264,7 +289,7 @@ void carryover_info::merge_old_carryover(const carryover_info& old_carryover)
 		//add the side if don't already have it.
 		if(iside == carryover_sides_.end())
 		{
-			this->carryover_sides_.push_back(old_side);
+			this->carryover_sides_.push_back(std::move(old_side));
 		}
 	}
 }
@@ -36,6 +36,8 @@ public:
 	{}
 	// Turns config from a loaded savegame into carryover_info
 	explicit carryover(const config& side);
+	/** Variant that moves the recall units and variables out of @a side. */
+	explicit carryover(config&& side);
 	~carryover(){}
 
 	const std::string& get_save_id() const{ return save_id_; }
@@ -43,6 +45,7 @@ public:
 	void transfer_all_recruits_to(config& side_cfg);
 	void transfer_all_recalls_to(config& side_cfg);
 	const std::string to_string();
+	/** Writes this carryover to @a cfg, moving the recall units out of this object. */
 	void to_config(config& cfg);
 private:
 	bool add_;
@@ -76,6 +79,12 @@ public:
 	 * @param from_snapshot true if cfg is a [snapshot], false if cfg is [carryover_sides(_start)]
 	 */
 	explicit carryover_info(const config& cfg, bool from_snapshot = false);
+	/**
+	 * Variant that moves the heavy per-side data (recall units, variables,
+	 * menu items) out of @a cfg instead of copying it. Used on the scenario
+	 * transition path, where the source config is discarded anyway.
+	 */
+	explicit carryover_info(config&& cfg, bool from_snapshot = false);
 
 	carryover* get_side(const std::string& save_id);
 	std::vector<carryover>& get_all_sides();
@@ -95,9 +104,10 @@ public:
 
 	const std::string& next_scenario() const { return next_scenario_; }
 
+	/** Writes the carryover to a config, moving the recall units out of the sides. */
 	const config to_config();
 
-	void merge_old_carryover(const carryover_info& old_carryover);
+	void merge_old_carryover(carryover_info&& old_carryover);
 private:
 	std::vector<carryover> carryover_sides_;
 	config variables_;
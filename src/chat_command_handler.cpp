@@ -22,6 +22,7 @@
 #include "map_command_handler.hpp"
 #include "preferences/display.hpp"
 #include "preferences/game.hpp"
+#include "utils/alloc_tracking.hpp"
 
 namespace events {
 
@@ -145,6 +146,10 @@ void chat_command_handler::do_clear_messages() {
 	chat_handler_.clear_messages();
 }
 
+void chat_command_handler::do_mem() {
+	print(_("memory"), utils::alloc_tracking::report());
+}
+
 void chat_command_handler::do_mp_report() {
 	std::string report_text;
 	gui2::dialogs::mp_report::execute(report_text);
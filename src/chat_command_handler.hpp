@@ -42,6 +42,7 @@ protected:
 	void do_display();
 	void do_version();
 	void do_clear_messages();
+	void do_mem();
 	void do_mp_report();
 
 	/** Request information about a user from the server. */
@@ -119,6 +120,8 @@ protected:
 			_("Request information about a nickname."), _("<nickname>"));
 		register_command("clear", &chat_command_handler::do_clear_messages,
 			_("Clear chat history."));
+		register_command("mem", &chat_command_handler::do_mem,
+			_("Display allocation statistics per subsystem."));
 	}
 private:
 	chat_handler& chat_handler_;
@@ -28,12 +28,16 @@
 #include "deprecation.hpp"
 #include "game_version.hpp"
 #include "serialization/string_utils.hpp"
+#include "utils/alloc_tracking.hpp"
 
 #include <algorithm>
 #include <cstdlib>
 #include <cstring>
 #include <istream>
 #include <locale>
+#include <mutex>
+#include <set>
+#include <unordered_map>
 
 static lg::log_domain log_config("config");
 #define ERR_CF LOG_STREAM(err, log_config)
@@ -71,6 +75,131 @@ int map_erase_key(Map& map, Key&& key)
 
 }
 
+/* ** interned_key implementation ** */
+
+namespace
+{
+/**
+ * The global key pool. A node-based container is required here: references
+ * into the pool are handed out and must survive later insertions. Entries
+ * are never erased, so they remain valid for the lifetime of the process.
+ */
+std::set<std::string, std::less<>>& key_pool()
+{
+	static std::set<std::string, std::less<>>* pool = new std::set<std::string, std::less<>>();
+	return *pool;
+}
+
+std::mutex& key_pool_mutex()
+{
+	static std::mutex* mutex = new std::mutex();
+	return *mutex;
+}
+
+}
+
+interned_key::interned_key(config_key_type key)
+	: str_(nullptr)
+{
+	std::lock_guard<std::mutex> lock(key_pool_mutex());
+	str_ = &*key_pool().emplace(key).first;
+}
+
+/* ** config node pool ** */
+
+namespace
+{
+/**
+ * A chunked pool for heap-allocated config nodes.
+ *
+ * All blocks are sizeof(config) bytes. New blocks are carved out of large
+ * chunks with a pointer bump; freed blocks go on a free list and are reused
+ * before a new chunk is touched. Chunks are never returned to the system:
+ * the high-water mark of live nodes (the fully loaded game config) bounds
+ * the pool, so releasing chunks mid-game would only fragment the heap.
+ */
+class config_node_pool
+{
+public:
+	static config_node_pool& instance()
+	{
+		static config_node_pool* pool = new config_node_pool();
+		return *pool;
+	}
+
+	void* allocate()
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+
+		if(free_list_) {
+			void* p = free_list_;
+			free_list_ = free_list_->next;
+			return p;
+		}
+
+		if(next_ == chunk_end_) {
+			chunks_.emplace_back(new char[chunk_size]);
+			next_ = chunks_.back().get();
+			chunk_end_ = next_ + chunk_size;
+		}
+
+		void* p = next_;
+		next_ += block_size;
+		return p;
+	}
+
+	void deallocate(void* p)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		free_list_ = new(p) free_node{free_list_};
+	}
+
+private:
+	config_node_pool() = default;
+
+	struct free_node
+	{
+		free_node* next;
+	};
+
+	/** Blocks are rounded up so a free node always fits. */
+	static constexpr std::size_t block_size = std::max(sizeof(config), sizeof(free_node));
+	static constexpr std::size_t blocks_per_chunk = 1024;
+	static constexpr std::size_t chunk_size = block_size * blocks_per_chunk;
+
+	std::mutex mutex_;
+	free_node* free_list_ = nullptr;
+	char* next_ = nullptr;
+	char* chunk_end_ = nullptr;
+	std::vector<std::unique_ptr<char[]>> chunks_;
+};
+
+}
+
+void* config::operator new(std::size_t size)
+{
+	utils::alloc_tracking::track_alloc(utils::alloc_tracking::tag::config_node, size);
+
+	if(size != sizeof(config)) {
+		// Can only happen for a derived type; let the general heap serve it.
+		return ::operator new(size);
+	}
+
+	return config_node_pool::instance().allocate();
+}
+
+void config::operator delete(void* p, std::size_t size)
+{
+	utils::alloc_tracking::track_free(utils::alloc_tracking::tag::config_node, size);
+
+	if(size != sizeof(config)) {
+		::operator delete(p);
+		return;
+	}
+
+	config_node_pool::instance().deallocate(p);
+}
+
 /* ** config implementation ** */
 
 const char* config::diff_track_attribute = "__diff_track";
@@ -87,7 +216,29 @@ config::config(const config& cfg)
 	, children_()
 	, ordered_children()
 {
-	append_children(cfg);
+	// Clone the child storage wholesale instead of re-inserting child by
+	// child through add_child(): the map shape is already known, so each
+	// distinct key costs one node insertion instead of one map lookup per
+	// child, and the child lists are copied with their final size reserved.
+	std::unordered_map<const child_map::value_type*, child_map::iterator> cloned_positions;
+	cloned_positions.reserve(cfg.children_.size());
+
+	for(const child_map::value_type& p : cfg.children_) {
+		child_list copies;
+		copies.reserve(p.second.size());
+
+		for(const auto& child : p.second) {
+			copies.push_back(std::make_unique<config>(*child));
+		}
+
+		const auto pos = children_.emplace_hint(children_.end(), p.first, std::move(copies));
+		cloned_positions.emplace(&p, pos);
+	}
+
+	ordered_children.reserve(cfg.ordered_children.size());
+	for(const child_pos& pos : cfg.ordered_children) {
+		ordered_children.emplace_back(cloned_positions[&*pos.pos], pos.index);
+	}
 }
 
 config::config(config_key_type child)
@@ -500,18 +651,77 @@ config& config::add_child_at(config_key_type key, const config& val, std::size_t
 	return *v[index];
 }
 
+void config::insert_children(config_key_type key, std::vector<config>&& data, std::size_t index)
+{
+	if(data.empty()) {
+		return;
+	}
+
+	child_list& v = map_get(children_, key);
+	if(index > v.size()) {
+		throw error("illegal index to insert children at");
+	}
+
+	const child_map::iterator pos = children_.find(key);
+	const std::size_t count = data.size();
+
+	{
+		child_list moved;
+		moved.reserve(count);
+		for(config& cfg : data) {
+			moved.emplace_back(new config(std::move(cfg)));
+		}
+
+		v.insert(v.begin() + index, std::make_move_iterator(moved.begin()), std::make_move_iterator(moved.end()));
+	}
+
+	// Shift the indices of the children behind the insertion point and find
+	// where the new block belongs in the ordering, all in a single pass.
+	// Entries of the same tag appear in the ordering in index order.
+	auto ord = ordered_children.end();
+	for(auto i = ordered_children.begin(); i != ordered_children.end(); ++i) {
+		if(i->pos != pos) {
+			continue;
+		}
+
+		if(i->index >= index) {
+			if(ord == ordered_children.end()) {
+				ord = i;
+			}
+
+			i->index += count;
+		}
+	}
+
+	std::vector<child_pos> block;
+	block.reserve(count);
+	for(std::size_t i = 0; i < count; ++i) {
+		block.emplace_back(pos, index + i);
+	}
+
+	ordered_children.insert(ord, block.begin(), block.end());
+}
+
 size_t config::find_total_first_of(config_key_type key, size_t start)
 {
 	assert(start <= ordered_children.size());
 	const size_t npos = static_cast<size_t>(-1);
 
-	auto pos = std::find_if(ordered_begin() + start, ordered_end(), [&](const config::any_child& can){ return can.key == key; });
+	// Resolve the key to its child map node once; the scan then only pays an
+	// iterator comparison per child instead of a string comparison.
+	const child_map::iterator i = children_.find(key);
+	if(i == children_.end()) {
+		return npos;
+	}
+
+	auto pos = std::find_if(ordered_children.begin() + start, ordered_children.end(),
+		[&](const child_pos& p) { return p.pos == i; });
 
-	if(pos == ordered_end()) {
+	if(pos == ordered_children.end()) {
 		return npos;
 	}
 
-	return static_cast<size_t>(pos - ordered_begin());
+	return static_cast<size_t>(pos - ordered_children.begin());
 }
 
 config& config::add_child_at_total(config_key_type key, const config &val, std::size_t pos)
@@ -524,7 +734,11 @@ config& config::add_child_at_total(config_key_type key, const config &val, std::
 
 	auto end = ordered_children.end();
 	auto pos_it = ordered_children.begin() + pos;
-	auto next = std::find_if(pos_it, end,[&](const child_pos& p){ return p.pos->first == key; });
+	// As in find_total_first_of(), compare child map nodes rather than key text.
+	const child_map::iterator existing = children_.find(key);
+	auto next = existing == children_.end()
+		? end
+		: std::find_if(pos_it, end, [&](const child_pos& p){ return p.pos == existing; });
 
 	if(next == end) {
 		config& res = config::add_child(key, val);
@@ -610,7 +824,7 @@ void config::recursive_clear_value(config_key_type key)
 {
 	map_erase_key(values_, key);
 
-	for(std::pair<const std::string, child_list>& p : children_) {
+	for(child_map::value_type& p : children_) {
 		for(auto& cfg : p.second) {
 			cfg->recursive_clear_value(key);
 		}
@@ -657,6 +871,37 @@ void config::remove_child(config_key_type key, std::size_t index)
 	remove_child(i, index);
 }
 
+void config::remove_children(config_key_type key, std::size_t start, std::size_t count)
+{
+	if(count == 0) {
+		return;
+	}
+
+	child_map::iterator pos = children_.find(key);
+	if(pos == children_.end() || start + count > pos->second.size()) {
+		ERR_CF << "Error: attempting to delete non-existing children: " << key << "[" << start << ".." << (start + count) << ")";
+		return;
+	}
+
+	pos->second.erase(pos->second.begin() + start, pos->second.begin() + start + count);
+
+	// Drop the removed entries from the ordering and renumber the survivors
+	// in one pass each, rather than once per removed child.
+	const auto removed = [&](const child_pos& p) {
+		return p.pos == pos && p.index >= start && p.index < start + count;
+	};
+
+	ordered_children.erase(
+		std::remove_if(ordered_children.begin(), ordered_children.end(), removed),
+		ordered_children.end());
+
+	for(child_pos& p : ordered_children) {
+		if(p.pos == pos && p.index >= start + count) {
+			p.index -= count;
+		}
+	}
+}
+
 void config::remove_children(config_key_type key, std::function<bool(const config&)> p)
 {
 	child_map::iterator pos = children_.find(key);
@@ -1093,7 +1338,7 @@ void config::clear_diff_track(const config& diff)
 		}
 	}
 
-	for(std::pair<const std::string, child_list>& p : children_) {
+	for(child_map::value_type& p : children_) {
 		for(auto& cfg : p.second) {
 			cfg->remove_attribute(diff_track_attribute);
 		}
@@ -1333,7 +1578,7 @@ bool config::validate_wml() const
 {
 	return std::all_of(children_.begin(), children_.end(), [](const auto& pair)
 	{
-		return valid_tag(pair.first) &&
+		return valid_tag(pair.first.str()) &&
 			std::all_of(pair.second.begin(), pair.second.end(),
 			[](const auto& c) { return c->validate_wml(); });
 	}) &&
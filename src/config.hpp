@@ -46,6 +46,8 @@
 #include <utility>
 #include <vector>
 
+#include <boost/container/flat_map.hpp>
+#include <boost/container/small_vector.hpp>
 #include <boost/range/iterator_range.hpp>
 
 using config_key_type = std::string_view;
@@ -53,6 +55,55 @@ enum class DEP_LEVEL : uint8_t;
 
 class config;
 
+/**
+ * A handle to a canonical copy of a WML key kept in a global, permanently
+ * allocated pool.
+ *
+ * Large game configs repeat the same few tag and attribute names across
+ * millions of nodes; storing a pooled handle instead of a full std::string
+ * per node removes the duplicated character storage and makes equality of
+ * two handles a pointer comparison. Entries are never removed from the
+ * pool, so the referenced string stays valid for the lifetime of the
+ * process and can safely be handed out as a const std::string&.
+ */
+class interned_key
+{
+public:
+	/** Interns @a key, allocating a pool entry if this is a new key. */
+	explicit interned_key(config_key_type key);
+
+	/** The canonical, permanently allocated string for this key. */
+	const std::string& str() const { return *str_; }
+
+	operator const std::string&() const { return *str_; }
+
+	/** Two handles are equal iff they came from the same pool entry. */
+	friend bool operator==(const interned_key& a, const interned_key& b) { return a.str_ == b.str_; }
+	friend bool operator!=(const interned_key& a, const interned_key& b) { return a.str_ != b.str_; }
+
+	friend bool operator==(const interned_key& a, config_key_type b) { return *a.str_ == b; }
+	friend bool operator==(config_key_type a, const interned_key& b) { return a == *b.str_; }
+	friend bool operator!=(const interned_key& a, config_key_type b) { return *a.str_ != b; }
+	friend bool operator!=(config_key_type a, const interned_key& b) { return a != *b.str_; }
+
+	/** Transparent comparator ordering handles and raw keys alike. */
+	struct less
+	{
+		using is_transparent = void;
+
+		bool operator()(const interned_key& a, const interned_key& b) const
+		{
+			return a.str_ != b.str_ && *a.str_ < *b.str_;
+		}
+
+		bool operator()(const interned_key& a, config_key_type b) const { return *a.str_ < b; }
+		bool operator()(config_key_type a, const interned_key& b) const { return a < *b.str_; }
+	};
+
+private:
+	const std::string* str_;
+};
+
 template<class T>
 class optional_config_impl
 {
@@ -185,14 +236,33 @@ public:
 
 	~config();
 
+	/**
+	 * Heap-allocated config nodes come from a chunked node pool instead of
+	 * the general-purpose heap.
+	 *
+	 * The WML parser creates one node per child tag, so loading a large
+	 * game config performs tens of millions of allocations of exactly
+	 * sizeof(config) bytes. The pool serves these with a free-list pop (or
+	 * a pointer bump into a fresh chunk), keeps sibling nodes contiguous in
+	 * memory, and makes freeing a node a cheap list push.
+	 */
+	static void* operator new(std::size_t size);
+	static void operator delete(void* p, std::size_t size);
+
 	// Verifies that the string can be used as a tag name
 	static bool valid_tag(config_key_type name);
 
 	// Verifies that the string can be used as an attribute name
 	static bool valid_attribute(config_key_type name);
 
-	typedef std::vector<std::unique_ptr<config>> child_list;
-	typedef std::map<std::string, child_list, std::less<>> child_map;
+	/**
+	 * The lists hold their first two children inline: most tags have a
+	 * handful of children spread over distinct names, so this usually spares
+	 * the separate heap block per name.
+	 */
+	typedef boost::container::small_vector<std::unique_ptr<config>, 2> child_list;
+	// Stays node-based: child_pos entries store iterators into this map.
+	typedef std::map<interned_key, child_list, interned_key::less> child_map;
 
 	struct const_child_iterator;
 
@@ -293,7 +363,14 @@ public:
 	 */
 	using attribute_value = config_attribute_value;
 
-	typedef std::map<
+	/**
+	 * Attributes live in a sorted, contiguous flat map: lookups binary-search
+	 * one allocation instead of chasing tree nodes, and iteration order is
+	 * the same as before. Note that, unlike with std::map, inserting or
+	 * erasing an attribute invalidates references to the other values, so
+	 * don't hold one across a mutation.
+	 */
+	typedef boost::container::flat_map<
 		std::string
 		, attribute_value
 		, std::less<>
@@ -467,6 +544,13 @@ public:
 
 	config &add_child(config_key_type key, config &&val);
 
+	/**
+	 * Moves all of @a data into new children with tag @a key, inserted as one
+	 * block before the child currently at @a index. Unlike repeated calls to
+	 * @ref add_child_at, the other children are shifted only once.
+	 */
+	void insert_children(config_key_type key, std::vector<config>&& data, std::size_t index);
+
 	/**
 	 * Returns a reference to the attribute with the given @a key.
 	 * Creates it if it does not exist.
@@ -639,6 +723,12 @@ public:
 	void splice_children(config &src, const std::string &key);
 
 	void remove_child(config_key_type key, std::size_t index);
+	/**
+	 * Removes @a count children with tag @a key, starting at @a start.
+	 * The remaining children are renumbered in a single pass, so this is
+	 * cheaper than removing them one by one.
+	 */
+	void remove_children(config_key_type key, std::size_t start, std::size_t count);
 	/**
 	 * Removes all children with tag @a key for which @a p returns true.
 	 */
@@ -669,9 +759,9 @@ public:
 
 	struct any_child
 	{
-		const child_map::key_type &key;
+		const std::string &key;
 		config &cfg;
-		any_child(const child_map::key_type *k, config *c): key(*k), cfg(*c) {}
+		any_child(const child_map::key_type *k, config *c): key(k->str()), cfg(*c) {}
 	};
 
 	struct const_all_children_iterator;
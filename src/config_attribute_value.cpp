@@ -25,11 +25,14 @@
 #include "log.hpp"
 #include "serialization/string_utils.hpp"
 
+#include <algorithm>
+#include <charconv>
 #include <cstdlib>
 #include <cstring>
 #include <deque>
 #include <functional>
 #include <istream>
+#include <string_view>
 
 static lg::log_domain log_config("config");
 #define ERR_CF LOG_STREAM(err, log_config)
@@ -157,32 +160,62 @@ bool from_string_verify(const std::string& source, To& res)
 }
 } // end anon namespace
 
-config_attribute_value& config_attribute_value::operator=(const std::string& v)
+bool config_attribute_value::try_assign_special(const std::string& v)
 {
-	// Handle some special strings.
-	if(v.empty()) {
-		value_ = v;
-		return *this;
-	}
-
 	if(v == s_yes) {
 		value_ = yes_no(true);
-		return *this;
+		return true;
 	}
 
 	if(v == s_no) {
 		value_ = yes_no(false);
-		return *this;
+		return true;
 	}
 
 	if(v == s_true) {
 		value_ = true_false(true);
-		return *this;
+		return true;
 	}
 
 	if(v == s_false) {
 		value_ = true_false(false);
-		return *this;
+		return true;
+	}
+
+	// Fast path: a string of (optionally negated) decimal digits either is a
+	// canonically formatted integer or stays a string, and std::from_chars
+	// can tell which without any stream round trip. This covers the bulk of
+	// the numeric attributes seen while loading saves and network data.
+	const bool negative = v[0] == '-';
+	const std::string_view digits(v.data() + (negative ? 1 : 0), v.size() - (negative ? 1 : 0));
+	if(!digits.empty() && std::all_of(digits.begin(), digits.end(), [](char c) { return c >= '0' && c <= '9'; })) {
+		// Leading zeros and "-0" do not survive a round trip through the
+		// numeric types, so such strings are kept as strings.
+		if((digits.size() > 1 && digits[0] == '0') || (negative && digits == "0")) {
+			return false;
+		}
+
+		if(negative) {
+			// The largest (variant) type for negative integers is int.
+			int i = 0;
+			const auto res = std::from_chars(v.data(), v.data() + v.size(), i);
+			if(res.ec == std::errc() && res.ptr == v.data() + v.size()) {
+				*this = i;
+				return true;
+			}
+		} else {
+			// The largest type for positive integers is unsigned long long.
+			unsigned long long ull = 0;
+			const auto res = std::from_chars(v.data(), v.data() + v.size(), ull);
+			if(res.ec == std::errc() && res.ptr == v.data() + v.size()) {
+				*this = ull;
+				return true;
+			}
+		}
+
+		// Out of range even for the widest type used; keep the string, just
+		// like the verified conversions below would have.
+		return false;
 	}
 
 	// Attempt to convert to a number.
@@ -196,13 +229,15 @@ config_attribute_value& config_attribute_value::operator=(const std::string& v)
 			// The largest type for positive integers is unsigned long long.
 			unsigned long long ull = 0;
 			if(from_string_verify<unsigned long long>(v, ull)) {
-				return *this = ull;
+				*this = ull;
+				return true;
 			}
 		} else {
 			// The largest (variant) type for negative integers is int.
 			int i = 0;
 			if(from_string_verify<int>(v, i)) {
-				return *this = i;
+				*this = i;
+				return true;
 			}
 		}
 
@@ -213,12 +248,37 @@ config_attribute_value& config_attribute_value::operator=(const std::string& v)
 		tester << d;
 		if(tester.str() == v) {
 			value_ = d;
-			return *this;
+			return true;
 		}
 	}
 
-	// No conversion possible. Store the string.
-	value_ = v;
+	// No conversion possible; the caller stores the string.
+	return false;
+}
+
+config_attribute_value& config_attribute_value::operator=(const std::string& v)
+{
+	// Handle some special strings.
+	if(v.empty()) {
+		value_ = v;
+		return *this;
+	}
+
+	if(!try_assign_special(v)) {
+		value_ = v;
+	}
+
+	return *this;
+}
+
+config_attribute_value& config_attribute_value::operator=(std::string&& v)
+{
+	// Same detection as the copy overload; only the plain-string
+	// fallthrough can reuse the buffer.
+	if(v.empty() || !try_assign_special(v)) {
+		value_ = std::move(v);
+	}
+
 	return *this;
 }
 
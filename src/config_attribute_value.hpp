@@ -90,6 +90,12 @@ public:
 private:
 	/** Visitor for checking equality. */
 	class equality_visitor;
+
+	/**
+	 * Attempts the boolean/numeric detection of @ref operator=(const std::string&).
+	 * @returns false if @a v has to be stored as a plain string.
+	 */
+	bool try_assign_special(const std::string& v);
 	/** Visitor for converting a variant to a string. */
 	class string_visitor;
 
@@ -136,6 +142,7 @@ public:
 	// String assignments:
 	config_attribute_value& operator=(const char *v) { return operator=(std::string(v)); }
 	config_attribute_value& operator=(const std::string &v);
+	config_attribute_value& operator=(std::string &&v);
 	config_attribute_value& operator=(const std::string_view &v);
 	config_attribute_value& operator=(const t_string &v);
 
@@ -29,6 +29,10 @@
 #include <boost/algorithm/string/replace.hpp>
 #include <boost/iostreams/filter/gzip.hpp>
 
+#include <algorithm>
+#include <future>
+#include <thread>
+
 static lg::log_domain log_cache("cache");
 #define ERR_CACHE LOG_STREAM(err, log_cache)
 #define LOG_CACHE LOG_STREAM(info, log_cache)
@@ -53,6 +57,37 @@ void add_builtin_defines(preproc_map& target)
 	target["WESNOTH_VERSION"] = preproc_define(game_config::wesnoth_version.str());
 }
 
+/** The main data tier uses the binary WML format (see write_binary_wml()). */
+const std::string data_extension = ".wmlb";
+
+/** Path of the cache segment with the given index. */
+std::string cache_segment_path(const std::string& fname, std::size_t index)
+{
+	// Segment 0 keeps the plain name, so a cache small enough to stay in
+	// one file looks exactly like the unsegmented layout.
+	if(index == 0) {
+		return fname + data_extension;
+	}
+
+	return fname + "." + std::to_string(index) + data_extension;
+}
+
+/**
+ * Number of segments to split a cache write over. Small configs stay in a
+ * single file; otherwise one segment per core, capped since the read side
+ * also has to open and append every segment.
+ */
+std::size_t cache_segment_count(const config& cfg)
+{
+	const std::size_t workers = std::max(1u, std::thread::hardware_concurrency());
+
+	if(workers < 2 || cfg.all_children_count() < 32) {
+		return 1;
+	}
+
+	return std::min<std::size_t>(workers, 8);
+}
+
 }
 
 config_cache& config_cache::instance()
@@ -126,6 +161,68 @@ void config_cache::read_file(const std::string& file_path, config& cfg)
 	read_gz(cfg, *stream);
 }
 
+void config_cache::read_binary_file(const std::string& file_path, config& cfg)
+{
+	filesystem::scoped_istream stream = filesystem::istream_file(file_path);
+	read_binary_wml(cfg, *stream);
+}
+
+void config_cache::read_cache_segments(const std::string& fname, config& cfg)
+{
+	std::vector<std::string> paths;
+	for(std::size_t i = 0; ; ++i) {
+		std::string path = cache_segment_path(fname, i);
+		if(i != 0 && !filesystem::file_exists(path)) {
+			break;
+		}
+
+		paths.push_back(std::move(path));
+	}
+
+	// Every segment but the first goes to a worker thread; each one is a
+	// self-contained stream covering a contiguous run of top-level children.
+	std::vector<std::future<config>> workers;
+	for(std::size_t i = 1; i < paths.size(); ++i) {
+		workers.push_back(std::async(std::launch::async, [this, path = paths[i]]() {
+			config part;
+			read_binary_file(path, part);
+			return part;
+		}));
+	}
+
+	read_binary_file(paths[0], cfg);
+
+	// Appending in index order restores the original child order. get()
+	// rethrows a worker's parse error here, where the caller's recovery
+	// path (regenerating the cache) can handle it.
+	for(std::future<config>& worker : workers) {
+		cfg.append(worker.get());
+	}
+}
+
+void config_cache::write_cache_segments(const std::string& fname, const config& cfg)
+{
+	const std::size_t segments = cache_segment_count(cfg);
+	const std::size_t children = cfg.all_children_count();
+
+	std::size_t first = 0;
+	for(std::size_t i = 0; i < segments; ++i) {
+		const std::size_t last = children * (i + 1) / segments;
+
+		filesystem::scoped_ostream stream = filesystem::ostream_file(cache_segment_path(fname, i));
+		write_binary_wml_shard(*stream, cfg, first, last);
+		first = last;
+	}
+
+	// Remove the next segment if a previous, wider split left it behind;
+	// otherwise the sequential probe in read_cache_segments() would append
+	// stale data.
+	const std::string stale = cache_segment_path(fname, segments);
+	if(filesystem::file_exists(stale)) {
+		filesystem::delete_directory(stale);
+	}
+}
+
 preproc_map& config_cache::make_copy_map()
 {
 	preproc_map& res = config_cache_transaction::instance().get_active_map(defines_map_);
@@ -149,6 +246,8 @@ void config_cache::read_configs(const std::string& file_path, config& cfg, prepr
 
 void config_cache::read_cache(const std::string& file_path, config& cfg, abstract_validator* validator)
 {
+	// The checksum and define files stay gzipped text WML; the main data
+	// tier uses the segmented binary format (see read_cache_segments()).
 	static const std::string extension = ".gz";
 
 	std::stringstream defines_string;
@@ -182,17 +281,25 @@ void config_cache::read_cache(const std::string& file_path, config& cfg, abstrac
 								  utils::md5(defines_string.str()).hex_digest();
 		const std::string fname_checksum = fname + ".checksum" + extension;
 
-		filesystem::file_tree_checksum dir_checksum;
+		// Work out the invalidation scope of this cache shard. A file inside
+		// an installed add-on only depends on that add-on's subtree plus the
+		// non-add-on data tree, so edits to other add-ons leave it valid.
+		std::string addon_scope;
+		const std::string addons_dir = filesystem::get_addons_dir() + "/";
+		if(file_path.compare(0, addons_dir.size(), addons_dir) == 0) {
+			const std::size_t sep = file_path.find('/', addons_dir.size());
+			if(sep != std::string::npos) {
+				addon_scope = file_path.substr(0, sep);
+			}
+		}
+
+		config checksum_cfg;
 
 		if(!force_valid_cache_ && !fake_invalid_cache_) {
 			try {
 				if(filesystem::file_exists(fname_checksum)) {
-					config checksum_cfg;
-
 					DBG_CACHE << "Reading checksum: " << fname_checksum;
 					read_file(fname_checksum, checksum_cfg);
-
-					dir_checksum = filesystem::file_tree_checksum(checksum_cfg);
 				}
 			} catch(const config::error&) {
 				ERR_CACHE << "cache checksum is corrupt";
@@ -203,16 +310,26 @@ void config_cache::read_cache(const std::string& file_path, config& cfg, abstrac
 			}
 		}
 
+		bool cache_valid = force_valid_cache_;
+
 		if(force_valid_cache_) {
 			LOG_CACHE << "skipping cache validation (forced)";
+		} else {
+			cache_valid = filesystem::file_tree_checksum(checksum_cfg) == filesystem::non_addons_tree_checksum();
+
+			if(cache_valid && !addon_scope.empty()) {
+				auto addon_sum = checksum_cfg.optional_child("addon");
+				cache_valid = addon_sum && (*addon_sum)["path"] == addon_scope
+					&& filesystem::file_tree_checksum(*addon_sum) == filesystem::get_file_tree_checksum(addon_scope);
+			}
 		}
 
-		if(filesystem::file_exists(fname + extension) && (force_valid_cache_ || (dir_checksum == filesystem::data_tree_checksum()))) {
-			LOG_CACHE << "found valid cache at '" << fname << extension << "' with defines_map " << defines_string.str();
+		if(filesystem::file_exists(fname + data_extension) && cache_valid) {
+			LOG_CACHE << "found valid cache at '" << fname << data_extension << "' with defines_map " << defines_string.str();
 			log_scope("read cache");
 
 			try {
-				read_file(fname + extension,cfg);
+				read_cache_segments(fname, cfg);
 				const std::string define_file = fname + ".define" + extension;
 
 				if(filesystem::file_exists(define_file)) {
@@ -221,16 +338,13 @@ void config_cache::read_cache(const std::string& file_path, config& cfg, abstrac
 
 				return;
 			} catch(const config::error& e) {
-				ERR_CACHE << "cache " << fname << extension << " is corrupt. Loading from files: "<< e.message;
+				ERR_CACHE << "cache " << fname << data_extension << " is corrupt. Loading from files: "<< e.message;
 			} catch(const filesystem::io_exception&) {
-				ERR_CACHE << "error reading cache " << fname << extension << ". Loading from files";
-			} catch (const boost::iostreams::gzip_error& e) {
-				//read_file -> ... -> read_gz can throw this exception.
-				ERR_CACHE << "cache " << fname << extension << " is corrupt. Error code: " << e.error();
+				ERR_CACHE << "error reading cache " << fname << data_extension << ". Loading from files";
 			}
 		}
 
-		LOG_CACHE << "no valid cache found. Writing cache to '" << fname << extension << " with defines_map "<< defines_string.str() << "'";
+		LOG_CACHE << "no valid cache found. Writing cache to '" << fname << data_extension << " with defines_map "<< defines_string.str() << "'";
 
 		// Now we need queued defines so read them to memory
 		read_defines_queue();
@@ -241,13 +355,19 @@ void config_cache::read_cache(const std::string& file_path, config& cfg, abstrac
 		add_defines_map_diff(copy_map);
 
 		try {
-			write_file(fname + extension, cfg);
+			write_cache_segments(fname, cfg);
 			write_file(fname + ".define" + extension, copy_map);
 
-			config checksum_cfg;
+			config new_checksum_cfg;
+
+			filesystem::non_addons_tree_checksum().write(new_checksum_cfg);
+			if(!addon_scope.empty()) {
+				config& addon_sum = new_checksum_cfg.add_child("addon");
+				filesystem::get_file_tree_checksum(addon_scope).write(addon_sum);
+				addon_sum["path"] = addon_scope;
+			}
 
-			filesystem::data_tree_checksum().write(checksum_cfg);
-			write_file(fname_checksum, checksum_cfg);
+			write_file(fname_checksum, new_checksum_cfg);
 		} catch(const filesystem::io_exception&) {
 			ERR_CACHE << "could not write to cache '" << fname << "'";
 		}
@@ -318,6 +438,7 @@ void config_cache::set_force_valid_cache(bool force)
 void config_cache::recheck_filetree_checksum()
 {
 	filesystem::data_tree_checksum(true);
+	filesystem::non_addons_tree_checksum(true);
 }
 
 void config_cache::add_define(const std::string& define)
@@ -163,6 +163,16 @@ private:
 	void read_file(const std::string& file, config& cfg);
 	void write_file(std::string file, const config& cfg);
 	void write_file(std::string file, const preproc_map& defines);
+	/** Reads/writes the binary cache tier (see write_binary_wml()). */
+	void read_binary_file(const std::string& file, config& cfg);
+
+	/**
+	 * Reads/writes the binary cache tier as independently parseable segment
+	 * files, so that reading can hand all segments but the first to worker
+	 * threads. @a fname is the cache path without the data extension.
+	 */
+	void read_cache_segments(const std::string& fname, config& cfg);
+	void write_cache_segments(const std::string& fname, const config& cfg);
 
 	void read_cache(const std::string& path, config& cfg, abstract_validator* validator = nullptr);
 
@@ -25,8 +25,10 @@
 #include "cursor.hpp"
 #include "draw.hpp"
 #include "draw_manager.hpp"
+#include "events.hpp"
 #include "fake_unit_manager.hpp"
 #include "font/sdl_ttf_compat.hpp"
+#include "frame_profiler.hpp"
 #include "font/text.hpp"
 #include "preferences/game.hpp"
 #include "gettext.hpp"
@@ -42,6 +44,7 @@
 #include "play_controller.hpp" //note: this can probably be refactored out
 #include "reports.hpp"
 #include "resources.hpp"
+#include "sdl/utils.hpp"
 #include "show_dialog.hpp"
 #include "synced_context.hpp"
 #include "team.hpp"
@@ -146,6 +149,48 @@ void display::remove_single_overlay(const map_location& loc, const std::string&
 	);
 }
 
+void dirty_hex_set::resize(int total_width, int total_height, int border)
+{
+	width_ = total_width;
+	height_ = total_height;
+	border_ = border;
+	grid_.assign(static_cast<std::size_t>(width_) * height_, false);
+	count_ = 0;
+	overflow_.clear();
+}
+
+void dirty_hex_set::clear()
+{
+	if(count_ != 0) {
+		std::fill(grid_.begin(), grid_.end(), false);
+		count_ = 0;
+	}
+	overflow_.clear();
+}
+
+bool dirty_hex_set::insert(const map_location& loc)
+{
+	const int i = index_of(loc);
+	if(i < 0) {
+		return overflow_.insert(loc).second;
+	}
+	if(grid_[i]) {
+		return false;
+	}
+	grid_[i] = true;
+	++count_;
+	return true;
+}
+
+bool dirty_hex_set::contains(const map_location& loc) const
+{
+	const int i = index_of(loc);
+	if(i < 0) {
+		return overflow_.count(loc) != 0;
+	}
+	return grid_[i];
+}
+
 display::display(const display_context* dc,
 		std::weak_ptr<wb::manager> wb,
 		reports& reports_object,
@@ -161,11 +206,15 @@ display::display(const display_context* dc,
 	, ypos_(0)
 	, view_locked_(false)
 	, theme_(theme::get_theme_config(theme_id.empty() ? preferences::theme() : theme_id), video::game_canvas())
+	, panel_buffer_()
+	, panel_buffer_generation_(0)
+	, panel_buffer_area_()
 	, zoom_index_(0)
 	, fake_unit_man_(new fake_unit_manager(*this))
 	, builder_(new terrain_builder(level, (dc_ ? &dc_->map() : nullptr), theme_.border().tile_image, theme_.border().show_border))
 	, minimap_(nullptr)
 	, minimap_location_(sdl::empty_rect)
+	, minimap_dirty_locs_()
 	, redraw_background_(false)
 	, invalidateAll_(true)
 	, diagnostic_label_(0)
@@ -217,6 +266,11 @@ display::display(const display_context* dc,
 
 	read(level.child_or_empty("display"));
 
+	if(dc_) {
+		const gamemap& map = get_map();
+		invalidated_.resize(map.total_width(), map.total_height(), map.border_size());
+	}
+
 	fill_images_list(game_config::fog_prefix, fog_images_);
 	fill_images_list(game_config::shroud_prefix, shroud_images_);
 
@@ -253,6 +307,7 @@ display::~display()
 void display::set_theme(const std::string& new_theme)
 {
 	theme_ = theme{theme::get_theme_config(new_theme), video::game_canvas()};
+	panel_buffer_.reset();
 	builder_->set_draw_border(theme_.border().show_border);
 	menu_buttons_.clear();
 	action_buttons_.clear();
@@ -459,16 +514,65 @@ void display::rebuild_all()
 	builder_->rebuild_all();
 }
 
+void display::rebuild_region(const std::set<map_location>& locs)
+{
+	invalidate(builder_->rebuild_region(locs));
+}
+
+void display::precache_textures(const map_location& initial_center)
+{
+	if(video::headless()) {
+		return;
+	}
+
+	const int center_y = get_map().on_board_with_border(initial_center)
+		? initial_center.y
+		: get_map().h() / 2;
+
+	// Rows closest to the initial view go first, so the visible area is warm
+	// even if later batches end up racing the end of the loading screen.
+	std::vector<int> rows(get_map().h());
+	std::iota(rows.begin(), rows.end(), 0);
+	std::stable_sort(rows.begin(), rows.end(), [center_y](int a, int b) {
+		return std::abs(a - center_y) < std::abs(b - center_y);
+	});
+
+	// A few rows per batch keeps each main-thread slice well under a frame
+	// length, letting the loading screen animate between uploads.
+	constexpr std::size_t batch_rows = 4;
+	for(std::size_t i = 0; i < rows.size(); i += batch_rows) {
+		events::call_in_main_thread([&, i]() {
+			const std::size_t end = std::min(rows.size(), i + batch_rows);
+			for(std::size_t r = i; r < end; ++r) {
+				for(int x = 0; x < get_map().w(); ++x) {
+					const map_location loc(x, rows[r]);
+					if(shrouded(loc)) {
+						continue;
+					}
+					const time_of_day& tod = get_time_of_day(loc);
+					// These fill the texture caches as a side effect.
+					get_terrain_images(loc, tod.id, BACKGROUND);
+					get_terrain_images(loc, tod.id, FOREGROUND);
+				}
+			}
+			terrain_image_vector_.clear();
+		});
+	}
+}
+
 void display::reload_map()
 {
 	redraw_background_ = true;
 	builder_->reload_map();
+	// The map size may have changed with it.
+	invalidated_.resize(get_map().total_width(), get_map().total_height(), get_map().border_size());
 }
 
 void display::change_display_context(const display_context * dc)
 {
 	dc_ = dc;
 	builder_->change_map(&dc_->map()); //TODO: Should display_context own and initialize the builder object?
+	invalidated_.resize(get_map().total_width(), get_map().total_height(), get_map().border_size());
 }
 
 void display::blindfold(bool value)
@@ -777,21 +881,43 @@ surface display::screenshot(bool map_screenshot)
 	xpos_ = 0;
 	ypos_ = 0;
 
-	// Reroute render output to a separate texture until the end of scope.
 	SDL_Rect area = max_map_area();
 	if (area.w > 1 << 16 || area.h > 1 << 16) {
 		WRN_DP << "Excessively large map screenshot area";
 	}
-	LOG_DP << "creating " << area.w << " by " << area.h
-	       << " texture for map screenshot";
-	texture output_texture(area.w, area.h, SDL_TEXTUREACCESS_TARGET);
+
+	// Render in horizontal bands through one bounded render-target texture
+	// and stitch the readbacks together, rather than drawing the whole map
+	// into a single full-size target. A large map is tens of thousands of
+	// pixels tall, past the texture size limit of common renderers, and a
+	// target that big fails to allocate outright; bands also keep the peak
+	// VRAM use fixed no matter the map size.
+	const int band_h = std::min(area.h, 4096);
+	LOG_DP << "creating " << area.w << " by " << band_h
+	       << " render target for a " << area.w << " by " << area.h
+	       << " map screenshot";
+	texture output_texture(area.w, band_h, SDL_TEXTUREACCESS_TARGET);
+	surface res(area.w, area.h);
+
+	// Reroute render output to the band texture until the end of scope.
 	auto target_setter = draw::set_render_target(output_texture);
-	auto clipper = draw::override_clip(area);
 
 	map_screenshot_ = true;
 
-	invalidate_locations_in_rect(map_area());
-	draw();
+	for(int y = 0; y < area.h; y += band_h) {
+		rect band{0, 0, area.w, std::min(band_h, area.h - y)};
+		ypos_ = y;
+
+		auto clipper = draw::override_clip(band);
+		invalidate_locations_in_rect(band);
+		draw();
+
+		// Read the band's pixels back and paste them into place.
+		surface band_pixels = video::read_pixels(&band);
+		SDL_SetSurfaceBlendMode(band_pixels, SDL_BLENDMODE_NONE);
+		SDL_Rect dst {0, y, band.w, band.h};
+		sdl_blit(band_pixels, nullptr, res, &dst);
+	}
 
 	map_screenshot_ = false;
 
@@ -799,8 +925,7 @@ surface display::screenshot(bool map_screenshot)
 	xpos_ = old_xpos;
 	ypos_ = old_ypos;
 
-	// Read rendered pixels back as an SDL surface.
-	return video::read_pixels();
+	return res;
 }
 
 std::shared_ptr<gui::button> display::find_action_button(const std::string& id)
@@ -1174,10 +1299,10 @@ void display::get_terrain_images(const map_location& loc, const std::string& tim
 			const bool off_map = (image.get_filename() == off_map_name
 				|| image.get_modifications().find("NO_TOD_SHIFT()") != std::string::npos);
 
-			if(off_map) {
-				tex = image::get_texture(image, image::HEXED);
-			} else if(lt.empty()) {
-				tex = image::get_texture(image, image::HEXED);
+			if(off_map || lt.empty()) {
+				// Unlighted tiles come from the terrain atlas, so that runs of
+				// them batch into as few draw calls as possible.
+				tex = image::get_terrain_texture(image);
 			} else {
 				tex = image::get_lighted_texture(image, lt);
 			}
@@ -1265,19 +1390,22 @@ void display::drawing_buffer_add(const drawing_layer layer, const map_location&
 		int(zoom_)
 	};
 
+	// The current size doubles as the insertion index in the low key half.
+	const uint64_t key = (uint64_t(generate_hex_key(layer, loc)) << 32) | drawing_buffer_.size();
+
 	// C++20 needed for in-place aggregate initilization
 #ifdef HAVE_CXX20
-	drawing_buffer_.emplace_back(generate_hex_key(layer, loc), draw_func, dest);
+	drawing_buffer_.emplace_back(key, draw_func, dest);
 #else
-	draw_helper temp{generate_hex_key(layer, loc), draw_func, dest};
+	draw_helper temp{key, draw_func, dest};
 	drawing_buffer_.push_back(std::move(temp));
 #endif //  HAVE_CXX20
 }
 
 void display::drawing_buffer_commit()
 {
-	// std::list::sort() is a stable sort
-	drawing_buffer_.sort();
+	// The insertion index in the key makes the unstable sort order-preserving.
+	std::sort(drawing_buffer_.begin(), drawing_buffer_.end());
 
 	const auto clipper = draw::reduce_clip(map_area());
 
@@ -1422,23 +1550,68 @@ void display::draw_label(const theme::label& label)
 
 bool display::draw_all_panels(const rect& region)
 {
-	bool drew = false;
 	const rect game_canvas = video::game_canvas();
 
+	// The chrome is static between theme and resolution changes, so it is
+	// composed into a buffer once and each redraw only blits from that.
+	if(!panel_buffer_ || panel_buffer_area_ != game_canvas
+		|| panel_buffer_generation_ != theme_.generation())
+	{
+		DBG_DP << "composing theme chrome for " << game_canvas;
+
+		const rect render_area = game_canvas * video::get_pixel_scale();
+		panel_buffer_ = texture(render_area.w, render_area.h, SDL_TEXTUREACCESS_TARGET);
+		panel_buffer_.set_draw_size(game_canvas.w, game_canvas.h);
+		panel_buffer_area_ = game_canvas;
+		panel_buffer_generation_ = theme_.generation();
+
+		auto target_setter = draw::set_render_target(panel_buffer_);
+		auto clipper = draw::override_clip(game_canvas);
+
+		// Not every part of the canvas is covered by a panel.
+		draw::set_blend_mode(SDL_BLENDMODE_NONE);
+		draw::fill(0, 0, 0, 0);
+		draw::set_blend_mode(SDL_BLENDMODE_BLEND);
+
+		for(const auto& panel : theme_.panels()) {
+			draw_panel(panel);
+		}
+
+		for(const auto& label : theme_.labels()) {
+			draw_label(label);
+		}
+	}
+
+	bool drew = false;
+
 	for(const auto& panel : theme_.panels()) {
 		if(region.overlaps(panel.location(game_canvas))) {
-			draw_panel(panel);
 			drew = true;
 		}
 	}
 
 	for(const auto& label : theme_.labels()) {
-		if(region.overlaps(label.location(game_canvas))) {
-			draw_label(label);
-			drew = true;
+		const rect& loc = label.location(game_canvas);
+		if(!region.overlaps(loc)) {
+			continue;
+		}
+
+		drew = true;
+
+		// Tooltips are cleared from well outside this scope, so they are
+		// re-registered even when the chrome itself comes from the buffer.
+		if(!label.icon().empty() && !label.text().empty()) {
+			tooltips::add_tooltip(loc, label.text());
 		}
 	}
 
+	if(drew) {
+		const rect dst = region.intersect(game_canvas);
+		panel_buffer_.set_src(dst);
+		draw::blit(panel_buffer_, dst);
+		panel_buffer_.clear_src();
+	}
+
 	return drew;
 }
 
@@ -1629,6 +1802,8 @@ void display::recalculate_minimap()
 		return;
 	}
 
+	minimap_dirty_locs_.clear();
+
 	minimap_ = texture(image::getMinimap(
 		area.w, area.h, get_map(),
 		dc_->teams().empty() ? nullptr : &dc_->teams()[currentTeam_],
@@ -1638,6 +1813,40 @@ void display::recalculate_minimap()
 	redraw_minimap();
 }
 
+void display::update_minimap()
+{
+	if(video::headless()) {
+		return;
+	}
+
+	const rect& area = minimap_area();
+	if(area.empty()) {
+		return;
+	}
+
+	// A reach-map highlight is baked into the minimap pixels, so those are
+	// always composed from scratch.
+	if(selectedHex_.valid() && !is_blindfolded()) {
+		recalculate_minimap();
+		return;
+	}
+
+	surface patched = image::update_minimap(
+		area.w, area.h, get_map(),
+		dc_->teams().empty() ? nullptr : &dc_->teams()[currentTeam_],
+		minimap_dirty_locs_
+	);
+
+	if(!patched) {
+		recalculate_minimap();
+		return;
+	}
+
+	minimap_dirty_locs_.clear();
+	minimap_ = texture(patched);
+	redraw_minimap();
+}
+
 void display::redraw_minimap()
 {
 	draw_manager::invalidate_region(minimap_area());
@@ -1789,6 +1998,7 @@ bool display::scroll(int xmove, int ymove, bool force)
 	 */
 	font::scroll_floating_labels(diff_x, diff_y);
 
+	labels().update_visibility();
 	labels().recalculate_shroud();
 
 	//
@@ -1908,6 +2118,10 @@ bool display::set_zoom(unsigned int amount, const bool validate_value_and_set_in
 	xpos_ -= (outside_area.w - area.w) / 2;
 	ypos_ -= (outside_area.h - area.h) / 2;
 
+	// Note that this is all there is to a zoom change: textures are cached at
+	// their native resolution and scaled on the GPU at blit time through the
+	// scaled_to_zoom() destination rects, so no image is re-scaled on the CPU
+	// here. The cost of the next frame is one full redraw from cached textures.
 	zoom_ = new_zoom;
 	bounds_check_position(xpos_, ypos_);
 	if(zoom_ != DefaultZoom) {
@@ -2394,6 +2608,9 @@ void display::draw()
 			draw_invalidated();
 			invalidated_.clear();
 		}
+		// The commit blits whatever draw_invalidated() queued. Most of the
+		// buffer is map tiles, so the profiler counts it as terrain.
+		frame_profiler::scope profile(frame_profiler::subsystem::terrain);
 		drawing_buffer_commit();
 	}
 
@@ -2403,6 +2620,10 @@ void display::draw()
 	} else if(fps_handle_ != 0) {
 		clear_fps_label();
 	}
+
+	// Floating labels can safely be replaced from here, as the fps label
+	// shows, so the profiler HUD is also refreshed here.
+	frame_profiler::update_hud();
 }
 
 void display::update()
@@ -2500,7 +2721,10 @@ bool display::expose(const rect& region)
 	}
 
 	// Render halos.
-	halo_man_.render(clipped_region);
+	{
+		frame_profiler::scope profile(frame_profiler::subsystem::halo);
+		halo_man_.render(clipped_region);
+	}
 
 	// Render UI elements.
 	// Ideally buttons would be drawn as part of panels,
@@ -2626,29 +2850,43 @@ void display::draw_invalidated()
 		drawer.emplace(*this);
 	}
 
-	for(const map_location& loc : invalidated_) {
-		int xpos = get_location_x(loc);
-		int ypos = get_location_y(loc);
+	invalidated_.for_each_run([&](const map_location& first, const map_location& last) {
+		// One region per run of adjacent hexes instead of one per hex
+		// keeps the draw manager's batch list short.
+		rect run_rect;
 
-		rect hex_rect(xpos, ypos, zoom_, zoom_);
-		if(!hex_rect.overlaps(clip_rect)) {
-			continue;
-		}
+		for(map_location loc = first; loc.x <= last.x; ++loc.x) {
+			int xpos = get_location_x(loc);
+			int ypos = get_location_y(loc);
 
-		draw_hex(loc);
-		drawn_hexes_ += 1;
+			rect hex_rect(xpos, ypos, zoom_, zoom_);
+			if(!hex_rect.overlaps(clip_rect)) {
+				continue;
+			}
+
+			{
+				frame_profiler::scope profile(frame_profiler::subsystem::terrain);
+				draw_hex(loc);
+				drawn_hexes_ += 1;
+			}
 
-		if(drawer) {
-			const auto u_it = dc_->units().find(loc);
-			const auto request = exclusive_unit_draw_requests_.find(loc);
+			if(drawer) {
+				const auto u_it = dc_->units().find(loc);
+				const auto request = exclusive_unit_draw_requests_.find(loc);
 
-			if(u_it != dc_->units().end() && (request == exclusive_unit_draw_requests_.end() || request->second == u_it->id())) {
-				drawer->redraw_unit(*u_it);
+				if(u_it != dc_->units().end() && (request == exclusive_unit_draw_requests_.end() || request->second == u_it->id())) {
+					frame_profiler::scope profile(frame_profiler::subsystem::units);
+					drawer->redraw_unit(*u_it);
+				}
 			}
+
+			run_rect.expand_to_cover(hex_rect.intersect(clip_rect));
 		}
 
-		draw_manager::invalidate_region(hex_rect.intersect(clip_rect));
-	}
+		if(!run_rect.empty()) {
+			draw_manager::invalidate_region(run_rect);
+		}
+	});
 
 	invalidated_hexes_ += invalidated_.size();
 }
@@ -2868,7 +3106,24 @@ void display::draw_hex(const map_location& loc)
  * If a config is not supplied, it will be generated via
  * reports::generate_report().
  */
+reports::context display::create_reports_context()
+{
+	utils::optional_reference<events::mouse_handler> mhb = std::nullopt;
+
+	if (resources::controller) {
+		mhb = resources::controller->get_mouse_handler_base();
+	}
+
+	return reports::context(*dc_, *this, *resources::tod_manager, wb_.lock(), mhb);
+}
+
 void display::refresh_report(const std::string& report_name, const config * new_cfg)
+{
+	reports::context temp_context = create_reports_context();
+	refresh_report(report_name, temp_context, new_cfg);
+}
+
+void display::refresh_report(const std::string& report_name, reports::context& ctx, const config* new_cfg)
 {
 	const theme::status_item *item = theme_.get_status_item(report_name);
 	if (!item) {
@@ -2879,16 +3134,7 @@ void display::refresh_report(const std::string& report_name, const config * new_
 	}
 
 	// Now we will need the config. Generate one if needed.
-
-	utils::optional_reference<events::mouse_handler> mhb = std::nullopt;
-
-	if (resources::controller) {
-		mhb = resources::controller->get_mouse_handler_base();
-	}
-
-	reports::context temp_context = reports::context(*dc_, *this, *resources::tod_manager, wb_.lock(), mhb);
-
-	const config generated_cfg = new_cfg ? config() : reports_object_->generate_report(report_name, temp_context);
+	const config generated_cfg = new_cfg ? config() : reports_object_->generate_report(report_name, ctx);
 	if ( new_cfg == nullptr )
 		new_cfg = &generated_cfg;
 
@@ -3121,21 +3367,27 @@ void display::invalidate_all()
 
 bool display::invalidate(const map_location& loc)
 {
+	// Recorded even when everything is invalidated: the minimap is composed
+	// on its own schedule, not as part of the full-redraw pass.
+	minimap_dirty_locs_.insert(loc);
+
 	if(invalidateAll_)
 		return false;
 
 	bool tmp;
-	tmp = invalidated_.insert(loc).second;
+	tmp = invalidated_.insert(loc);
 	return tmp;
 }
 
 bool display::invalidate(const std::set<map_location>& locs)
 {
+	minimap_dirty_locs_.insert(locs.begin(), locs.end());
+
 	if(invalidateAll_)
 		return false;
 	bool ret = false;
 	for (const map_location& loc : locs) {
-		ret = invalidated_.insert(loc).second || ret;
+		ret = invalidated_.insert(loc) || ret;
 	}
 	return ret;
 }
@@ -3152,16 +3404,13 @@ bool display::propagate_invalidation(const std::set<map_location>& locs)
 	{
 		// search the first hex invalidated (if any)
 		std::set<map_location>::const_iterator i = locs.begin();
-		for(; i != locs.end() && invalidated_.count(*i) == 0 ; ++i) {}
+		for(; i != locs.end() && !invalidated_.contains(*i) ; ++i) {}
 
 		if (i != locs.end()) {
-
 			// propagate invalidation
-			// 'i' is already in, but I suspect that splitting the range is bad
-			// especially because locs are often adjacents
-			size_t previous_size = invalidated_.size();
-			invalidated_.insert(locs.begin(), locs.end());
-			result = previous_size < invalidated_.size();
+			for (const map_location& loc : locs) {
+				result = invalidated_.insert(loc) || result;
+			}
 		}
 	}
 	return result;
@@ -3222,10 +3471,23 @@ void display::invalidate_animations()
 		u->anim_comp().refresh();
 	}
 
+	// Animation level-of-detail: standing and idle animations are purely
+	// cosmetic, so units far off screen don't get theirs advanced, and below
+	// animation_lod_zoom nobody's is. Movement and combat animations keep
+	// running unconditionally, and a frozen unit picks its frame from the
+	// shared animation clock again the moment it becomes relevant, so no
+	// transition is visible.
+	const bool animate_cosmetic = get_zoom_factor() >= animation_lod_zoom;
+
 	bool new_inval;
 	do {
 		new_inval = false;
 		for(const unit& u : dc_->units()) {
+			if(u.anim_comp().is_cosmetic_animation()
+				&& (!animate_cosmetic || !tile_nearly_on_screen(u.get_location())))
+			{
+				continue;
+			}
 			new_inval |= u.anim_comp().invalidate(*this);
 		}
 		for(const unit* u : *fake_unit_man_) {
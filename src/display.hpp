@@ -59,6 +59,7 @@ namespace wb {
 #include "halo.hpp"
 #include "picture.hpp" //only needed for enums (!)
 #include "key.hpp"
+#include "reports.hpp"
 #include "time_of_day.hpp"
 #include "sdl/rect.hpp"
 #include "sdl/surface.hpp"
@@ -80,6 +81,108 @@ namespace wb {
 
 class gamemap;
 
+/**
+ * Tracks the set of hexes that need to be redrawn, one bit per hex.
+ *
+ * display previously kept these in a std::set<map_location>; during
+ * scrolling and full-map animations most of the visible map is inserted
+ * again every frame, and the tree's node allocations and rebalancing
+ * showed up in profiles. The grid covers the map including its border;
+ * anything outside (possible before the grid is first sized) lands in a
+ * plain fallback set, so no location is ever silently dropped.
+ */
+class dirty_hex_set
+{
+public:
+	dirty_hex_set()
+		: grid_()
+		, width_(0)
+		, height_(0)
+		, border_(0)
+		, count_(0)
+		, overflow_()
+	{
+	}
+
+	/**
+	 * Sizes the grid to @a total_width by @a total_height hexes, of which
+	 * @a border rows and columns on each side are map border, and clears it.
+	 */
+	void resize(int total_width, int total_height, int border);
+
+	/** Removes all hexes. */
+	void clear();
+
+	/** Marks @a loc as dirty. Returns whether it was clean before. */
+	bool insert(const map_location& loc);
+
+	/** Whether @a loc is currently marked. */
+	bool contains(const map_location& loc) const;
+
+	std::size_t size() const
+	{
+		return count_ + overflow_.size();
+	}
+
+	bool empty() const
+	{
+		return count_ == 0 && overflow_.empty();
+	}
+
+	/**
+	 * Calls @a f(first, last) once per horizontal run of marked hexes,
+	 * where @a first and @a last are the run's leftmost and rightmost
+	 * members. Handing the renderer one rectangle per run instead of one
+	 * per hex keeps the region list short.
+	 */
+	template<typename F>
+	void for_each_run(F&& f) const
+	{
+		for(int y = 0; y < height_; ++y) {
+			const int row = y * width_;
+			int x = 0;
+			while(x < width_) {
+				if(!grid_[row + x]) {
+					++x;
+					continue;
+				}
+				int run_end = x + 1;
+				while(run_end < width_ && grid_[row + run_end]) {
+					++run_end;
+				}
+				f(map_location(x - border_, y - border_), map_location(run_end - 1 - border_, y - border_));
+				x = run_end;
+			}
+		}
+
+		for(const map_location& loc : overflow_) {
+			f(loc, loc);
+		}
+	}
+
+private:
+	/** Returns the bit index of @a loc, or -1 if it is outside the grid. */
+	int index_of(const map_location& loc) const
+	{
+		const int x = loc.x + border_;
+		const int y = loc.y + border_;
+		if(x < 0 || y < 0 || x >= width_ || y >= height_) {
+			return -1;
+		}
+		return y * width_ + x;
+	}
+
+	/** One bit per hex, row by row. */
+	std::vector<bool> grid_;
+	int width_;
+	int height_;
+	int border_;
+	/** Number of bits set in grid_. */
+	std::size_t count_;
+	/** Marked hexes falling outside the grid. */
+	std::set<map_location> overflow_;
+};
+
 class display : public gui2::top_level_drawable
 {
 public:
@@ -252,6 +355,13 @@ public:
 		return static_cast<double>(zoom_) / static_cast<double>(game_config::tile_size);
 	}
 
+	/**
+	 * Zoom factor below which purely cosmetic unit animations (standing,
+	 * idling) are frozen; the pixel or two they move is not discernible at
+	 * such zoom levels. See invalidate_animations().
+	 */
+	static constexpr double animation_lod_zoom = 0.5;
+
 	/** Scale the width and height of a rect by the current zoom factor */
 	static rect scaled_to_zoom(const SDL_Rect& r)
 	{
@@ -391,6 +501,17 @@ public:
 	/** Update the given report. Actual drawing is done in draw_report(). */
 	void refresh_report(const std::string& report_name, const config * new_cfg=nullptr);
 
+	/**
+	 * As above, but using a caller-provided report context. Rebuilding the
+	 * whole sidebar through one shared context lets the reports reuse each
+	 * other's resolved inputs (displayed unit, illuminated time of day)
+	 * instead of recomputing them per report.
+	 */
+	void refresh_report(const std::string& report_name, reports::context& ctx, const config* new_cfg = nullptr);
+
+	/** Builds a report context for the current game state. */
+	reports::context create_reports_context();
+
 	/**
 	 * Draw the specified report.
 	 *
@@ -446,6 +567,24 @@ public:
 	/** Rebuild all dynamic terrain. */
 	void rebuild_all();
 
+	/**
+	 * Rebuild the dynamic terrain around the given changed locations,
+	 * and invalidate every hex whose images were rebuilt. Much cheaper
+	 * than rebuild_all() when only a few tiles changed.
+	 */
+	void rebuild_region(const std::set<map_location>& locs);
+
+	/**
+	 * Uploads the map's terrain textures to the GPU in small batches, rows
+	 * nearest @a initial_center first, so the first draw of a scenario
+	 * doesn't stall on hundreds of synchronous uploads.
+	 *
+	 * Safe to call from a loading screen worker thread: each batch runs on
+	 * the main thread via events::call_in_main_thread(), and the loading
+	 * screen keeps animating between batches.
+	 */
+	void precache_textures(const map_location& initial_center);
+
 	const theme::action* action_pressed();
 	const theme::menu*   menu_pressed();
 
@@ -615,6 +754,13 @@ public:
 	 */
 	void recalculate_minimap();
 
+	/**
+	 * Update the minimap for the hexes invalidated since it was last
+	 * composed, redrawing only their footprints. Falls back to a full
+	 * recalculation when no composed minimap is available to patch.
+	 */
+	void update_minimap();
+
 	/**
 	 * Schedule the minimap to be redrawn.
 	 * Useful if units have moved about on the map.
@@ -711,6 +857,12 @@ protected:
 	int xpos_, ypos_;
 	bool view_locked_;
 	theme theme_;
+	/** Static theme chrome (panels and labels), composed once; see draw_all_panels(). */
+	texture panel_buffer_;
+	/** The theme generation the panel buffer was composed from. */
+	std::size_t panel_buffer_generation_;
+	/** The game canvas the panel buffer was composed for. */
+	rect panel_buffer_area_;
 	/**
 	 * The current zoom, in pixels (on screen) per 72 pixels (in the
 	 * graphic assets), i.e., 72 means 100%.
@@ -723,6 +875,8 @@ protected:
 	const std::unique_ptr<terrain_builder> builder_;
 	texture minimap_;
 	SDL_Rect minimap_location_;
+	/** Hexes invalidated since the minimap was last composed; see update_minimap(). */
+	std::set<map_location> minimap_dirty_locs_;
 	bool redraw_background_;
 	bool invalidateAll_;
 	int diagnostic_label_;
@@ -745,7 +899,7 @@ protected:
 	std::map<std::string, texture> reportSurfaces_;
 	std::map<std::string, config> reports_;
 	std::vector<std::shared_ptr<gui::button>> menu_buttons_, action_buttons_;
-	std::set<map_location> invalidated_;
+	dirty_hex_set invalidated_;
 	// If we're transitioning from one time of day to the next,
 	// then we will use these two masks on top of all hexes when we blit.
 	texture tod_hex_mask1 = {};
@@ -865,8 +1019,13 @@ protected:
 	 */
 	struct draw_helper
 	{
-		/** Controls the ordering of draw calls by layer and location. */
-		const uint32_t key;
+		/**
+		 * Controls the ordering of draw calls by layer and location.
+		 * The high half holds the packed group/row/layer/column key; the low
+		 * half holds the insertion index, so sorting by this single integer
+		 * also preserves the order in which equal hex keys were added.
+		 */
+		uint64_t key;
 
 		/** Handles the actual drawing at this location. */
 		std::function<void(const rect&)> do_draw;
@@ -880,7 +1039,9 @@ protected:
 		}
 	};
 
-	std::list<draw_helper> drawing_buffer_;
+	/** Per-frame draw list. clear() keeps the capacity, so after the first few
+	 * frames no allocation happens while filling it. */
+	std::vector<draw_helper> drawing_buffer_;
 
 public:
 	/**
@@ -16,6 +16,7 @@
 
 #include "draw.hpp"
 #include "exceptions.hpp"
+#include "frame_profiler.hpp"
 #include "log.hpp"
 #include "gui/core/top_level_drawable.hpp"
 #include "preferences/general.hpp"
@@ -48,6 +49,7 @@ std::vector<rect> invalidated_regions_;
 bool drawing_ = false;
 bool tlds_need_tidying_ = false;
 uint32_t last_sparkle_ = 0;
+std::map<top_level_drawable*, int> render_timings_;
 } // namespace
 
 namespace draw_manager {
@@ -130,6 +132,9 @@ void sparkle()
 		throw game::error("recursive draw");
 	}
 
+	// One sparkle is one frame, as far as the profiler is concerned.
+	frame_profiler::next_frame();
+
 	// Remove any invalidated TLDs from previous iterations or events.
 	if (tlds_need_tidying_) {
 		tidy_drawables();
@@ -150,6 +155,7 @@ void sparkle()
 	}
 
 	// Ensure any off-screen render buffers are up-to-date.
+	render_timings_.clear();
 	draw_manager::render();
 
 	// Draw to the screen.
@@ -205,18 +211,45 @@ static void render()
 {
 	for (size_t i = 0; i < top_level_drawables_.size(); ++i) {
 		top_level_drawable* tld = top_level_drawables_[i];
-		if (tld) { tld->render(); }
+		if (tld) {
+			const uint32_t started = SDL_GetTicks();
+			tld->render();
+			render_timings_[tld] += SDL_GetTicks() - started;
+		}
 	}
 }
 
+const std::map<top_level_drawable*, int>& render_timings()
+{
+	return render_timings_;
+}
+
 static bool expose()
 {
 	drawing_ = true;
 
+	// Overrunning the frame length turns into a visible stutter, so draw
+	// work is budgeted: once the deadline passes, any regions still pending
+	// stay invalidated and are drawn in following frames instead. At least
+	// one region is always drawn per frame, so the queue keeps draining.
+	const uint32_t deadline = last_sparkle_ + get_frame_length();
+
+	// Largest regions last, as regions are drawn back-to-front: the biggest
+	// visible change lands first, and small cosmetic patches are the
+	// cheapest to postpone if the budget runs out.
+	std::sort(invalidated_regions_.begin(), invalidated_regions_.end(),
+		[](const rect& a, const rect& b) { return a.area() < b.area(); });
+
 	// For now just send all regions to all TLDs in the correct order.
 	bool drawn = false;
+	bool drew_something = false;
 next:
 	while (!invalidated_regions_.empty()) {
+		if (drew_something && SDL_GetTicks() >= deadline) {
+			DBG_DM << "frame budget exhausted, deferring "
+				<< invalidated_regions_.size() << " pending regions";
+			break;
+		}
 		rect r = invalidated_regions_.back();
 		invalidated_regions_.pop_back();
 		// check if this will be superceded by or should be merged with another
@@ -249,7 +282,9 @@ next:
 			DBG_DM << "  to " << static_cast<void*>(tld);
 			//STREAMING_LOG << "*";
 			try {
+				const uint32_t started = SDL_GetTicks();
 				drawn |= tld->expose(i);
+				render_timings_[tld] += SDL_GetTicks() - started;
 			} catch(...) {
 				WRN_DM << "exception " << utils::get_unknown_exception_type()
 					   << " thrown during expose " << static_cast<void*>(tld);
@@ -257,6 +292,7 @@ next:
 				throw;
 			}
 		}
+		drew_something = true;
 	}
 	drawing_ = false;
 	return drawn;
@@ -290,6 +326,8 @@ void deregister_drawable(top_level_drawable* tld)
 	// This prevents removals from interfering with TLD iteration.
 	*it = nullptr;
 	tlds_need_tidying_ = true;
+	// Don't leave a dangling pointer in the timings.
+	render_timings_.erase(tld);
 }
 
 void raise_drawable(top_level_drawable* tld)
@@ -16,6 +16,8 @@
 
 #include "sdl/rect.hpp"
 
+#include <map>
+
 namespace gui2 { class top_level_drawable; }
 
 /**
@@ -112,6 +114,16 @@ void sparkle();
  */
 int get_frame_length();
 
+/**
+ * Time spent drawing each top-level drawable during the last frame,
+ * in milliseconds.
+ *
+ * Covers both the offscreen render() and on-screen expose() phases.
+ * Useful for diagnosing which drawable is blowing the frame budget.
+ * Entries are replaced every frame in which drawing happens.
+ */
+const std::map<gui2::top_level_drawable*, int>& render_timings();
+
 /** Register a top-level drawable.
  *
  * Registered drawables will be drawn in the order of registration,
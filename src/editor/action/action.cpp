@@ -75,6 +75,11 @@ void editor_action_whole_map::perform_without_undo(map_context& mc) const
 	mc.set_map(m_);
 }
 
+std::size_t editor_action_whole_map::memory_hint() const
+{
+	return static_cast<std::size_t>(m_.total_width()) * m_.total_height() * sizeof(t_translation::terrain_code);
+}
+
 editor_action_chain::editor_action_chain(const editor::editor_action_chain& other)
 	: editor_action()
 	, actions_()
@@ -113,6 +118,18 @@ int editor_action_chain::action_count() const
 	return count;
 }
 
+std::size_t editor_action_chain::memory_hint() const
+{
+	std::size_t total = 0;
+	for(const auto& a : actions_) {
+		if(a) {
+			total += a->memory_hint();
+		}
+	}
+
+	return total;
+}
+
 void editor_action_chain::append_action(std::unique_ptr<editor_action> a)
 {
 	actions_.push_back(std::move(a));
@@ -45,6 +45,7 @@ public:
 
 	std::unique_ptr<editor_action> clone() const override;
 	void perform_without_undo(map_context& m) const override;
+	std::size_t memory_hint() const override;
 	const std::string& get_name() const override;
 
 protected:
@@ -121,6 +122,11 @@ public:
 	 */
 	int action_count() const override;
 
+	/**
+	 * Go through the chain and add up the memory estimates
+	 */
+	std::size_t memory_hint() const override;
+
 	/**
 	 * Add an action at the end of the chain
 	 */
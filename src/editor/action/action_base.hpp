@@ -69,6 +69,18 @@ public:
 	 */
 	virtual int action_count() const;
 
+	/**
+	 * @return an estimate of the heap memory held by this action, in bytes.
+	 *
+	 * Used to bound the total memory of the undo and redo stacks. Actions
+	 * that only store metadata can rely on the default of zero; actions
+	 * holding map snapshots or fragments should report their size.
+	 */
+	virtual std::size_t memory_hint() const
+	{
+		return 0;
+	}
+
 	/**
 	 * @return a short name of this action type, defaults to unknown
 	 */
@@ -185,6 +185,16 @@ EXIT_STATUS editor_controller::main_loop()
 	return quit_mode_;
 }
 
+void editor_controller::play_slice(bool is_delay_enabled)
+{
+	controller_base::play_slice(is_delay_enabled);
+
+	// Input events during this slice only queued graphics work; apply the
+	// merged rebuild regions once, so paint latency stays independent of
+	// how many brush strokes arrived.
+	context_manager_->flush_deferred_rebuilds();
+}
+
 void editor_controller::status_table() {
 }
 
@@ -281,6 +291,8 @@ bool editor_controller::can_execute_command(const hotkey::hotkey_command& cmd, i
 		case HOTKEY_MOUSE_SCROLL:
 		case HOTKEY_ANIMATE_MAP:
 		case HOTKEY_MUTE:
+		case HOTKEY_PROFILER:
+		case HOTKEY_PROFILER_DUMP:
 		case HOTKEY_PREFERENCES:
 		case HOTKEY_HELP:
 		case HOTKEY_QUIT_GAME:
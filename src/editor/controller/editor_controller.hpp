@@ -87,6 +87,9 @@ class editor_controller : public controller_base,
 		/** Editor main loop */
 		EXIT_STATUS main_loop();
 
+		/** controller_base override; also applies deferred terrain rebuilds */
+		void play_slice(bool is_delay_enabled = true) override;
+
 		/** Takes a screenshot **/
 		void do_screenshot(const std::string& screenshot_filename = "map_screenshot.png");
 
@@ -78,6 +78,9 @@ context_manager::context_manager(editor_display& gui, const game_config_view& ga
 	, auto_update_transitions_(preferences::editor::auto_update_transitions())
 	, map_contexts_()
 	, clipboard_()
+	, pending_rebuild_locs_()
+	, pending_rebuild_all_(false)
+	, pending_minimap_(false)
 {
 	resources::filter_con = this;
 
@@ -122,6 +125,11 @@ void context_manager::refresh_on_context_change()
 
 void context_manager::refresh_all()
 {
+	// A full rebuild supersedes anything that was deferred.
+	pending_rebuild_locs_.clear();
+	pending_rebuild_all_ = false;
+	pending_minimap_ = false;
+
 	gui_.rebuild_all();
 	get_map_context().set_needs_terrain_rebuild(false);
 	gui_.create_buttons();
@@ -545,9 +553,15 @@ void context_manager::refresh_after_action(bool drag_part)
 		|| ((auto_update_transitions_ == preferences::editor::TRANSITION_UPDATE_PARTIAL)
 		&& (!drag_part || get_map_context().everything_changed())))
 		{
-			gui_.rebuild_all();
+			// Defer the rebuild; a drag stroke can trigger this once per
+			// mouse-motion event, and flush_deferred_rebuilds() merges the
+			// changed regions into a single rebuild per frame.
+			if(!get_map_context().everything_changed() && !changed_locs.empty()) {
+				pending_rebuild_locs_.insert(changed_locs.begin(), changed_locs.end());
+			} else {
+				pending_rebuild_all_ = true;
+			}
 			get_map_context().set_needs_terrain_rebuild(false);
-			gui_.invalidate_all();
 		} else {
 			for(const map_location& loc : changed_locs) {
 				gui_.rebuild_terrain(loc);
@@ -567,7 +581,25 @@ void context_manager::refresh_after_action(bool drag_part)
 	}
 
 	get_map_context().clear_changed_locations();
-	gui_.recalculate_minimap();
+	pending_minimap_ = true;
+}
+
+void context_manager::flush_deferred_rebuilds()
+{
+	if(pending_rebuild_all_) {
+		gui_.rebuild_all();
+		gui_.invalidate_all();
+	} else if(!pending_rebuild_locs_.empty()) {
+		gui_.rebuild_region(pending_rebuild_locs_);
+	}
+
+	pending_rebuild_all_ = false;
+	pending_rebuild_locs_.clear();
+
+	if(pending_minimap_) {
+		pending_minimap_ = false;
+		gui_.recalculate_minimap();
+	}
 }
 
 void context_manager::resize_map_dialog()
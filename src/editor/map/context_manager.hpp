@@ -75,6 +75,18 @@ public:
 	 */
 	void perform_refresh(const editor_action& action, bool drag_part = false);
 
+	/**
+	 * Performs the terrain-graphics rebuilds and minimap refresh that
+	 * refresh_after_action() deferred.
+	 *
+	 * Edits are applied to the map immediately, but re-matching the terrain
+	 * graphics around the changed hexes is expensive, so those rebuilds are
+	 * coalesced (as a union of changed regions) and paid once per editor
+	 * frame instead of once per input event. Called by the editor controller
+	 * at the end of each slice.
+	 */
+	void flush_deferred_rebuilds();
+
 	/**
 	 * Save all maps, open dialog if not named yet, except when using
 	 * auto_save_windows which will name unnamed maps "windows_N".
@@ -331,6 +343,15 @@ private:
 	/** The currently opened map context object */
 	std::vector<context_ptr> map_contexts_;
 
+	/** Changed hexes whose graphics rebuild is deferred; see flush_deferred_rebuilds(). */
+	std::set<map_location> pending_rebuild_locs_;
+
+	/** Whether a deferred full rebuild supersedes pending_rebuild_locs_. */
+	bool pending_rebuild_all_;
+
+	/** Whether a minimap refresh is owed for deferred edits. */
+	bool pending_minimap_;
+
 	/** Clipboard map_fragment -- used for copy-paste. */
 	map_fragment clipboard_;
 };
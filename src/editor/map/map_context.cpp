@@ -54,6 +54,7 @@ editor_team_info::editor_team_info(const team& t)
 }
 
 const std::size_t map_context::max_action_stack_size_ = 100;
+const std::size_t map_context::max_action_stack_memory_ = 32 * 1024 * 1024;
 
 map_context::map_context(const editor_map& map, bool pure_map, const config& schedule)
 	: filename_()
@@ -834,6 +835,25 @@ void map_context::trim_stack(action_stack& stack)
 	if(stack.size() > max_action_stack_size_) {
 		stack.pop_front();
 	}
+
+	// The count limit alone does not bound memory: actions that keep
+	// whole-map snapshots dominate on large maps. Drop the oldest actions
+	// once the stack's estimated footprint exceeds its budget, always
+	// keeping the most recent one.
+	std::size_t total = 0;
+	for(const auto& a : stack) {
+		if(a) {
+			total += a->memory_hint();
+		}
+	}
+
+	while(total > max_action_stack_memory_ && stack.size() > 1) {
+		if(stack.front()) {
+			total -= stack.front()->memory_hint();
+		}
+
+		stack.pop_front();
+	}
 }
 
 void map_context::perform_action_between_stacks(action_stack& from, action_stack& to)
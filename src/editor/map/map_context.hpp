@@ -464,6 +464,13 @@ protected:
 	 */
 	static const std::size_t max_action_stack_size_;
 
+	/**
+	 * Action stack estimated memory budget, in bytes. Whole-map undo
+	 * snapshots of large maps dwarf the action count limit, and each open
+	 * context keeps its own stacks, so their footprint is bounded too.
+	 */
+	static const std::size_t max_action_stack_memory_;
+
 	/**
 	 * Number of actions performed since the map was saved. Zero means the map was not modified.
 	 */
@@ -17,6 +17,7 @@
 
 #include "cursor.hpp"
 #include "desktop/clipboard.hpp"
+#include "frame_profiler.hpp"
 #include "log.hpp"
 #include "draw_manager.hpp"
 #include "quit_confirmation.hpp"
@@ -482,6 +483,9 @@ void pump()
 		return;
 	}
 
+	// Covers the handlers too; slow event handling shows up here.
+	frame_profiler::scope profile(frame_profiler::subsystem::events);
+
 	pump_info info;
 
 	// Used to keep track of double click events
@@ -524,6 +528,42 @@ void pump()
 		}
 	}
 
+	// When the queue has backed up behind a long operation (WML event
+	// execution, AI turns), dispatching every stale intermediate mouse
+	// position walks the full handler chain dozens of times for nothing.
+	// Coalesce each uninterrupted run of motion events into its newest
+	// member, summing the relative motion so the total movement survives.
+	// Wheel events coalesce the same way, so a scroll burst arrives as one
+	// big step instead of grinding through single notches.
+	//
+	// Note the handler-side SDL_PeepEvents() loops can't do this any more:
+	// by the time handlers run, the OS queue has already been drained into
+	// this vector.
+	for(auto it = events.begin(); it != events.end();) {
+		const auto next = std::next(it);
+		if(next == events.end()) {
+			break;
+		}
+
+		if(it->type == SDL_MOUSEMOTION && next->type == SDL_MOUSEMOTION
+			&& it->motion.which == next->motion.which
+			&& it->motion.state == next->motion.state)
+		{
+			next->motion.xrel += it->motion.xrel;
+			next->motion.yrel += it->motion.yrel;
+			it = events.erase(it);
+		} else if(it->type == SDL_MOUSEWHEEL && next->type == SDL_MOUSEWHEEL
+			&& it->wheel.which == next->wheel.which
+			&& it->wheel.direction == next->wheel.direction)
+		{
+			next->wheel.x += it->wheel.x;
+			next->wheel.y += it->wheel.y;
+			it = events.erase(it);
+		} else {
+			++it;
+		}
+	}
+
 	for(SDL_Event& event : events) {
 		for(context& c : event_contexts) {
 			c.add_staging_handlers();
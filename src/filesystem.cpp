@@ -52,8 +52,14 @@
 
 #endif /* !_WIN32 */
 
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
 #include <algorithm>
 #include <set>
+#include <unordered_set>
 
 // Copied from boost::predef, as it's there only since 1.55.
 #if defined(__APPLE__) && defined(__MACH__) && defined(__ENVIRONMENT_IPHONE_OS_VERSION_MIN_REQUIRED__)
@@ -1043,6 +1049,18 @@ bool delete_file(const std::string& filename)
 	return ret;
 }
 
+bool rename_file(const std::string& src, const std::string& dest)
+{
+	error_code ec;
+	bfs::rename(bfs::path(src), bfs::path(dest), ec);
+	if(ec) {
+		ERR_FS << "Could not rename file " << src << " to " << dest << ": " << ec.message();
+		return false;
+	}
+
+	return true;
+}
+
 std::string read_file(const std::string& fname)
 {
 	scoped_istream is = istream_file(fname);
@@ -1077,7 +1095,9 @@ filesystem::scoped_istream istream_file(const std::string& fname, bool treat_fai
 			return s;
 		}
 
-		return std::make_unique<boost::iostreams::stream<boost::iostreams::file_descriptor_source>>(fd, 4096, 0);
+		// 64KB reads: big enough that streaming a multi-megabyte save or cache
+		// file is not dominated by read() calls, still bounded.
+		return std::make_unique<boost::iostreams::stream<boost::iostreams::file_descriptor_source>>(fd, 64 * 1024, 0);
 	} catch(const std::exception&) {
 		if(treat_failure_as_error) {
 			ERR_FS << "Could not open '" << fname << "' for reading.";
@@ -1336,6 +1356,27 @@ std::set<std::string> binary_paths;
 typedef std::map<std::string, std::vector<std::string>> paths_map;
 paths_map binary_paths_cache;
 
+/**
+ * One-shot index of the files under each typed binary-path directory.
+ *
+ * get_binary_file_location() probes every binary path for every lookup, so
+ * an image-heavy add-on turns loading into tens of thousands of failed stat
+ * calls. Instead each typed directory ("images", "sounds", ...) is walked
+ * once and its relative file paths are kept in a hash set, making a probe a
+ * single hash lookup that never touches the OS. The index is dropped along
+ * with the binary-path cache, so add-on installs and config reloads see
+ * fresh content.
+ */
+std::map<std::string, std::unordered_set<std::string>> binary_file_index;
+
+/**
+ * The binary-path entries that are whole typed directories and therefore
+ * safe to index. The main-directory fallbacks at the end of each path list
+ * are not: walking all of the user data directory would cost more than the
+ * stats it saves.
+ */
+std::set<std::string> indexable_binary_paths;
+
 } // namespace
 
 static void init_binary_paths()
@@ -1385,6 +1426,8 @@ void binary_paths_manager::set_paths(const game_config_view& cfg)
 void binary_paths_manager::cleanup()
 {
 	binary_paths_cache.clear();
+	binary_file_index.clear();
+	indexable_binary_paths.clear();
 
 	for(const std::string& p : paths_) {
 		binary_paths.erase(p);
@@ -1394,6 +1437,8 @@ void binary_paths_manager::cleanup()
 void clear_binary_paths_cache()
 {
 	binary_paths_cache.clear();
+	binary_file_index.clear();
+	indexable_binary_paths.clear();
 }
 
 static bool is_legal_file(const std::string& filename_str)
@@ -1456,9 +1501,11 @@ const std::vector<std::string>& get_binary_paths(const std::string& type)
 
 	for(const std::string& path : binary_paths) {
 		res.push_back(get_user_data_dir() + "/" + path + type + "/");
+		indexable_binary_paths.insert(res.back());
 
 		if(!game_config::path.empty()) {
 			res.push_back(game_config::path + "/" + path + type + "/");
+			indexable_binary_paths.insert(res.back());
 		}
 	}
 
@@ -1472,6 +1519,32 @@ const std::vector<std::string>& get_binary_paths(const std::string& type)
 	return res;
 }
 
+/**
+ * Whether @a filename exists under the typed directory @a dir, per the
+ * index. The first probe of a directory walks and indexes it; a directory
+ * that doesn't exist simply yields an empty index.
+ */
+static bool indexed_file_exists(const std::string& dir, const std::string& filename)
+{
+	const auto [itor, fresh] = binary_file_index.try_emplace(dir);
+	std::unordered_set<std::string>& index = itor->second;
+
+	if(fresh) {
+		DBG_FS << "indexing binary path directory '" << dir << "'";
+
+		error_code ec;
+		for(bfs::recursive_directory_iterator i(dir, ec), end; i != end && !ec; i.increment(ec)) {
+			if(bfs::is_regular_file(i->status())) {
+				// Keyed the way lookups arrive: relative to dir, with
+				// generic separators.
+				index.insert(i->path().generic_string().substr(dir.size()));
+			}
+		}
+	}
+
+	return index.count(filename) != 0;
+}
+
 std::string get_binary_file_location(const std::string& type, const std::string& filename)
 {
 	// We define ".." as "remove everything before" this is needed because
@@ -1498,7 +1571,11 @@ std::string get_binary_file_location(const std::string& type, const std::string&
 
 		DBG_FS << "  checking '" << bp << "'";
 
-		if(file_exists(bpath)) {
+		const bool found = indexable_binary_paths.count(bp) != 0
+			? indexed_file_exists(bp, filename)
+			: file_exists(bpath);
+
+		if(found) {
 			DBG_FS << "  found at '" << bpath.string() << "'";
 			if(result.empty()) {
 				result = bpath.string();
@@ -1698,4 +1775,183 @@ std::string get_localized_path(const std::string& file, const std::string& suff)
 	return "";
 }
 
+/* ** change_tracker ** */
+
+/** Snapshot of every file under @a root: path -> (mtime, size). */
+static std::map<std::string, std::pair<std::time_t, std::size_t>> snapshot_tree(const std::string& root)
+{
+	std::map<std::string, std::pair<std::time_t, std::size_t>> res;
+
+	error_code ec;
+	for(bfs::recursive_directory_iterator i(root, ec), end; i != end && !ec; i.increment(ec)) {
+		if(!bfs::is_regular_file(i->status())) {
+			continue;
+		}
+
+		error_code stat_ec;
+		const std::time_t modified = bfs::last_write_time(i->path(), stat_ec);
+		if(stat_ec) {
+			continue;
+		}
+
+		const auto size = bfs::file_size(i->path(), stat_ec);
+		if(stat_ec) {
+			continue;
+		}
+
+		res.emplace(i->path().generic_string(),
+			std::pair(modified, static_cast<std::size_t>(size)));
+	}
+
+	return res;
+}
+
+#ifdef __linux__
+
+/** Puts an inotify watch on @a dir and, recursively, its subdirectories. */
+static void add_journal_watches(int fd, const std::string& dir, std::map<int, std::string>& watch_dirs)
+{
+	const int wd = inotify_add_watch(fd, dir.c_str(),
+		IN_CREATE | IN_DELETE | IN_CLOSE_WRITE | IN_MOVED_FROM | IN_MOVED_TO);
+	if(wd == -1) {
+		return;
+	}
+
+	watch_dirs[wd] = dir;
+
+	error_code ec;
+	for(bfs::directory_iterator i(dir, ec), end; i != end && !ec; i.increment(ec)) {
+		if(is_directory_internal(i->path())) {
+			add_journal_watches(fd, i->path().generic_string(), watch_dirs);
+		}
+	}
+}
+
+#endif
+
+change_tracker::change_tracker(const std::string& root)
+	: root_(root)
+	, snapshot_(snapshot_tree(root))
+	, journal_fd_(-1)
+	, watch_dirs_()
+{
+#ifdef __linux__
+	journal_fd_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+	if(journal_fd_ == -1) {
+		LOG_FS << "inotify unavailable, using snapshot diffing for '" << root_ << "'";
+		return;
+	}
+
+	add_journal_watches(journal_fd_, root_, watch_dirs_);
+
+	if(watch_dirs_.empty()) {
+		close(journal_fd_);
+		journal_fd_ = -1;
+	}
+#endif
+}
+
+change_tracker::~change_tracker()
+{
+#ifdef __linux__
+	if(journal_fd_ != -1) {
+		close(journal_fd_);
+	}
+#endif
+}
+
+void change_tracker::rescan(std::set<std::string>& changes)
+{
+	std::map<std::string, std::pair<std::time_t, std::size_t>> current = snapshot_tree(root_);
+
+	for(const auto& [path, stamp] : current) {
+		const auto old = snapshot_.find(path);
+		if(old == snapshot_.end() || old->second != stamp) {
+			changes.insert(path);
+		}
+	}
+
+	for(const auto& [path, stamp] : snapshot_) {
+		if(current.count(path) == 0) {
+			changes.insert(path);
+		}
+	}
+
+	snapshot_ = std::move(current);
+}
+
+std::set<std::string> change_tracker::poll_changes()
+{
+	std::set<std::string> changes;
+
+#ifdef __linux__
+	if(journal_fd_ != -1) {
+		bool overflowed = false;
+		alignas(inotify_event) char buf[4096];
+
+		for(;;) {
+			const ssize_t len = read(journal_fd_, buf, sizeof(buf));
+			if(len <= 0) {
+				break;
+			}
+
+			for(ssize_t off = 0; off < len;) {
+				const inotify_event* ev = reinterpret_cast<const inotify_event*>(buf + off);
+				off += sizeof(inotify_event) + ev->len;
+
+				if(ev->mask & IN_Q_OVERFLOW) {
+					overflowed = true;
+					continue;
+				}
+
+				const auto dir = watch_dirs_.find(ev->wd);
+				if(dir == watch_dirs_.end() || ev->len == 0) {
+					continue;
+				}
+
+				const std::string path = dir->second + "/" + ev->name;
+				changes.insert(path);
+
+				// A new directory needs its own watch, and anything already
+				// inside it predates that watch, so report it by hand.
+				if((ev->mask & IN_ISDIR) && (ev->mask & (IN_CREATE | IN_MOVED_TO))) {
+					add_journal_watches(journal_fd_, path, watch_dirs_);
+					for(const auto& [file, stamp] : snapshot_tree(path)) {
+						changes.insert(file);
+					}
+				}
+			}
+		}
+
+		if(!overflowed) {
+			// Keep the snapshot current so an overflow can fall back on it.
+			for(const std::string& path : changes) {
+				error_code ec;
+				const std::time_t modified = bfs::last_write_time(path, ec);
+				if(ec) {
+					snapshot_.erase(path);
+					continue;
+				}
+
+				const auto size = bfs::file_size(path, ec);
+				if(ec) {
+					snapshot_.erase(path);
+					continue;
+				}
+
+				snapshot_[path] = {modified, static_cast<std::size_t>(size)};
+			}
+
+			return changes;
+		}
+
+		LOG_FS << "inotify queue overflowed, rescanning '" << root_ << "'";
+		changes.clear();
+	}
+#endif
+
+	rescan(changes);
+	return changes;
+}
+
 } // namespace filesystem
@@ -23,8 +23,11 @@
 #include <ctime>
 #include <fstream>
 #include <iosfwd>
+#include <map>
 #include <memory>
+#include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "exceptions.hpp"
@@ -177,6 +180,8 @@ std::string get_exe_dir();
 bool make_directory(const std::string& dirname);
 bool delete_directory(const std::string& dirname, const bool keep_pbl = false);
 bool delete_file(const std::string& filename);
+/** Moves @a src to @a dest, replacing any existing file at @a dest. */
+bool rename_file(const std::string& src, const std::string& dest);
 
 bool looks_like_pbl(const std::string& file);
 
@@ -260,9 +265,60 @@ struct file_tree_checksum
 	{ return !operator==(rhs); }
 };
 
+/**
+ * Detects changes under a directory tree between polls.
+ *
+ * The constructor takes a snapshot of the tree; poll_changes() returns the
+ * files added, modified or removed since the previous poll. On Linux the
+ * changes come out of an inotify journal, so a poll costs one non-blocking
+ * read no matter how large the tree is; elsewhere (or when inotify is
+ * unavailable) each poll re-walks the tree and diffs it against the stored
+ * snapshot, which is still one walk instead of one per consumer.
+ */
+class change_tracker
+{
+public:
+	explicit change_tracker(const std::string& root);
+	~change_tracker();
+
+	change_tracker(const change_tracker&) = delete;
+	change_tracker& operator=(const change_tracker&) = delete;
+
+	/** Paths added, modified or removed since the last poll. */
+	std::set<std::string> poll_changes();
+
+	const std::string& root() const { return root_; }
+
+private:
+	/** Re-walks the tree, updating the snapshot and collecting changes. */
+	void rescan(std::set<std::string>& changes);
+
+	std::string root_;
+
+	/** File path -> (modification time, size) as of the last poll. */
+	std::map<std::string, std::pair<std::time_t, std::size_t>> snapshot_;
+
+	/** inotify descriptor, or -1 when using snapshot diffing. */
+	int journal_fd_;
+
+	/** inotify watch descriptor -> directory path. */
+	std::map<int, std::string> watch_dirs_;
+};
+
 /** Get the time at which the data/ tree was last modified at. */
 const file_tree_checksum& data_tree_checksum(bool reset = false);
 
+/**
+ * Get the time at which the data/ tree, excluding installed add-ons, was
+ * last modified at. Add-on subtrees are checksummed individually (see
+ * get_file_tree_checksum()), so a change inside one add-on does not
+ * invalidate caches built from the rest of the tree.
+ */
+const file_tree_checksum& non_addons_tree_checksum(bool reset = false);
+
+/** Calculates the checksum of the tree rooted at @a path. */
+file_tree_checksum get_file_tree_checksum(const std::string& path);
+
 /** Returns the size of a file, or -1 if the file doesn't exist. */
 int file_size(const std::string& fname);
 
@@ -268,4 +268,40 @@ const file_tree_checksum& data_tree_checksum(bool reset)
 	return checksum;
 }
 
+const file_tree_checksum& non_addons_tree_checksum(bool reset)
+{
+	static file_tree_checksum checksum;
+	if (reset)
+		checksum.reset();
+	if(checksum.nfiles == 0) {
+		get_file_tree_checksum_internal("data/",checksum);
+
+		// The user data tree, except installed add-ons: their subtrees are
+		// checksummed individually by the caches built from them.
+		const std::string user_data = get_user_data_dir() + "/data/";
+		std::vector<std::string> dirs;
+		get_files_in_dir(user_data, nullptr, &dirs, name_mode::ENTIRE_FILE_PATH,
+			filter_mode::SKIP_MEDIA_DIR, reorder_mode::DONT_REORDER, &checksum);
+
+		for(const std::string& dir : dirs) {
+			if(base_name(dir) != "add-ons") {
+				get_file_tree_checksum_internal(dir, checksum);
+			}
+		}
+
+		LOG_FS << "calculated non-add-ons tree checksum: "
+			   << checksum.nfiles << " files; "
+			   << checksum.sum_size << " bytes";
+	}
+
+	return checksum;
+}
+
+file_tree_checksum get_file_tree_checksum(const std::string& path)
+{
+	file_tree_checksum checksum;
+	get_file_tree_checksum_internal(path, checksum);
+	return checksum;
+}
+
 }
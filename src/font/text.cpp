@@ -39,7 +39,9 @@
 
 #include <cassert>
 #include <cstring>
+#include <list>
 #include <stdexcept>
+#include <unordered_map>
 
 static lg::log_domain log_font("font");
 #define DBG_FT LOG_STREAM(debug, log_font)
@@ -49,6 +51,63 @@ namespace font
 
 namespace
 {
+/**
+ * A bounded cache evicting its least-recently-used entry.
+ *
+ * Text is an easy way to accumulate unique entries (chat lines, damage
+ * numbers), so the caches below cap their size instead of growing for the
+ * lifetime of the process.
+ */
+template<typename Key, typename Value>
+class lru_cache
+{
+public:
+	explicit lru_cache(std::size_t max_size)
+		: max_size_(max_size)
+	{
+	}
+
+	/** Returns the entry for @a key and marks it as recently used, or nullptr. */
+	const Value* lookup(const Key& key)
+	{
+		const auto iter = index_.find(key);
+		if(iter == index_.end()) {
+			return nullptr;
+		}
+
+		items_.splice(items_.begin(), items_, iter->second);
+		return &iter->second->second;
+	}
+
+	const Value& insert(const Key& key, Value value)
+	{
+		if(const Value* present = lookup(key)) {
+			return *present;
+		}
+
+		items_.emplace_front(key, std::move(value));
+		index_[key] = items_.begin();
+
+		if(items_.size() > max_size_) {
+			index_.erase(items_.back().first);
+			items_.pop_back();
+		}
+
+		return items_.front().second;
+	}
+
+	void clear()
+	{
+		index_.clear();
+		items_.clear();
+	}
+
+private:
+	std::size_t max_size_;
+	std::list<std::pair<Key, Value>> items_;
+	std::unordered_map<Key, typename std::list<std::pair<Key, Value>>::iterator> index_;
+};
+
 /**
  * The text texture cache.
  *
@@ -59,12 +118,23 @@ namespace
  * @todo Figure out how this can be optimized with a texture atlas. It should be possible
  * to store smaller bits of text in the atlas and construct new textures from hem.
  */
-std::map<std::size_t, texture> rendered_cache{};
+lru_cache<std::size_t, texture> rendered_cache{256};
+
+/**
+ * Layout metrics for recently shaped text, keyed by pango_text::shaping_hash.
+ *
+ * gui2 widgets query text sizes over and over during layout negotiation,
+ * usually through the single shared pango_text instance, whose own layout
+ * state gets clobbered between widgets. Keeping the resulting extents here
+ * means repeated strings skip Pango shaping entirely.
+ */
+lru_cache<std::size_t, PangoRectangle> layout_metrics_cache{1024};
 } // anon namespace
 
 void flush_texture_cache()
 {
 	rendered_cache.clear();
+	layout_metrics_cache.clear();
 }
 
 pango_text::pango_text()
@@ -117,16 +187,29 @@ texture pango_text::render_and_get_texture()
 {
 	// Update our settings then hash them.
 	update_pixel_scale(); // TODO: this should be in recalculate()
-	recalculate();
+
+	// The settings hash includes the layout extents. For repeated text those
+	// can come from the metrics cache, sparing the shaping pass whenever the
+	// rendered texture is about to be a cache hit anyway. calculation_dirty_
+	// stays set on such a shortcut, since layout_ was never configured.
+	if(calculation_dirty_) {
+		if(const PangoRectangle* metrics = layout_metrics_cache.lookup(shaping_hash())) {
+			rect_ = *metrics;
+		} else {
+			recalculate();
+		}
+	}
+
 	const std::size_t hash = std::hash<pango_text>{}(*this);
 	// If we already have the appropriate texture in-cache, use it.
-	if(const auto iter = rendered_cache.find(hash); iter != rendered_cache.end()) {
-		return with_draw_scale(iter->second);
+	if(const texture* cached = rendered_cache.lookup(hash)) {
+		return with_draw_scale(*cached);
 	}
 
+	recalculate();
+
 	if(surface text_surf = create_surface(); text_surf) {
-		const auto& [new_iter, added] = rendered_cache.try_emplace(hash, std::move(text_surf));
-		return with_draw_scale(new_iter->second);
+		return with_draw_scale(rendered_cache.insert(hash, texture(std::move(text_surf))));
 	}
 
 	// Render output was null for some reason. Don't cache.
@@ -161,6 +244,16 @@ point pango_text::to_draw_scale(const point& p) const
 point pango_text::get_size()
 {
 	update_pixel_scale(); // TODO: this should be in recalculate()
+
+	if(calculation_dirty_) {
+		// Leave calculation_dirty_ set on a hit: layout_ hasn't been
+		// configured for this text yet, so a later render still needs the
+		// full recalculation.
+		if(const PangoRectangle* cached = layout_metrics_cache.lookup(shaping_hash())) {
+			return to_draw_scale({cached->width, cached->height});
+		}
+	}
+
 	this->recalculate();
 
 	return to_draw_scale({rect_.width, rect_.height});
@@ -576,9 +669,28 @@ void pango_text::recalculate() const
 
 		calculation_dirty_ = false;
 		rect_ = calculate_size(*layout_);
+		layout_metrics_cache.insert(shaping_hash(), rect_);
 	}
 }
 
+std::size_t pango_text::shaping_hash() const
+{
+	std::size_t hash = 0;
+
+	boost::hash_combine(hash, text_);
+	boost::hash_combine(hash, markedup_text_);
+	boost::hash_combine(hash, font_class_);
+	boost::hash_combine(hash, font_size_);
+	boost::hash_combine(hash, font_style_);
+	boost::hash_combine(hash, maximum_width_);
+	boost::hash_combine(hash, maximum_height_);
+	boost::hash_combine(hash, characters_per_line_);
+	boost::hash_combine(hash, ellipse_mode_);
+	boost::hash_combine(hash, alignment_);
+
+	return hash;
+}
+
 PangoRectangle pango_text::calculate_size(PangoLayout& layout) const
 {
 	PangoRectangle size;
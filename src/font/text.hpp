@@ -384,6 +384,15 @@ private:
 	/** Calculates surface size. */
 	PangoRectangle calculate_size(PangoLayout& layout) const;
 
+	/**
+	 * Hash of all the state that determines the shaped layout extents.
+	 *
+	 * Unlike std::hash<pango_text>, this excludes state that only affects the
+	 * rendered pixels (foreground color, outline), so it can key a cache of
+	 * layout metrics shared across widgets displaying the same string.
+	 */
+	std::size_t shaping_hash() const;
+
 	/** Allow specialization of std::hash for pango_text. */
 	friend struct std::hash<pango_text>;
 
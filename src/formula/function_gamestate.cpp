@@ -15,6 +15,7 @@
 
 #include "formula/function_gamestate.hpp"
 #include "formula/callable_objects.hpp"
+#include "formula/formula.hpp"
 
 #include "resources.hpp"
 #include "game_board.hpp"
@@ -26,6 +27,10 @@
 #include "tod_manager.hpp"
 #include "resources.hpp"
 
+#include <list>
+#include <map>
+#include <mutex>
+
 namespace wfl {
 
 namespace gamestate {
@@ -462,4 +467,42 @@ gamestate_function_symbol_table::gamestate_function_symbol_table(std::shared_ptr
 	DECLARE_WFL_FUNCTION(base_tod_bonus);
 }
 
+const_formula_ptr cached_gamestate_formula(const std::string& str)
+{
+	static std::mutex cache_mutex;
+	static std::list<std::string> cache_order;
+	static std::map<std::string, std::pair<std::list<std::string>::iterator, const_formula_ptr>> cache;
+	static const std::size_t cache_max_entries = 1024;
+
+	{
+		const std::lock_guard<std::mutex> lock(cache_mutex);
+		const auto found = cache.find(str);
+		if(found != cache.end()) {
+			cache_order.splice(cache_order.begin(), cache_order, found->second.first);
+			return found->second.second;
+		}
+	}
+
+	// Parse outside the lock; other threads may be parsing other sources.
+	static const std::shared_ptr<function_symbol_table> shared_table =
+		std::make_shared<gamestate_function_symbol_table>();
+	const auto parsed = std::make_shared<const formula>(str, shared_table.get());
+
+	const std::lock_guard<std::mutex> lock(cache_mutex);
+	const auto found = cache.find(str);
+	if(found != cache.end()) {
+		// Another thread won the parse race; keep its entry.
+		return found->second.second;
+	}
+
+	cache_order.push_front(str);
+	cache.emplace(str, std::pair(cache_order.begin(), parsed));
+	while(cache.size() > cache_max_entries) {
+		cache.erase(cache_order.back());
+		cache_order.pop_back();
+	}
+
+	return parsed;
+}
+
 }
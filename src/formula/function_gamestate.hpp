@@ -22,4 +22,17 @@ public:
 	gamestate_function_symbol_table(std::shared_ptr<function_symbol_table> parent = nullptr);
 };
 
+/**
+ * Returns a shared parsed formula for @a str, bound to a symbol table shared
+ * by all cached formulas. Since every gamestate_function_symbol_table built
+ * without a parent registers the same functions, formulas differing only in
+ * their table instance are interchangeable, and a parsed tree is immutable,
+ * so callers that evaluate the same source per unit per frame (ability
+ * values, weapon filters) skip re-tokenizing it every time. Thread-safe;
+ * the cache is bounded and drops the least recently requested entries.
+ *
+ * Throws formula_error like the formula constructor; errors are not cached.
+ */
+const_formula_ptr cached_gamestate_formula(const std::string& str);
+
 }
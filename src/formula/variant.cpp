@@ -36,8 +36,22 @@ static lg::log_domain log_scripting_formula("scripting/formula");
 namespace wfl
 {
 
-// Static value to initialize null variants to ensure its value is never nullptr.
-static value_base_ptr null_value(new variant_value_base);
+/**
+ * Materializes a value object for a variant stored inline, so the rare
+ * operations still routed through the virtual interface (string casts,
+ * serialization, debug output) need no dedicated numeric code paths here.
+ */
+static std::unique_ptr<variant_value_base> box_small_value(formula_variant::type type, int value)
+{
+	switch(type) {
+	case formula_variant::type::integer:
+		return std::make_unique<variant_int>(value);
+	case formula_variant::type::decimal:
+		return std::make_unique<variant_decimal>(value);
+	default:
+		return std::make_unique<variant_value_base>();
+	}
+}
 
 static std::string variant_type_to_string(formula_variant::type type)
 {
@@ -141,41 +155,50 @@ bool variant_iterator::operator!=(const variant_iterator& that) const
 
 
 variant::variant()
-	: value_(null_value)
+	: type_(formula_variant::type::null)
+	, small_value_(0)
+	, value_()
 {}
 
 variant::variant(int n)
-	: value_(std::make_shared<variant_int>(n))
-{
-	assert(value_.get());
-}
+	: type_(formula_variant::type::integer)
+	, small_value_(n)
+	, value_()
+{}
 
 variant::variant(int n, variant::DECIMAL_VARIANT_TYPE)
-	: value_(std::make_shared<variant_decimal>(n))
-{
-	assert(value_.get());
-}
+	: type_(formula_variant::type::decimal)
+	, small_value_(n)
+	, value_()
+{}
 
 variant::variant(double n, variant::DECIMAL_VARIANT_TYPE)
-	: value_(std::make_shared<variant_decimal>(n))
-{
-	assert(value_.get());
-}
+	: type_(formula_variant::type::decimal)
+	// A stack temporary, purely for its rounding logic.
+	, small_value_(variant_decimal(n).get_numeric_value())
+	, value_()
+{}
 
 variant::variant(const std::vector<variant>& vec)
-	: value_((std::make_shared<variant_list>(vec)))
+	: type_(formula_variant::type::list)
+	, small_value_(0)
+	, value_((std::make_shared<variant_list>(vec)))
 {
 	assert(value_.get());
 }
 
 variant::variant(const std::string& str)
-	: value_(std::make_shared<variant_string>(str))
+	: type_(formula_variant::type::string)
+	, small_value_(0)
+	, value_(std::make_shared<variant_string>(str))
 {
 	assert(value_.get());
 }
 
 variant::variant(const std::map<variant,variant>& map)
-	: value_((std::make_shared<variant_map>(map)))
+	: type_(formula_variant::type::map)
+	, small_value_(0)
+	, value_((std::make_shared<variant_map>(map)))
 {
 	assert(value_.get());
 }
@@ -254,17 +277,29 @@ variant variant::get_values() const
 
 variant_iterator variant::begin() const
 {
+	// Inline-stored values aren't iterable; match the no-op iterator pair
+	// variant_value_base::make_iterator produces.
+	if(!value_) {
+		return variant_iterator();
+	}
+
 	return value_->make_iterator().begin();
 }
 
 variant_iterator variant::end() const
 {
+	if(!value_) {
+		return variant_iterator();
+	}
+
 	return value_->make_iterator().end();
 }
 
 bool variant::is_empty() const
 {
-	return value_->is_empty();
+	// The numeric value classes never overrode variant_value_base::is_empty,
+	// so the inline types count as empty just as they always have.
+	return value_ ? value_->is_empty() : true;
 }
 
 std::size_t variant::num_elements() const
@@ -297,15 +332,15 @@ int variant::as_int() const
 	if(is_decimal()) { return as_decimal() / 1000; }
 
 	must_be(formula_variant::type::integer);
-	return value_cast<variant_int>()->get_numeric_value();
+	return small_value_;
 }
 
 int variant::as_decimal() const
 {
 	if(is_decimal()) {
-		return value_cast<variant_decimal>()->get_numeric_value();
+		return small_value_;
 	} else if(is_int()) {
-		return value_cast<variant_int>()->get_numeric_value() * 1000;
+		return small_value_ * 1000;
 	} else if(is_null()) {
 		return 0;
 	}
@@ -315,7 +350,7 @@ int variant::as_decimal() const
 
 bool variant::as_bool() const
 {
-	return value_->as_bool();
+	return value_ ? value_->as_bool() : small_value_ != 0;
 }
 
 const std::string& variant::as_string() const
@@ -496,6 +531,12 @@ bool variant::operator==(const variant& v) const
 		return false;
 	}
 
+	// Same type from here on, so either both sides are inline or neither is.
+	// Null compares equal to null, matching variant_value_base::equals.
+	if(!value_) {
+		return small_value_ == v.small_value_;
+	}
+
 	return value_->equals(*v.value_);
 }
 
@@ -518,6 +559,10 @@ bool variant::operator<(const variant& v) const
 		return type() < v.type();
 	}
 
+	if(!value_) {
+		return small_value_ < v.small_value_;
+	}
+
 	return value_->less_than(*v.value_);
 }
 
@@ -590,7 +635,7 @@ variant variant::build_range(const variant& v) const
 {
 	must_both_be(formula_variant::type::integer, v);
 
-	return value_cast<variant_int>()->build_range_variant(v.as_int());
+	return variant_int(small_value_).build_range_variant(v.as_int());
 }
 
 bool variant::contains(const variant& v) const
@@ -625,6 +670,10 @@ void variant::must_both_be(formula_variant::type t, const variant& second) const
 
 std::string variant::serialize_to_string() const
 {
+	if(!value_) {
+		return box_small_value(type_, small_value_)->get_serialized_string();
+	}
+
 	return value_->get_serialized_string();
 }
 
@@ -640,17 +689,29 @@ void variant::serialize_from_string(const std::string& str)
 
 std::string variant::string_cast() const
 {
+	if(!value_) {
+		return box_small_value(type_, small_value_)->string_cast();
+	}
+
 	return value_->string_cast();
 }
 
 std::string variant::to_debug_string(bool verbose, formula_seen_stack* seen) const
 {
+	const variant_value_base* value = value_.get();
+
+	std::unique_ptr<variant_value_base> boxed;
+	if(!value) {
+		boxed = box_small_value(type_, small_value_);
+		value = boxed.get();
+	}
+
 	if(!seen) {
 		formula_seen_stack seen_stack;
-		return value_->get_debug_string(seen_stack, verbose);
+		return value->get_debug_string(seen_stack, verbose);
 	}
 
-	return value_->get_debug_string(*seen, verbose);
+	return value->get_debug_string(*seen, verbose);
 }
 
 variant variant::execute_variant(const variant& var)
@@ -42,7 +42,9 @@ public:
 
 	template<typename T>
 	variant(std::shared_ptr<T> callable)
-		: value_(std::make_shared<variant_callable>(callable))
+		: type_(formula_variant::type::object)
+		, small_value_(0)
+		, value_(std::make_shared<variant_callable>(callable))
 	{
 		assert(value_.get());
 	}
@@ -165,12 +167,23 @@ private:
 
 	formula_variant::type type() const
 	{
-		return value_->get_type();
+		return type_;
 	}
 
+	/** Type of the stored value, kept inline so no allocation is needed to query it. */
+	formula_variant::type type_;
+
+	/**
+	 * Payload for the small types: the raw integer for integers and decimals,
+	 * zero for null. The remaining types store their value in @ref value_.
+	 */
+	int small_value_;
+
 	/**
-	 * Variant value.
-	 * Each of the constructors initialized this with the appropriate helper class.
+	 * Variant value for string, list, map and object variants.
+	 * Null, integer and decimal variants live entirely in @ref small_value_
+	 * and leave this empty, avoiding the allocation and refcount traffic the
+	 * numeric-heavy formula paths used to pay per temporary.
 	 */
 	value_base_ptr value_;
 };
@@ -0,0 +1,237 @@
+/*
+	Copyright (C) 2022
+	Part of the Battle for Wesnoth Project https://www.wesnoth.org/
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY.
+
+	See the COPYING file for more details.
+*/
+
+#include "frame_profiler.hpp"
+
+#include "filesystem.hpp"
+#include "floating_label.hpp"
+#include "font/standard_colors.hpp"
+#include "log.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
+static lg::log_domain log_display("display");
+#define LOG_DP LOG_STREAM(info, log_display)
+
+namespace frame_profiler
+{
+
+namespace
+{
+
+constexpr std::size_t num_subsystems = static_cast<std::size_t>(subsystem::count);
+
+/** Column names, in enum order. */
+constexpr std::array<const char*, num_subsystems> subsystem_names {
+	"terrain", "units", "halos", "gui2", "lua", "events", "pathfind", "combat"
+};
+
+/** One frame's wall times, in microseconds. */
+struct frame_record
+{
+	std::array<int64_t, num_subsystems> times{};
+	int64_t total = 0;
+};
+
+/**
+ * Frames kept for the dump; at 60 fps, about half a minute. Small enough
+ * to leave on during a whole session without anyone noticing.
+ */
+constexpr std::size_t history_size = 2000;
+
+/** The HUD is refreshed every so many frames, like the fps label. */
+constexpr int hud_refresh_frames = 10;
+
+bool active_ = false;
+
+/**
+ * The times being accumulated by scopes this frame. Atomic because
+ * instrumented code can also run on the loading screen's worker thread;
+ * the HUD and dump only read between frames on the main thread, so
+ * relaxed ordering is enough.
+ */
+std::array<std::atomic<int64_t>, num_subsystems> current_times_{};
+
+/** Ring buffer of completed records; the slot for frame n is n modulo size. */
+std::vector<frame_record> history_(history_size);
+
+/** Completed frames since the last dump; also the ring's write position. */
+std::size_t frames_recorded_ = 0;
+
+int64_t frame_started_ = 0;
+
+int frames_since_hud_refresh_ = 0;
+int hud_handle_ = 0;
+
+int64_t now_us()
+{
+	using namespace std::chrono;
+	return duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+/** The per-subsystem averages and peaks over the most recent frames. */
+std::string report()
+{
+	// Short enough for the HUD to track changes, long enough to be stable.
+	const std::size_t sample = std::min<std::size_t>(30, std::min(frames_recorded_, history_size));
+	if(sample == 0) {
+		return "<tt>profiling...</tt>";
+	}
+
+	frame_record sums;
+	frame_record peaks;
+	for(std::size_t i = frames_recorded_ - sample; i != frames_recorded_; ++i) {
+		const frame_record& rec = history_[i % history_size];
+		for(std::size_t s = 0; s != num_subsystems; ++s) {
+			sums.times[s] += rec.times[s];
+			peaks.times[s] = std::max(peaks.times[s], rec.times[s]);
+		}
+		sums.total += rec.total;
+		peaks.total = std::max(peaks.total, rec.total);
+	}
+
+	std::ostringstream out;
+	out << "<tt>         avg ms  peak</tt>\n" << std::fixed << std::setprecision(1);
+	for(std::size_t s = 0; s != num_subsystems; ++s) {
+		out << "<tt>" << std::left << std::setw(8) << subsystem_names[s] << std::right
+			<< std::setw(6) << sums.times[s] / 1000.0 / sample
+			<< std::setw(6) << peaks.times[s] / 1000.0 << "</tt>\n";
+	}
+	out << "<tt>" << std::left << std::setw(8) << "frame" << std::right
+		<< std::setw(6) << sums.total / 1000.0 / sample
+		<< std::setw(6) << peaks.total / 1000.0 << "</tt>\n";
+
+	return out.str();
+}
+
+void clear_hud()
+{
+	if(hud_handle_ != 0) {
+		font::remove_floating_label(hud_handle_);
+		hud_handle_ = 0;
+	}
+}
+
+} // anonymous namespace
+
+bool active()
+{
+	return active_;
+}
+
+void toggle()
+{
+	active_ = !active_;
+	if(active_) {
+		for(auto& t : current_times_) {
+			t.store(0, std::memory_order_relaxed);
+		}
+		frame_started_ = now_us();
+		frames_since_hud_refresh_ = 0;
+	} else {
+		// Keep the buffered records, so data from a stutter can still be
+		// dumped after switching the overlay off.
+		clear_hud();
+	}
+}
+
+void next_frame()
+{
+	if(!active_) {
+		return;
+	}
+
+	const int64_t now = now_us();
+	frame_record rec;
+	for(std::size_t s = 0; s != num_subsystems; ++s) {
+		rec.times[s] = current_times_[s].exchange(0, std::memory_order_relaxed);
+	}
+	rec.total = now - frame_started_;
+	history_[frames_recorded_ % history_size] = rec;
+	++frames_recorded_;
+
+	frame_started_ = now;
+}
+
+void update_hud()
+{
+	if(!active_) {
+		return;
+	}
+
+	if(++frames_since_hud_refresh_ < hud_refresh_frames) {
+		return;
+	}
+	frames_since_hud_refresh_ = 0;
+
+	clear_hud();
+
+	font::floating_label flabel(report());
+	flabel.set_font_size(12);
+	flabel.set_color(font::NORMAL_COLOR);
+	// Below the fps label, which sits at y = 100.
+	flabel.set_position(10, 160);
+	flabel.set_alignment(font::LEFT_ALIGN);
+
+	hud_handle_ = font::add_floating_label(flabel);
+}
+
+std::string dump()
+{
+	const std::string filename = filesystem::get_user_data_dir() + "/profile_log.csv";
+	const bool fresh = !filesystem::file_exists(filename);
+
+	filesystem::scoped_ostream log = filesystem::ostream_file(filename, std::ios_base::binary | std::ios_base::app);
+	if(fresh) {
+		*log << "frame_us";
+		for(const char* name : subsystem_names) {
+			*log << ',' << name << "_us";
+		}
+		*log << '\n';
+	}
+
+	const std::size_t filled = std::min(frames_recorded_, history_size);
+	for(std::size_t i = frames_recorded_ - filled; i != frames_recorded_; ++i) {
+		const frame_record& rec = history_[i % history_size];
+		*log << rec.total;
+		for(const int64_t t : rec.times) {
+			*log << ',' << t;
+		}
+		*log << '\n';
+	}
+	frames_recorded_ = 0;
+
+	LOG_DP << "dumped " << filled << " profiled frames to " << filename;
+	return filename;
+}
+
+scope::scope(subsystem s)
+	: subsystem_(s)
+	, started_(active_ ? now_us() : 0)
+{
+}
+
+scope::~scope()
+{
+	if(started_ != 0) {
+		current_times_[static_cast<std::size_t>(subsystem_)].fetch_add(now_us() - started_, std::memory_order_relaxed);
+	}
+}
+
+} // namespace frame_profiler
@@ -0,0 +1,103 @@
+/*
+	Copyright (C) 2022
+	Part of the Battle for Wesnoth Project https://www.wesnoth.org/
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY.
+
+	See the COPYING file for more details.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+/**
+ * @file
+ * A sampling frame profiler.
+ *
+ * Subsystems mark their work with frame_profiler::scope — mostly on the
+ * draw path, but also hot game logic like pathfinding whose cost shows up
+ * as frame hitches; the draw manager closes one record per frame. While active, recent
+ * per-subsystem times are shown in a HUD overlay, and every record is kept
+ * in a ring buffer that can be dumped to a CSV file in the user data
+ * directory, so reports about scenarios that "chug" can come with numbers
+ * attached. When inactive, scopes cost a single branch.
+ */
+namespace frame_profiler
+{
+
+/** Subsystems whose per-frame cost is tracked separately. */
+enum class subsystem : std::size_t {
+	/** Terrain rendering, including the drawing buffer commit. */
+	terrain,
+	/** The unit drawer, for both real and fake units. */
+	units,
+	/** Halo rendering. */
+	halo,
+	/** GUI2 window drawing. */
+	gui,
+	/** Lua calls routed through a kernel. */
+	lua,
+	/** The SDL event pump, including everything handlers do. */
+	events,
+	/** Movement and vision route finding, including batch worker threads. */
+	pathfinding,
+	/** Combat outcome prediction. */
+	combat,
+	/** Number of subsystems. Keep this last! */
+	count
+};
+
+/** Whether scopes currently record anything and the HUD is shown. */
+bool active();
+
+/** Turns the profiler and its HUD on or off. Buffered records are kept. */
+void toggle();
+
+/**
+ * Closes the current frame's record and starts the next one.
+ * The draw manager calls this once per frame.
+ */
+void next_frame();
+
+/**
+ * Refreshes the HUD overlay, a few frames apart. Called from the display's
+ * draw routine, where adding floating labels is known to be safe.
+ */
+void update_hud();
+
+/**
+ * Appends all buffered frame records to profile_log.csv in the user data
+ * directory and clears the buffer.
+ *
+ * @returns the path of the log file.
+ */
+std::string dump();
+
+/**
+ * Adds the wall time between construction and destruction to the current
+ * frame's total for one subsystem. Constructing one while the profiler is
+ * inactive is free, so scopes can stay in place permanently.
+ */
+class scope
+{
+public:
+	explicit scope(subsystem s);
+	~scope();
+
+	scope(const scope&) = delete;
+	scope& operator=(const scope&) = delete;
+
+private:
+	subsystem subsystem_;
+	/** Start time in microseconds, or 0 when the profiler was inactive. */
+	int64_t started_;
+};
+
+} // namespace frame_profiler
@@ -15,6 +15,7 @@
 
 #include "game_board.hpp"
 #include "config.hpp"
+#include "game_events/pump.hpp"
 #include "log.hpp"
 #include "map/map.hpp"
 #include "preferences/game.hpp"
@@ -39,6 +40,8 @@ game_board::game_board(const config& level)
 	, map_(std::make_unique<gamemap>(level["map_data"]))
 	, unit_id_manager_(level["next_underlying_unit_id"])
 	, units_()
+	, unit_placement_batch_(0)
+	, deferred_unit_placed_()
 {
 }
 
@@ -48,6 +51,8 @@ game_board::game_board(const game_board& other)
 	, map_(new gamemap(*(other.map_)))
 	, unit_id_manager_(other.unit_id_manager_)
 	, units_(other.units_)
+	, unit_placement_batch_(0)
+	, deferred_unit_placed_()
 {
 }
 
@@ -66,6 +71,35 @@ void swap(game_board& one, game_board& other)
 	one.map_.swap(other.map_);
 }
 
+unit_placement_batch::unit_placement_batch(game_board& board, game_events::wml_event_pump& pump)
+	: board_(board)
+	, pump_(pump)
+{
+	++board_.unit_placement_batch_;
+}
+
+unit_placement_batch::~unit_placement_batch()
+{
+	--board_.unit_placement_batch_;
+	if(board_.unit_placement_batch_ == 0) {
+		board_.deferred_unit_placed_.clear();
+	}
+}
+
+void unit_placement_batch::commit()
+{
+	if(board_.unit_placement_batch_ != 1 || board_.deferred_unit_placed_.empty()) {
+		return;
+	}
+
+	for(const map_location& loc : board_.deferred_unit_placed_) {
+		pump_.raise("unit_placed", loc);
+	}
+	board_.deferred_unit_placed_.clear();
+
+	pump_();
+}
+
 void game_board::new_turn(int player_num)
 {
 	for(unit& i : units_) {
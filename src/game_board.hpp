@@ -35,6 +35,10 @@ namespace events {
 	class menu_handler;
 }
 
+namespace game_events {
+	class wml_event_pump;
+}
+
 /**
  *
  * Game board class.
@@ -58,6 +62,11 @@ class game_board : public display_context
 	n_unit::id_manager unit_id_manager_;
 	unit_map units_;
 
+	/** Nesting depth of open unit placement batches; see unit_placement_batch. */
+	int unit_placement_batch_;
+	/** Locations whose unit_placed events were deferred by an open batch. */
+	std::vector<map_location> deferred_unit_placed_;
+
 	/**
 	 * Temporary unit move structs:
 	 *
@@ -75,6 +84,7 @@ class game_board : public display_context
 	friend struct temporary_unit_placer;
 	friend struct temporary_unit_mover;
 	friend struct temporary_unit_remover;
+	friend struct unit_placement_batch;
 
 public:
 	n_unit::id_manager& unit_id_manager() { return unit_id_manager_; }
@@ -156,6 +166,14 @@ public:
 	void side_drop_to (int side_num, side_controller::type ctrl, side_proxy_controller::type proxy = side_proxy_controller::type::human);
 	void side_change_controller (int side_num, bool is_local, const std::string& pname, const std::string& controller_type);
 
+	// Batched unit placement, used by spawners; see unit_placement_batch
+
+	/** Whether a unit placement batch is currently open. */
+	bool in_unit_placement_batch() const { return unit_placement_batch_ != 0; }
+
+	/** Queues a unit_placed event to be fired when the open batch commits. */
+	void defer_unit_placed_event(const map_location& loc) { deferred_unit_placed_.push_back(loc); }
+
 	// Manipulator from actionwml
 
 	bool try_add_unit_to_recall_list(const map_location& loc, const unit_ptr u);
@@ -183,6 +201,28 @@ public:
 void swap(game_board & one, game_board & other);
 
 
+/**
+ * Opens a unit placement batch on the board for this object's lifetime.
+ * While a batch is open, spawners queue their unit_placed events on the board
+ * instead of firing (and pumping) them one unit at a time; commit() raises all
+ * queued events and runs the pump once. The destructor closes the batch and
+ * discards anything left uncommitted, so an exception thrown mid-batch does
+ * not fire events during unwinding. Batches may nest; only the outermost
+ * commit() pumps.
+ */
+struct unit_placement_batch
+{
+	unit_placement_batch(game_board& board, game_events::wml_event_pump& pump);
+	~unit_placement_batch();
+
+	void commit();
+
+private:
+	game_board& board_;
+	game_events::wml_event_pump& pump_;
+};
+
+
 /**
  * This object is used to temporary place a unit in the unit map, swapping out
  * any unit that is already there.  On destruction, it restores the unit map to
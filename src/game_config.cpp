@@ -165,6 +165,10 @@ std::map<std::string, t_string> team_rgb_name;
 
 std::map<std::string, std::vector<color_t>> team_rgb_colors;
 
+// Recoloring tables computed from the maps above, built on first use per
+// (range, palette) pair and kept until the color info is reset.
+static std::map<std::pair<color_range, std::string>, color_range_map> team_rgb_recolor_tables;
+
 std::vector<std::string> default_colors;
 
 namespace colors
@@ -513,6 +517,7 @@ void reset_color_info()
 	team_rgb_colors.clear();
 	team_rgb_name.clear();
 	team_rgb_range.clear();
+	team_rgb_recolor_tables.clear();
 }
 
 const color_range& color_info(const std::string& name)
@@ -557,6 +562,18 @@ const std::vector<color_t>& tc_info(const std::string& name)
 	return tc_info(name);
 }
 
+const color_range_map& recolor_range_table(const color_range& new_range, const std::string& palette_name)
+{
+	const auto key = std::make_pair(new_range, palette_name);
+
+	auto i = team_rgb_recolor_tables.find(key);
+	if(i != team_rgb_recolor_tables.end()) {
+		return i->second;
+	}
+
+	return team_rgb_recolor_tables.emplace(key, recolor_range(new_range, tc_info(palette_name))).first->second;
+}
+
 color_t red_to_green(double val, bool for_text)
 {
 	const std::vector<color_t>& color_scale = for_text ? red_green_scale_text : red_green_scale;
@@ -25,6 +25,7 @@ class color_range;
 #include <vector>
 #include <map>
 #include <cstdint>
+#include <unordered_map>
 
 //basic game configuration information is here.
 namespace game_config
@@ -201,6 +202,13 @@ namespace game_config
 	const std::vector<color_t>& tc_info(const std::string& name);
 	const color_range& color_info(const std::string& name);
 
+	/**
+	 * Returns the table mapping the palette named @a palette_name onto
+	 * @a new_range, as produced by recolor_range(). Each table is computed
+	 * on first use, then shared read-only until reset_color_info().
+	 */
+	const std::unordered_map<color_t, color_t>& recolor_range_table(const color_range& new_range, const std::string& palette_name);
+
 	/**
 	 * Return a color corresponding to the value val
 	 * red for val=0.0 to green for val=100.0, passing by yellow.
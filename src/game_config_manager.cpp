@@ -43,6 +43,8 @@
 #include "theme.hpp"
 #include "units/types.hpp"
 
+#include <future>
+
 static lg::log_domain log_config("config");
 #define ERR_CONFIG LOG_STREAM(err, log_config)
 #define WRN_CONFIG LOG_STREAM(warn, log_config)
@@ -204,18 +206,20 @@ void game_config_manager::load_game_config(bool reload_everything, const game_cl
 		// Load every compatible addon.
 		if(reload_everything) {
 			gui2::dialogs::loading_screen::progress(loading_stage::verify_cache);
-			filesystem::data_tree_checksum();
-			gui2::dialogs::loading_screen::progress(loading_stage::create_cache);
+
+			// The checksum scans only walk the filesystem, so overlap them
+			// with the startup work below. The first cache read is what needs
+			// them, and it waits on the future.
+			auto checksum_scan = std::async(std::launch::async, []() {
+				filesystem::data_tree_checksum();
+				filesystem::non_addons_tree_checksum();
+			});
 
 			// Start transaction so macros are shared.
 			game_config::config_cache_transaction main_transaction;
 			achievements_.reload();
 
-			// Load mainline cores definition file.
-			config cores_cfg;
-			cache_.get_config(game_config::path + "/data/cores.cfg", cores_cfg);
-
-			// Append the $user_campaign_dir/*/cores.cfg files to the cores.
+			// Scan for the $user_campaign_dir/*/cores.cfg files appended below.
 			std::vector<std::string> user_dirs;
 			{
 				const std::string user_campaign_dir = filesystem::get_addons_dir();
@@ -224,6 +228,13 @@ void game_config_manager::load_game_config(bool reload_everything, const game_cl
 					user_campaign_dir, &user_files, &user_dirs, filesystem::name_mode::ENTIRE_FILE_PATH);
 			}
 
+			checksum_scan.get();
+			gui2::dialogs::loading_screen::progress(loading_stage::create_cache);
+
+			// Load mainline cores definition file.
+			config cores_cfg;
+			cache_.get_config(game_config::path + "/data/cores.cfg", cores_cfg);
+
 			for(const std::string& umc : user_dirs) {
 				const std::string cores_file = umc + "/cores.cfg";
 				if(filesystem::file_exists(cores_file)) {
@@ -667,6 +678,27 @@ void game_config_manager::set_unit_data()
 
 void game_config_manager::reload_changed_game_config()
 {
+	// The first reload sets the journals up; everything needs reloading
+	// then anyway, since there is no record of what changed before.
+	const bool journals_ready = data_tracker_ && user_data_tracker_;
+	if(!journals_ready) {
+		data_tracker_ = std::make_unique<filesystem::change_tracker>(game_config::path + "/data");
+		user_data_tracker_ = std::make_unique<filesystem::change_tracker>(filesystem::get_user_data_dir());
+	}
+
+	std::set<std::string> changed = data_tracker_->poll_changes();
+	changed.merge(user_data_tracker_->poll_changes());
+
+	if(journals_ready && changed.empty()) {
+		LOG_CONFIG << "reload: no filesystem changes, keeping the loaded config";
+		return;
+	}
+
+	const auto changed_under = [&changed](const std::string& dir) {
+		return std::any_of(changed.begin(), changed.end(),
+			[&dir](const std::string& path) { return path.find(dir) != std::string::npos; });
+	};
+
 	// Rebuild addon version info cache.
 	refresh_addon_version_info_cache();
 
@@ -676,8 +708,15 @@ void game_config_manager::reload_changed_game_config()
 	filesystem::clear_binary_paths_cache();
 	init_game_config(FORCE_RELOAD);
 
-	image::flush_cache();
-	sound::flush_cache();
+	// The media caches only need dropping when media actually changed;
+	// WML-only edits keep every decoded image and sound.
+	if(!journals_ready || changed_under("/images/")) {
+		image::flush_cache();
+	}
+
+	if(!journals_ready || changed_under("/sounds/") || changed_under("/music/")) {
+		sound::flush_cache();
+	}
 }
 
 void game_config_manager::load_game_config_for_editor()
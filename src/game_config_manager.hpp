@@ -84,6 +84,13 @@ private:
 
 	filesystem::binary_paths_manager paths_manager_;
 
+	/**
+	 * Change journals over the main data tree and the user data directory,
+	 * set up by the first reload so later reloads only touch what changed.
+	 */
+	std::unique_ptr<filesystem::change_tracker> data_tracker_;
+	std::unique_ptr<filesystem::change_tracker> user_data_tracker_;
+
 	game_config::config_cache& cache_;
 
 	std::shared_ptr<terrain_type_data> tdata_;
@@ -127,6 +127,27 @@ void game_data::clear_variable(const std::string& varname)
 	}
 }
 
+const variable_path* game_data::lookup_variable_path(const std::string& varname) const
+{
+	// Interpolated indices make names like 'store[123].x' effectively unbounded
+	// over a long session, so don't let the cache grow without limit.
+	if(path_cache_.size() >= 4096) {
+		path_cache_.clear();
+	}
+
+	auto [iter, inserted] = path_cache_.try_emplace(varname);
+	if(inserted) {
+		try {
+			iter->second = parse_variable_path(varname);
+		} catch(const invalid_variablename_exception&) {
+			path_cache_.erase(iter);
+			return nullptr;
+		}
+	}
+
+	return &iter->second;
+}
+
 void game_data::write_snapshot(config& cfg) const
 {
 	write_phase(cfg, phase_);
@@ -21,6 +21,8 @@
 #include "mt_rng.hpp"
 #include "variable_info.hpp"
 
+#include <unordered_map>
+
 class scoped_wml_variable;
 class t_string;
 
@@ -46,12 +48,18 @@ public:
 	variable_access_const get_variable_access_read(const std::string& varname) const
 	{
 		activate_scope_variable(varname);
+		if(const variable_path* path = lookup_variable_path(varname)) {
+			return variable_access_const(varname, *path, variables_);
+		}
 		return variable_access_const(varname, variables_);
 	}
 	/** returns a variable_access that can be used to change the game variables */
 	variable_access_create get_variable_access_write(const std::string& varname)
 	{
 		activate_scope_variable(varname);
+		if(const variable_path* path = lookup_variable_path(varname)) {
+			return variable_access_create(varname, *path, variables_);
+		}
 		return variable_access_create(varname, variables_);
 	}
 	/**
@@ -151,9 +159,20 @@ private:
 	variable_access_throw get_variable_access_throw(const std::string& varname)
 	{
 		activate_scope_variable(varname);
+		if(const variable_path* path = lookup_variable_path(varname)) {
+			return variable_access_throw(varname, *path, variables_);
+		}
 		return variable_access_throw(varname, variables_);
 	}
 
+	/**
+	 * Returns the tokenized form of @a varname, parsing and caching it on first
+	 * use so that repeated accesses in event loops skip the string splitting.
+	 * Returns nullptr for malformed names; those are rediagnosed by the plain
+	 * variable_info constructor, which marks the access invalid without throwing.
+	 */
+	const variable_path* lookup_variable_path(const std::string& varname) const;
+
 	randomness::mt_rng rng_;
 	config variables_;
 	PHASE phase_;
@@ -167,4 +186,6 @@ private:
 	std::string theme_;
 	std::vector<std::string> defeat_music_;
 	std::vector<std::string> victory_music_;
+	/** Memoized tokenizations of variable names, see lookup_variable_path. */
+	mutable std::unordered_map<std::string, variable_path> path_cache_;
 };
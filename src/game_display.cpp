@@ -28,6 +28,7 @@
 #include "fake_unit_manager.hpp"
 #include "fake_unit_ptr.hpp"
 #include "floating_label.hpp"
+#include "frame_profiler.hpp"
 #include "game_board.hpp"
 #include "preferences/game.hpp"
 #include "halo.hpp"
@@ -81,6 +82,7 @@ game_display::game_display(game_board& board,
 	, chat_man_(new display_chat_manager(*this))
 	, mode_(RUNNING)
 	, needs_rebuild_(false)
+	, rebuild_locations_()
 {
 }
 
@@ -213,9 +215,11 @@ void game_display::draw_invalidated()
 	for (const unit* temp_unit : *fake_unit_man_) {
 		const map_location& loc = temp_unit->get_location();
 		exclusive_unit_draw_requests_t::iterator request = exclusive_unit_draw_requests_.find(loc);
-		if (invalidated_.find(loc) != invalidated_.end()
-				&& (request == exclusive_unit_draw_requests_.end() || request->second == temp_unit->id()))
+		if (invalidated_.contains(loc)
+				&& (request == exclusive_unit_draw_requests_.end() || request->second == temp_unit->id())) {
+			frame_profiler::scope profile(frame_profiler::subsystem::units);
 			drawer.redraw_unit(*temp_unit);
+		}
 	}
 }
 
@@ -366,10 +370,15 @@ void game_display::layout()
 	{
 		wb::future_map future; // start planned unit map scope
 
+		// One shared context for the whole rebuild, so inputs common to
+		// many reports (the displayed unit, the illuminated time of day)
+		// are resolved once rather than once per report.
+		reports::context ctx = create_reports_context();
+
 		// We display the unit the mouse is over if it is over a unit,
 		// otherwise we display the unit that is selected.
 		for (const std::string &name : reports_object_->report_list()) {
-			refresh_report(name);
+			refresh_report(name, ctx);
 		}
 		invalidateGameStatus_ = false;
 	}
@@ -657,14 +666,27 @@ void game_display::needs_rebuild(bool b) {
 	}
 }
 
+void game_display::needs_rebuild(const map_location& loc) {
+	if (!needs_rebuild_) {
+		rebuild_locations_.insert(loc);
+	}
+}
+
 bool game_display::maybe_rebuild() {
 	if (needs_rebuild_) {
 		needs_rebuild_ = false;
+		rebuild_locations_.clear();
 		recalculate_minimap();
 		invalidate_all();
 		rebuild_all();
 		return true;
 	}
+	if (!rebuild_locations_.empty()) {
+		rebuild_region(rebuild_locations_);
+		rebuild_locations_.clear();
+		recalculate_minimap();
+		return true;
+	}
 	return false;
 }
 
@@ -226,7 +226,13 @@ public:
 	/** Sets whether the screen (map visuals) needs to be rebuilt. This is typically after the map has been changed by wml. */
 	void needs_rebuild(bool b);
 
-	/** Rebuilds the screen if needs_rebuild(true) was previously called, and resets the flag. */
+	/**
+	 * Records that the terrain at the given location has been changed by
+	 * wml, so the next maybe_rebuild() only needs to rebuild around it.
+	 */
+	void needs_rebuild(const map_location& loc);
+
+	/** Rebuilds the screen if needs_rebuild() was previously called, and resets the flag. */
 	bool maybe_rebuild();
 
 private:
@@ -256,4 +262,10 @@ private:
 
 	bool needs_rebuild_;
 
+	/**
+	 * The locations changed since the last rebuild, when a full one
+	 * hasn't been requested. See needs_rebuild(const map_location&).
+	 */
+	std::set<map_location> rebuild_locations_;
+
 };
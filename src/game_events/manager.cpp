@@ -201,37 +201,64 @@ void manager::execute_on_events(const std::string& event_id, manager::event_func
 {
 	const std::string standardized_event_id = event_handlers::standardize_name(event_id);
 	const game_data* gd = resources::gamedata;
-	auto& active_handlers = event_handlers_->get_active();
-
-	// Save the end outside the loop so the end point remains constant,
-	// even if new events are added to the queue.
-	const unsigned saved_end = active_handlers.size();
-
 
 	{
 		// Ensure that event handlers won't be cleaned up while we're iterating them.
 		event_handler_list_lock lock;
 
-		for (unsigned i = 0; i < saved_end; ++i) {
-			handler_ptr handler = nullptr;
+		if(event_handlers_->get_dynamic().empty()) {
+			// No handler has a variable in its name, so the only handlers that can
+			// match are the ones filed under this exact name. The by-name index
+			// hands us those directly instead of a scan over every active handler.
+			handler_list& matching = event_handlers_->get(standardized_event_id);
 
-			try {
-				handler = active_handlers.at(i);
-			}
-			catch (const std::out_of_range&) {
-				continue;
-			}
+			// Save the end outside the loop so the end point remains constant,
+			// even if new events are added to the queue.
+			const std::size_t saved_end = matching.size();
 
-			// Shouldn't happen, but we're just being safe.
-			if (!handler || handler->disabled()) {
-				continue;
+			std::size_t i = 0;
+			for(auto iter = matching.begin(); iter != matching.end() && i < saved_end; ++iter, ++i) {
+				handler_ptr handler = iter->lock();
+
+				// Removed handlers stay in the index until the next cleanup pass.
+				if(!handler || handler->disabled()) {
+					continue;
+				}
+
+				func(*this, handler);
 			}
+		} else {
+			// A handler with a variable in its name can match any event id once the
+			// variable is substituted, and the substitution can change between fires.
+			// Relative firing order between such handlers and ordinary ones must be
+			// preserved, so scan the full list in registration order as before.
+			auto& active_handlers = event_handlers_->get_active();
+
+			// Save the end outside the loop so the end point remains constant,
+			// even if new events are added to the queue.
+			const unsigned saved_end = active_handlers.size();
+
+			for (unsigned i = 0; i < saved_end; ++i) {
+				handler_ptr handler = nullptr;
+
+				try {
+					handler = active_handlers.at(i);
+				}
+				catch (const std::out_of_range&) {
+					continue;
+				}
+
+				// Shouldn't happen, but we're just being safe.
+				if (!handler || handler->disabled()) {
+					continue;
+				}
 
-			// Could be more than one.
-			for(const std::string& name : handler->names(gd)) {
-				if(standardized_event_id == name) {
-					func(*this, handler);
-					break;
+				// Could be more than one.
+				for(const std::string& name : handler->names(gd)) {
+					if(standardized_event_id == name) {
+						func(*this, handler);
+						break;
+					}
 				}
 			}
 		}
@@ -93,6 +93,8 @@ struct pump_impl
 
 	unsigned instance_count;
 
+	unsigned long long processed_count;
+
 	manager* my_manager;
 
 	pump_impl(manager& man)
@@ -100,6 +102,7 @@ struct pump_impl
 		, wml_messages_stream()
 		, contexts_()
 		, instance_count(0)
+		, processed_count(0)
 		, my_manager(&man)
 	{
 		contexts_.emplace(false);
@@ -211,6 +214,8 @@ void wml_event_pump::process_event(handler_ptr& handler_p, const queued_event& e
 	scoped_weapon_info first_weapon("weapon", ev.data.optional_child("first"));
 	scoped_weapon_info second_weapon("second_weapon", ev.data.optional_child("second"));
 
+	++impl_->processed_count;
+
 	if(!handler_p->filter_event(ev)) {
 		return;
 	}
@@ -400,9 +405,9 @@ void wml_event_pump::put_wml_message(const std::string& logger, const std::strin
 }
 
 pump_result_t wml_event_pump::fire(
-		const std::string& event, const entity_location& loc1, const entity_location& loc2, const config& data)
+		const std::string& event, const entity_location& loc1, const entity_location& loc2, config data)
 {
-	raise(event, loc1, loc2, data);
+	raise(event, loc1, loc2, std::move(data));
 	return (*this)();
 }
 
@@ -410,9 +415,9 @@ pump_result_t wml_event_pump::fire(const std::string& event,
 		const std::string& id,
 		const entity_location& loc1,
 		const entity_location& loc2,
-		const config& data)
+		config data)
 {
-	raise(event, id, loc1, loc2, data);
+	raise(event, id, loc1, loc2, std::move(data));
 	return (*this)();
 }
 
@@ -420,14 +425,14 @@ void wml_event_pump::raise(const std::string& event,
 		const std::string& id,
 		const entity_location& loc1,
 		const entity_location& loc2,
-		const config& data)
+		config data)
 {
 	if(game_display::get_singleton() == nullptr)
 		return;
 
 	DBG_EH << "raising event name=" << event << ", id=" << id;
 
-	impl_->events_queue.emplace_back(event, id, loc1, loc2, data);
+	impl_->events_queue.emplace_back(event, id, loc1, loc2, std::move(data));
 }
 
 pump_result_t wml_event_pump::operator()()
@@ -521,6 +526,11 @@ pump_result_t wml_event_pump::operator()()
 	return std::tuple(undo_disabled(), action_canceled());
 }
 
+unsigned long long wml_event_pump::processed_event_count() const
+{
+	return impl_->processed_count;
+}
+
 void wml_event_pump::flush_messages()
 {
 	// Dialogs can only be shown if the display is not fake
@@ -50,12 +50,12 @@ struct queued_event
 			const std::string& id,
 			const entity_location& loc1,
 			const entity_location& loc2,
-			const config& data)
+			config&& data)
 		: name(name)
 		, id(id)
 		, loc1(loc1)
 		, loc2(loc2)
-		, data(data)
+		, data(std::move(data))
 	{
 		std::replace(this->name.begin(), this->name.end(), ' ', '_');
 	}
@@ -111,30 +111,34 @@ public:
 	 * Function to fire an event.
 	 *
 	 * Events may have up to two arguments, both of which must be locations.
+	 *
+	 * @a data is taken by value: callers passing a temporary (the common
+	 * case, e.g. the per-strike weapon info in attack events) have it moved
+	 * into the queued event rather than deep-copied.
 	 */
 	pump_result_t fire(const std::string& event,
 			const entity_location& loc1 = entity_location::null_entity,
 			const entity_location& loc2 = entity_location::null_entity,
-			const config& data = config());
+			config data = config());
 
 	pump_result_t fire(const std::string& event,
 			const std::string& id,
 			const entity_location& loc1 = entity_location::null_entity,
 			const entity_location& loc2 = entity_location::null_entity,
-			const config& data = config());
+			config data = config());
 
 	void raise(const std::string& event,
 			const std::string& id,
 			const entity_location& loc1 = entity_location::null_entity,
 			const entity_location& loc2 = entity_location::null_entity,
-			const config& data = config());
+			config data = config());
 
 	inline void raise(const std::string& event,
 			const entity_location& loc1 = entity_location::null_entity,
 			const entity_location& loc2 = entity_location::null_entity,
-			const config& data = config())
+			config data = config())
 	{
-		raise(event, "", loc1, loc2, data);
+		raise(event, "", loc1, loc2, std::move(data));
 	}
 
 	pump_result_t operator()();
@@ -142,6 +146,14 @@ public:
 	/** Flushes WML messages and errors. */
 	void flush_messages();
 
+	/**
+	 * Monotonic count of event handlers executed so far. Since everything WML
+	 * can alter (variables, time areas, ...) is altered from inside a handler,
+	 * caches of data derived from WML filters can include this in their
+	 * staleness stamp.
+	 */
+	unsigned long long processed_event_count() const;
+
 private:
 	void process_event(handler_ptr& handler_p, const queued_event& ev);
 
@@ -105,6 +105,11 @@ connect_engine::connect_engine(saved_game& state, const bool first_scenario, mp_
 	for(config& side : sides) {
 		const std::string side_str = std::to_string(side_count);
 
+		// Make sure both keys exist before taking the references: the second
+		// operator[] could otherwise insert into the flat attribute map and
+		// invalidate the first reference.
+		side["team_name"];
+		side["user_team_name"];
 		config::attribute_value& team_name = side["team_name"];
 		config::attribute_value& user_team_name = side["user_team_name"];
 
@@ -458,7 +463,7 @@ void connect_engine::start_game()
 	save_reserved_sides_information();
 
 	// Build the gamestate object after updating the level.
-	mp::level_to_gamestate(level_, state_);
+	mp::level_to_gamestate(std::move(level_), state_);
 
 	mp::send_to_server(config("start_game"));
 }
@@ -559,7 +564,7 @@ void connect_engine::start_game_commandline(const commandline_options& cmdline_o
 	save_reserved_sides_information();
 
 	// Build the gamestate object after updating the level
-	mp::level_to_gamestate(level_, state_);
+	mp::level_to_gamestate(std::move(level_), state_);
 	mp::send_to_server(config("start_game"));
 }
 
@@ -46,6 +46,41 @@ static lg::log_domain log_mp_create_engine("mp/create/engine");
 
 namespace ng {
 
+namespace {
+
+/**
+ * Parsed editor content, kept across create_engine instances.
+ *
+ * The engine is rebuilt from scratch every time the create dialog opens, and
+ * rereading and reparsing every user map and editor scenario each time is what
+ * makes reopening it slow; the add-on WML proper is already cached on disk by
+ * game_config_manager. Entries are checked against the file's modification
+ * time, so content edited while the game is running is still picked up.
+ */
+struct editor_map_cache_entry
+{
+	std::time_t mtime = 0;
+	std::string map_data;
+	/** Parsed map, or nullptr if the data was invalid. */
+	std::unique_ptr<gamemap> map;
+	/** Untranslated parse error, shown as the map's description. */
+	std::string error;
+	/** False if the file isn't map data at all and should be skipped. */
+	bool usable = false;
+};
+
+struct editor_scenario_cache_entry
+{
+	std::time_t mtime = 0;
+	config data;
+	bool usable = false;
+};
+
+std::map<std::string, editor_map_cache_entry> editor_map_cache;
+std::map<std::string, editor_scenario_cache_entry> editor_scenario_cache;
+
+} // namespace
+
 level::level(const config& data)
 	: data_(data)
 {
@@ -653,60 +688,91 @@ void create_engine::init_all_levels()
 		int dep_index_offset = 0;
 		for(std::size_t i = 0; i < user_map_names_.size(); i++)
 		{
-			config user_map_data = gen_mp_data;
-			user_map_data["map_data"] = filesystem::read_map(user_map_names_[i]);
-
-			// Check if a file is actually a map.
-			// Note that invalid maps should be displayed in order to
-			// show error messages in the GUI.
-			bool add_map = true;
-			std::unique_ptr<gamemap> map;
-			try {
-				map.reset(new gamemap(user_map_data["map_data"]));
-			} catch (const incorrect_map_format_error& e) {
-				// Set map content to nullptr, so that it fails can_launch_game()
-				map.reset(nullptr);
-				user_map_data["description"] = _("Map could not be loaded: ") + e.message;
-
-				ERR_CF << "map could not be loaded: " << e.message;
-			} catch (const wml_exception&) {
-				add_map = false;
-				dep_index_offset++;
+			const std::string& name = user_map_names_[i];
+			auto [cache_it, missing] = editor_map_cache.try_emplace(name);
+			editor_map_cache_entry& cached = cache_it->second;
+
+			const std::time_t mtime = filesystem::file_modified_time(
+				filesystem::get_user_data_dir() + "/editor/maps/" + name);
+
+			if(missing || cached.mtime != mtime) {
+				cached = editor_map_cache_entry();
+				cached.mtime = mtime;
+				cached.map_data = filesystem::read_map(name);
+				cached.usable = true;
+
+				// Check if a file is actually a map.
+				// Note that invalid maps should be displayed in order to
+				// show error messages in the GUI.
+				try {
+					cached.map.reset(new gamemap(cached.map_data));
+				} catch (const incorrect_map_format_error& e) {
+					// Leave the map as nullptr, so that it fails can_launch_game()
+					cached.error = e.message;
+
+					ERR_CF << "map could not be loaded: " << e.message;
+				} catch (const wml_exception&) {
+					cached.usable = false;
+				}
 			}
 
-			if(add_map) {
-				type_map_[level_type::type::user_map].games.emplace_back(new user_map(user_map_data, user_map_names_[i], map.get()));
+			if(!cached.usable) {
+				dep_index_offset++;
+				continue;
+			}
 
-				// Since user maps are treated as scenarios, some dependency info is required
-				config depinfo;
-				depinfo["id"] = user_map_names_[i];
-				depinfo["name"] = user_map_names_[i];
-				dependency_manager_->insert_element(depcheck::SCENARIO, depinfo, i - dep_index_offset);
+			config user_map_data = gen_mp_data;
+			user_map_data["map_data"] = cached.map_data;
+			if(!cached.error.empty()) {
+				user_map_data["description"] = _("Map could not be loaded: ") + cached.error;
 			}
+
+			type_map_[level_type::type::user_map].games.emplace_back(new user_map(user_map_data, name, cached.map.get()));
+
+			// Since user maps are treated as scenarios, some dependency info is required
+			config depinfo;
+			depinfo["id"] = name;
+			depinfo["name"] = name;
+			dependency_manager_->insert_element(depcheck::SCENARIO, depinfo, i - dep_index_offset);
 		}
 
 		// User made scenarios.
 		dep_index_offset = 0;
 		for(std::size_t i = 0; i < user_scenario_names_.size(); i++)
 		{
-			config data;
-			try {
-				read(data, *preprocess_file(filesystem::get_user_data_dir() + "/editor/scenarios/" + user_scenario_names_[i]));
-			} catch(const config::error & e) {
-				ERR_CF << "Caught a config error while parsing user made (editor) scenarios:\n" << e.message;
-				ERR_CF << "Skipping file: " << (filesystem::get_user_data_dir() + "/editor/scenarios/" + user_scenario_names_[i]);
+			const std::string path = filesystem::get_user_data_dir() + "/editor/scenarios/" + user_scenario_names_[i];
+			auto [cache_it, missing] = editor_scenario_cache.try_emplace(user_scenario_names_[i]);
+			editor_scenario_cache_entry& cached = cache_it->second;
+
+			const std::time_t mtime = filesystem::file_modified_time(path);
+
+			if(missing || cached.mtime != mtime) {
+				cached = editor_scenario_cache_entry();
+				cached.mtime = mtime;
+				cached.usable = true;
+
+				try {
+					read(cached.data, *preprocess_file(path));
+				} catch(const config::error & e) {
+					ERR_CF << "Caught a config error while parsing user made (editor) scenarios:\n" << e.message;
+					ERR_CF << "Skipping file: " << path;
+					cached.usable = false;
+				}
+			}
+
+			if(!cached.usable) {
 				continue;
 			}
 
-			scenario_ptr new_scenario(new scenario(data));
+			scenario_ptr new_scenario(new scenario(cached.data));
 			if(new_scenario->id().empty()) continue;
 
 			type_map_[level_type::type::user_scenario].games.push_back(std::move(new_scenario));
 
 			// Since user scenarios are treated as scenarios, some dependency info is required
 			config depinfo;
-			depinfo["id"] = data["id"];
-			depinfo["name"] = data["name"];
+			depinfo["id"] = cached.data["id"];
+			depinfo["name"] = cached.data["name"];
 			dependency_manager_->insert_element(depcheck::SCENARIO, depinfo, i - dep_index_offset++);
 		}
 	}
@@ -111,7 +111,7 @@ std::string make_game_type_marker(const std::string& text, bool color_for_missin
 
 } // end anon namespace
 
-game_info::game_info(const config& game, const std::vector<std::string>& installed_addons)
+game_info::game_info(const config& game, const std::vector<std::string>& installed_addons, const game_info* old_info)
 	: id(game["id"])
 	, map_data(game["map_data"])
 	, name(font::escape_text(game["name"]))
@@ -230,6 +230,16 @@ game_info::game_info(const config& game, const std::vector<std::string>& install
 
 	if(map_data.empty()) {
 		info_stream << " — ??×??";
+	} else if(old_info && old_info->map_data == map_data) {
+		// The server resends the unchanged map with every status update of a
+		// game, so don't parse the whole terrain grid again just to print its
+		// size. An empty size means the previous parse failed.
+		map_size_info = old_info->map_size_info;
+		if(map_size_info.empty()) {
+			verified = false;
+		} else {
+			info_stream << spaced_em_dash() << map_size_info;
+		}
 	} else {
 		try {
 			gamemap map(map_data);
@@ -64,7 +64,16 @@ struct user_info
  */
 struct game_info
 {
-	game_info(const config& c, const std::vector<std::string>& installed_addons);
+	/**
+	 * @param c                   The [game] config to parse.
+	 * @param installed_addons    The add-ons installed on the client.
+	 * @param old_info            The entry this one replaces, if any. Used to
+	 *                            carry over results that are expensive to
+	 *                            recompute, such as the parsed map size, when
+	 *                            their inputs are unchanged.
+	 */
+	game_info(const config& c, const std::vector<std::string>& installed_addons,
+			const game_info* old_info = nullptr);
 
 	bool can_join() const;
 	bool can_observe() const;
@@ -192,7 +192,7 @@ bool lobby_info::process_gamelist_diff_impl(const config& data)
 			}
 
 			// Had a game with that id, so update it and mark it as such
-			current_i->second = game_info(c, installed_addons_);
+			current_i->second = game_info(c, installed_addons_, &current_i->second);
 			current_i->second.display_status = game_info::disp_status::UPDATED;
 		} else if(diff_result == "deleted") {
 			if(current_i == games_by_id_.end()) {
@@ -221,7 +221,26 @@ bool lobby_info::process_gamelist_diff_impl(const config& data)
 
 	DBG_LB << "postclean " << dump_games_config(gamelist_.mandatory_child("gamelist"));
 
-	process_userlist();
+	// Most diffs in a busy lobby only advance the status of a game or two and
+	// mention no [user] at all; rebuilding and re-sorting the whole user list
+	// for those is what made big lobbies stutter. Updated game entries start
+	// with their friend/ignored markers cleared though, so those still have
+	// to be refreshed from the existing user list.
+	bool users_changed = false;
+	for(const std::string key : {"insert_child", "delete_child", "change_child"}) {
+		for(const config& i : data.child_range(key)) {
+			if(i.has_child("user")) {
+				users_changed = true;
+			}
+		}
+	}
+
+	if(users_changed) {
+		process_userlist();
+	} else {
+		mark_games_with_relations();
+	}
+
 	return true;
 }
 
@@ -231,8 +250,17 @@ void lobby_info::process_userlist()
 
 	users_.clear();
 	for(const auto& c : gamelist_.child_range("user")) {
-		user_info& ui = users_.emplace_back(c);
+		users_.emplace_back(c);
+	}
+
+	mark_games_with_relations();
+
+	std::stable_sort(users_.begin(), users_.end());
+}
 
+void lobby_info::mark_games_with_relations()
+{
+	for(const user_info& ui : users_) {
 		if(ui.game_id == 0) {
 			continue;
 		}
@@ -254,8 +282,6 @@ void lobby_info::process_userlist()
 			break;
 		}
 	}
-
-	std::stable_sort(users_.begin(), users_.end());
 }
 
 std::function<void()> lobby_info::begin_state_sync()
@@ -127,6 +127,9 @@ private:
 
 	void process_userlist();
 
+	/** Sets the friend/ignored markers on games from the current user list. */
+	void mark_games_with_relations();
+
 	/**
 	 * Generates a new vector of game pointers from the ID/game map.
 	 * The games will be referenced in ascending order by ID.
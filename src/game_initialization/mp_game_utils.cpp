@@ -129,10 +129,10 @@ config initial_level_config(saved_game& state)
 	return level;
 }
 
-void level_to_gamestate(const config& level, saved_game& state)
+void level_to_gamestate(config&& level, saved_game& state)
 {
 	campaign_type::type type = state.classification().type;
-	state = saved_game(level);
+	state = saved_game(std::move(level));
 	state.classification().type = type;
 }
 
@@ -22,6 +22,13 @@ namespace mp {
 
 config initial_level_config(saved_game& state);
 
-void level_to_gamestate(const config& level, saved_game& state);
+/**
+ * Rebuilds @a state from a received or composed level config.
+ *
+ * The level is consumed: an 8-player map's [scenario] with all its sides and
+ * units is far too big to deep-copy just to tear the original down right
+ * after, which is what every caller used to do.
+ */
+void level_to_gamestate(config&& level, saved_game& state);
 
 } // end namespace mp
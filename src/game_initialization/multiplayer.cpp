@@ -146,6 +146,11 @@ private:
 	/** This single instance is reused for all games played during the current connection to the server. */
 	saved_game state;
 
+	/**
+	 * The lobby snapshot. Like the connection it outlives the individual
+	 * lobby, create and game screens, so returning to the lobby reuses the
+	 * last known gamelist instead of starting from scratch.
+	 */
 	mp::lobby_info lobby_info;
 
 	std::list<mp::network_registrar::handler> process_handlers;
@@ -575,9 +580,12 @@ void mp_manager::enter_create_mode()
 
 	if(gui2::dialogs::mp_create_game::execute(state, connection == nullptr)) {
 		enter_staging_mode();
-	} else if(connection) {
-		connection->send_data(config("refresh_lobby"));
 	}
+
+	// No gamelist refresh is requested when creation is cancelled. We never
+	// left the server-side lobby, so the [gamelist_diff]s that queued up
+	// while the dialog was open bring our snapshot current the moment the
+	// lobby dialog starts processing network data again.
 }
 
 void mp_manager::enter_staging_mode()
@@ -73,10 +73,9 @@ game_state::game_state(const config& level, play_controller& pc)
 
 game_state::~game_state() {}
 
-static int placing_score(const config& side, const gamemap& map, const map_location& pos)
+static int placing_score(const t_translation::ter_list& terrain, const gamemap& map, const map_location& pos)
 {
 	int positions = 0, liked = 0;
-	const t_translation::ter_list terrain = t_translation::read_list(side["terrain_liked"].str());
 
 	for(int i = -8; i != 8; ++i) {
 		for(int j = -8; j != +8; ++j) {
@@ -118,9 +117,13 @@ void game_state::place_sides_in_preferred_locations(const config& level)
 	int side_num = 1;
 	for(const config &side : level.child_range("side"))
 	{
+		// The liked terrain doesn't depend on the position, so parse it
+		// once per side instead of once per candidate position.
+		const t_translation::ter_list terrain = t_translation::read_list(side["terrain_liked"].str());
+
 		for(int p = 1; p <= num_pos; ++p) {
 			const map_location& pos = board_.map().starting_position(p);
-			int score = placing_score(side, board_.map(), pos);
+			int score = placing_score(terrain, board_.map(), pos);
 			placing_info obj;
 			obj.side = side_num;
 			obj.score = score;
@@ -24,12 +24,18 @@
 #include "map/map.hpp"
 #include "seed_rng.hpp"
 
+#include <algorithm>
+#include <sstream>
+
 static lg::log_domain log_engine("engine");
 #define DBG_NG LOG_STREAM(debug, log_engine)
 
 namespace {
 	const int max_island = 10;
 	const int max_coastal = 5;
+
+	// How many finished generations to keep for instant replay.
+	const std::size_t max_cached_maps = 8;
 }
 
 generator_data::generator_data(const config &cfg)
@@ -51,7 +57,8 @@ generator_data::generator_data(const config &cfg)
 }
 
 default_map_generator::default_map_generator(const config& cfg)
-	: cfg_(cfg)
+	: cache_()
+	, cfg_(cfg)
 	, data_(cfg)
 {
 }
@@ -78,6 +85,17 @@ std::string default_map_generator::create_map(std::optional<uint32_t> randomseed
 	return generate_map(nullptr, randomseed);
 }
 
+std::string default_map_generator::settings_key() const
+{
+	std::ostringstream key;
+	key << data_.width << ':' << data_.height
+		<< ':' << data_.nplayers << ':' << data_.nvillages
+		<< ':' << data_.iterations << ':' << data_.hill_size
+		<< ':' << data_.castle_size << ':' << data_.island_size
+		<< ':' << data_.max_lakes << ':' << data_.link_castles;
+	return key.str();
+}
+
 std::string default_map_generator::generate_map(std::map<map_location,std::string>* labels, std::optional<uint32_t> randomseed)
 {
 	uint32_t seed;
@@ -87,6 +105,37 @@ std::string default_map_generator::generate_map(std::map<map_location,std::strin
 		seed = seed_rng::next_seed();
 	}
 
+	// Suppress labels?
+	if(!data_.show_labels) {
+		labels = nullptr;
+	}
+
+	/* Label generation draws from the same random stream as the terrain, so a
+	 * labelled and an unlabelled run of one seed produce different maps and
+	 * must not share cache entries.
+	 */
+	const std::string settings = settings_key() + (labels ? ":labeled" : ":plain");
+	const bool cacheable = !labels || labels->empty();
+	if(cacheable) {
+		for(auto i = cache_.begin(); i != cache_.end(); ++i) {
+			if(i->seed != seed || i->settings != settings) {
+				continue;
+			}
+
+			DBG_NG << "serving map for seed " << seed << " from the generation cache";
+
+			// Most recently used entries are kept at the back.
+			std::rotate(i, i + 1, cache_.end());
+			const cached_map& entry = cache_.back();
+
+			if(labels) {
+				*labels = entry.labels;
+			}
+
+			return entry.map;
+		}
+	}
+
 	/* We construct a copy of the generator data and modify it as needed. This ensures every time
 	 * this function is called the generator job gets a fresh set of settings, and that the internal
 	 * copy of the settings are never touched except by the settings dialog.
@@ -96,11 +145,6 @@ std::string default_map_generator::generate_map(std::map<map_location,std::strin
 	 */
 	generator_data job_data = data_;
 
-	// Suppress labels?
-	if(!data_.show_labels) {
-		labels = nullptr;
-	}
-
 	// The random generator thinks odd widths are nasty, so make them even
 	if(is_odd(data_.width)) {
 		++job_data.width;
@@ -163,6 +207,14 @@ std::string default_map_generator::generate_map(std::map<map_location,std::strin
 		throw mapgen_exception(error_message);
 	}
 
+	if(cacheable) {
+		if(cache_.size() >= max_cached_maps) {
+			cache_.pop_front();
+		}
+
+		cache_.push_back(cached_map{settings, seed, map, labels ? *labels : std::map<map_location, std::string>()});
+	}
+
 	return map;
 }
 
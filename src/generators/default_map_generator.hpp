@@ -18,6 +18,8 @@
 #include "config.hpp"
 #include "generators/map_generator.hpp"
 
+#include <deque>
+
 struct generator_data {
 	generator_data(const config& cfg);
 	generator_data() = default;
@@ -56,6 +58,21 @@ public:
 private:
 	std::string generate_map(std::map<map_location,std::string>* labels, std::optional<uint32_t> randomseed);
 
+	/** A serialization of every setting the generator job reads, for cache keying. */
+	std::string settings_key() const;
+
+	/** One finished generation, kept so the same settings and seed replay instantly. */
+	struct cached_map
+	{
+		std::string settings;
+		uint32_t seed;
+		std::string map;
+		std::map<map_location, std::string> labels;
+	};
+
+	/** Recently generated maps, most recently used last. */
+	std::deque<cached_map> cache_;
+
 	config cfg_;
 
 	generator_data data_;
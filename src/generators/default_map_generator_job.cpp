@@ -34,6 +34,8 @@
 
 #include <SDL2/SDL_timer.h>
 
+#include <thread>
+
 static lg::log_domain log_mapgen("mapgen");
 #define ERR_NG LOG_STREAM(err, log_mapgen)
 #define LOG_NG LOG_STREAM(info, log_mapgen)
@@ -291,6 +293,20 @@ height_map default_map_generator_job::generate_height_map(size_t width, size_t h
 {
 	height_map res(width, std::vector<int>(height,0));
 
+	// A hill's random parameters. These are drawn up front, in the same order
+	// as the old all-in-one loop, so that applying the hills can be spread
+	// over several threads without changing the rng_ draw order and therefore
+	// the generated map for a given seed.
+	struct hill
+	{
+		int x, y, radius;
+		// Is this a negative hill? (i.e. a valley)
+		bool is_valley;
+	};
+
+	std::vector<hill> hills;
+	hills.reserve(iterations);
+
 	DBG_NG << iterations << " iterations";
 	for(std::size_t i = 0; i != iterations; ++i) {
 
@@ -304,7 +320,6 @@ height_map default_map_generator_job::generate_height_map(size_t width, size_t h
 		// to a rectangle that contains all the positive values for this formula --
 		// the rectangle is given by min_x,max_x,min_y,max_y.
 
-		// Is this a negative hill? (i.e. a valley)
 		bool is_valley = false;
 
 		int x1 = island_size > 0 ? center_x - island_size + (rng_()%(island_size*2)) : static_cast<int>(rng_()%width);
@@ -321,31 +336,65 @@ height_map default_map_generator_job::generate_height_map(size_t width, size_t h
 		const int radius = rng_()%hill_size + 1;
 		DBG_NG << "placing hill at " << x1 << "," << y1 << " radius=" << radius << " is_valley=" << is_valley;
 
-		const int min_x = x1 - radius > 0 ? x1 - radius : 0;
-		const int max_x = x1 + radius < static_cast<long>(res.size()) ? x1 + radius : res.size();
-		const int min_y = y1 - radius > 0 ? y1 - radius : 0;
-		const int max_y = y1 + radius < static_cast<long>(res.front().size()) ? y1 + radius : res.front().size();
-
-		for(int x2 = min_x; x2 < max_x; ++x2) {
-			for(int y2 = min_y; y2 < max_y; ++y2) {
-				const int xdiff = (x2-x1);
-				const int ydiff = (y2-y1);
-
-				const int hill_height = radius - static_cast<int>(std::sqrt(static_cast<double>(xdiff*xdiff + ydiff*ydiff)));
+		hills.push_back({x1, y1, radius, is_valley});
+	}
 
-				if(hill_height > 0) {
-					if(is_valley) {
-						if(hill_height > res[x2][y2]) {
-							res[x2][y2] = 0;
+	// Applies every hill's contribution to the columns [col_begin, col_end).
+	// Each cell is written by exactly one invocation, which visits the hills
+	// in draw order, so partitioning the map into column bands gives the same
+	// result as the serial loop no matter how the bands are scheduled.
+	const auto apply_hills = [&res, &hills](int col_begin, int col_end) {
+		for(const hill& h : hills) {
+			const int min_x = std::max(h.x - h.radius, col_begin);
+			const int max_x = std::min(h.x + h.radius, col_end);
+			const int min_y = h.y - h.radius > 0 ? h.y - h.radius : 0;
+			const int max_y = h.y + h.radius < static_cast<long>(res.front().size()) ? h.y + h.radius : res.front().size();
+
+			for(int x2 = min_x; x2 < max_x; ++x2) {
+				for(int y2 = min_y; y2 < max_y; ++y2) {
+					const int xdiff = (x2-h.x);
+					const int ydiff = (y2-h.y);
+
+					const int hill_height = h.radius - static_cast<int>(std::sqrt(static_cast<double>(xdiff*xdiff + ydiff*ydiff)));
+
+					if(hill_height > 0) {
+						if(h.is_valley) {
+							if(hill_height > res[x2][y2]) {
+								res[x2][y2] = 0;
+							} else {
+								res[x2][y2] -= hill_height;
+							}
 						} else {
-							res[x2][y2] -= hill_height;
+							res[x2][y2] += hill_height;
 						}
-					} else {
-						res[x2][y2] += hill_height;
 					}
 				}
 			}
 		}
+	};
+
+	// Narrow bands would make most hills span several of them, so the work
+	// per band must stay substantial for the split to pay off.
+	const std::size_t max_threads = std::max(1u, std::thread::hardware_concurrency());
+	const std::size_t band_width = std::max<std::size_t>(hill_size * 2, 16);
+	const std::size_t thread_count = std::min(max_threads, width / band_width);
+
+	if(thread_count <= 1) {
+		apply_hills(0, res.size());
+	} else {
+		std::vector<std::thread> workers;
+		workers.reserve(thread_count);
+
+		const int step = width / thread_count;
+		for(std::size_t i = 0; i != thread_count; ++i) {
+			const int col_begin = i * step;
+			const int col_end = i + 1 == thread_count ? res.size() : col_begin + step;
+			workers.emplace_back(apply_hills, col_begin, col_end);
+		}
+
+		for(std::thread& worker : workers) {
+			worker.join();
+		}
 	}
 
 	// Find the highest and lowest points on the map for normalization:
@@ -22,9 +22,11 @@
 #include <fstream>
 #include <locale>
 #include <map>
+#include <mutex>
 #include <boost/locale.hpp>
 #include <set>
 #include <type_traits>
+#include <unordered_map>
 
 #if defined(__GNUC__)
 #pragma GCC diagnostic push
@@ -404,6 +406,34 @@ namespace
 		return *mng;
 	}
 
+	/**
+	 * Memoized dsgettext() results, keyed by domain and message id.
+	 * bl::dgettext matches the domain by name and walks its catalog on every
+	 * call, which is visible while building text-heavy dialogs; repeated ids
+	 * resolve from here instead. Cleared whenever the locale can change.
+	 */
+	std::unordered_map<std::string, std::string> message_cache;
+
+	/**
+	 * Collation sort keys from previous icompare() calls.
+	 *
+	 * Producing a key costs about as much as one collated compare, but
+	 * sorting a list of n rows compares each string O(log n) times, and the
+	 * same names are re-sorted every time a dialog column header is clicked;
+	 * with the key cached, each comparison is a plain byte compare. Cleared
+	 * whenever the locale can change.
+	 */
+	std::unordered_map<std::string, std::string> collation_key_cache;
+
+	/**
+	 * Guards both caches above. Translation is not main-thread-only: the
+	 * loading screen's worker resolves t_strings (and registers textdomains)
+	 * while the main thread keeps drawing. References into the caches must
+	 * not be used after this is released, since a concurrent language
+	 * change clears them.
+	 */
+	std::mutex cache_mutex;
+
 	// Converts ASCII letters to lowercase. Ignores Unicode letters.
 	std::string ascii_to_lowercase(const std::string& str)
 	{
@@ -431,6 +461,18 @@ std::string egettext(char const *msgid)
 
 std::string dsgettext (const char * domainname, const char *msgid)
 {
+	std::string key = domainname;
+	key += '\x01';
+	key += msgid;
+
+	{
+		const std::lock_guard<std::mutex> lock(cache_mutex);
+		const auto cached = message_cache.find(key);
+		if(cached != message_cache.end()) {
+			return cached->second;
+		}
+	}
+
 	std::string msgval = dgettext (domainname, msgid);
 	if (msgval == msgid) {
 		const char* firsthat = std::strchr (msgid, '^');
@@ -439,6 +481,11 @@ std::string dsgettext (const char * domainname, const char *msgid)
 		else
 			msgval = firsthat + 1;
 	}
+
+	// The catalog walk above ran unlocked; losing the race to another
+	// thread translating the same id just stores the same value twice.
+	const std::lock_guard<std::mutex> lock(cache_mutex);
+	message_cache.emplace(std::move(key), msgval);
 	return msgval;
 }
 
@@ -480,6 +527,9 @@ void bind_textdomain(const char* domain, const char* directory, const char* /*en
 	get_manager().add_messages_domain(domain);
 	get_manager().add_messages_path(directory);
 	get_manager().update_locale();
+	const std::lock_guard<std::mutex> lock(cache_mutex);
+	message_cache.clear();
+	collation_key_cache.clear();
 }
 
 void set_default_textdomain(const char* domain)
@@ -495,6 +545,9 @@ void set_language(const std::string& language, const std::vector<std::string>* /
 	// to which languages we ship with and not which the os supports
 	LOG_G << "setting language to  '" << language << "'";
 	get_manager().set_language(language);
+	const std::lock_guard<std::mutex> lock(cache_mutex);
+	message_cache.clear();
+	collation_key_cache.clear();
 }
 
 int compare(const std::string& s1, const std::string& s2)
@@ -514,21 +567,41 @@ int compare(const std::string& s1, const std::string& s2)
 	}
 }
 
-int icompare(const std::string& s1, const std::string& s2)
+namespace {
+
+/**
+ * Returns the cached collation sort key for @a s, generating it on first use.
+ * The caller must hold cache_mutex, and may only use the reference while it
+ * does.
+ */
+const std::string& icompare_key(const std::string& s)
 {
+	const auto cached = collation_key_cache.find(s);
+	if(cached != collation_key_cache.end()) {
+		return cached->second;
+	}
+
+	std::string key;
+
 	// todo: maybe we should replace this preprocessor check with a std::has_facet<bl::collator<char>> check?
 #ifdef __APPLE__
 	// https://github.com/wesnoth/wesnoth/issues/2094
-	return compare(ascii_to_lowercase(s1), ascii_to_lowercase(s2));
+	try {
+		const std::string lower = ascii_to_lowercase(s);
+		key = std::use_facet<std::collate<char>>(get_manager().get_locale())
+			.transform(lower.c_str(), lower.c_str() + lower.size());
+	} catch(const std::bad_cast&) {
+		key = ascii_to_lowercase(s);
+	}
 #else
 
 	try {
 #if BOOST_VERSION < 108100
-		return std::use_facet<bl::collator<char>>(get_manager().get_locale()).compare(
-			bl::collator_base::secondary, s1, s2);
+		key = std::use_facet<bl::collator<char>>(get_manager().get_locale()).transform(
+			bl::collator_base::secondary, s);
 #else
-		return std::use_facet<bl::collator<char>>(get_manager().get_locale()).compare(
-			bl::collate_level::secondary, s1, s2);
+		key = std::use_facet<bl::collator<char>>(get_manager().get_locale()).transform(
+			bl::collate_level::secondary, s);
 #endif
 	} catch(const std::bad_cast&) {
 		static bool bad_cast_once = false;
@@ -545,9 +618,21 @@ int icompare(const std::string& s1, const std::string& s2)
 		}
 
 		// Let's convert at least ASCII letters to lowercase to get a somewhat case-insensitive comparison.
-		return ascii_to_lowercase(s1).compare(ascii_to_lowercase(s2));
+		key = ascii_to_lowercase(s);
 	}
 #endif
+
+	return collation_key_cache.emplace(s, std::move(key)).first->second;
+}
+
+} // namespace
+
+int icompare(const std::string& s1, const std::string& s2)
+{
+	// Comparing the transforms is equivalent to comparing the strings
+	// through the collator itself.
+	const std::lock_guard<std::mutex> lock(cache_mutex);
+	return icompare_key(s1).compare(icompare_key(s2));
 }
 
 std::string strftime(const std::string& format, const std::tm* time)
@@ -129,13 +129,24 @@ private:
 	 */
 	std::optional<std::string> formula_;
 
+	/**
+	 * The parsed formula, built on first evaluation.
+	 *
+	 * Parsing a formula string is far more expensive than evaluating the
+	 * result, and canvas shapes evaluate their formulas on every draw, so
+	 * the parse must not be repeated per call. Parsing needs the function
+	 * table, which is only available in @ref operator(), hence lazy. Every
+	 * caller is expected to pass the same table on each invocation.
+	 */
+	mutable wfl::const_formula_ptr parsed_formula_;
+
 	/** If there's no formula it contains the value. */
 	T value_;
 };
 
 template<typename T>
 typed_formula<T>::typed_formula(const std::string& str, const T value)
-	: formula_(), value_(value)
+	: formula_(), parsed_formula_(), value_(value)
 {
 	if(str.empty()) {
 		return;
@@ -156,7 +167,11 @@ operator()(const wfl::map_formula_callable& variables, wfl::function_symbol_tabl
 		return value_;
 	}
 
-	wfl::variant v = wfl::formula(*formula_, functions).evaluate(variables);
+	if(!parsed_formula_) {
+		parsed_formula_ = std::make_shared<const wfl::formula>(*formula_, functions);
+	}
+
+	wfl::variant v = parsed_formula_->evaluate(variables);
 	const T& result = execute(v);
 
 	DBG_GUI_D << "Formula: execute '" << *formula_ << "' result '" << result << "'.";
@@ -30,6 +30,11 @@ gui_theme_map_t guis;
 gui_theme_map_t::iterator current_gui = guis.end();
 gui_theme_map_t::iterator default_gui = guis.end();
 
+namespace
+{
+void clear_control_resolution_cache();
+} // namespace
+
 gui_definition::gui_definition(const config& cfg)
 	: widget_types()
 	, window_types()
@@ -156,6 +161,10 @@ void gui_definition::activate() const
 	settings::sound_slider_adjust = sound_slider_adjust_;
 	settings::has_helptip_message = has_helptip_message_;
 	settings::tips = tips_;
+
+	// The gui map may have been rebuilt in place, so resolved widget
+	// definitions from before the switch cannot be trusted.
+	clear_control_resolution_cache();
 }
 
 namespace
@@ -196,9 +205,24 @@ const typename TList::value_type& get_best_resolution(const TList& list, const T
 	return *best_resolution;
 }
 
-} // namespace
+/**
+ * Resolved (widget type, definition id) lookups, so opening a dialog pays
+ * the fallback chains in resolve_control() once per distinct widget style
+ * instead of once per widget. The cache is tied to the active theme and
+ * the screen size, since both influence which resolution wins.
+ */
+std::map<std::pair<std::string, std::string>, resolution_definition_ptr> control_resolution_cache;
+const gui_definition* control_cache_gui = nullptr;
+unsigned control_cache_screen_w = 0;
+unsigned control_cache_screen_h = 0;
+
+void clear_control_resolution_cache()
+{
+	control_resolution_cache.clear();
+	control_cache_gui = nullptr;
+}
 
-resolution_definition_ptr get_control(const std::string& control_type, const std::string& definition)
+resolution_definition_ptr resolve_control(const std::string& control_type, const std::string& definition)
 {
 	const auto& current_types = current_gui->second.widget_types;
 	const auto& default_types = default_gui->second.widget_types;
@@ -231,7 +255,7 @@ resolution_definition_ptr get_control(const std::string& control_type, const std
 			if(definition != "default") {
 				LOG_GUI_G << "Control: type '" << control_type << "' definition '" << definition
 						  << "' not found, falling back to 'default'.";
-				return get_control(control_type, "default");
+				return resolve_control(control_type, "default");
 			}
 
 			FAIL(formatter() << "default definition not found for styled_widget " << control_type);
@@ -251,6 +275,30 @@ resolution_definition_ptr get_control(const std::string& control_type, const std
 	});
 }
 
+} // namespace
+
+resolution_definition_ptr get_control(const std::string& control_type, const std::string& definition)
+{
+	if(control_cache_gui != &current_gui->second
+		|| control_cache_screen_w != settings::screen_width
+		|| control_cache_screen_h != settings::screen_height)
+	{
+		control_resolution_cache.clear();
+		control_cache_gui = &current_gui->second;
+		control_cache_screen_w = settings::screen_width;
+		control_cache_screen_h = settings::screen_height;
+	}
+
+	const auto key = std::make_pair(control_type, definition);
+
+	auto cached = control_resolution_cache.find(key);
+	if(cached != control_resolution_cache.end()) {
+		return cached->second;
+	}
+
+	return control_resolution_cache.emplace(key, resolve_control(control_type, definition)).first->second;
+}
+
 const builder_window::window_resolution& get_window_builder(const std::string& type)
 {
 	settings::update_screen_size_variables();
@@ -300,6 +348,7 @@ bool add_single_widget_definition(const std::string& widget_type, const std::str
 	}
 
 	def_map.emplace(definition_id, parser->second.parser(cfg));
+	control_resolution_cache.clear();
 	return true;
 }
 
@@ -310,6 +359,7 @@ void remove_single_widget_definition(const std::string& widget_type, const std::
 	auto it = definition_map.find(definition_id);
 	if(it != definition_map.end()) {
 		definition_map.erase(it);
+		control_resolution_cache.clear();
 	}
 }
 
@@ -27,6 +27,7 @@
 #include "help/help.hpp"
 #include "gettext.hpp"
 #include "gui/auxiliary/find_widget.hpp"
+#include "gui/core/timer.hpp"
 #include "gui/dialogs/addon/license_prompt.hpp"
 #include "gui/dialogs/addon/addon_auth.hpp"
 #include "gui/dialogs/message.hpp"
@@ -241,10 +242,20 @@ const std::vector<addon_tag> tag_filter_types_{
 };
 };
 
+addon_manager::~addon_manager()
+{
+	if(list_fetch_timer_ != 0) {
+		remove_timer(list_fetch_timer_);
+	}
+}
+
 addon_manager::addon_manager(addons_client& client)
 	: modal_dialog(window_id())
 	, orders_()
 	, cfg_()
+	, fetched_addons_(0)
+	, list_complete_(false)
+	, list_fetch_timer_(0)
 	, client_(client)
 	, addons_()
 	, tracking_info_()
@@ -544,10 +555,84 @@ void addon_manager::toggle_details(button& btn, stacked_widget& stk)
 
 void addon_manager::fetch_addons_list()
 {
-	bool success = client_.request_addons_list(cfg_);
-	if(!success) {
+	if(!client_.server_supports_list_paging()) {
+		bool success = client_.request_addons_list(cfg_);
+		if(!success) {
+			gui2::show_error_message(_("An error occurred while downloading the add-ons list from the server."));
+			get_window()->close();
+			return;
+		}
+
+		list_complete_ = true;
+		return;
+	}
+
+	// A small first page gets results on screen quickly; the rest of the
+	// list arrives through a timer while the dialog is already usable, and
+	// the filters simply re-run over what has been received so far.
+	cfg_.clear();
+	fetched_addons_ = 0;
+	list_complete_ = false;
+
+	if(!fetch_addons_list_page(false)) {
+		return;
+	}
+
+	if(!list_complete_ && list_fetch_timer_ == 0) {
+		list_fetch_timer_ = add_timer(100, std::bind(&addon_manager::fetch_next_addons_page, this), true);
+	}
+}
+
+bool addon_manager::fetch_addons_list_page(bool quiet)
+{
+	const std::size_t page_size = quiet ? 300 : 100;
+
+	config page;
+	if(!client_.request_addons_list_page(page, fetched_addons_, page_size, quiet)) {
 		gui2::show_error_message(_("An error occurred while downloading the add-ons list from the server."));
 		get_window()->close();
+		return false;
+	}
+
+	const std::size_t total = page["total"].to_size_t();
+
+	std::size_t count = 0;
+	for(const config& c : page.child_range("campaign")) {
+		cfg_.add_child("campaign", c);
+		++count;
+	}
+
+	fetched_addons_ += count;
+	list_complete_ = count == 0 || fetched_addons_ >= total;
+
+	return true;
+}
+
+void addon_manager::fetch_next_addons_page()
+{
+	if(list_complete_) {
+		remove_timer(list_fetch_timer_);
+		list_fetch_timer_ = 0;
+		return;
+	}
+
+	// Keep the player's selection across the incremental list reloads.
+	const addon_info* selected = find_widget<addon_list>(get_window(), "addons", false).get_selected_addon();
+	const std::string selected_id = selected ? selected->id : "";
+
+	if(!fetch_addons_list_page(true)) {
+		return;
+	}
+
+	if(selected_id.empty()) {
+		load_addon_list();
+	} else {
+		reload_list_and_reselect_item(selected_id);
+	}
+
+	if(list_complete_) {
+		remove_timer(list_fetch_timer_);
+		list_fetch_timer_ = 0;
 	}
 }
 
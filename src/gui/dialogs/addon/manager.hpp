@@ -54,6 +54,8 @@ class addon_manager : public modal_dialog
 public:
 	explicit addon_manager(addons_client& client);
 
+	~addon_manager();
+
 	bool get_need_wml_cache_refresh() const
 	{
 		return need_wml_cache_refresh_;
@@ -88,6 +90,8 @@ private:
 	virtual void pre_show(window& window) override;
 
 	void fetch_addons_list();
+	bool fetch_addons_list_page(bool quiet);
+	void fetch_next_addons_page();
 	void load_addon_list();
 
 	void reload_list_and_reselect_item(const std::string id);
@@ -95,6 +99,15 @@ private:
 	/** Config which contains the list with the campaigns. */
 	config cfg_;
 
+	/** Number of add-ons fetched so far when the list arrives in pages. */
+	std::size_t fetched_addons_;
+
+	/** Whether the complete list has been received. */
+	bool list_complete_;
+
+	/** Repeating GUI timer driving background list page fetches. */
+	std::size_t list_fetch_timer_;
+
 	addons_client& client_;
 
 	addons_list addons_;
@@ -494,6 +494,7 @@ void game_load::delete_button_callback()
 
 		// Delete the file
 		save_index_manager_->delete_game(games_[index].name());
+		save_index_manager_->write_save_index();
 
 		// Remove it from the list of saves
 		games_.erase(games_.begin() + index);
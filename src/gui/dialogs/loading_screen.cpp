@@ -121,8 +121,12 @@ void loading_screen::progress(loading_stage stage)
 {
 	if(singleton_ && stage != loading_stage::none) {
 		singleton_->current_stage_.store(stage, std::memory_order_release);
-		// Allow display to update, close events to be handled, etc.
-		events::pump_and_draw();
+
+		// Only the main thread may pump events and draw. Worker threads just
+		// publish the stage; the window's own loop picks it up in layout().
+		if(events::is_in_main_thread()) {
+			events::pump_and_draw();
+		}
 	}
 }
 
@@ -160,17 +164,25 @@ void loading_screen::process(events::pump_info&)
 		return;
 	}
 
-	// Do not automatically recurse.
-	if (running_) { return; }
-	running_ = true;
+	if (!running_) {
+		// Launch the loading function on a worker thread, so this loop keeps
+		// pumping events and drawing while the function does its work. Any
+		// interaction with the UI from the worker has to go through
+		// events::call_in_main_thread(), which this loop also services.
+		running_ = true;
+		LOG_LS << "Launching loading screen worker function.";
+		worker_result_ = std::async(std::launch::async, load_funcs_.back());
+		return;
+	}
 
-	// Run the loading function.
-	auto func = load_funcs_.back();
-	load_funcs_.pop_back();
-	LOG_LS << "Executing loading screen worker function.";
-	func();
+	if (worker_result_.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+		return;
+	}
 
+	// Collect the worker; this rethrows anything the loading function threw.
+	worker_result_.get();
 	running_ = false;
+	load_funcs_.pop_back();
 
 	// If there's nothing more to do, close.
 	if (load_funcs_.empty()) {
@@ -212,6 +224,12 @@ void loading_screen::layout()
 
 loading_screen::~loading_screen()
 {
+	// Never destroy the dialog while a worker still references it, e.g. when
+	// an exception unwinds through window::show().
+	if(worker_result_.valid()) {
+		worker_result_.wait();
+	}
+
 	LOG_LS << "Loading screen destroyed.";
 	singleton_ = nullptr;
 }
@@ -127,7 +127,7 @@ bool mp_join_game::fetch_game_config()
 	}
 
 	if(level_["started"].to_bool()) {
-		mp::level_to_gamestate(level_, state_);
+		mp::level_to_gamestate(std::move(level_), state_);
 		return true;
 	}
 
@@ -581,7 +581,7 @@ void mp_join_game::post_show(window& window)
 			statistics::read_stats(*stats);
 		}
 
-		mp::level_to_gamestate(level_, state_);
+		mp::level_to_gamestate(std::move(level_), state_);
 
 		mp::ui_alerts::game_has_begun();
 	} else if(observe_game_) {
@@ -262,8 +262,12 @@ void mp_options_helper::display_custom_options(const std::string& type, int node
 				std::vector<std::string> combo_values;
 
 				for(auto i : option_cfg.child_range("item")) {
-					// Comboboxes expect this key to be 'label' not 'name'
-					i["label"] = i["name"];
+					// Comboboxes expect this key to be 'label' not 'name'.
+					// Copy before assigning: operator[] on the left may insert
+					// into the flat attribute map and invalidate a reference
+					// returned on the right.
+					const config::attribute_value name = i["name"];
+					i["label"] = name;
 
 					combo_items.push_back(i);
 					combo_values.push_back(i["value"]);
@@ -51,10 +51,10 @@ void init()
 	try {
 		schema_validation::schema_validator validator(filesystem::get_wml_location("schema/gui.cfg"));
 
-		preproc_map preproc(game_config::config_cache::instance().get_preproc_map());
-		filesystem::scoped_istream stream = preprocess_file(filesystem::get_wml_location("gui/_main.cfg"), &preproc);
-
-		read(cfg, *stream, &validator);
+		// Let the config cache preprocess and validate this. On the usual
+		// launch where no data files changed, that serves the parsed result
+		// from disk and skips both the preprocessor and the schema check.
+		game_config::config_cache::instance().get_config(filesystem::get_wml_location("gui/_main.cfg"), cfg, &validator);
 	} catch(const config::error& e) {
 		ERR_GUI_P << e.what();
 		ERR_GUI_P << "Setting: could not read file 'data/gui/_main.cfg'.";
@@ -50,6 +50,16 @@ static lg::log_domain log_lobby("lobby");
 namespace gui2
 {
 
+namespace
+{
+/**
+ * How many messages each chat window keeps. Busy lobby channels would
+ * otherwise grow the log label without bound, and every new message pays
+ * for laying the whole label out again.
+ */
+const std::size_t max_messages = 256;
+} // namespace
+
 // ------------ WIDGET -----------{
 
 REGISTER_WIDGET(chatbox)
@@ -222,9 +232,22 @@ void chatbox::append_to_chatbox(const std::string& text, std::size_t id, const b
 	const bool chatbox_at_end = log.vertical_scrollbar_at_end();
 	const unsigned chatbox_position = log.get_vertical_scrollbar_item_position();
 
-	const std::string before_message = log.get_label().empty() ? "" : "\n";
-	const std::string new_text = formatter()
-		<< log.get_label() << before_message << "<span color='#bcb088'>" << preferences::get_chat_timestamp(std::time(0)) << text << "</span>";
+	std::deque<std::string>& messages = open_windows_[id].messages;
+	messages.push_back(formatter()
+		<< "<span color='#bcb088'>" << preferences::get_chat_timestamp(std::time(0)) << text << "</span>");
+	while(messages.size() > max_messages) {
+		messages.pop_front();
+	}
+
+	std::ostringstream stream;
+	for(const std::string& message : messages) {
+		if(&message != &messages.front()) {
+			stream << '\n';
+		}
+		stream << message;
+	}
+
+	const std::string new_text = stream.str();
 
 	log.set_use_markup(true);
 	log.set_label(new_text);
@@ -257,6 +280,7 @@ void chatbox::clear_messages()
 	const auto id = active_window_;
 	grid& grid = chat_log_container_->page_grid(id);
 	scroll_label& log = find_widget<scroll_label>(&grid, "log_text", false);
+	open_windows_[id].messages.clear();
 	log.set_label("");
 }
 
@@ -407,6 +431,12 @@ lobby_chat_window* chatbox::find_or_create_window(const std::string& name,
 
 	open_windows_.emplace_back(name, whisper);
 
+	// A log restored from a previous lobby visit enters the ring as one
+	// entry; it ages out as new messages arrive.
+	if(!initial_text.empty()) {
+		open_windows_.back().messages.push_back(initial_text);
+	}
+
 	//
 	// Add a new chat log page.
 	//
@@ -20,6 +20,7 @@
 #include "game_initialization/lobby_info.hpp"
 #include "gui/widgets/container_base.hpp"
 
+#include <deque>
 #include <map>
 #include <string>
 
@@ -49,6 +50,13 @@ struct lobby_chat_window
 	std::string name;
 	bool whisper;
 	int pending_messages;
+
+	/**
+	 * The most recent messages of this window, oldest first. Bounded, so
+	 * the displayed log is rebuilt from a fixed number of entries however
+	 * long the session runs.
+	 */
+	std::deque<std::string> messages;
 };
 
 class chatbox : public container_base, public events::chat_handler
@@ -199,6 +199,15 @@ void horizontal_list::set_visible_rectangle(const SDL_Rect& rectangle)
 	 */
 	for(std::size_t i = 0; i < get_item_count(); ++i) {
 		grid& grid = item_ordered(i);
+
+		// Skip rows that were clipped away entirely and stay that way;
+		// their whole widget tree already has the state this call would
+		// set. See vertical_list::set_visible_rectangle.
+		if(grid.get_drawing_action() == widget::redraw_action::none
+				&& grid.get_rectangle().intersect(rectangle).empty()) {
+			continue;
+		}
+
 		grid.set_visible_rectangle(rectangle);
 	}
 }
@@ -207,15 +216,24 @@ widget* horizontal_list::find_at(const point& coordinate, const bool must_be_act
 {
 	assert(get_window());
 
+	// The rows are laid out left to right in ordered (on-screen) order, so
+	// only the row under the coordinate needs its widget tree searched and
+	// the walk can stop once it has passed the coordinate.
 	for(std::size_t i = 0; i < get_item_count(); ++i) {
-		if(!get_item_shown(i)) {
+		const unsigned index = get_item_at_ordered(i);
+		if(!get_item_shown(index)) {
 			continue;
 		}
 
-		widget* widget = item(i).find_at(coordinate, must_be_active);
+		grid& grid = item(index);
+		const rect rectangle = grid.get_rectangle();
 
-		if(widget) {
-			return widget;
+		if(coordinate.x < rectangle.x) {
+			break;
+		}
+
+		if(rectangle.contains(coordinate)) {
+			return grid.find_at(coordinate, must_be_active);
 		}
 	}
 
@@ -227,14 +245,20 @@ const widget* horizontal_list::find_at(const point& coordinate, const bool must_
 	assert(get_window());
 
 	for(std::size_t i = 0; i < get_item_count(); ++i) {
-		if(!get_item_shown(i)) {
+		const unsigned index = get_item_at_ordered(i);
+		if(!get_item_shown(index)) {
 			continue;
 		}
 
-		const widget* widget = item(i).find_at(coordinate, must_be_active);
+		const grid& grid = item(index);
+		const rect rectangle = grid.get_rectangle();
 
-		if(widget) {
-			return widget;
+		if(coordinate.x < rectangle.x) {
+			break;
+		}
+
+		if(rectangle.contains(coordinate)) {
+			return grid.find_at(coordinate, must_be_active);
 		}
 	}
 
@@ -410,6 +434,19 @@ void vertical_list::set_visible_rectangle(const SDL_Rect& rectangle)
 	 */
 	for(std::size_t i = 0; i < get_item_count(); ++i) {
 		grid& grid = item(i);
+
+		/*
+		 * A row that was entirely clipped away and remains so keeps the
+		 * same state (empty clip, no redraw) for its whole widget tree,
+		 * so the recursion can be skipped. With long lists nearly every
+		 * row is off-screen, which makes scrolling O(viewport) instead
+		 * of O(rows).
+		 */
+		if(grid.get_drawing_action() == widget::redraw_action::none
+				&& grid.get_rectangle().intersect(rectangle).empty()) {
+			continue;
+		}
+
 		grid.set_visible_rectangle(rectangle);
 	}
 }
@@ -418,15 +455,24 @@ widget* vertical_list::find_at(const point& coordinate, const bool must_be_activ
 {
 	assert(get_window());
 
+	// The rows are stacked top to bottom in ordered (on-screen) order, so
+	// only the row under the coordinate needs its widget tree searched and
+	// the walk can stop once it has passed the coordinate.
 	for(std::size_t i = 0; i < get_item_count(); ++i) {
-		if(!get_item_shown(i)) {
+		const unsigned index = get_item_at_ordered(i);
+		if(!get_item_shown(index)) {
 			continue;
 		}
 
-		widget* widget = item(i).find_at(coordinate, must_be_active);
+		grid& grid = item(index);
+		const rect rectangle = grid.get_rectangle();
 
-		if(widget) {
-			return widget;
+		if(coordinate.y < rectangle.y) {
+			break;
+		}
+
+		if(rectangle.contains(coordinate)) {
+			return grid.find_at(coordinate, must_be_active);
 		}
 	}
 	return nullptr;
@@ -437,14 +483,20 @@ const widget* vertical_list::find_at(const point& coordinate, const bool must_be
 	assert(get_window());
 
 	for(std::size_t i = 0; i < get_item_count(); ++i) {
-		if(!get_item_shown(i)) {
+		const unsigned index = get_item_at_ordered(i);
+		if(!get_item_shown(index)) {
 			continue;
 		}
 
-		const widget* widget = item(i).find_at(coordinate, must_be_active);
+		const grid& grid = item(index);
+		const rect rectangle = grid.get_rectangle();
 
-		if(widget) {
-			return widget;
+		if(coordinate.y < rectangle.y) {
+			break;
+		}
+
+		if(rectangle.contains(coordinate)) {
+			return grid.find_at(coordinate, must_be_active);
 		}
 	}
 	return nullptr;
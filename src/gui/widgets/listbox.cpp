@@ -412,6 +412,21 @@ void listbox::resize_content(const widget& row)
 		return;
 	}
 
+	/*
+	 * When the initial layout hasn't run yet, or a new layout phase is
+	 * already pending, content_resize_request() bails out anyway; don't
+	 * pay for a full best-size calculation of the row (which measures
+	 * every piece of text in it) just to find that out. Dialogs filling
+	 * a big list row by row in pre_show() hit this path for every row.
+	 */
+	if(get_size() == point()) {
+		return;
+	}
+
+	if(window* window = get_window(); window && window->get_need_layout()) {
+		return;
+	}
+
 	DBG_GUI_L << LOG_HEADER << " current size " << content_grid()->get_size() << " row size " << row.get_best_size()
 			  << ".";
 
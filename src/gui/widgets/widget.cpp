@@ -24,6 +24,7 @@
 #include "gui/core/log.hpp"
 #include "gui/core/window_builder/helper.hpp"
 #include "sdl/rect.hpp"
+#include "utils/alloc_tracking.hpp"
 #include "video.hpp"
 
 namespace gui2
@@ -40,6 +41,7 @@ widget::widget()
 	, width_(0)
 	, height_(0)
 	, layout_size_()
+	, cached_best_size_()
 #ifdef DEBUG_WINDOW_LAYOUT_GRAPHS
 	, last_best_size_()
 #endif
@@ -62,6 +64,7 @@ widget::widget(const builder_widget& builder)
 	, width_(0)
 	, height_(0)
 	, layout_size_()
+	, cached_best_size_()
 #ifdef DEBUG_WINDOW_LAYOUT_GRAPHS
 	, last_best_size_()
 #endif
@@ -94,6 +97,18 @@ widget::~widget()
 	}
 }
 
+void* widget::operator new(std::size_t size)
+{
+	utils::alloc_tracking::track_alloc(utils::alloc_tracking::tag::gui2_widget, size);
+	return ::operator new(size);
+}
+
+void widget::operator delete(void* p, std::size_t size)
+{
+	utils::alloc_tracking::track_free(utils::alloc_tracking::tag::gui2_widget, size);
+	::operator delete(p);
+}
+
 /***** ***** ***** ***** ID functions. ***** ***** ***** *****/
 
 void widget::set_id(const std::string& id)
@@ -171,6 +186,7 @@ void widget::layout_initialize(const bool /*full_initialization*/)
 	assert(get_window());
 
 	layout_size_ = point();
+	cached_best_size_ = point();
 	if(!linked_group_.empty()) {
 		get_window()->add_linked_widget(linked_group_, this);
 	}
@@ -197,13 +213,29 @@ point widget::get_best_size() const
 
 	point result = layout_size_;
 	if(result == point()) {
-		result = calculate_best_size();
-		//Adjust to linked widget size if linked widget size was already calculated.
-		if(!get_window()->get_need_layout() && !linked_group_.empty())
-		{
-			point linked_size = get_window()->get_linked_size(linked_group_);
-			result.x = std::max(result.x, linked_size.x);
-			result.y = std::max(result.y, linked_size.y);
+		if(get_window()->get_need_layout()) {
+			/*
+			 * A layout phase measures the same unchanged subtrees over
+			 * and over while it negotiates sizes, so memoize the result
+			 * until something below us changes size or visibility. The
+			 * cache is only trusted during the layout phase; outside it
+			 * widgets can change in ways that don't pass through
+			 * set_layout_size(), so there we always recalculate.
+			 */
+			if(cached_best_size_ == point()) {
+				cached_best_size_ = calculate_best_size();
+			}
+
+			result = cached_best_size_;
+		} else {
+			result = calculate_best_size();
+			//Adjust to linked widget size if linked widget size was already calculated.
+			if(!linked_group_.empty())
+			{
+				point linked_size = get_window()->get_linked_size(linked_group_);
+				result.x = std::max(result.x, linked_size.x);
+				result.y = std::max(result.y, linked_size.y);
+			}
 		}
 	}
 
@@ -336,6 +368,14 @@ unsigned widget::get_height() const
 void widget::set_layout_size(const point& size)
 {
 	layout_size_ = size;
+	clear_cached_best_size();
+}
+
+void widget::clear_cached_best_size()
+{
+	for(widget* current = this; current != nullptr; current = current->parent_) {
+		current->cached_best_size_ = point();
+	}
 }
 
 const point& widget::layout_size() const
@@ -464,6 +504,7 @@ void widget::set_visible(const visibility visible)
 	const bool need_resize = visible_ == visibility::invisible
 		|| (visible == visibility::invisible && get_size() != point());
 	visible_ = visible;
+	clear_cached_best_size();
 
 	if(need_resize) {
 		if(visible == visibility::visible && new_widgets) {
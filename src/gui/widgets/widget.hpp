@@ -153,6 +153,15 @@ public:
 
 	virtual ~widget() override;
 
+	/**
+	 * Accounts every heap-allocated widget under one allocation tag.
+	 *
+	 * Derived widgets are created with std::make_unique, whose `new Derived`
+	 * finds this inherited operator; the virtual destructor guarantees the
+	 * sized delete below sees the most-derived size.
+	 */
+	static void* operator new(std::size_t size);
+	static void operator delete(void* p, std::size_t size);
 
 	/***** ***** ***** ***** ID functions. ***** ***** ***** *****/
 
@@ -486,6 +495,24 @@ private:
 	 */
 	point layout_size_;
 
+	/**
+	 * Memoized result of @ref calculate_best_size.
+	 *
+	 * A layout phase measures the same unchanged subtrees several times
+	 * while it negotiates sizes, and recalculating a big grid each time
+	 * means walking its whole widget tree. The value is only trusted
+	 * during a layout phase and is thrown away, for this widget and all
+	 * its ancestors, whenever @ref layout_size_ or the visibility
+	 * changes. (0,0) means nothing is cached.
+	 */
+	mutable point cached_best_size_;
+
+	/**
+	 * Throws away @ref cached_best_size_ of this widget and its
+	 * ancestors, so the next @ref get_best_size recalculates them.
+	 */
+	void clear_cached_best_size();
+
 #ifdef DEBUG_WINDOW_LAYOUT_GRAPHS
 
 	/**
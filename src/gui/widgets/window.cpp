@@ -28,6 +28,7 @@
 #include "events.hpp"
 #include "formula/callable.hpp"
 #include "formula/string_utils.hpp"
+#include "frame_profiler.hpp"
 #include "gettext.hpp"
 #include "log.hpp"
 #include "gui/auxiliary/typed_formula.hpp"
@@ -654,6 +655,7 @@ bool window::expose(const rect& region)
 	if (i.empty()) {
 		return false;
 	}
+	frame_profiler::scope profile(frame_profiler::subsystem::gui);
 	draw();
 	return true;
 }
@@ -60,7 +60,16 @@ class halo_impl
 		void queue_undraw();
 		void queue_redraw();
 		void update();
-		bool render();
+
+		/** Advances the animation and reports whether the halo needs drawing. */
+		bool prepare_render();
+
+		/** Issues the draw. The caller is responsible for clipping and ordering. */
+		void draw();
+
+		/** The texture of the current animation frame, used to batch draws. */
+		SDL_Texture* frame_texture() const { return tex_.get(); }
+		ORIENTATION orientation() const { return orientation_; }
 
 		bool expired()     const { return !images_.cycles() && images_.animation_finished(); }
 		bool need_update() const { return images_.need_update(); }
@@ -207,8 +216,12 @@ void halo_impl::effect::update()
 		}
 	}
 
-	// Load texture for current animation frame
-	tex_ = image::get_texture(current_image());
+	// Load texture for current animation frame.
+	// Static haloes keep the same frame forever, so for those the per-frame
+	// cache lookup is skipped once the texture is in hand.
+	if(!tex_ || does_change()) {
+		tex_ = image::get_texture(current_image());
+	}
 	if(!tex_) {
 		ERR_HL << "no texture found for current halo animation frame";
 		screen_loc_ = {};
@@ -252,21 +265,19 @@ bool halo_impl::effect::visible()
 	return true;
 }
 
-bool halo_impl::effect::render()
+bool halo_impl::effect::prepare_render()
 {
 	// This should only be set if we actually draw something
 	last_draw_loc_ = {};
 
-	// Update animation frame, even if we didn't actually draw it
+	// Update animation frame, even if we don't end up drawing it
 	images_.update_last_draw_time();
 
-	if(!visible()) {
-		return false;
-	}
-
-	// Make sure we clip to the map area
-	auto clipper = draw::reduce_clip(disp->map_outside_area());
+	return visible();
+}
 
+void halo_impl::effect::draw()
+{
 	DBG_HL << "drawing halo at " << screen_loc_;
 
 	if (orientation_ == NORMAL) {
@@ -278,8 +289,6 @@ bool halo_impl::effect::render()
 	}
 
 	last_draw_loc_ = screen_loc_;
-
-	return true;
 }
 
 void halo_impl::effect::queue_undraw()
@@ -405,10 +414,65 @@ void halo_impl::render(const rect& region)
 		return;
 	}
 
+	// Haloes sharing a frame texture are submitted back to back, so the
+	// renderer's internal batching can merge them into a single draw call.
+	// Auras and illumination tend to use the same handful of images for
+	// every affected unit, which is where this matters.
+	//
+	// Draw order only affects the result where haloes overlap, so an effect
+	// may only join an earlier batch if nothing drawn after that batch
+	// overlaps it. Overlapping the batch itself is fine: the effect is
+	// appended, keeping its relative order within the batch.
+	struct batch
+	{
+		SDL_Texture* tex;
+		ORIENTATION orientation;
+		rect cover;
+		std::vector<effect*> members;
+	};
+	std::vector<batch> batches;
+
 	for(auto& [id, effect] : haloes) {
-		if(region.overlaps(effect.get_draw_location())) {
-			DBG_HL << "drawing intersected halo " << id;
-			effect.render();
+		if(!region.overlaps(effect.get_draw_location())) {
+			continue;
+		}
+		DBG_HL << "drawing intersected halo " << id;
+		if(!effect.prepare_render()) {
+			continue;
+		}
+
+		const rect loc = effect.get_draw_location();
+		batch* target = nullptr;
+		for(auto b = batches.rbegin(); b != batches.rend(); ++b) {
+			if(b->tex == effect.frame_texture() && b->orientation == effect.orientation()) {
+				target = &*b;
+				break;
+			}
+			if(loc.overlaps(b->cover)) {
+				// Joining any batch before this one would draw the halo
+				// under something it should be drawn over.
+				break;
+			}
+		}
+
+		if(target) {
+			target->cover.expand_to_cover(loc);
+			target->members.push_back(&effect);
+		} else {
+			batches.push_back({effect.frame_texture(), effect.orientation(), loc, {&effect}});
+		}
+	}
+
+	if(batches.empty()) {
+		return;
+	}
+
+	// Make sure we clip to the map area
+	auto clipper = draw::reduce_clip(display::get_singleton()->map_outside_area());
+
+	for(batch& b : batches) {
+		for(effect* e : b.members) {
+			e->draw();
 		}
 	}
 }
@@ -417,7 +417,6 @@ std::vector<topic> generate_time_of_day_topics(const bool /*sort_generated*/)
 		const std::string image_neutral = "<img>src='icons/alignments/alignment_neutral_30.png'</img>";
 		const std::string image_chaotic = "<img>src='icons/alignments/alignment_chaotic_30.png'</img>";
 		const std::string image_liminal = "<img>src='icons/alignments/alignment_liminal_30.png'</img>";
-		std::stringstream text;
 
 		const int lawful_bonus = generic_combat_modifier(time.lawful_bonus, unit_alignments::type::lawful, false, resources::tod_manager->get_max_liminal_bonus());
 		const int neutral_bonus = generic_combat_modifier(time.lawful_bonus, unit_alignments::type::neutral, false, resources::tod_manager->get_max_liminal_bonus());
@@ -430,14 +429,19 @@ std::vector<topic> generate_time_of_day_topics(const bool /*sort_generated*/)
 			image_chaotic << time_of_day_bonus_colored(chaotic_bonus) << jump_to(520) <<
 			image_liminal << time_of_day_bonus_colored(liminal_bonus) << '\n';
 
-		text << image << '\n' << time.description.str() << '\n' <<
-			image_lawful << _("Lawful Bonus:") << ' ' << time_of_day_bonus_colored(lawful_bonus) << '\n' <<
-			image_neutral << _("Neutral Bonus:") << ' ' << time_of_day_bonus_colored(neutral_bonus) << '\n' <<
-			image_chaotic << _("Chaotic Bonus:") << ' ' << time_of_day_bonus_colored(chaotic_bonus) << '\n' <<
-			image_liminal << _("Liminal Bonus:") << ' ' << time_of_day_bonus_colored(liminal_bonus) << '\n' <<
-			'\n' << make_link(_("Schedule"), "..schedule");
+		auto generator = [time, image, image_lawful, image_neutral, image_chaotic, image_liminal,
+				lawful_bonus, neutral_bonus, chaotic_bonus, liminal_bonus]() {
+			std::stringstream text;
+			text << image << '\n' << time.description.str() << '\n' <<
+				image_lawful << _("Lawful Bonus:") << ' ' << time_of_day_bonus_colored(lawful_bonus) << '\n' <<
+				image_neutral << _("Neutral Bonus:") << ' ' << time_of_day_bonus_colored(neutral_bonus) << '\n' <<
+				image_chaotic << _("Chaotic Bonus:") << ' ' << time_of_day_bonus_colored(chaotic_bonus) << '\n' <<
+				image_liminal << _("Liminal Bonus:") << ' ' << time_of_day_bonus_colored(liminal_bonus) << '\n' <<
+				'\n' << make_link(_("Schedule"), "..schedule");
+			return text.str();
+		};
 
-		topics.emplace_back(time.name.str(), id, text.str());
+		topics.emplace_back(time.name.str(), id, std::make_shared<function_topic_generator>(generator));
 	}
 
 	topics.emplace_back(_("Time of Day Schedule"), "..schedule", toplevel.str());
@@ -525,15 +529,17 @@ std::vector<topic> generate_weapon_special_topics(const bool sort_generated)
 			s != special_description.end(); ++s) {
 		// use untranslated name to have universal topic id
 		std::string id = "weaponspecial_" + s->first.base_str();
-		std::stringstream text;
-		text << s->second;
-		text << "\n\n" << _("<header>text='Units with this special attack'</header>") << "\n";
-		std::set<std::string, string_less> &units = special_units[s->first];
-		for (std::set<std::string, string_less>::iterator u = units.begin(); u != units.end(); ++u) {
-			text << font::unicode_bullet << " " << (*u) << "\n";
-		}
+		auto generator = [description = s->second, units = std::move(special_units[s->first])]() {
+			std::stringstream text;
+			text << description;
+			text << "\n\n" << _("<header>text='Units with this special attack'</header>") << "\n";
+			for (std::set<std::string, string_less>::const_iterator u = units.begin(); u != units.end(); ++u) {
+				text << font::unicode_bullet << " " << (*u) << "\n";
+			}
+			return text.str();
+		};
 
-		topics.emplace_back(s->first, id, text.str());
+		topics.emplace_back(s->first, id, std::make_shared<function_topic_generator>(generator));
 	}
 
 	if (sort_generated)
@@ -589,15 +595,19 @@ std::vector<topic> generate_ability_topics(const bool sort_generated)
 		if (a.second->name.empty()) {
 			continue;
 		}
-		std::ostringstream text;
-		text << a.second->description;
-		text << "\n\n" << _("<header>text='Units with this ability'</header>") << "\n";
+		auto generator = [description = a.second->description, units = std::move(ability_units[a.first])]() {
+			std::ostringstream text;
+			text << description;
+			text << "\n\n" << _("<header>text='Units with this ability'</header>") << "\n";
 
-		for(const auto& u : ability_units[a.first]) { // first is the topic ref id
-			text << font::unicode_bullet << " " << u << "\n";
-		}
+			for(const auto& u : units) {
+				text << font::unicode_bullet << " " << u << "\n";
+			}
+
+			return text.str();
+		};
 
-		topics.emplace_back(a.second->name, ability_prefix + a.first, text.str());
+		topics.emplace_back(a.second->name, ability_prefix + a.first, std::make_shared<function_topic_generator>(generator));
 	}
 
 	if(sort_generated) {
@@ -619,24 +629,26 @@ std::vector<topic> generate_era_topics(const bool sort_generated, const std::str
 		for (const topic & t : topics) {
 			faction_links.push_back(make_link(t.title, t.id));
 		}
+		std::sort(faction_links.begin(), faction_links.end());
 
-		std::stringstream text;
-		text << "<header>text='" << _("Era:") << " " << era["name"] << "'</header>" << "\n";
-		text << "\n";
-		const config::attribute_value& description = era["description"];
-		if (!description.empty()) {
-			text << description.t_str() << "\n";
+		auto generator = [name = era["name"].t_str(), description = era["description"].t_str(), faction_links]() {
+			std::stringstream text;
+			text << "<header>text='" << _("Era:") << " " << name << "'</header>" << "\n";
 			text << "\n";
-		}
+			if (!description.empty()) {
+				text << description << "\n";
+				text << "\n";
+			}
 
-		text << "<header>text='" << _("Factions") << "'</header>" << "\n";
+			text << "<header>text='" << _("Factions") << "'</header>" << "\n";
 
-		std::sort(faction_links.begin(), faction_links.end());
-		for (const std::string &link : faction_links) {
-			text << font::unicode_bullet << " " << link << "\n";
-		}
+			for (const std::string &link : faction_links) {
+				text << font::unicode_bullet << " " << link << "\n";
+			}
+			return text.str();
+		};
 
-		topic era_topic(era["name"], ".." + era_prefix + era["id"].str(), text.str());
+		topic era_topic(era["name"], ".." + era_prefix + era["id"].str(), std::make_shared<function_topic_generator>(generator));
 
 		topics.push_back( era_topic );
 	}
@@ -651,67 +663,72 @@ std::vector<topic> generate_faction_topics(const config & era, const bool sort_g
 		if (id == "Random")
 			continue;
 
-		std::stringstream text;
+		// The deferred body needs its own copy: the era config may be
+		// rebuilt (e.g. on a cache refresh) while this topic is alive.
+		auto generator = [side = f]() {
+			std::stringstream text;
 
-		const config::attribute_value& description = f["description"];
-		if (!description.empty()) {
-			text << description.t_str() << "\n";
-			text << "\n";
-		}
+			const config::attribute_value& description = side["description"];
+			if (!description.empty()) {
+				text << description.t_str() << "\n";
+				text << "\n";
+			}
 
-		const std::vector<std::string> recruit_ids = utils::split(f["recruit"]);
-		std::set<std::string> races;
-		std::set<std::string> alignments;
+			const std::vector<std::string> recruit_ids = utils::split(side["recruit"]);
+			std::set<std::string> races;
+			std::set<std::string> alignments;
 
-		for (const std::string & u_id : recruit_ids) {
-			if (const unit_type * t = unit_types.find(u_id, unit_type::HELP_INDEXED)) {
-				assert(t);
-				const unit_type & type = *t;
+			for (const std::string & u_id : recruit_ids) {
+				if (const unit_type * t = unit_types.find(u_id, unit_type::HELP_INDEXED)) {
+					assert(t);
+					const unit_type & type = *t;
 
-				if (const unit_race *r = unit_types.find_race(type.race_id())) {
-					races.insert(make_link(r->plural_name(), std::string("..") + race_prefix + r->id()));
+					if (const unit_race *r = unit_types.find_race(type.race_id())) {
+						races.insert(make_link(r->plural_name(), std::string("..") + race_prefix + r->id()));
+					}
+					alignments.insert(make_link(type.alignment_description(type.alignment(), type.genders().front()), "time_of_day"));
 				}
-				alignments.insert(make_link(type.alignment_description(type.alignment(), type.genders().front()), "time_of_day"));
 			}
-		}
 
-		if (!races.empty()) {
-			std::set<std::string>::iterator it = races.begin();
-			text << _("Races: ") << *(it++);
-			while(it != races.end()) {
-				text << ", " << *(it++);
+			if (!races.empty()) {
+				std::set<std::string>::iterator it = races.begin();
+				text << _("Races: ") << *(it++);
+				while(it != races.end()) {
+					text << ", " << *(it++);
+				}
+				text << "\n\n";
 			}
-			text << "\n\n";
-		}
 
-		if (!alignments.empty()) {
-			std::set<std::string>::iterator it = alignments.begin();
-			text << _("Alignments: ") << *(it++);
-			while(it != alignments.end()) {
-				text << ", " << *(it++);
+			if (!alignments.empty()) {
+				std::set<std::string>::iterator it = alignments.begin();
+				text << _("Alignments: ") << *(it++);
+				while(it != alignments.end()) {
+					text << ", " << *(it++);
+				}
+				text << "\n\n";
 			}
-			text << "\n\n";
-		}
 
-		text << "<header>text='" << _("Leaders") << "'</header>" << "\n";
-		const std::vector<std::string> leaders =
-				make_unit_links_list( utils::split(f["leader"]), true );
-		for (const std::string &link : leaders) {
-			text << font::unicode_bullet << " " << link << "\n";
-		}
+			text << "<header>text='" << _("Leaders") << "'</header>" << "\n";
+			const std::vector<std::string> leaders =
+					make_unit_links_list( utils::split(side["leader"]), true );
+			for (const std::string &link : leaders) {
+				text << font::unicode_bullet << " " << link << "\n";
+			}
 
-		text << "\n";
+			text << "\n";
 
-		text << "<header>text='" << _("Recruits") << "'</header>" << "\n";
-		const std::vector<std::string> recruit_links =
-				make_unit_links_list( recruit_ids, true );
-		for (const std::string &link : recruit_links) {
-			text << font::unicode_bullet << " " << link << "\n";
-		}
+			text << "<header>text='" << _("Recruits") << "'</header>" << "\n";
+			const std::vector<std::string> recruit_links =
+					make_unit_links_list( recruit_ids, true );
+			for (const std::string &link : recruit_links) {
+				text << font::unicode_bullet << " " << link << "\n";
+			}
+			return text.str();
+		};
 
 		const std::string name = f["name"];
 		const std::string ref_id = faction_prefix + era["id"] + "_" + id;
-		topics.emplace_back(name, ref_id, text.str());
+		topics.emplace_back(name, ref_id, std::make_shared<function_topic_generator>(generator));
 	}
 	if (sort_generated)
 		std::sort(topics.begin(), topics.end(), title_less());
@@ -1119,58 +1136,62 @@ std::vector<topic> generate_unit_topics(const bool sort_generated, const std::st
 		}
 	}
 
-	std::stringstream text;
+	auto generator = [race_description, alignments, race_help_taxonomy, subgroups, race_units]() {
+		std::stringstream text;
 
-	if (!race_description.empty()) {
-		text << race_description << "\n\n";
-	}
+		if (!race_description.empty()) {
+			text << race_description << "\n\n";
+		}
 
-	if (!alignments.empty()) {
-		std::set<std::string>::iterator it = alignments.begin();
-		text << (alignments.size() > 1 ? _("Alignments: ") : _("Alignment: ")) << *(it++);
-		while(it != alignments.end()) {
-			text << ", " << *(it++);
+		if (!alignments.empty()) {
+			std::set<std::string>::const_iterator it = alignments.begin();
+			text << (alignments.size() > 1 ? _("Alignments: ") : _("Alignment: ")) << *(it++);
+			while(it != alignments.end()) {
+				text << ", " << *(it++);
+			}
+			text << "\n\n";
 		}
-		text << "\n\n";
-	}
 
-	if (!race_help_taxonomy.empty()) {
-		utils::string_map symbols;
-		symbols["topic_id"] = "..race_"+race_help_taxonomy;
-		if (const unit_race *r = unit_types.find_race(race_help_taxonomy)) {
-			symbols["help_taxonomy"] = r->plural_name();
-		} else {
-			// Fall back to using showing the race id for the race that we couldn't find.
-			// Not great, but probably useful if UMC has a broken link.
-			symbols["help_taxonomy"] = race_help_taxonomy;
+		if (!race_help_taxonomy.empty()) {
+			utils::string_map symbols;
+			symbols["topic_id"] = "..race_"+race_help_taxonomy;
+			if (const unit_race *r = unit_types.find_race(race_help_taxonomy)) {
+				symbols["help_taxonomy"] = r->plural_name();
+			} else {
+				// Fall back to using showing the race id for the race that we couldn't find.
+				// Not great, but probably useful if UMC has a broken link.
+				symbols["help_taxonomy"] = race_help_taxonomy;
+			}
+			// TRANSLATORS: this is expected to say "[Dunefolk are] a group of units, all of whom are Humans",
+			// or "[Quenoth Elves are] a group of units, all of whom are Elves".
+			text << VGETTEXT("This is a group of units, all of whom are <ref>dst='$topic_id' text='$help_taxonomy'</ref>.", symbols) << "\n\n";
+		}
+
+		if (!subgroups.empty()) {
+			if (!race_help_taxonomy.empty()) {
+				text << _("<header>text='Subgroups of units within this group'</header>") << "\n";
+			} else {
+				text << _("<header>text='Groups of units within this race'</header>") << "\n";
+			}
+			for (const auto &sg : subgroups) {
+				text << font::unicode_bullet << " " << make_link(sg.second, "..race_" + sg.first) << "\n";
+			}
+			text << "\n";
 		}
-		// TRANSLATORS: this is expected to say "[Dunefolk are] a group of units, all of whom are Humans",
-		// or "[Quenoth Elves are] a group of units, all of whom are Elves".
-		text << VGETTEXT("This is a group of units, all of whom are <ref>dst='$topic_id' text='$help_taxonomy'</ref>.", symbols) << "\n\n";
-	}
 
-	if (!subgroups.empty()) {
 		if (!race_help_taxonomy.empty()) {
-			text << _("<header>text='Subgroups of units within this group'</header>") << "\n";
+			text << _("<header>text='Units of this group'</header>") << "\n";
 		} else {
-			text << _("<header>text='Groups of units within this race'</header>") << "\n";
+			text << _("<header>text='Units of this race'</header>") << "\n";
 		}
-		for (const auto &sg : subgroups) {
-			text << font::unicode_bullet << " " << make_link(sg.second, "..race_" + sg.first) << "\n";
+		for (const auto &u : race_units) {
+			text << font::unicode_bullet << " " << u << "\n";
 		}
-		text << "\n";
-	}
 
-	if (!race_help_taxonomy.empty()) {
-		text << _("<header>text='Units of this group'</header>") << "\n";
-	} else {
-		text << _("<header>text='Units of this race'</header>") << "\n";
-	}
-	for (const auto &u : race_units) {
-		text << font::unicode_bullet << " " << u << "\n";
-	}
+		return text.str();
+	};
 
-	topics.emplace_back(race_name, race_id, text.str());
+	topics.emplace_back(race_name, race_id, std::make_shared<function_topic_generator>(generator));
 
 	if (sort_generated)
 		std::sort(topics.begin(), topics.end(), title_less());
@@ -38,6 +38,7 @@
 #include "gettext.hpp"
 #include <optional>
 #include <cstring>
+#include <functional>                   // for function
 #include <list>                         // for list
 #include <memory>
 #include <ostream>                      // for operator<<, stringstream, etc
@@ -76,6 +77,18 @@ public:
 	virtual std::string operator()() const { return text_; }
 };
 
+/**
+ * Assembles topic text from a captured callable on first view. The list
+ * builders use this so that opening the help browser only enumerates
+ * titles, and a topic's body is put together when it is actually visited.
+ */
+class function_topic_generator: public topic_generator {
+	std::function<std::string()> generator_;
+public:
+	explicit function_topic_generator(std::function<std::string()> g): generator_(std::move(g)) {}
+	virtual std::string operator()() const { return generator_(); }
+};
+
 /**
  * The text displayed in a topic. It is generated on the fly with the information contained in generator_
  */
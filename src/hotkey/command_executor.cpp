@@ -24,6 +24,7 @@
 #include "gui/dialogs/drop_down_menu.hpp"
 #include "gui/widgets/retval.hpp"
 #include "filesystem.hpp"
+#include "frame_profiler.hpp"
 #include "gettext.hpp"
 #include "log.hpp"
 #include "preferences/general.hpp"
@@ -647,6 +648,15 @@ void command_executor::execute_command_wrap(const command_executor::queued_comma
 		case HOTKEY_MOUSE_SCROLL:
 			preferences::enable_mouse_scroll(!preferences::mouse_scroll_enabled());
 			break;
+		case HOTKEY_PROFILER:
+			frame_profiler::toggle();
+			break;
+		case HOTKEY_PROFILER_DUMP:
+			{
+				const std::string filename = frame_profiler::dump();
+				gui2::show_transient_message(_("Frame Profiler"), _("Profile data written to:") + std::string("\n") + filename);
+			}
+			break;
 		case HOTKEY_MUTE:
 			{
 				// look if both is not playing
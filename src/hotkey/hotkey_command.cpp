@@ -118,6 +118,8 @@ constexpr std::array<hotkey_command_temp, HOTKEY_NULL - 1> master_hotkey_list {{
 	{ HOTKEY_MOUSE_SCROLL, "mousescroll", N_("Mouse Scrolling"), false, scope_game | scope_editor, HKCAT_GENERAL, "" },
 	{ HOTKEY_STATUS_TABLE, "statustable", N_("Status Table"), false, scope_game, HKCAT_GENERAL, "" },
 	{ HOTKEY_MUTE, "mute", N_("Mute"), false, scope_game | scope_editor | scope_main, HKCAT_GENERAL, "" },
+	{ HOTKEY_PROFILER, "profiler", N_("Toggle Frame Profiler"), false, scope_game | scope_editor | scope_main, HKCAT_GENERAL, N_("Overlays per-subsystem frame times on the screen") },
+	{ HOTKEY_PROFILER_DUMP, "profilerdump", N_("Dump Frame Profiler Data"), false, scope_game | scope_editor | scope_main, HKCAT_GENERAL, N_("Writes the recorded frame times to profile_log.csv in the user data directory") },
 	{ HOTKEY_SPEAK, "speak", N_("Speak"), false, scope_game, HKCAT_CHAT, "" },
 	{ HOTKEY_CREATE_UNIT, "createunit", N_("Create Unit (Debug!)"), false, scope_game, HKCAT_DEBUG, "" },
 	{ HOTKEY_CHANGE_SIDE, "changeside", N_("Change Side (Debug!)"), false, scope_game, HKCAT_DEBUG, "" },
@@ -315,6 +317,11 @@ const std::set<HOTKEY_COMMAND> toggle_commands {
 // Contains copies of master_hotkey_list and all current active wml menu hotkeys
 std::map<std::string_view, hotkey::hotkey_command> registered_hotkeys;
 
+// Fast lookup of the static commands by their HOTKEY_COMMAND value.
+// WML hotkeys all share HOTKEY_WML and are not indexed here; map nodes are
+// stable, so these pointers stay valid for the lifetime of registered_hotkeys.
+std::array<const hotkey::hotkey_command*, HOTKEY_NULL + 1> commands_by_enum {};
+
 hk_scopes scope_active(0);
 } // end anon namespace
 
@@ -354,11 +361,10 @@ bool is_scope_active(hk_scopes s)
 
 const hotkey_command& get_hotkey_command(const std::string& command)
 {
-	try {
-		return registered_hotkeys.at(command);
-	} catch(const std::out_of_range&) {
-		return hotkey_command::null_command();
-	}
+	// This runs for every bound hotkey on every keystroke, so avoid
+	// exception-based control flow for the unknown-command case.
+	const auto iter = registered_hotkeys.find(command);
+	return iter != registered_hotkeys.end() ? iter->second : hotkey_command::null_command();
 }
 
 const std::map<std::string_view, hotkey::hotkey_command>& get_hotkey_commands()
@@ -467,9 +473,9 @@ bool hotkey_command::null() const
 
 const hotkey_command& hotkey_command::get_command_by_command(hotkey::HOTKEY_COMMAND command)
 {
-	for(auto& [id, cmd] : registered_hotkeys) {
-		if(cmd.command == command) {
-			return cmd;
+	if(command >= 0 && command <= HOTKEY_NULL) {
+		if(const hotkey_command* cmd = commands_by_enum[command]) {
+			return *cmd;
 		}
 	}
 
@@ -480,10 +486,14 @@ const hotkey_command& hotkey_command::get_command_by_command(hotkey::HOTKEY_COMM
 void init_hotkey_commands()
 {
 	registered_hotkeys.clear();
+	commands_by_enum.fill(nullptr);
 
 	for(const hotkey_command_temp& cmd : master_hotkey_list) {
 		// Initialize the full hotkey from the temp data.
-		registered_hotkeys.try_emplace(cmd.id, cmd);
+		const auto& [iter, inserted] = registered_hotkeys.try_emplace(cmd.id, cmd);
+		if(inserted) {
+			commands_by_enum[cmd.command] = &iter->second;
+		}
 	}
 }
 
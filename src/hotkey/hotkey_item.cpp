@@ -95,11 +95,14 @@ bool hotkey_base::bindings_equal(hotkey_ptr other)
 
 bool hotkey_base::matches(const SDL_Event& event) const
 {
-	if(!hotkey::is_scope_active(hotkey::get_hotkey_command(get_command()).scope) || !active() || is_disabled()) {
+	// Compare the binding first: it is a cheap key/modifier check, while the
+	// scope test needs a string-keyed command lookup. This runs for every
+	// bound hotkey on every input event.
+	if(!matches_helper(event)) {
 		return false;
 	}
 
-	return matches_helper(event);
+	return hotkey::is_scope_active(hotkey::get_hotkey_command(get_command()).scope) && active() && !is_disabled();
 }
 
 void hotkey_base::save(config& item) const
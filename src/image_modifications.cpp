@@ -655,20 +655,16 @@ REGISTER_MOD_PARSER(TC, args)
 		return nullptr;
 	}
 
-	color_range_map rc_map;
 	try {
 		const color_range& new_color = team::get_side_color_range(side_n);
-		const std::vector<color_t>& old_color = game_config::tc_info(params[1]);
 
-		rc_map = recolor_range(new_color,old_color);
+		return new rc_modification(game_config::recolor_range_table(new_color, params[1]));
 	} catch(const config::error& e) {
 		ERR_DP << "caught config::error while processing TC: " << e.message;
 		ERR_DP << "bailing out from TC";
 
 		return nullptr;
 	}
-
-	return new rc_modification(rc_map);
 }
 
 // Team-color-based color range selection and recoloring
@@ -683,21 +679,18 @@ REGISTER_MOD_PARSER(RC, args)
 	//
 	// recolor source palette to color range
 	//
-	color_range_map rc_map;
 	try {
 		const color_range& new_color = game_config::color_info(recolor_params[1]);
-		const std::vector<color_t>& old_color = game_config::tc_info(recolor_params[0]);
 
-		rc_map = recolor_range(new_color,old_color);
+		return new rc_modification(game_config::recolor_range_table(new_color, recolor_params[0]));
 	} catch (const config::error& e) {
 		ERR_DP
 			<< "caught config::error while processing color-range RC: "
 			<< e.message;
 		ERR_DP << "bailing out from RC";
-		rc_map.clear();
 	}
 
-	return new rc_modification(rc_map);
+	return new rc_modification(color_range_map());
 }
 
 // Palette switch
@@ -23,6 +23,8 @@
 #include "resources.hpp"
 #include "tooltips.hpp"
 
+#include <algorithm>
+
 /**
  * Our definition of map labels being obscured is if the tile is obscured,
  * or the tile below is obscured. This is because in the case where the tile
@@ -49,6 +51,8 @@ map_labels::map_labels(const team* team)
 	, labels_()
 	, enabled_(true)
 	, categories_dirty(true)
+	, chunks_()
+	, chunks_dirty_(true)
 {
 }
 
@@ -56,6 +60,8 @@ map_labels::map_labels(const map_labels& other)
 	: team_(other.team_)
 	, labels_()
 	, enabled_(true)
+	, chunks_()
+	, chunks_dirty_(true)
 {
 	config cfg;
 	other.write(cfg);
@@ -196,6 +202,7 @@ const terrain_label* map_labels::set_label(const map_location& loc,
 	}
 
 	categories_dirty = true;
+	chunks_dirty_ = true;
 	return res;
 }
 
@@ -203,6 +210,7 @@ template<typename... T>
 terrain_label* map_labels::add_label(T&&... args)
 {
 	categories_dirty = true;
+	chunks_dirty_ = true;
 
 	terrain_label t(std::forward<T>(args)...);
 	return &(*labels_[t.team_name()].emplace(t.location(), std::move(t)).first).second;
@@ -235,15 +243,21 @@ void map_labels::clear_map(label_map& m, bool force)
 	}
 
 	categories_dirty = true;
+	chunks_dirty_ = true;
 }
 
 void map_labels::clear_all()
 {
 	labels_.clear();
+	chunks_dirty_ = true;
 }
 
 void map_labels::recalculate_labels()
 {
+	// Zooming (and anything else that forces a full recalculation) changes
+	// which chunks are in view, so refresh visibility first.
+	update_visibility();
+
 	for(auto& m : labels_) {
 		for(auto& l : m.second) {
 			l.second.recalculate();
@@ -275,6 +289,47 @@ bool map_labels::visible_global_label(const map_location& loc) const
 	return glabels == labels_.end() || glabels->second.find(loc) == glabels->second.end();
 }
 
+void map_labels::rebuild_chunks()
+{
+	chunks_.clear();
+
+	for(auto& m : labels_) {
+		for(auto& l : m.second) {
+			const map_location& loc = l.second.location();
+			chunks_[{loc.x / chunk_size_, loc.y / chunk_size_}].push_back(&l.second);
+		}
+	}
+
+	chunks_dirty_ = false;
+}
+
+void map_labels::update_visibility()
+{
+	display* disp = display::get_singleton();
+	if(!disp) {
+		return;
+	}
+
+	if(chunks_dirty_) {
+		rebuild_chunks();
+	}
+
+	const display::rect_of_hexes hexes = disp->get_visible_hexes();
+	const int left = hexes.left / chunk_size_;
+	const int right = hexes.right / chunk_size_;
+	const int top = std::min(hexes.top[0], hexes.top[1]) / chunk_size_;
+	const int bottom = std::max(hexes.bottom[0], hexes.bottom[1]) / chunk_size_;
+
+	for(auto& chunk : chunks_) {
+		const bool visible = chunk.first.first >= left && chunk.first.first <= right
+			&& chunk.first.second >= top && chunk.first.second <= bottom;
+
+		for(terrain_label* label : chunk.second) {
+			label->set_on_screen(visible);
+		}
+	}
+}
+
 void map_labels::recalculate_shroud()
 {
 	for(auto& m : labels_) {
@@ -325,6 +380,7 @@ terrain_label::terrain_label(const map_labels& parent,
 		const std::string& category,
 		const t_string& tooltip)
 	: handle_(0)
+	, on_screen_(true)
 	, text_(text)
 	, tooltip_(tooltip)
 	, category_(category)
@@ -344,6 +400,7 @@ terrain_label::terrain_label(const map_labels& parent,
 terrain_label::terrain_label(const map_labels& parent, const config& cfg)
 	: handle_(0)
 	, tooltip_handle_(0)
+	, on_screen_(true)
 	, text_()
 	, tooltip_()
 	, team_name_()
@@ -361,6 +418,7 @@ terrain_label::terrain_label(const map_labels& parent, const config& cfg)
 terrain_label::terrain_label(terrain_label&& l)
 	: handle_(l.handle_)
 	, tooltip_handle_(l.tooltip_handle_)
+	, on_screen_(l.on_screen_)
 	, text_(l.text_)
 	, tooltip_(l.tooltip_)
 	, category_(l.category_)
@@ -479,6 +537,11 @@ void terrain_label::update_info(const t_string& text,
 
 void terrain_label::calculate_shroud()
 {
+	// Off-screen labels hold no floating label or tooltip to update.
+	if(!on_screen_) {
+		return;
+	}
+
 	if(handle_) {
 		font::show_floating_label(handle_, !hidden());
 	}
@@ -535,6 +598,12 @@ void terrain_label::recalculate()
 
 	clear();
 
+	// Labels scrolled out of view are not given rendering resources at all;
+	// map_labels::update_visibility() recreates them when they scroll back in.
+	if(!on_screen_) {
+		return;
+	}
+
 	if(!viewable(*disp)) {
 		return;
 	}
@@ -639,6 +708,21 @@ bool terrain_label::viewable(const display& disp) const
 	return can_see_team_labels && parent_->team_name() == team_name_;
 }
 
+void terrain_label::set_on_screen(bool visible)
+{
+	if(visible == on_screen_) {
+		return;
+	}
+
+	on_screen_ = visible;
+
+	if(on_screen_) {
+		recalculate();
+	} else {
+		clear();
+	}
+}
+
 void terrain_label::clear()
 {
 	if(handle_) {
@@ -23,6 +23,8 @@
 #include <SDL2/SDL_rect.h>
 #include <map>
 #include <string>
+#include <utility>
+#include <vector>
 
 class config;
 class display;
@@ -75,6 +77,17 @@ public:
 	void recalculate_labels();
 	void recalculate_shroud();
 
+	/**
+	 * Materializes the labels whose chunk of the map intersects the visible
+	 * area and tears down the floating labels of the rest.
+	 *
+	 * Labels are bucketed by chunk_size_-hex squares, so label-heavy maps
+	 * (hundreds of labels used as UI by some add-ons) only pay per-frame
+	 * rendering and shroud-update costs for the handful of labels in view.
+	 * Called whenever the view scrolls or the zoom level changes.
+	 */
+	void update_visibility();
+
 	bool visible_global_label(const map_location&) const;
 
 	const std::string& team_name() const;
@@ -90,6 +103,9 @@ private:
 
 	void clear_map(label_map&, bool);
 
+	/** Rebuilds the per-chunk buckets used by update_visibility(). */
+	void rebuild_chunks();
+
 	terrain_label* get_label_private(const map_location& loc, const std::string& team_name);
 	// Note: this is not an overload of get_label() so that we do not block
 	//       outsiders from calling get_label for a non-const map_labels object.
@@ -101,6 +117,12 @@ private:
 
 	mutable std::vector<std::string> categories;
 	mutable bool categories_dirty;
+
+	/** Labels bucketed by chunk_size_-hex square; see update_visibility(). */
+	std::map<std::pair<int, int>, std::vector<terrain_label*>> chunks_;
+	bool chunks_dirty_;
+
+	static const int chunk_size_ = 8;
 };
 
 /**
@@ -206,6 +228,14 @@ public:
 	void recalculate();
 	void calculate_shroud();
 
+	/**
+	 * Materializes or tears down this label's rendering resources as its
+	 * chunk of the map scrolls into or out of view. Off-screen labels keep
+	 * only their data; the floating label and tooltip are recreated when
+	 * they become visible again.
+	 */
+	void set_on_screen(bool visible);
+
 private:
 	void clear();
 	bool hidden() const;
@@ -214,6 +244,9 @@ private:
 	int handle_;
 	int tooltip_handle_;
 
+	/** Whether this label's chunk intersects the visible area. */
+	bool on_screen_;
+
 	t_string text_;
 	t_string tooltip_;
 
@@ -31,6 +31,10 @@
 
 #include <boost/functional/hash_fwd.hpp>
 
+#include <map>
+#include <memory>
+#include <mutex>
+
 static lg::log_domain log_config("config");
 #define ERR_CF LOG_STREAM(err, log_config)
 
@@ -363,37 +367,19 @@ map_location map_location::get_direction(map_location::DIRECTION dir, unsigned i
 		return map_location::null_location();
 	}
 
-	if (dir == NORTH) {
-		return map_location(x,y-n);
-	}
-
-	if (dir == SOUTH) {
-		return map_location(x,y+n);
-	}
-
-	int x_factor = (static_cast<unsigned int> (dir) <= 2u) ? 1 : -1; //whether we go east + or west -
-
-	unsigned int tmp_y = dir - 2; //South East => 0, South => 1, South West => 2, North West => 3, North => INT_MAX, North East => INT_MAX - 1
-	int y_factor = (tmp_y <= 2u) ? 1 : -1; //whether we go south + or north -
-
-	if (tmp_y <= 2u) {
-		return map_location(x + x_factor * n, y + y_factor * ((n + ((x & 1) == 1)) / 2));
-	} else {
-		return map_location(x + x_factor * n, y + y_factor * ((n + ((x & 1) == 0)) / 2));
-	}
-
-/*
-	switch(dir) {
-		case NORTH:      return map_location(x, y - n);
-		case SOUTH:      return map_location(x, y + n);
-		case SOUTH_EAST: return map_location(x + n, y + (n+is_odd(x))/2 );
-		case SOUTH_WEST: return map_location(x - n, y + (n+is_odd(x))/2 );
-		case NORTH_EAST: return map_location(x + n, y - (n+is_even(x))/2 );
-		case NORTH_WEST: return map_location(x - n, y - (n+is_even(x))/2 );
-		default:
-			assert(false);
-			return map_location::null_location();
-	}*/
+	// One cubic step per direction, in DIRECTION order. Walking in cubic
+	// coordinates replaces the column parity branches of the offset grid
+	// with a table lookup and three multiply-adds.
+	static constexpr cubic_location steps[6] {
+		{0, -1, 1}, {1, -1, 0}, {1, 0, -1}, {0, 1, -1}, {-1, 1, 0}, {-1, 0, 1}
+	};
+
+	cubic_location h = to_cubic();
+	const int len = static_cast<int>(n);
+	h.q += len * steps[dir].q;
+	h.r += len * steps[dir].r;
+	h.s += len * steps[dir].s;
+	return from_cubic(h);
 }
 
 void write_location_range(const std::set<map_location>& locs, config& cfg)
@@ -500,6 +486,42 @@ std::array<map_location, 6> get_adjacent_tiles(const map_location& center)
 	return res;
 }
 
+adjacency_index::adjacency_index(int w, int h)
+	: w_(w)
+	, h_(h)
+	, table_(static_cast<std::size_t>(w) * h)
+{
+	for(int y = 0; y != h; ++y) {
+		for(int x = 0; x != w; ++x) {
+			const std::array<map_location, 6> adj = get_adjacent_tiles(map_location(x, y));
+			std::array<int, 6>& entry = table_[x + static_cast<std::size_t>(y) * w];
+
+			for(std::size_t a = 0; a != adj.size(); ++a) {
+				const bool on_board =
+					adj[a].x >= 0 && adj[a].x < w && adj[a].y >= 0 && adj[a].y < h;
+				entry[a] = on_board ? adj[a].x + adj[a].y * w : -1;
+			}
+		}
+	}
+}
+
+const adjacency_index& get_adjacency_index(int w, int h)
+{
+	static std::mutex cache_mutex;
+	static std::map<std::pair<int, int>, std::unique_ptr<adjacency_index>> cache;
+
+	// Guarded because pathfinding can run on worker threads. Entries are
+	// never removed, so the returned reference stays valid.
+	std::lock_guard<std::mutex> lock(cache_mutex);
+
+	std::unique_ptr<adjacency_index>& entry = cache[{w, h}];
+	if(!entry) {
+		entry = std::make_unique<adjacency_index>(w, h);
+	}
+
+	return *entry;
+}
+
 bool tiles_adjacent(const map_location& a, const map_location& b)
 {
 	// Two tiles are adjacent:
@@ -562,3 +584,14 @@ std::size_t distance_between(const map_location& a, const map_location& b)
 
 	return std::max<int>(hdistance, std::abs(a.y - b.y) + vpenalty + hdistance/2);
 }
+
+void distances_between(const map_location& a, const std::vector<map_location>& locs, std::vector<std::size_t>& out)
+{
+	const cubic_location from = a.to_cubic();
+
+	out.clear();
+	out.reserve(locs.size());
+	for(const map_location& loc : locs) {
+		out.push_back(distance_between(from, loc.to_cubic()));
+	}
+}
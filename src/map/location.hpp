@@ -27,6 +27,16 @@ class variable_set;
 
 struct wml_loc {};
 
+/**
+ * Represents a map location in cubic hexagonal coordinates.
+ * q + r + s == 0 holds for every valid location, which makes walking and
+ * measuring distances pure arithmetic with no column parity branches.
+ * See https://www.redblobgames.com/grids/hexagons/ for the theory.
+ */
+struct cubic_location {
+	int q, r, s;
+};
+
 /**
  * Encapsulates the map of the game.
  *
@@ -67,9 +77,9 @@ struct map_location {
 	static std::string write_direction(DIRECTION dir);
 	static std::string write_translated_direction(DIRECTION dir);
 
-	map_location() : x(-1000), y(-1000) {}
-	map_location(int x, int y) : x(x), y(y) {}
-	map_location(int x, int y, wml_loc) : x(x - 1), y(y - 1) {}
+	constexpr map_location() : x(-1000), y(-1000) {}
+	constexpr map_location(int x, int y) : x(x), y(y) {}
+	constexpr map_location(int x, int y, wml_loc) : x(x - 1), y(y - 1) {}
 	map_location(const config& cfg, const variable_set *variables = nullptr);
 
 	static const map_location & ZERO()
@@ -131,6 +141,20 @@ struct map_location {
 		return vector_sum_assign(a.vector_negation());
 	}
 
+	/** This map's offset coordinates expressed in cubic coordinates. */
+	constexpr cubic_location to_cubic() const
+	{
+		const int q = x;
+		const int r = y - (x - (x % 2 != 0 ? 1 : 0)) / 2;
+		return {q, r, -q - r};
+	}
+
+	/** The inverse of @ref to_cubic. */
+	static constexpr map_location from_cubic(const cubic_location& h)
+	{
+		return map_location(h.q, h.r + (h.q - (h.q % 2 != 0 ? 1 : 0)) / 2);
+	}
+
 	// Do n step in the direction d
 	map_location get_direction(DIRECTION dir, unsigned int n = 1u) const;
 	map_location get_direction(DIRECTION dir, signed int n) const
@@ -175,6 +199,37 @@ void get_adjacent_tiles(const map_location& a, map_location* res);
 /** Returns an array of the six hexes adjacent to @p center. */
 std::array<map_location, 6> get_adjacent_tiles(const map_location& center);
 
+/**
+ * Precomputed neighbor indices for every hex of a w by h grid.
+ *
+ * Algorithms that already address hexes by flat row-major index (x + y*w)
+ * can load the six neighbor indices of a hex from this table instead of
+ * redoing the parity offset math of get_adjacent_tiles() and converting
+ * the results back to indices. Off-board neighbors are stored as -1.
+ */
+class adjacency_index
+{
+public:
+	adjacency_index(int w, int h);
+
+	/** The six neighbor indices of hex @a index, in DIRECTION order. */
+	const std::array<int, 6>& adjacent(unsigned index) const { return table_[index]; }
+
+	int w() const { return w_; }
+	int h() const { return h_; }
+
+private:
+	int w_, h_;
+	std::vector<std::array<int, 6>> table_;
+};
+
+/**
+ * The shared adjacency table for a w by h map, built on first use.
+ * Tables are kept per distinct size, so a resize builds a new one while
+ * the common case of repeated queries on one map reuses a single table.
+ */
+const adjacency_index& get_adjacency_index(int w, int h);
+
 /**
  * Function which gives the number of hexes between two tiles
  * (i.e. the minimum number of hexes that have to be traversed
@@ -182,6 +237,23 @@ std::array<map_location, 6> get_adjacent_tiles(const map_location& center);
  */
 std::size_t distance_between(const map_location& a, const map_location& b);
 
+/** The same distance, for locations already converted to cubic coordinates. */
+constexpr std::size_t distance_between(const cubic_location& a, const cubic_location& b)
+{
+	const int dq = a.q < b.q ? b.q - a.q : a.q - b.q;
+	const int dr = a.r < b.r ? b.r - a.r : a.r - b.r;
+	const int ds = a.s < b.s ? b.s - a.s : a.s - b.s;
+	return static_cast<std::size_t>(dq + dr + ds) / 2;
+}
+
+/**
+ * Fills @a out with the distance from @a a to each entry of @a locs.
+ * Converting @a a to cubic coordinates once keeps the per-entry work down to
+ * a few subtractions, which matters in AI loops that measure one hex against
+ * every candidate target on the map.
+ */
+void distances_between(const map_location& a, const std::vector<map_location>& locs, std::vector<std::size_t>& out);
+
 /**
  * Write a set of locations into a config using ranges,
  * adding keys x=x1,..,xn and y=y1a-y1b,..,yna-ynb
@@ -103,9 +103,18 @@ void gamemap::write_terrain(const map_location &loc, config& cfg) const
 	cfg["terrain"] = t_translation::write_terrain_code(get_terrain(loc));
 }
 
+namespace
+{
+	// Source of gamemap version numbers. Handing out globally unique values
+	// means a stamp taken from one map instance can never read as current on
+	// another one, e.g. after a scenario change recreated the game board.
+	unsigned long long next_map_version = 0;
+}
+
 gamemap::gamemap(const std::string& data):
 		gamemap_base(1, 1),
 		tdata_(),
+		version_(++next_map_version),
 		villages_()
 {
 	if(const auto* gcm = game_config_manager::get()) {
@@ -119,6 +128,18 @@ gamemap::gamemap(const std::string& data):
 	read(data);
 }
 
+gamemap& gamemap::operator=(const gamemap& that)
+{
+	// Memberwise copy, except that the version counter takes a fresh value:
+	// stamps taken from the replaced map have to read as stale.
+	const unsigned long long next = ++next_map_version;
+	gamemap_base::operator=(that);
+	tdata_ = that.tdata_;
+	villages_ = that.villages_;
+	version_ = next;
+	return *this;
+}
+
 gamemap_base::gamemap_base(int w, int h, terrain_code t)
 	: tiles_(w, h, t)
 	, starting_positions_()
@@ -178,6 +199,8 @@ void gamemap::read(const std::string& data, const bool allow_invalid)
 			}
 		}
 	}
+
+	version_ = ++next_map_version;
 }
 
 int gamemap::read_header(const std::string& data)
@@ -419,6 +442,7 @@ void gamemap::set_terrain(const map_location& loc, const t_translation::terrain_
 	}
 
 	(*this)[loc] = new_terrain;
+	version_ = ++next_map_version;
 }
 
 std::vector<map_location> gamemap_base::parse_location_range(const std::string &x, const std::string &y,
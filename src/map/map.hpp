@@ -151,6 +151,23 @@ public:
 			}
 		}
 	}
+
+	/**
+	 * Calls @a f with the location and terrain of every hex, border
+	 * included. Walks the contiguous terrain store in storage order, so
+	 * unlike a for_each_loc()/get_terrain() pair there is no per-hex range
+	 * check; meant for bulk consumers like the minimap renderer.
+	 */
+	template<typename F>
+	void for_each_terrain(const F& f) const
+	{
+		const terrain_code* t = tiles_.data.data();
+		for(int x = 0; x < total_width(); ++x) {
+			for(int y = 0; y < total_height(); ++y) {
+				f(map_location{x, y, wml_loc()}, *t++);
+			}
+		}
+	}
 protected:
 	gamemap_base() = default;
 	gamemap_base(int w, int h, terrain_code default_ter = terrain_code());
@@ -213,6 +230,11 @@ public:
 	 */
 	gamemap(const std::string& data); // throw(incorrect_map_format_error)
 
+	gamemap(const gamemap&) = default;
+
+	/** Copies @a that, but keeps version() monotonic; see game_board::replace_map(). */
+	gamemap& operator=(const gamemap& that);
+
 	void read(const std::string& data, const bool allow_invalid = true);
 
 	std::string write() const;
@@ -221,6 +243,17 @@ public:
 	{
 		return tiles().get(loc.x + border_size(), loc.y + border_size());
 	}
+
+	/**
+	 * Variant of operator[] for hot loops whose locations are already known
+	 * to be on the map (border included), such as pathfinding working from
+	 * the precomputed adjacency table: skips the range check on the
+	 * terrain store.
+	 */
+	t_translation::terrain_code get_terrain_unchecked(const map_location& loc) const
+	{
+		return tiles().get_unchecked(loc.x + border_size(), loc.y + border_size());
+	}
 private:
 	//private method, use set_terrain instead which also updates villages_.
 	t_translation::terrain_code& operator[](const map_location& loc)
@@ -230,6 +263,15 @@ private:
 public:
 	void set_terrain(const map_location& loc, const terrain_code & terrain, const terrain_type_data::merge_mode mode = terrain_type_data::BOTH, bool replace_if_failed = false) override;
 
+	/**
+	 * Counter bumped whenever set_terrain() actually changes a hex.
+	 * Compare against a stored value to tell whether terrain-derived data
+	 * (movement cost caches and the like) is still current. Values are
+	 * globally unique, so a stamp also reads as stale on every other map
+	 * instance, past or present.
+	 */
+	unsigned long long version() const { return version_; }
+
 	/** Writes the terrain at loc to cfg. */
 	void write_terrain(const map_location &loc, config& cfg) const;
 
@@ -253,6 +295,9 @@ private:
 
 	std::shared_ptr<terrain_type_data> tdata_;
 
+	/** Bumped by set_terrain(), see version(). */
+	unsigned long long version_;
+
 protected:
 	std::vector<map_location> villages_;
 };
@@ -33,6 +33,7 @@
 #include "display_chat_manager.hpp"
 #include "font/standard_colors.hpp"
 #include "formula/string_utils.hpp"
+#include "frame_profiler.hpp"
 #include "game_board.hpp"
 #include "game_config_manager.hpp"
 #include "game_end_exceptions.hpp"
@@ -1146,6 +1147,7 @@ protected:
 	void do_layers();
 	void do_fps();
 	void do_benchmark();
+	void do_profile();
 	void do_save();
 	void do_save_quit();
 	void do_quit();
@@ -1153,6 +1155,7 @@ protected:
 	void do_nosaves();
 	void do_next_level();
 	void do_choose_level();
+	void do_restart();
 	void do_turn();
 	void do_turn_limit();
 	void do_debug();
@@ -1248,6 +1251,8 @@ protected:
 				"layers", &console_handler::do_layers, _("Debug layers from terrain under the mouse."), "", "D");
 		register_command("fps", &console_handler::do_fps, _("Display and log fps (Frames Per Second)."));
 		register_command("benchmark", &console_handler::do_benchmark, _("Similar to the 'fps' command, but also forces everything to redraw instead of only things that have changed."));
+		register_command("profile", &console_handler::do_profile,
+				_("Toggle the frame profiler overlay, or write its recorded data to a file with 'profile dump'."), "[dump]");
 		register_command("save", &console_handler::do_save, _("Save game."));
 		register_alias("save", "w");
 		register_command("quit", &console_handler::do_quit, _("Quit game."));
@@ -1262,6 +1267,8 @@ protected:
 		register_alias("next_level", "n");
 		register_command("choose_level", &console_handler::do_choose_level, _("Choose next scenario"), "", "DS");
 		register_alias("choose_level", "cl");
+		register_command("restart", &console_handler::do_restart,
+				_("Restart the scenario from its initial state without reloading."), "", "N");
 		register_command("turn", &console_handler::do_turn,
 				_("Change turn number (and time of day), or increase by one if no number is specified."), _("[turn]"),
 				"DS");
@@ -1769,6 +1776,15 @@ void console_handler::do_benchmark()
 	menu_handler_.gui_->toggle_debug_flag(display::DEBUG_BENCHMARK);
 }
 
+void console_handler::do_profile()
+{
+	if(get_data() == "dump") {
+		print(get_cmd(), _("Profile data written to: ") + frame_profiler::dump());
+	} else {
+		frame_profiler::toggle();
+	}
+}
+
 void console_handler::do_save()
 {
 	menu_handler_.pc_.do_consolesave(get_data());
@@ -1800,6 +1816,13 @@ void console_handler::do_next_level()
 	synced_context::run_and_throw("debug_next_level", config {"next_level", get_data()});
 }
 
+void console_handler::do_restart()
+{
+	if(!menu_handler_.pc_.restart_from_hotstart()) {
+		command_failed(_("No restart snapshot is available in this game."));
+	}
+}
+
 void console_handler::do_choose_level()
 {
 	std::string tag = menu_handler_.pc_.get_classification().get_tagname();
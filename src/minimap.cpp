@@ -40,254 +40,404 @@ static lg::log_domain log_display("display");
 
 namespace image {
 
-surface getMinimap(int w, int h, const gamemap &map, const team *vw, const std::map<map_location,unsigned int> *reach_map, bool ignore_terrain_disabled)
-{
-	const terrain_type_data & tdata = *map.tdata();
+namespace {
 
+/** Minimap drawing mode flags, from preferences. */
+struct minimap_prefs
+{
+	bool draw_terrain;
+	bool terrain_coding;
+	bool draw_villages;
+	bool unit_coding;
 
-	const bool preferences_minimap_draw_terrain = preferences::minimap_draw_terrain() || ignore_terrain_disabled;
-	const bool preferences_minimap_terrain_coding = preferences::minimap_terrain_coding();
-	const bool preferences_minimap_draw_villages = preferences::minimap_draw_villages();
-	const bool preferences_minimap_unit_coding = preferences::minimap_movement_coding();
+	int scale() const
+	{
+		return (draw_terrain && terrain_coding) ? 24 : 4;
+	}
 
-	const int scale = (preferences_minimap_draw_terrain && preferences_minimap_terrain_coding) ? 24 : 4;
+	bool operator==(const minimap_prefs& o) const
+	{
+		return draw_terrain == o.draw_terrain && terrain_coding == o.terrain_coding
+			&& draw_villages == o.draw_villages && unit_coding == o.unit_coding;
+	}
+};
 
-	DBG_DP << "creating minimap " << int(map.w()*scale*0.75) << "," << map.h()*scale;
+minimap_prefs current_minimap_prefs(bool ignore_terrain_disabled)
+{
+	return {
+		preferences::minimap_draw_terrain() || ignore_terrain_disabled,
+		preferences::minimap_terrain_coding(),
+		preferences::minimap_draw_villages(),
+		preferences::minimap_movement_coding()
+	};
+}
 
-	const std::size_t map_width = map.w()*scale*3/4;
-	const std::size_t map_height = map.h()*scale;
-	if(map_width == 0 || map_height == 0) {
-		return surface(nullptr);
-	}
+/**
+ * Pixel footprint of a hex on the full-scale composed minimap.
+ *
+ * We need a balanced shift up and down of the hexes. If not, only the
+ * bottom half-hexes are clipped and it looks asymmetrical.
+ */
+rect minimap_loc_rect(const map_location& loc, int scale)
+{
+	return {
+		loc.x * scale * 3 / 4 - (scale / 4),
+		loc.y * scale + scale / 4 * (is_odd(loc.x) ? 1 : -1) - (scale / 4),
+		scale,
+		scale
+	};
+}
 
-	if(!preferences_minimap_draw_villages && !preferences_minimap_draw_terrain)
-	{
-		//return if there is nothing to draw.
-		//(optimisation)
-		double ratio = std::min<double>( w*1.0 / map_width, h*1.0 / map_height);
-		return surface(map_width * ratio, map_height * ratio);
+/** Draws one hex of the composed minimap: terrain, then the village marker. */
+void draw_minimap_hex(surface& minimap, const map_location& loc, const gamemap& map,
+	const team* vw, const std::map<map_location, unsigned int>* reach_map, const minimap_prefs& prefs)
+{
+	if(!map.on_board_with_border(loc)) {
+		return;
 	}
 
-	surface minimap(map_width, map_height);
-	if(minimap == nullptr)
-		return surface(nullptr);
+	const terrain_type_data& tdata = *map.tdata();
+	const int scale = prefs.scale();
 
 	typedef mini_terrain_cache_map cache_map;
 	cache_map *normal_cache = &mini_terrain_cache;
 	cache_map *fog_cache = &mini_fogged_terrain_cache;
 	cache_map *highlight_cache = &mini_highlighted_terrain_cache;
 
-	for(int y = 0; y <= map.total_height(); ++y)
-		for(int x = 0; x <= map.total_width(); ++x) {
+	const bool shrouded = (display::get_singleton() != nullptr && display::get_singleton()->is_blindfolded()) || (vw != nullptr && vw->shrouded(loc));
+	// shrouded hex are not considered fogged (no need to fog a black image)
+	const bool fogged = (vw != nullptr && !shrouded && vw->fogged(loc));
 
-			const map_location loc(x,y);
-			if(!map.on_board_with_border(loc))
-				continue;
+	const bool highlighted = reach_map && reach_map->count(loc) != 0 && !shrouded;
 
-			const bool shrouded = (display::get_singleton() != nullptr && display::get_singleton()->is_blindfolded()) || (vw != nullptr && vw->shrouded(loc));
-			// shrouded hex are not considered fogged (no need to fog a black image)
-			const bool fogged = (vw != nullptr && !shrouded && vw->fogged(loc));
+	const t_translation::terrain_code terrain = shrouded ?
+			t_translation::VOID_TERRAIN : map[loc];
+	const terrain_type& terrain_info = tdata.get_terrain_info(terrain);
 
-			const bool highlighted = reach_map && reach_map->count(loc) != 0 && !shrouded;
+	SDL_Rect maprect = minimap_loc_rect(loc, scale);
+	maprect.w = 0;
+	maprect.h = 0;
 
-			const t_translation::terrain_code terrain = shrouded ?
-					t_translation::VOID_TERRAIN : map[loc];
-			const terrain_type& terrain_info = tdata.get_terrain_info(terrain);
+	if (prefs.draw_terrain) {
 
-			// we need a balanced shift up and down of the hexes.
-			// if not, only the bottom half-hexes are clipped
-			// and it looks asymmetrical.
+		if (prefs.terrain_coding) {
 
-			SDL_Rect maprect {
-					x * scale * 3 / 4 - (scale / 4)
-					, y * scale + scale / 4 * (is_odd(x) ? 1 : -1) - (scale / 4)
-					, 0
-					, 0
-			};
+			surface surf(nullptr);
 
-			if (preferences_minimap_draw_terrain) {
+			bool need_fogging = false;
+			bool need_highlighting = false;
 
-				if (preferences_minimap_terrain_coding) {
+			cache_map* cache = fogged ? fog_cache : normal_cache;
+			if (highlighted)
+				cache = highlight_cache;
+			cache_map::iterator i = cache->find(terrain);
 
-					surface surf(nullptr);
-
-					bool need_fogging = false;
-					bool need_highlighting = false;
+			if (fogged && i == cache->end()) {
+				// we don't have the fogged version in cache
+				// try the normal cache and ask fogging the image
+				cache = normal_cache;
+				i = cache->find(terrain);
+				need_fogging = true;
+			}
 
-					cache_map* cache = fogged ? fog_cache : normal_cache;
-					if (highlighted)
-						cache = highlight_cache;
-					cache_map::iterator i = cache->find(terrain);
+			if (highlighted && i == cache->end()) {
+				// we don't have the highlighted version in cache
+				// try the normal cache and ask fogging the image
+				cache = normal_cache;
+				i = cache->find(terrain);
+				need_highlighting = true;
+			}
 
-					if (fogged && i == cache->end()) {
-						// we don't have the fogged version in cache
-						// try the normal cache and ask fogging the image
-						cache = normal_cache;
-						i = cache->find(terrain);
-						need_fogging = true;
+			if(i == cache->end() && !terrain_info.minimap_image().empty()) {
+				std::string base_file =
+						"terrain/" + terrain_info.minimap_image() + ".png";
+				surface tile = get_surface(base_file,image::HEXED);
+
+				//Compose images of base and overlay if necessary
+				// NOTE we also skip overlay when base is missing (to avoid hiding the error)
+				if(tile != nullptr && tdata.get_terrain_info(terrain).is_combined() && !terrain_info.minimap_image_overlay().empty()) {
+					std::string overlay_file =
+							"terrain/" + terrain_info.minimap_image_overlay() + ".png";
+					surface overlay = get_surface(overlay_file, image::HEXED);
+
+					if(overlay != nullptr && overlay != tile) {
+						surface combined(tile->w, tile->h);
+						SDL_Rect r {0,0,0,0};
+						sdl_blit(tile, nullptr, combined, &r);
+						r.x = std::max(0, (tile->w - overlay->w)/2);
+						r.y = std::max(0, (tile->h - overlay->h)/2);
+						sdl_blit(overlay, nullptr, combined, &r);
+						tile = combined;
 					}
+				}
 
-					if (highlighted && i == cache->end()) {
-						// we don't have the highlighted version in cache
-						// try the normal cache and ask fogging the image
-						cache = normal_cache;
-						i = cache->find(terrain);
-						need_highlighting = true;
-					}
+				surf = scale_surface_sharp(tile, scale, scale);
 
-					if(i == cache->end() && !terrain_info.minimap_image().empty()) {
-						std::string base_file =
-								"terrain/" + terrain_info.minimap_image() + ".png";
-						surface tile = get_surface(base_file,image::HEXED);
-
-						//Compose images of base and overlay if necessary
-						// NOTE we also skip overlay when base is missing (to avoid hiding the error)
-						if(tile != nullptr && tdata.get_terrain_info(terrain).is_combined() && !terrain_info.minimap_image_overlay().empty()) {
-							std::string overlay_file =
-									"terrain/" + terrain_info.minimap_image_overlay() + ".png";
-							surface overlay = get_surface(overlay_file, image::HEXED);
-
-							if(overlay != nullptr && overlay != tile) {
-								surface combined(tile->w, tile->h);
-								SDL_Rect r {0,0,0,0};
-								sdl_blit(tile, nullptr, combined, &r);
-								r.x = std::max(0, (tile->w - overlay->w)/2);
-								r.y = std::max(0, (tile->h - overlay->h)/2);
-								sdl_blit(overlay, nullptr, combined, &r);
-								tile = combined;
-							}
-						}
+				i = normal_cache->emplace(terrain, surf).first;
+			}
 
-						surf = scale_surface_sharp(tile, scale, scale);
+			if (i != cache->end())
+			{
+				surf = i->second;
 
-						i = normal_cache->emplace(terrain, surf).first;
-					}
+				if (need_fogging) {
+					surf = adjust_surface_color(surf, -50, -50, -50);
+					fog_cache->emplace(terrain, surf);
+				}
 
-					if (i != cache->end())
-					{
-						surf = i->second;
+				if (need_highlighting) {
+					surf = adjust_surface_color(surf, 50, 50, 50);
+					highlight_cache->emplace(terrain, surf);
+				}
+			}
 
-						if (need_fogging) {
-							surf = adjust_surface_color(surf, -50, -50, -50);
-							fog_cache->emplace(terrain, surf);
-						}
+			if(surf != nullptr)
+				sdl_blit(surf, nullptr, minimap, &maprect);
 
-						if (need_highlighting) {
-							surf = adjust_surface_color(surf, 50, 50, 50);
-							highlight_cache->emplace(terrain, surf);
-						}
-					}
+		} else {
 
-					if(surf != nullptr)
-						sdl_blit(surf, nullptr, minimap, &maprect);
+			// Despite its name, game_config::team_rgb_range isn't just team colors,
+			// it has "red", "lightblue", "cave", "reef", "fungus", etc.
+			color_t col;
+			std::map<std::string, color_range>::const_iterator it = game_config::team_rgb_range.find(terrain_info.id());
+			if (it == game_config::team_rgb_range.end()) {
+				col = color_t(0,0,0,0);
+			} else
+				col = it->second.rep();
 
-				} else {
+			bool first = true;
+			const t_translation::ter_list& underlying_terrains = tdata.underlying_union_terrain(terrain);
+			for(const t_translation::terrain_code& underlying_terrain : underlying_terrains) {
 
-					// Despite its name, game_config::team_rgb_range isn't just team colors,
-					// it has "red", "lightblue", "cave", "reef", "fungus", etc.
-					color_t col;
-					std::map<std::string, color_range>::const_iterator it = game_config::team_rgb_range.find(terrain_info.id());
-					if (it == game_config::team_rgb_range.end()) {
-						col = color_t(0,0,0,0);
-					} else
-						col = it->second.rep();
+				const std::string& terrain_id = tdata.get_terrain_info(underlying_terrain).id();
+				it = game_config::team_rgb_range.find(terrain_id);
+				if (it == game_config::team_rgb_range.end())
+					continue;
 
-					bool first = true;
-					const t_translation::ter_list& underlying_terrains = tdata.underlying_union_terrain(terrain);
-					for(const t_translation::terrain_code& underlying_terrain : underlying_terrains) {
+				color_t tmp = it->second.rep();
 
-						const std::string& terrain_id = tdata.get_terrain_info(underlying_terrain).id();
-						it = game_config::team_rgb_range.find(terrain_id);
-						if (it == game_config::team_rgb_range.end())
-							continue;
+				if (fogged) {
+					if (tmp.b < 50) tmp.b = 0;
+					else tmp.b -= 50;
+					if (tmp.g < 50) tmp.g = 0;
+					else tmp.g -= 50;
+					if (tmp.r < 50) tmp.r = 0;
+					else tmp.r -= 50;
+				}
 
-						color_t tmp = it->second.rep();
+				if (highlighted) {
+					if (tmp.b > 205) tmp.b = 255;
+					else tmp.b += 50;
+					if (tmp.g > 205) tmp.g = 255;
+					else tmp.g += 50;
+					if (tmp.r > 205) tmp.r = 255;
+					else tmp.r += 50;
+				}
 
-						if (fogged) {
-							if (tmp.b < 50) tmp.b = 0;
-							else tmp.b -= 50;
-							if (tmp.g < 50) tmp.g = 0;
-							else tmp.g -= 50;
-							if (tmp.r < 50) tmp.r = 0;
-							else tmp.r -= 50;
-						}
+				if (first) {
+					first = false;
+					col = tmp;
+				} else {
+					col.r = col.r - (col.r - tmp.r)/2;
+					col.g = col.g - (col.g - tmp.g)/2;
+					col.b = col.b - (col.b - tmp.b)/2;
+				}
+			}
+			SDL_Rect fillrect {maprect.x, maprect.y, scale * 3/4, scale};
+			const uint32_t mapped_col = SDL_MapRGB(minimap->format,col.r,col.g,col.b);
+			sdl::fill_surface_rect(minimap, &fillrect, mapped_col);
+		}
+	}
 
-						if (highlighted) {
-							if (tmp.b > 205) tmp.b = 255;
-							else tmp.b += 50;
-							if (tmp.g > 205) tmp.g = 255;
-							else tmp.g += 50;
-							if (tmp.r > 205) tmp.r = 255;
-							else tmp.r += 50;
-						}
+	if (terrain_info.is_village() && prefs.draw_villages) {
 
-						if (first) {
-							first = false;
-							col = tmp;
-						} else {
-							col.r = col.r - (col.r - tmp.r)/2;
-							col.g = col.g - (col.g - tmp.g)/2;
-							col.b = col.b - (col.b - tmp.b)/2;
-						}
-					}
-					SDL_Rect fillrect {maprect.x, maprect.y, scale * 3/4, scale};
-					const uint32_t mapped_col = SDL_MapRGB(minimap->format,col.r,col.g,col.b);
-					sdl::fill_surface_rect(minimap, &fillrect, mapped_col);
+		int side_num = (resources::gameboard ? resources::gameboard->village_owner(loc) : 0); //check needed for mp create dialog
+
+		// TODO: Add a key to [game_config][colors] for this
+		auto iter = game_config::team_rgb_range.find("white");
+		color_t col(255,255,255);
+		if(iter != game_config::team_rgb_range.end()) {
+			col = iter->second.min();
+		}
+
+		if (!fogged) {
+			if (side_num > 0) {
+
+				if (prefs.unit_coding || !vw ) {
+					col = team::get_minimap_color(side_num);
+				} else {
+
+					if (vw->owns_village(loc))
+						col = game_config::color_info(preferences::unmoved_color()).rep();
+					else if (vw->is_enemy(side_num))
+						col = game_config::color_info(preferences::enemy_color()).rep();
+					else
+						col = game_config::color_info(preferences::allied_color()).rep();
 				}
 			}
+		}
 
-			if (terrain_info.is_village() && preferences_minimap_draw_villages) {
+		SDL_Rect fillrect {
+				maprect.x
+				, maprect.y
+				, scale * 3/4
+				, scale
+		};
 
-				int side_num = (resources::gameboard ? resources::gameboard->village_owner(loc) : 0); //check needed for mp create dialog
+		const uint32_t mapped_col = SDL_MapRGB(minimap->format,col.r,col.g,col.b);
+		sdl::fill_surface_rect(minimap, &fillrect, mapped_col);
 
-				// TODO: Add a key to [game_config][colors] for this
-				auto iter = game_config::team_rgb_range.find("white");
-				color_t col(255,255,255);
-				if(iter != game_config::team_rgb_range.end()) {
-					col = iter->second.min();
-				}
+	}
+}
 
-				if (!fogged) {
-					if (side_num > 0) {
+/**
+ * The composed (unscaled) minimap of the last getMinimap() call, kept so
+ * update_minimap() can redraw just the hexes that changed.
+ */
+struct minimap_cache_t
+{
+	surface composed = nullptr;
+	surface scaled = nullptr;
+	minimap_prefs prefs = {};
+	int w = 0;
+	int h = 0;
+	int map_w = 0;
+	int map_h = 0;
+	int viewer_side = 0;
+	bool blindfolded = false;
+};
 
-						if (preferences_minimap_unit_coding || !vw ) {
-							col = team::get_minimap_color(side_num);
-						} else {
+minimap_cache_t minimap_cache;
 
-							if (vw->owns_village(loc))
-								col = game_config::color_info(preferences::unmoved_color()).rep();
-							else if (vw->is_enemy(side_num))
-								col = game_config::color_info(preferences::enemy_color()).rep();
-							else
-								col = game_config::color_info(preferences::allied_color()).rep();
-						}
-					}
-				}
+} // namespace
 
-				SDL_Rect fillrect {
-						maprect.x
-						, maprect.y
-						, scale * 3/4
-						, scale
-				};
+surface getMinimap(int w, int h, const gamemap &map, const team *vw, const std::map<map_location,unsigned int> *reach_map, bool ignore_terrain_disabled)
+{
+	const minimap_prefs prefs = current_minimap_prefs(ignore_terrain_disabled);
+	const int scale = prefs.scale();
 
-				const uint32_t mapped_col = SDL_MapRGB(minimap->format,col.r,col.g,col.b);
-				sdl::fill_surface_rect(minimap, &fillrect, mapped_col);
+	// Whatever happens below, the previously composed minimap is stale now.
+	minimap_cache.composed = nullptr;
+	minimap_cache.scaled = nullptr;
 
-			}
+	DBG_DP << "creating minimap " << int(map.w()*scale*0.75) << "," << map.h()*scale;
+
+	const std::size_t map_width = map.w()*scale*3/4;
+	const std::size_t map_height = map.h()*scale;
+	if(map_width == 0 || map_height == 0) {
+		return surface(nullptr);
+	}
+
+	if(!prefs.draw_villages && !prefs.draw_terrain)
+	{
+		//return if there is nothing to draw.
+		//(optimisation)
+		double ratio = std::min<double>( w*1.0 / map_width, h*1.0 / map_height);
+		return surface(map_width * ratio, map_height * ratio);
+	}
 
+	surface minimap(map_width, map_height);
+	if(minimap == nullptr)
+		return surface(nullptr);
+
+	for(int y = 0; y <= map.total_height(); ++y)
+		for(int x = 0; x <= map.total_width(); ++x) {
+			draw_minimap_hex(minimap, map_location(x, y), map, vw, reach_map, prefs);
 		}
 
 	double wratio = w*1.0 / minimap->w;
 	double hratio = h*1.0 / minimap->h;
 	double ratio = std::min<double>(wratio, hratio);
 
-	minimap = scale_surface_sharp(minimap,
+	surface scaled = scale_surface_sharp(minimap,
 		static_cast<int>(minimap->w * ratio), static_cast<int>(minimap->h * ratio));
 
+	// A reach map is baked into the composed pixels and changes with every
+	// selection, so only selection-free minimaps are worth keeping around
+	// for incremental updates.
+	if(!reach_map) {
+		minimap_cache.composed = minimap;
+		minimap_cache.scaled = scaled;
+		minimap_cache.prefs = prefs;
+		minimap_cache.w = w;
+		minimap_cache.h = h;
+		minimap_cache.map_w = map.w();
+		minimap_cache.map_h = map.h();
+		minimap_cache.viewer_side = vw ? vw->side() : 0;
+		minimap_cache.blindfolded = display::get_singleton() != nullptr && display::get_singleton()->is_blindfolded();
+	}
+
 	DBG_DP << "done generating minimap";
 
-	return minimap;
+	return scaled;
+}
+
+surface update_minimap(int w, int h, const gamemap& map, const team* vw, const std::set<map_location>& changed_locs)
+{
+	minimap_cache_t& cache = minimap_cache;
+	const minimap_prefs prefs = current_minimap_prefs(false);
+	const bool blindfolded = display::get_singleton() != nullptr && display::get_singleton()->is_blindfolded();
+
+	// The update must describe the same minimap that was last composed.
+	if(cache.composed == nullptr
+		|| !(cache.prefs == prefs)
+		|| cache.w != w || cache.h != h
+		|| cache.map_w != map.w() || cache.map_h != map.h()
+		|| cache.viewer_side != (vw ? vw->side() : 0)
+		|| cache.blindfolded != blindfolded)
+	{
+		return surface(nullptr);
+	}
+
+	const int scale = prefs.scale();
+	surface& composed = cache.composed;
+
+	// Union of the changed hexes' footprints on the composed surface.
+	rect changed;
+	for(const map_location& loc : changed_locs) {
+		const rect footprint = minimap_loc_rect(loc, scale);
+		changed = changed.empty() ? footprint : changed.minimal_cover(footprint);
+	}
+	changed.clip({0, 0, composed->w, composed->h});
+
+	if(changed.empty()) {
+		return cache.scaled;
+	}
+
+	DBG_DP << "updating minimap region " << changed;
+
+	// Hexes overlap their neighbors on the minimap, so the changed area is
+	// rebuilt from scratch: clear it, then repaint every hex touching it in
+	// the same order as the full pass. The clip rect keeps the repainted
+	// neighbors from double-blending pixels outside the area.
+	SDL_SetClipRect(composed, &changed);
+	sdl::fill_surface_rect(composed, &changed, 0);
+
+	for(int y = 0; y <= map.total_height(); ++y)
+		for(int x = 0; x <= map.total_width(); ++x) {
+			const map_location loc(x, y);
+			if(changed.overlaps(minimap_loc_rect(loc, scale))) {
+				draw_minimap_hex(composed, loc, map, vw, nullptr, prefs);
+			}
+		}
+
+	SDL_SetClipRect(composed, nullptr);
+
+	// Re-render the patched part of the scaled-down surface. The margin
+	// absorbs the rounding at the region edges.
+	if(cache.scaled.get() != composed.get()) {
+		const double xr = static_cast<double>(cache.scaled->w) / composed->w;
+		const double yr = static_cast<double>(cache.scaled->h) / composed->h;
+
+		scale_surface_sharp_region(composed, cache.scaled, {
+			static_cast<int>(std::floor(changed.x * xr)) - 1,
+			static_cast<int>(std::floor(changed.y * yr)) - 1,
+			static_cast<int>(std::ceil(changed.w * xr)) + 3,
+			static_cast<int>(std::ceil(changed.h * yr)) + 3
+		});
+	}
+
+	return cache.scaled;
 }
 
 void render_minimap(unsigned dst_w,
@@ -369,10 +519,10 @@ void render_minimap(unsigned dst_w,
 		// Terrain
 		//
 		if(preferences_minimap_draw_terrain) {
-			map.for_each_loc([&](const map_location& loc) {
+			map.for_each_terrain([&](const map_location& loc, const t_translation::terrain_code& map_terrain) {
 				const bool highlighted = reach_map && reach_map->count(loc) != 0 && !shrouded(loc);
 
-				const t_translation::terrain_code terrain = shrouded(loc) ? t_translation::VOID_TERRAIN : map[loc];
+				const t_translation::terrain_code terrain = shrouded(loc) ? t_translation::VOID_TERRAIN : map_terrain;
 				const terrain_type& terrain_info = map.tdata()->get_terrain_info(terrain);
 
 				// Destination rect for drawing the current hex.
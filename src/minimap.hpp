@@ -17,6 +17,7 @@
 
 #include <cstddef>
 #include <map>
+#include <set>
 
 class gamemap;
 class surface;
@@ -31,6 +32,18 @@ namespace image {
 	 */
 	surface getMinimap(int w, int h, const gamemap &map_, const team *vm = nullptr, const std::map<map_location,unsigned int> *reach_map = nullptr, bool ignore_terrain_disabled = false);
 
+	/**
+	 * Patches the last minimap created by getMinimap() for a set of changed hexes.
+	 *
+	 * Only the changed hexes' footprints are redrawn and rescaled, so clearing
+	 * a bit of shroud costs a few hexes of work instead of the whole map. The
+	 * parameters must describe the same minimap as the preceding getMinimap()
+	 * call; if they don't, or if no composed minimap is cached (e.g. the last
+	 * one had a reach map baked in), a null surface is returned and the caller
+	 * should fall back to a full getMinimap().
+	 */
+	surface update_minimap(int w, int h, const gamemap& map_, const team* vm, const std::set<map_location>& changed_locs);
+
 /**
  * Renders the minimap to the screen.
  */
@@ -30,6 +30,7 @@
 #include "language.hpp"                      // for string_table, symbol_table
 #include "log.hpp"                           // for LOG_STREAM, logger, etc
 #include "map/map.hpp"                       // for gamemap
+#include "pathfind/hierarchical.hpp"         // for hierarchical_route
 #include "pathfind/teleport.hpp"             // for get_teleport_locations, etc
 #include "play_controller.hpp"               // for playing_side, set_button_state
 #include "replay_helper.hpp"
@@ -68,6 +69,7 @@ mouse_handler::mouse_handler(game_display* gui, play_controller& pc)
 	, selected_hex_()
 	, next_unit_()
 	, current_route_()
+	, route_preview_request_()
 	, current_paths_()
 	, unselected_paths_(false)
 	, unselected_reach_(false)
@@ -295,6 +297,7 @@ void mouse_handler::touch_motion(int x, int y, const bool browse, bool update, m
 		}
 
 		if(dest == selected_hex_ || dest_un) {
+			route_preview_request_.reset();
 			current_route_.steps.clear();
 			gui().set_route(nullptr);
 			pc_.get_whiteboard()->erase_temp_move();
@@ -304,13 +307,7 @@ void mouse_handler::touch_motion(int x, int y, const bool browse, bool update, m
 		{
 			if (selected_unit && !selected_unit->incapacitated()) {
 				// Show the route from selected unit to mouseover hex
-				current_route_ = get_route(&*selected_unit, dest, viewing_team());
-
-				pc_.get_whiteboard()->create_temp_move();
-
-				if(!browse) {
-					gui().set_route(&current_route_);
-				}
+				request_route_preview(selected_unit.get_shared_ptr(), dest, !browse);
 			}
 		}
 
@@ -319,14 +316,9 @@ void mouse_handler::touch_motion(int x, int y, const bool browse, bool update, m
 		   && mouseover_unit.valid()
 		   && mouseover_unit) {
 			// Show the route from selected hex to mouseover unit
-			current_route_ = get_route(&*mouseover_unit, selected_hex_, viewing_team());
-
-			pc_.get_whiteboard()->create_temp_move();
-
-			if(!browse) {
-				gui().set_route(&current_route_);
-			}
+			request_route_preview(mouseover_unit.get_shared_ptr(), selected_hex_, !browse);
 		} else if (!selected_unit) {
+			route_preview_request_.reset();
 			current_route_.steps.clear();
 			gui().set_route(nullptr);
 			pc_.get_whiteboard()->erase_temp_move();
@@ -543,32 +535,22 @@ void mouse_handler::mouse_motion(int x, int y, const bool browse, bool update, m
 		}
 
 		if(dest == selected_hex_ || dest_un) {
+			route_preview_request_.reset();
 			current_route_.steps.clear();
 			gui().set_route(nullptr);
 			pc_.get_whiteboard()->erase_temp_move();
 		} else if(!current_paths_.destinations.empty() && pc_.get_map().on_board(selected_hex_) && pc_.get_map().on_board(new_hex)) {
 			if(selected_unit && !selected_unit->incapacitated()) {
 				// Show the route from selected unit to mouseover hex
-				current_route_ = get_route(&*selected_unit, dest, viewing_team());
-
-				pc_.get_whiteboard()->create_temp_move();
-
-				if(!browse) {
-					gui().set_route(&current_route_);
-				}
+				request_route_preview(selected_unit.get_shared_ptr(), dest, !browse);
 			}
 		}
 
 		if(pc_.get_map().on_board(selected_hex_) && !selected_unit && mouseover_unit.valid() && mouseover_unit) {
 			// Show the route from selected hex to mouseover unit
-			current_route_ = get_route(&*mouseover_unit, selected_hex_, viewing_team());
-
-			pc_.get_whiteboard()->create_temp_move();
-
-			if(!browse) {
-				gui().set_route(&current_route_);
-			}
+			request_route_preview(mouseover_unit.get_shared_ptr(), selected_hex_, !browse);
 		} else if(!selected_unit) {
+			route_preview_request_.reset();
 			current_route_.steps.clear();
 			gui().set_route(nullptr);
 			pc_.get_whiteboard()->erase_temp_move();
@@ -767,12 +749,47 @@ pathfind::marked_route mouse_handler::get_route(const unit* un, map_location go_
 
 	pathfind::plain_route route;
 
-	route = pathfind::a_star_search(
-		un->get_location(), go_to, 10000.0, calc, board.map().w(), board.map().h(), &allowed_teleports);
+	// The preview is recomputed on every hover, so route through the cluster
+	// abstraction; on big maps that caps the cost of long goto arrows.
+	route = pathfind::hierarchical_route(
+		*un, un->get_location(), go_to, 10000.0, calc, board.map(), &allowed_teleports);
 
 	return mark_route(route);
 }
 
+void mouse_handler::request_route_preview(const unit_const_ptr& un, const map_location& dest, bool show)
+{
+	route_preview_request_ = route_preview_request{un, dest, show};
+}
+
+void mouse_handler::process_route_preview()
+{
+	if(!route_preview_request_) {
+		return;
+	}
+
+	const route_preview_request req = *route_preview_request_;
+	route_preview_request_.reset();
+
+	// The unit can leave the board between the motion event and this slice
+	// (a network move, say); the shared_ptr keeps it alive, but previewing
+	// a route for it would be meaningless.
+	unit_map::const_iterator u = find_unit(req.un->get_location());
+	if(!u || u.get_shared_ptr() != req.un) {
+		return;
+	}
+
+	wb::future_map_if_active raii;
+
+	current_route_ = get_route(req.un.get(), req.dest, viewing_team());
+
+	pc_.get_whiteboard()->create_temp_move();
+
+	if(req.show) {
+		gui().set_route(&current_route_);
+	}
+}
+
 bool mouse_handler::right_click_show_menu(int x, int y, const bool /*browse*/)
 {
 	if(selected_hex_.valid() || unselected_reach_) {
@@ -1015,6 +1032,7 @@ void mouse_handler::select_hex(const map_location& hex, const bool browse, const
 {
 	selected_hex_ = hex;
 
+	route_preview_request_.reset();
 	gui().select_hex(selected_hex_);
 	gui().clear_attack_indicator();
 	gui().set_route(nullptr);
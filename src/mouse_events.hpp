@@ -22,6 +22,7 @@
 #include "pathfind/pathfind.hpp"        // for marked_route, paths
 #include "units/map.hpp"                 // for unit_map, etc
 
+#include <optional>                     // for optional
 #include <set>                          // for set
 #include <vector>                       // for vector
 #include <SDL2/SDL_events.h>                 // for SDL_MouseButtonEvent
@@ -67,6 +68,17 @@ public:
 
 	const pathfind::marked_route& get_current_route() const { return current_route_; }
 
+	/**
+	 * Resolves the route preview the latest mouse motion asked for, if any.
+	 *
+	 * Mouse motion only records what to preview; the pathfind runs here,
+	 * once per main-loop slice. A newer motion replaces the pending request
+	 * outright, so sweeping the cursor across several hexes costs a single
+	 * pathfind, and the previous goto arrow stays visible until its
+	 * replacement is ready.
+	 */
+	void process_route_preview();
+
 	//get visible adjacent enemies of 1-based side around location loc
 	std::set<map_location> get_adj_enemies(const map_location& loc, int side) const;
 
@@ -169,6 +181,9 @@ private:
 	 */
 	void show_reach_for_unit(const unit_ptr& un);
 
+	/** Queues a route preview for process_route_preview() to resolve. */
+	void request_route_preview(const unit_const_ptr& un, const map_location& dest, bool show);
+
 	game_display* gui_;
 	play_controller & pc_;
 
@@ -179,6 +194,17 @@ private:
 	map_location selected_hex_;
 	map_location next_unit_;
 	pathfind::marked_route current_route_;
+
+	struct route_preview_request
+	{
+		unit_const_ptr un;
+		map_location dest;
+		/** Whether to draw the arrow once resolved (false while browsing). */
+		bool show;
+	};
+
+	/** Preview requested by the latest motion, pending resolution. */
+	std::optional<route_preview_request> route_preview_request_;
 	/**
 	 * If non-empty, current_paths_.destinations contains a cache of highlighted
 	 * hexes, likely the movement range or attack range of a unit.
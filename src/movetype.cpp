@@ -27,6 +27,9 @@
 #include "terrain/translation.hpp"
 #include "units/types.hpp" // for attack_type
 
+#include <algorithm>
+#include <unordered_map>
+
 static lg::log_domain log_config("config");
 #define ERR_CF LOG_STREAM(err, log_config)
 #define WRN_CF LOG_STREAM(warn, log_config)
@@ -142,7 +145,17 @@ private:
 	          const terrain_info * fallback, unsigned recurse_count) const;
 
 private:
-	typedef std::map<t_translation::terrain_code, int> cache_t;
+	typedef std::unordered_map<uint64_t, int> cache_t;
+
+	/**
+	 * Cache key: base and overlay packed into one integer, so the lookup in
+	 * the pathfinding cost callbacks hashes a single word instead of
+	 * comparing terrain codes field by field down a tree.
+	 */
+	static uint64_t cache_key(const t_translation::terrain_code & terrain)
+	{
+		return (uint64_t(terrain.base) << 32) | uint64_t(terrain.overlay);
+	}
 
 	/** Config describing the terrain values. */
 	config cfg_;
@@ -383,7 +396,7 @@ int movetype::terrain_info::data::value(
 {
 	// Check the cache.
 	std::pair<cache_t::iterator, bool> cache_it =
-		cache_.emplace(terrain, -127); // Bogus value that should never be seen.
+		cache_.emplace(cache_key(terrain), -127); // Bogus value that should never be seen.
 	if ( cache_it.second )
 		// The cache did not have an entry for this terrain, so calculate the value.
 		cache_it.first->second = calc_value(terrain, fallback, recurse_count);
@@ -738,12 +751,28 @@ utils::string_map_res movetype::resistances::damage_table() const
 }
 
 
+/**
+ * Rebuilds the sorted lookup table from the config.
+ */
+void movetype::resistances::refresh_table() const
+{
+	table_.clear();
+
+	for (const config::attribute & attrb : cfg_.attribute_range()) {
+		table_.emplace_back(attrb.first, attrb.second.to_int(100));
+	}
+
+	std::sort(table_.begin(), table_.end());
+	table_dirty_ = false;
+}
+
+
 /**
  * Returns the resistance against the indicated attack.
  */
 int movetype::resistances::resistance_against(const attack_type & attack) const
 {
-	return cfg_[attack.type()].to_int(100);
+	return resistance_against(attack.type());
 }
 
 
@@ -752,7 +781,16 @@ int movetype::resistances::resistance_against(const attack_type & attack) const
  */
 int movetype::resistances::resistance_against(const std::string & damage_type) const
 {
-	return cfg_[damage_type].to_int(100);
+	if ( table_dirty_ )
+		refresh_table();
+
+	const auto it = std::lower_bound(table_.begin(), table_.end(), damage_type,
+		[](const std::pair<std::string, int> & entry, const std::string & type) { return entry.first < type; });
+
+	if ( it != table_.end() && it->first == damage_type )
+		return it->second;
+
+	return 100;
 }
 
 
@@ -772,6 +810,8 @@ void movetype::resistances::merge(const config & new_data, bool overwrite)
 			config::attribute_value & dest = cfg_[a.first];
 			dest = std::max(0, dest.to_int(100) + a.second.to_int(0));
 		}
+
+	table_dirty_ = true;
 }
 
 
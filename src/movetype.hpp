@@ -222,8 +222,8 @@ public:
 	class resistances
 	{
 	public:
-		resistances() : cfg_() {}
-		explicit resistances(const config & cfg) : cfg_(cfg) {}
+		resistances() : cfg_(), table_(), table_dirty_(true) {}
+		explicit resistances(const config & cfg) : cfg_(cfg), table_(), table_dirty_(true) {}
 
 		/** Returns a map from attack types to resistances. */
 		utils::string_map_res damage_table() const;
@@ -237,7 +237,19 @@ public:
 		void write(config & out_cfg, const std::string & child_name="") const;
 
 	private:
+		/** Rebuilds table_ from cfg_. */
+		void refresh_table() const;
+
 		config cfg_;
+		/**
+		 * The resistances as a sorted (type, percentage) vector, rebuilt when
+		 * the config changes. Damage calculations query the same handful of
+		 * damage types for every simulated strike, and a binary search over
+		 * pre-parsed values is much cheaper than an attribute lookup plus
+		 * numeric conversion each time.
+		 */
+		mutable std::vector<std::pair<std::string, int>> table_;
+		mutable bool table_dirty_;
 	};
 
 private:
@@ -234,5 +234,135 @@ plain_route a_star_search(const map_location& src, const map_location& dst,
 	return route;
 }
 
+plain_route bidirectional_a_star_search(const map_location& src, const map_location& dst,
+                          double stop_at, const cost_calculator& calc,
+                          const std::size_t width, const std::size_t height,
+                          const teleport_map *teleports, bool border) {
+	// The reverse adjacency of a teleport map isn't available, and a search
+	// over a trivial distance gains nothing from a second frontier; both
+	// cases go through the classic search.
+	if ((teleports && !teleports->empty()) || src == dst) {
+		return a_star_search(src, dst, stop_at, calc, width, height, teleports, border);
+	}
+
+	//----------------- PRE_CONDITIONS ------------------
+	assert(src.valid(width, height, border));
+	assert(dst.valid(width, height, border));
+	assert(stop_at <= calc.getNoPathValue());
+	//---------------------------------------------------
+
+	DBG_PF << "bidirectional A* search: " << src << " -> " << dst;
+
+	if (calc.cost(dst, 0) >= stop_at) {
+		LOG_PF << "aborted bidirectional A* search because Start or Dest is invalid";
+		plain_route locRoute;
+		locRoute.move_cost = static_cast<int>(calc.getNoPathValue());
+		return locRoute;
+	}
+
+	// increment search_counter but skip the range equivalent to uninitialized
+	search_counter += 2;
+	if (search_counter - bad_search_counter <= 1u)
+		search_counter += 2;
+
+	static std::vector<node> fwd_nodes;
+	static std::vector<node> bwd_nodes;
+	fwd_nodes.resize(width * height);  // this create uninitialized nodes
+	bwd_nodes.resize(width * height);
+
+	indexer index(width);
+	comp fwd_comp(fwd_nodes);
+	comp bwd_comp(bwd_nodes);
+
+	fwd_nodes[index(src)] = node(0, src, map_location::null_location(), dst, true, nullptr);
+	bwd_nodes[index(dst)] = node(0, dst, map_location::null_location(), src, true, nullptr);
+
+	std::vector<int> fwd_pq;
+	std::vector<int> bwd_pq;
+	fwd_pq.push_back(index(src));
+	bwd_pq.push_back(index(dst));
+
+	double best_total = stop_at + 1;
+	map_location meet = map_location::null_location();
+
+	while (!fwd_pq.empty() && !bwd_pq.empty()) {
+		// Any path still undiscovered goes through a hex unexpanded on at
+		// least one side, so it cannot beat the cheaper of the two frontiers.
+		if (std::min(fwd_nodes[fwd_pq.front()].t, bwd_nodes[bwd_pq.front()].t) >= best_total) break;
+
+		const bool forward = fwd_nodes[fwd_pq.front()].t <= bwd_nodes[bwd_pq.front()].t;
+
+		std::vector<node>& nodes = forward ? fwd_nodes : bwd_nodes;
+		const std::vector<node>& other = forward ? bwd_nodes : fwd_nodes;
+		std::vector<int>& pq = forward ? fwd_pq : bwd_pq;
+		comp& node_comp = forward ? fwd_comp : bwd_comp;
+		const map_location& goal = forward ? dst : src;
+
+		node& n = nodes[pq.front()];
+
+		n.in = search_counter;
+
+		std::pop_heap(pq.begin(), pq.end(), node_comp);
+		pq.pop_back();
+
+		std::vector<map_location> locs(6);
+		get_adjacent_tiles(n.curr, locs.data());
+
+		for(auto i = locs.rbegin(); i != locs.rend(); ++i) {
+			const map_location& loc = *i;
+
+			if (!loc.valid(width, height, border)) continue;
+			if (loc == n.curr) continue;
+			node& next = nodes[index(loc)];
+
+			double thresh = (next.in - search_counter <= 1u) ? next.g : stop_at + 1;
+			// cost() is always >= 1  (assumed and needed by the heuristic)
+			if (n.g + 1 >= thresh) continue;
+			// A forward step pays for the hex it enters, a backward step for
+			// the hex it leaves; the halves then sum to the exact forward
+			// path cost wherever the frontiers meet.
+			double cost = n.g + (forward ? calc.cost(loc, n.g) : calc.cost(n.curr, n.g));
+			if (cost >= thresh) continue;
+
+			bool in_list = next.in == search_counter + 1;
+
+			next = node(cost, loc, n.curr, goal, true, nullptr);
+
+			if (in_list) {
+				std::push_heap(pq.begin(), std::find(pq.begin(), pq.end(), static_cast<int>(index(loc))) + 1, node_comp);
+			} else {
+				pq.push_back(index(loc));
+				std::push_heap(pq.begin(), pq.end(), node_comp);
+			}
+
+			const node& o = other[index(loc)];
+			if (o.in - search_counter <= 1u && cost + o.g < best_total) {
+				best_total = cost + o.g;
+				meet = loc;
+			}
+		}
+	}
+
+	plain_route route;
+	if (best_total <= stop_at) {
+		DBG_PF << "found solution; calculating it...";
+		route.move_cost = static_cast<int>(best_total);
+		for (node curr = fwd_nodes[index(meet)]; curr.prev != map_location::null_location(); curr = fwd_nodes[index(curr.prev)]) {
+			route.steps.push_back(curr.curr);
+		}
+		route.steps.push_back(src);
+		std::reverse(route.steps.begin(), route.steps.end());
+		// The backward half, from just past the meeting hex down to dst.
+		for (node curr = bwd_nodes[index(meet)]; curr.prev != map_location::null_location(); curr = bwd_nodes[index(curr.prev)]) {
+			route.steps.push_back(curr.prev);
+		}
+	} else {
+		LOG_PF << "aborted bidirectional a* search  ";
+		route.move_cost = static_cast<int>(calc.getNoPathValue());
+	}
+
+	return route;
+}
+
 
 }//namespace pathfind
@@ -0,0 +1,254 @@
+/*
+	Copyright (C) 2022
+	Part of the Battle for Wesnoth Project https://www.wesnoth.org/
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY.
+
+	See the COPYING file for more details.
+*/
+
+#include "pathfind/hierarchical.hpp"
+
+#include "map/map.hpp"
+#include "movetype.hpp"
+#include "pathfind/teleport.hpp"
+#include "units/unit.hpp"
+
+#include <limits>
+#include <map>
+#include <queue>
+#include <vector>
+
+namespace pathfind {
+
+namespace {
+
+/** Width and height of a cluster, in hexes. */
+const int cluster_size = 8;
+
+/** Maps smaller than this many hexes aren't worth the indirection. */
+const int min_map_area = 10000;
+
+/** Below this hex distance the corridor would cover most touched hexes anyway. */
+const int min_goto_distance = 2 * cluster_size;
+
+/** The cluster-level view of the map for one movement type. */
+struct cluster_grid
+{
+	int w, h; // in clusters
+
+	/** Average movement cost over a cluster's passable hexes. */
+	std::vector<double> avg_cost;
+
+	/** False when no hex of the cluster can be entered at all. */
+	std::vector<bool> passable;
+
+	int index(const map_location& loc) const
+	{
+		return (loc.y / cluster_size) * w + loc.x / cluster_size;
+	}
+};
+
+cluster_grid build_grid(const gamemap& map, const movetype& mt)
+{
+	cluster_grid grid;
+	grid.w = (map.w() + cluster_size - 1) / cluster_size;
+	grid.h = (map.h() + cluster_size - 1) / cluster_size;
+
+	const int clusters = grid.w * grid.h;
+	std::vector<double> summed(clusters, 0.0);
+	std::vector<int> hexes(clusters, 0);
+
+	for(int x = 0; x < map.w(); ++x) {
+		for(int y = 0; y < map.h(); ++y) {
+			const map_location loc(x, y);
+			const int cost = mt.movement_cost(map.get_terrain(loc));
+			if(cost >= movetype::UNREACHABLE) {
+				continue;
+			}
+
+			const int c = grid.index(loc);
+			summed[c] += cost;
+			++hexes[c];
+		}
+	}
+
+	grid.avg_cost.assign(clusters, 0.0);
+	grid.passable.assign(clusters, false);
+	for(int c = 0; c < clusters; ++c) {
+		if(hexes[c] > 0) {
+			grid.avg_cost[c] = summed[c] / hexes[c];
+			grid.passable[c] = true;
+		}
+	}
+
+	return grid;
+}
+
+/** Cluster grids per unit type, stamped with the terrain revision they mirror. */
+struct grid_cache
+{
+	unsigned long long map_version = 0;
+	std::map<std::string, cluster_grid> grids;
+};
+
+const cluster_grid& get_grid(const unit& u, const gamemap& map)
+{
+	// Thread-local as cheap insurance should pathfinding ever run off the
+	// main thread; today all callers are on it.
+	static thread_local grid_cache cache;
+
+	if(cache.map_version != map.version() ) {
+		cache.grids.clear();
+		cache.map_version = map.version();
+	}
+
+	const auto found = cache.grids.find(u.type_id());
+	if(found != cache.grids.end()) {
+		return found->second;
+	}
+
+	return cache.grids.emplace(u.type_id(), build_grid(map, u.movement_type())).first->second;
+}
+
+/**
+ * Cheapest cluster chain from @a from to @a to, or an empty vector when the
+ * clusters aren't connected. Clusters are treated as 8-connected: square
+ * clusters of a hex grid touch their diagonal neighbours through at least
+ * one hex edge, and the refinement pass sorts out the exact geometry.
+ */
+std::vector<int> coarse_route(const cluster_grid& grid, int from, int to)
+{
+	const int clusters = grid.w * grid.h;
+	std::vector<double> dist(clusters, std::numeric_limits<double>::max());
+	std::vector<int> prev(clusters, -1);
+
+	typedef std::pair<double, int> queued;
+	std::priority_queue<queued, std::vector<queued>, std::greater<queued>> pq;
+
+	dist[from] = 0.0;
+	pq.emplace(0.0, from);
+
+	while(!pq.empty()) {
+		const queued top = pq.top();
+		pq.pop();
+		if(top.first > dist[top.second]) {
+			continue;
+		}
+		if(top.second == to) {
+			break;
+		}
+
+		const int cx = top.second % grid.w;
+		const int cy = top.second / grid.w;
+		for(int dy = -1; dy <= 1; ++dy) {
+			for(int dx = -1; dx <= 1; ++dx) {
+				const int nx = cx + dx;
+				const int ny = cy + dy;
+				if((dx == 0 && dy == 0) || nx < 0 || ny < 0 || nx >= grid.w || ny >= grid.h) {
+					continue;
+				}
+
+				const int n = ny * grid.w + nx;
+				if(!grid.passable[n]) {
+					continue;
+				}
+
+				const double edge = cluster_size * (grid.avg_cost[top.second] + grid.avg_cost[n]) / 2.0;
+				if(top.first + edge < dist[n]) {
+					dist[n] = top.first + edge;
+					prev[n] = top.second;
+					pq.emplace(dist[n], n);
+				}
+			}
+		}
+	}
+
+	std::vector<int> chain;
+	if(dist[to] == std::numeric_limits<double>::max()) {
+		return chain;
+	}
+
+	for(int c = to; c != -1; c = prev[c]) {
+		chain.push_back(c);
+	}
+
+	return chain;
+}
+
+/** Makes every hex outside the corridor look impassable to the wrapped calculator. */
+struct corridor_calculator : cost_calculator
+{
+	corridor_calculator(const cost_calculator& base, const std::vector<bool>& allowed, const cluster_grid& grid)
+		: base_(base)
+		, allowed_(allowed)
+		, grid_(grid)
+	{
+	}
+
+	virtual double cost(const map_location& loc, const double so_far) const
+	{
+		if(loc.x < 0 || loc.y < 0 || !allowed_[grid_.index(loc)]) {
+			return getNoPathValue();
+		}
+
+		return base_.cost(loc, so_far);
+	}
+
+private:
+	const cost_calculator& base_;
+	const std::vector<bool>& allowed_;
+	const cluster_grid& grid_;
+};
+
+} // anonymous namespace
+
+plain_route hierarchical_route(const unit& u, const map_location& src,
+		const map_location& dst, double stop_at, const cost_calculator& calc,
+		const gamemap& map, const teleport_map* teleports)
+{
+	const bool tunnels = teleports && !teleports->empty();
+	if(tunnels || map.w() * map.h() < min_map_area
+			|| static_cast<int>(distance_between(src, dst)) < min_goto_distance) {
+		return a_star_search(src, dst, stop_at, calc, map.w(), map.h(), teleports);
+	}
+
+	const cluster_grid& grid = get_grid(u, map);
+	const std::vector<int> chain = coarse_route(grid, grid.index(src), grid.index(dst));
+	if(chain.empty()) {
+		return a_star_search(src, dst, stop_at, calc, map.w(), map.h(), teleports);
+	}
+
+	// Allow the chain's clusters plus everything bordering them, so the
+	// refinement has room to wind around local obstacles.
+	std::vector<bool> allowed(grid.w * grid.h, false);
+	for(const int c : chain) {
+		const int cx = c % grid.w;
+		const int cy = c / grid.w;
+		for(int dy = -1; dy <= 1; ++dy) {
+			for(int dx = -1; dx <= 1; ++dx) {
+				const int nx = cx + dx;
+				const int ny = cy + dy;
+				if(nx >= 0 && ny >= 0 && nx < grid.w && ny < grid.h) {
+					allowed[ny * grid.w + nx] = true;
+				}
+			}
+		}
+	}
+
+	const corridor_calculator corridor(calc, allowed, grid);
+	plain_route route = a_star_search(src, dst, stop_at, corridor, map.w(), map.h(), teleports);
+	if(route.steps.empty()) {
+		// The true route leaves the corridor; pay for the full search once.
+		route = a_star_search(src, dst, stop_at, calc, map.w(), map.h(), teleports);
+	}
+
+	return route;
+}
+
+} // namespace pathfind
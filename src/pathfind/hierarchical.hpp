@@ -0,0 +1,53 @@
+/*
+	Copyright (C) 2022
+	Part of the Battle for Wesnoth Project https://www.wesnoth.org/
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY.
+
+	See the COPYING file for more details.
+*/
+
+/**
+ * @file
+ * Hierarchical route search for long goto previews on big maps.
+ */
+
+#pragma once
+
+#include "map/location.hpp"
+#include "pathfind/pathfind.hpp"
+
+class gamemap;
+class unit;
+
+namespace pathfind {
+
+class teleport_map;
+
+/**
+ * Searches a route from @a src to @a dst through a clustered abstraction
+ * of the map.
+ *
+ * The map is divided into fixed-size clusters of hexes carrying an average
+ * transit cost per movement type, rebuilt only when the terrain changes. A
+ * coarse search over the clusters picks a corridor, and the exact route is
+ * refined on demand by running a_star_search() restricted to that corridor,
+ * so the number of expanded hexes grows with the route length instead of
+ * the map area.
+ *
+ * The result can be slightly longer than the true optimum when the best
+ * route leaves the corridor, which makes this a fit for the mouse-over
+ * route preview rather than for movement execution. Small maps, short
+ * hops, failed corridor refinements and non-empty teleport maps all fall
+ * back to a plain a_star_search().
+ */
+plain_route hierarchical_route(const unit& u, const map_location& src,
+		const map_location& dst, double stop_at, const cost_calculator& calc,
+		const gamemap& map, const teleport_map* teleports = nullptr);
+
+}
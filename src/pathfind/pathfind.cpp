@@ -23,6 +23,7 @@
 #include "pathfind/teleport.hpp"
 
 #include "display.hpp"
+#include "frame_profiler.hpp"
 #include "game_board.hpp"
 #include "gettext.hpp"
 #include "log.hpp"
@@ -33,8 +34,8 @@
 #include "units/map.hpp"
 #include "wml_exception.hpp"
 
-#include <vector>
 #include <algorithm>
+#include <vector>
 
 static lg::log_domain log_engine("engine");
 #define ERR_PF LOG_STREAM(err, log_engine)
@@ -226,6 +227,35 @@ namespace {
 			return nodes[r] < nodes[l];
 		}
 	};
+
+	/**
+	 * Per-thread scratch state reused across find_routes() calls.
+	 *
+	 * The AI runs thousands of reachability queries per turn, so the node
+	 * array, the heap and the adjacency buffer keep their storage between
+	 * searches; a query only allocates when the map grows. The generation
+	 * counter makes resetting the node array O(1), as entries written by
+	 * earlier searches are simply ignored.
+	 */
+	struct search_context {
+		std::vector<findroute_node> nodes;
+		std::vector<unsigned> hexes_to_process;
+		std::vector<map_location> adj_locs;
+		unsigned search_counter = 0;
+
+		/** Readies the context for a new search over @a map_size nodes. */
+		unsigned begin_search(unsigned map_size) {
+			++search_counter;
+			// Whenever the counter cycles, trash the node contents and restart at 1.
+			if ( search_counter == 0 ) {
+				nodes.resize(0);
+				search_counter = 1;
+			}
+			nodes.resize(map_size);
+			hexes_to_process.clear();
+			return search_counter;
+		}
+	};
 }
 
 /**
@@ -276,6 +306,9 @@ static void find_routes(
 		const std::map<map_location, int> * jamming_map=nullptr,
 		std::vector<std::pair<int, int>> * full_cost_map=nullptr, bool check_vision=false)
 {
+	// One branch when the profiler is off, so this can stay in permanently.
+	frame_profiler::scope profile(frame_profiler::subsystem::pathfinding);
+
 	const gamemap& map = resources::gameboard->map();
 
 	const bool see_all =  viewing_team == nullptr;
@@ -289,20 +322,15 @@ static void find_routes(
 			get_teleport_locations(*teleporter, *viewing_team, see_all, current_team == nullptr, check_vision) :
 			teleport_map();
 
-	// Since this is called so often, keep memory reserved for the node list.
-	static std::vector<findroute_node> nodes;
-	static unsigned search_counter = 0;
-	// Incrementing search_counter means we ignore results from earlier searches.
-	++search_counter;
-	// Whenever the counter cycles, trash the contents of nodes and restart at 1.
-	if ( search_counter == 0 ) {
-		nodes.resize(0);
-		search_counter = 1;
-	}
-	// Initialize the nodes for this search.
-	nodes.resize(map.w() * map.h());
+	// Since this is called so often, keep memory reserved for the node list,
+	// the heap and the adjacency buffer between searches.
+	static thread_local search_context ctx;
+	// Incrementing the counter means we ignore results from earlier searches.
+	const unsigned search_counter = ctx.begin_search(map.w() * map.h());
+	std::vector<findroute_node>& nodes = ctx.nodes;
 	findroute_comp node_comp(nodes);
 	findroute_indexer index(map.w(), map.h());
+	const adjacency_index& adjacency = get_adjacency_index(map.w(), map.h());
 
 	assert(index.on_board(origin));
 
@@ -327,7 +355,8 @@ static void find_routes(
 	                                      map_location::null_location(),
 	                                      search_counter);
 	// Begin the search at the starting location.
-	std::vector<unsigned> hexes_to_process(1, index(origin));  // Will be maintained as a heap.
+	std::vector<unsigned>& hexes_to_process = ctx.hexes_to_process;  // Will be maintained as a heap.
+	hexes_to_process.push_back(index(origin));
 
 	while ( !hexes_to_process.empty() ) {
 		// Process the hex closest to the origin.
@@ -338,20 +367,20 @@ static void find_routes(
 		std::pop_heap(hexes_to_process.begin(), hexes_to_process.end(), node_comp);
 		hexes_to_process.pop_back();
 
-		// Get the locations adjacent to current.
-		std::vector<map_location> adj_locs(6);
-		get_adjacent_tiles(cur_hex, adj_locs.data());
-
-		// Sort adjacents by on-boardness
-		auto off_board_it = std::partition(adj_locs.begin(), adj_locs.end(), [&index](map_location loc){
-			return index.on_board(loc);
-		});
-		// Store off-board edges if needed
-		if(edges != nullptr){
-			edges->insert(off_board_it, adj_locs.end());
+		// Get the on-board locations adjacent to current, straight from the
+		// precomputed table; -1 entries are the off-board sides.
+		std::vector<map_location>& adj_locs = ctx.adj_locs;
+		adj_locs.clear();
+		for(std::size_t a = 0; a != 6; ++a) {
+			const int adj_index = adjacency.adjacent(cur_index)[a];
+			if(adj_index >= 0) {
+				adj_locs.push_back(index(static_cast<unsigned>(adj_index)));
+			} else if(edges != nullptr) {
+				// Off-board neighbors are rare (border hexes only), so the
+				// offset math is only redone for them, and only on demand.
+				edges->insert(cur_hex.get_direction(static_cast<map_location::DIRECTION>(a)));
+			}
 		}
-		// Remove off-board map locations
-		adj_locs.erase(off_board_it, adj_locs.end());
 
 		if ( teleporter ) {
 			auto allowed_teleports = teleports.get_adjacents(cur_hex);
@@ -375,7 +404,9 @@ static void find_routes(
 			next.prev = cur_hex;
 
 			// Calculate the cost of entering next_hex.
-			int cost = costs.cost(map[next_hex], slowed);
+			// next_hex comes from the adjacency table or a teleport exit,
+			// so it is known to be on the map.
+			int cost = costs.cost(map.get_terrain_unchecked(next_hex), slowed);
 			if ( jamming_map ) {
 				const std::map<map_location, int>::const_iterator jam_it =
 					jamming_map->find(next_hex);
@@ -561,6 +592,21 @@ paths::~paths()
 {
 }
 
+std::vector<paths> find_paths_batch(const std::vector<const unit*>& units,
+		bool force_ignore_zoc, bool allow_teleport, const team& viewing_team,
+		int additional_turns, bool see_all, bool ignore_units)
+{
+	std::vector<paths> res;
+	res.reserve(units.size());
+
+	for ( const unit * u : units ) {
+		res.emplace_back(*u, force_ignore_zoc, allow_teleport,
+		                 viewing_team, additional_turns, see_all, ignore_units);
+	}
+
+	return res;
+}
+
 /**
  * Constructs a list of vision paths for a unit.
  *
@@ -101,6 +101,23 @@ struct paths
 	dest_vect destinations;
 };
 
+/**
+ * Computes the paths of several units in one call.
+ *
+ * The results line up index-for-index with @a units; the remaining
+ * parameters mean the same as for the paths constructor. The searches run
+ * one after another on the caller's thread: too much lazily built state
+ * hangs off the live board to shard them across workers — the movetype
+ * cost caches shared between same-type units, the per-unit invisibility
+ * caches filled in by visibility checks, and [tunnel] and ability filters
+ * that may call into Lua. Batching still pays because consecutive
+ * searches hit the memoized teleport map and reuse the reserved search
+ * scratch buffers.
+ */
+std::vector<paths> find_paths_batch(const std::vector<const unit*>& units,
+		bool force_ignore_zoc, bool allow_teleport, const team& viewing_team,
+		int additional_turns = 0, bool see_all = false, bool ignore_units = false);
+
 /**
  * A refinement of paths for use when calculating vision.
  */
@@ -195,6 +212,21 @@ plain_route a_star_search(const map_location& src, const map_location& dst,
 		const std::size_t parWidth, const std::size_t parHeight,
 		const teleport_map* teleports = nullptr, bool border = false);
 
+/**
+ * Variant of a_star_search() expanding frontiers from both ends at once.
+ *
+ * On long routes this expands roughly half the nodes of the one-sided
+ * search. The meeting arithmetic is only exact when the calculator's cost
+ * doesn't depend on its so_far argument, so callers whose cost varies with
+ * accumulated movement (e.g. ZoC handling in shortest_path_calculator)
+ * should stay with a_star_search(). Falls back to it internally when a
+ * non-empty teleport map is given, as teleports have no reverse adjacency.
+ */
+plain_route bidirectional_a_star_search(const map_location& src, const map_location& dst,
+		double stop_at, const cost_calculator& costCalculator,
+		const std::size_t parWidth, const std::size_t parHeight,
+		const teleport_map* teleports = nullptr, bool border = false);
+
 /**
  * Add marks on a route @a rt assuming that the unit located at the first hex of
  * rt travels along it.
@@ -18,10 +18,14 @@
 #include "display_context.hpp"
 #include "filter_context.hpp"
 #include "game_board.hpp"
+#include "game_events/manager.hpp"
+#include "game_events/pump.hpp"
 #include "log.hpp"
+#include "map/map.hpp"
 #include "resources.hpp"
 #include "serialization/string_utils.hpp"
 #include "team.hpp"
+#include "tod_manager.hpp"
 #include "terrain/filter.hpp"
 #include "units/unit.hpp"
 #include "units/filter.hpp"
@@ -267,10 +271,64 @@ std::set<map_location> teleport_map::get_targets() const
 	return res;
 }
 
+namespace {
+
+/**
+ * Memoizes the teleport_map most recently built on this thread.
+ *
+ * The stamp covers everything the [tunnel] filters can read: the tunnel list
+ * itself, unit placement and terrain (via the unit_map and gamemap version
+ * counters), the turn, and the number of WML event handlers run so far —
+ * variables, time areas and in-place unit changes only happen from inside a
+ * handler. Kept thread-local so a future off-main-thread caller gets its
+ * own copy instead of a race.
+ */
+struct teleport_cache {
+	bool valid = false;
+	unsigned long long tunnels_version;
+	unsigned long long events_processed;
+	unsigned long long units_version;
+	unsigned long long map_version;
+	int turn;
+	std::size_t unit_id;
+	map_location unit_loc;
+	int viewing_side;
+	bool see_all;
+	bool ignore_units;
+	bool check_vision;
+	teleport_map map;
+};
+
+}
+
 const teleport_map get_teleport_locations(const unit &u,
 	const team &viewing_team,
 	bool see_all, bool ignore_units, bool check_vision)
 {
+	static thread_local teleport_cache cache;
+
+	const unsigned long long tunnels_version = resources::tunnels->version();
+	const unsigned long long events_processed =
+			resources::game_events ? resources::game_events->pump().processed_event_count() : 0;
+	const unsigned long long units_version = resources::gameboard->units().version();
+	const unsigned long long map_version = resources::gameboard->map().version();
+	const int turn = resources::tod_manager ? resources::tod_manager->turn() : 0;
+
+	if (cache.valid
+			&& cache.tunnels_version == tunnels_version
+			&& cache.events_processed == events_processed
+			&& cache.units_version == units_version
+			&& cache.map_version == map_version
+			&& cache.turn == turn
+			&& cache.unit_id == u.underlying_id()
+			&& cache.unit_loc == u.get_location()
+			&& cache.viewing_side == viewing_team.side()
+			&& cache.see_all == see_all
+			&& cache.ignore_units == ignore_units
+			&& cache.check_vision == check_vision) {
+		return cache.map;
+	}
+
 	std::vector<teleport_group> groups;
 
 	for (const unit_ability & teleport : u.get_abilities("teleport")) {
@@ -284,10 +342,14 @@ const teleport_map get_teleport_locations(const unit &u,
 	const std::vector<teleport_group>& global_groups = resources::tunnels->get();
 	groups.insert(groups.end(), global_groups.begin(), global_groups.end());
 
-	return teleport_map(groups, u, viewing_team, see_all, ignore_units, check_vision);
+	cache = teleport_cache{true, tunnels_version, events_processed, units_version,
+			map_version, turn, u.underlying_id(), u.get_location(), viewing_team.side(),
+			see_all, ignore_units, check_vision,
+			teleport_map(groups, u, viewing_team, see_all, ignore_units, check_vision)};
+	return cache.map;
 }
 
-manager::manager(const config &cfg) : tunnels_(), id_(cfg["next_teleport_group_id"].to_int(0)) {
+manager::manager(const config &cfg) : tunnels_(), id_(cfg["next_teleport_group_id"].to_int(0)), version_(0) {
 	const int tunnel_count = cfg.child_count("tunnel");
 	for(int i = 0; i < tunnel_count; ++i) {
 		const config& t = cfg.mandatory_child("tunnel", i);
@@ -303,6 +365,7 @@ manager::manager(const config &cfg) : tunnels_(), id_(cfg["next_teleport_group_i
 
 void manager::add(const teleport_group &group) {
 	tunnels_.push_back(group);
+	++version_;
 }
 
 void manager::remove(const std::string &id) {
@@ -310,6 +373,7 @@ void manager::remove(const std::string &id) {
 	for(;t != tunnels_.end();) {
 		if (t->get_teleport_id() == id || t->get_teleport_id() == id + reversed_suffix) {
 			t = tunnels_.erase(t);
+			++version_;
 		} else {
 			++t;
 		}
@@ -179,9 +179,16 @@ public:
 	 * @returns the next free unique id for a teleport group
 	 */
 	std::string next_unique_id();
+
+	/*
+	 * Counter incremented whenever a tunnel is added or removed, so cached
+	 * teleport maps can tell that the tunnel list changed under them.
+	 */
+	unsigned long long version() const { return version_; }
 private:
 	std::vector<teleport_group> tunnels_;
 	int id_;
+	unsigned long long version_;
 };
 
 }
@@ -24,6 +24,8 @@
 #include "display.hpp"
 #include "filesystem.hpp"
 #include "game_config.hpp"
+#include "game_version.hpp"
+#include "hash.hpp"
 #include "image_modifications.hpp"
 #include "log.hpp"
 #include "preferences/general.hpp"
@@ -40,7 +42,9 @@
 #include <boost/functional/hash_fwd.hpp>
 
 #include <array>
+#include <map>
 #include <set>
+#include <thread>
 
 static lg::log_domain log_image("image");
 #define ERR_IMG LOG_STREAM(err, log_image)
@@ -153,6 +157,19 @@ namespace
 /** Definition of all image maps */
 std::array<surface_cache, NUM_TYPES> surfaces_;
 
+/**
+ * Approximate VRAM held by cached textures, and the point at which the
+ * texture caches get dropped wholesale.
+ *
+ * Textures are cheap to recreate from the surface cache, so the eviction
+ * policy is deliberately simple: every texture entering a cache is counted,
+ * and when a long session crosses the budget everything is flushed and the
+ * working set rebuilds on demand. Whatever the current screen uses is back
+ * within a frame; everything stale stays gone.
+ */
+constexpr std::size_t texture_cache_budget = 256u * 1024u * 1024u;
+std::size_t cached_texture_bytes = 0;
+
 /**
  * Texture caches.
  * Note that the latter two are temporary and should be removed once we have OGL and shader support.
@@ -163,6 +180,132 @@ texture_cache_map textures_;
 texture_cache_map textures_hexed_;
 texture_cache_map texture_tod_colored_;
 
+/**
+ * Packs small images into shared texture pages.
+ *
+ * The terrain layers are drawn as long runs of hex-sized blits, one texture
+ * per tile. When those tiles live in a handful of shared pages instead of one
+ * SDL_Texture each, the renderer's internal batching can merge consecutive
+ * blits into a single draw call, which is what keeps scrolling smooth at far
+ * zoom where thousands of tiles are on screen.
+ *
+ * Entries are placed with a simple shelf packer; images too large to pack
+ * sensibly get their own texture, as before.
+ */
+class texture_atlas
+{
+public:
+	/** Uploads @a surf into a page and returns a handle referencing it. */
+	texture add(const surface& surf);
+
+	void clear()
+	{
+		pages_.clear();
+	}
+
+private:
+	struct page
+	{
+		bool init();
+		bool try_allocate(int w, int h, rect& out);
+
+		texture tex;
+		int next_x = 0;
+		int next_y = 0;
+		int shelf_height = 0;
+	};
+
+	static constexpr int page_size = 2048;
+	static constexpr int max_entry_size = 512;
+	/** Keeps scaled drawing from sampling texels of the adjacent entry. */
+	static constexpr int padding = 1;
+
+	std::vector<page> pages_;
+};
+
+bool texture_atlas::page::init()
+{
+	set_texture_scale_quality("nearest");
+	tex = texture(page_size, page_size, SDL_TEXTUREACCESS_STATIC);
+	if(!tex) {
+		return false;
+	}
+
+	// Clear the page, so the padding around entries is transparent
+	// rather than whatever the driver left in the memory.
+	const surface blank(page_size, page_size);
+	SDL_UpdateTexture(tex, nullptr, blank->pixels, blank->pitch);
+
+	cached_texture_bytes += std::size_t(4) * page_size * page_size;
+	return true;
+}
+
+bool texture_atlas::page::try_allocate(int w, int h, rect& out)
+{
+	if(next_x + w + padding > page_size) {
+		// Start a new shelf below the current one.
+		next_x = 0;
+		next_y += shelf_height;
+		shelf_height = 0;
+	}
+
+	if(next_y + h + padding > page_size) {
+		return false;
+	}
+
+	out = {next_x, next_y, w, h};
+	next_x += w + padding;
+	shelf_height = std::max(shelf_height, h + padding);
+	return true;
+}
+
+texture texture_atlas::add(const surface& surf)
+{
+	if(!surf || surf->w <= 0 || surf->h <= 0) {
+		return texture();
+	}
+
+	// Oversized images would leave most of a shelf unusable, and non-neutral
+	// surfaces can't be uploaded as-is. Both keep their own texture.
+	if(!surf.is_neutral() || surf->w > max_entry_size || surf->h > max_entry_size) {
+		cached_texture_bytes += std::size_t(4) * surf->w * surf->h;
+		return texture(surf);
+	}
+
+	page* p = nullptr;
+	rect dst;
+
+	for(page& candidate : pages_) {
+		if(candidate.try_allocate(surf->w, surf->h, dst)) {
+			p = &candidate;
+			break;
+		}
+	}
+
+	if(!p) {
+		pages_.emplace_back();
+		if(!pages_.back().init()) {
+			// No renderer, or the driver can't handle pages this large.
+			pages_.pop_back();
+			cached_texture_bytes += std::size_t(4) * surf->w * surf->h;
+			return texture(surf);
+		}
+
+		p = &pages_.back();
+		p->try_allocate(surf->w, surf->h, dst); // can't fail on a fresh page
+	}
+
+	SDL_UpdateTexture(p->tex, &dst, surf->pixels, surf->pitch);
+
+	texture res = p->tex;
+	res.set_src_raw(dst);
+	res.set_draw_size(surf->w, surf->h);
+	return res;
+}
+
+texture_atlas terrain_atlas_;
+image::texture_cache terrain_textures_;
+
 // cache storing if each image fit in a hex
 image::bool_cache in_hex_info_;
 
@@ -176,6 +319,34 @@ image::lit_texture_cache lit_textures_;
 image::lit_surface_variants surface_lightmaps_;
 image::lit_texture_variants texture_lightmaps_;
 
+/**
+ * Drops every cached texture once the VRAM budget is exceeded.
+ *
+ * The surface caches are left alone, so evicted entries that are still in use
+ * get rebuilt from RAM without touching the disk. Called right after each
+ * insertion into a texture cache; must not be called while the terrain atlas
+ * is in the middle of an add().
+ */
+void enforce_texture_budget()
+{
+	if(cached_texture_bytes < texture_cache_budget) {
+		return;
+	}
+
+	LOG_IMG << "cached textures reached "
+			<< (cached_texture_bytes / (1024 * 1024))
+			<< " MiB, flushing the texture caches";
+
+	textures_.clear();
+	textures_hexed_.clear();
+	texture_tod_colored_.clear();
+	lit_textures_.flush();
+	texture_lightmaps_.clear();
+	terrain_textures_.flush();
+	terrain_atlas_.clear();
+	cached_texture_bytes = 0;
+}
+
 // diagnostics for tracking skipped cache impact
 std::array<bool_cache, NUM_TYPES> skipped_cache_;
 int duplicate_loads_ = 0;
@@ -216,6 +387,131 @@ parsed_data_URI::parsed_data_URI(std::string_view data_URI)
 	good = (scheme == "data" && base64 == "base64" && mime.length() > 0 && data.length() > 0);
 }
 
+/**
+ * Computes the disk cache location for an image with modifications applied.
+ *
+ * Applying a chain of path functions (team color, crops, masks...) redoes
+ * exactly the same pixel work on every launch, so finished results are kept
+ * on disk under a content hash and reloaded on later runs. The hash covers
+ * the resolved base file (path, size, timestamp), the modification chain and
+ * the game version. Images pulled in by the chain itself (a ~MASK or ~BLIT
+ * argument, say) are not tracked; editing one of those without touching the
+ * base image keeps serving the stale entry, which is the usual add-on
+ * development case for clearing the cache directory.
+ *
+ * Returns an empty string for images that shouldn't be cached on disk.
+ */
+std::string disk_cache_path(const image::locator& loc)
+{
+	// Sub-tile cuts also populate the empty-hex cache as a side effect of
+	// being built, and data URIs already carry their content in the key.
+	if(loc.get_modifications().empty() || loc.get_loc().valid() || loc.is_data_uri()) {
+		return "";
+	}
+
+	const std::string location = filesystem::get_binary_file_location("images", loc.get_filename());
+	if(location.empty()) {
+		return "";
+	}
+
+	static const std::string dir = []() {
+		std::string d = filesystem::get_cache_dir() + "/images";
+		filesystem::make_directory(d);
+		return d;
+	}();
+
+	std::ostringstream key;
+	key << location << '|' << filesystem::file_size(location) << '|'
+		<< filesystem::file_modified_time(location) << '|'
+		<< loc.get_modifications() << '|' << game_config::wesnoth_version.str();
+
+	return dir + "/" + utils::md5(key.str()).hex_digest() + ".png";
+}
+
+/** Returns the cached result for @a path, or null on a cache miss. */
+surface load_from_disk_cache(const std::string& path)
+{
+	if(path.empty() || !filesystem::file_exists(path)) {
+		return nullptr;
+	}
+
+	filesystem::rwops_ptr rwops = filesystem::make_read_RWops(path);
+	return IMG_Load_RW(rwops.release(), true); // SDL takes ownership of rwops
+}
+
+void store_to_disk_cache(const std::string& path, const surface& surf)
+{
+	const int err = IMG_SavePNG_RW(surf, filesystem::make_write_RWops(path).release(), true); // SDL takes ownership of the RWops
+	if(err != 0) {
+		WRN_IMG << "Could not write to the image disk cache: " << path;
+	}
+}
+
+/**
+ * Base images decoded ahead of time by a worker pool, keyed by the resolved
+ * on-disk location. load_image_file() consumes entries instead of decoding
+ * again. Only the main thread touches this map; the workers each fill a
+ * private slot and the results are collected after the join.
+ */
+std::map<std::string, surface> predecoded_images;
+
+/**
+ * Decodes the given image files on a worker pool and stages the results for
+ * load_image_file().
+ *
+ * Decoding is the thread-safe part of a cache fill: each worker reads and
+ * inflates files nobody else can see, so disk waits and PNG inflate overlap
+ * across cores. Everything touching shared state - the caches, and the
+ * surface refcount, which is SDL's and not atomic - stays on the calling
+ * thread.
+ */
+void predecode_image_files(const std::vector<std::string>& locations)
+{
+	const std::size_t workers = std::min<std::size_t>(
+		std::max(1u, std::thread::hardware_concurrency()), locations.size());
+
+	if(workers < 2) {
+		return;
+	}
+
+	std::vector<SDL_Surface*> decoded(locations.size(), nullptr);
+	std::vector<std::thread> pool;
+
+	for(std::size_t w = 0; w != workers; ++w) {
+		pool.emplace_back([&, w]() {
+			// Strided split: neighbouring list entries tend to be files of
+			// similar size, so stripes spread the heavy ones evenly.
+			for(std::size_t i = w; i < locations.size(); i += workers) {
+				filesystem::rwops_ptr rwops = filesystem::make_read_RWops(locations[i]);
+				decoded[i] = IMG_Load_RW(rwops.release(), true); // SDL takes ownership of rwops
+			}
+		});
+	}
+
+	for(std::thread& t : pool) {
+		t.join();
+	}
+
+	for(std::size_t i = 0; i != locations.size(); ++i) {
+		if(decoded[i]) {
+			predecoded_images.emplace(locations[i], surface(decoded[i]));
+		}
+	}
+}
+
+/** Takes the predecoded surface for @a location out of the staging map, if any. */
+surface take_predecoded(const std::string& location)
+{
+	const auto it = predecoded_images.find(location);
+	if(it == predecoded_images.end()) {
+		return nullptr;
+	}
+
+	surface res = std::move(it->second);
+	predecoded_images.erase(it);
+	return res;
+}
+
 } // end anon namespace
 
 mini_terrain_cache_map mini_terrain_cache;
@@ -236,6 +532,9 @@ void flush_cache()
 	textures_.clear();
 	textures_hexed_.clear();
 	texture_tod_colored_.clear();
+	terrain_textures_.flush();
+	terrain_atlas_.clear();
+	cached_texture_bytes = 0;
 	mini_terrain_cache.clear();
 	mini_fogged_terrain_cache.clear();
 	mini_highlighted_terrain_cache.clear();
@@ -473,8 +772,11 @@ static surface load_image_file(const image::locator& loc)
 				location = loc_location;
 			}
 
-			filesystem::rwops_ptr rwops = filesystem::make_read_RWops(location);
-			res = IMG_Load_RW(rwops.release(), true); // SDL takes ownership of rwops
+			res = take_predecoded(location);
+			if(!res) {
+				filesystem::rwops_ptr rwops = filesystem::make_read_RWops(location);
+				res = IMG_Load_RW(rwops.release(), true); // SDL takes ownership of rwops
+			}
 
 			// If there was no standalone localized image, check if there is an overlay.
 			if(res && loc_location.empty()) {
@@ -499,6 +801,11 @@ static surface load_image_file(const image::locator& loc)
 
 static surface load_image_sub_file(const image::locator& loc)
 {
+	const std::string cache_file = disk_cache_path(loc);
+	if(surface cached = load_from_disk_cache(cache_file)) {
+		return cached;
+	}
+
 	surface surf = get_surface(loc.get_filename(), UNSCALED);
 	if(surf == nullptr) {
 		return nullptr;
@@ -558,6 +865,10 @@ static surface load_image_sub_file(const image::locator& loc)
 		loc.add_to_cache(is_empty_hex_, is_empty);
 	}
 
+	if(surf && !cache_file.empty()) {
+		store_to_disk_cache(cache_file, surf);
+	}
+
 	return surf;
 }
 
@@ -904,6 +1215,12 @@ texture get_lighted_texture(
 	// record the lighted texture in the corresponding variants cache
 	i_locator.access_in_cache(*imap)[ls] = tex;
 
+	if(tex) {
+		const point size = tex.get_raw_size();
+		cached_texture_bytes += std::size_t(4) * size.x * size.y;
+		enforce_texture_budget();
+	}
+
 	return tex;
 }
 
@@ -1076,6 +1393,44 @@ texture get_texture(const image::locator& i_locator, TYPE type, bool skip_cache)
 	return get_texture(i_locator, scale_quality::nearest, type, skip_cache);
 }
 
+void precache_surfaces(const std::vector<locator>& locators)
+{
+	// First decode the base files on a worker pool. The resolution mirrors
+	// load_image_file() so the staged results are found again below.
+	std::set<std::string> locations;
+
+	for(const locator& loc : locators) {
+		if(loc.is_data_uri()) {
+			continue;
+		}
+
+		std::string location = filesystem::get_binary_file_location("images", loc.get_filename());
+		if(location.empty()) {
+			continue;
+		}
+
+		const std::string loc_location = filesystem::get_localized_path(location);
+		if(!loc_location.empty()) {
+			location = loc_location;
+		}
+
+		locations.insert(location);
+	}
+
+	predecode_image_files({locations.begin(), locations.end()});
+
+	// Surface building stays sequential: surfaces are shared through SDL's
+	// non-atomic refcount, and the caches aren't locked. With the decodes
+	// already staged this loop is mostly blits and cache inserts.
+	for(const locator& loc : locators) {
+		get_surface(loc);
+	}
+
+	// Whatever wasn't consumed - base files whose modified result came out
+	// of the disk cache, mostly - shouldn't outlive the precache.
+	predecoded_images.clear();
+}
+
 /** Returns a texture for the corresponding image. */
 texture get_texture(const image::locator& i_locator, scale_quality quality, TYPE type, bool skip_cache)
 {
@@ -1133,9 +1488,33 @@ texture get_texture(const image::locator& i_locator, scale_quality quality, TYPE
 		DBG_IMG << "texture cache [" << type << "] skip: " << i_locator;
 	} else {
 		i_locator.add_to_cache(*cache, res);
+
+		if(res) {
+			const point size = res.get_raw_size();
+			cached_texture_bytes += std::size_t(4) * size.x * size.y;
+			enforce_texture_budget();
+		}
 	}
 
 	return res;
 }
 
+texture get_terrain_texture(const image::locator& i_locator)
+{
+	if(i_locator.is_void()) {
+		return texture();
+	}
+
+	if(auto cached_item = i_locator.copy_from_cache(terrain_textures_)) {
+		return *cached_item;
+	}
+
+	DBG_IMG << "terrain texture cache miss: " << i_locator;
+
+	texture res = terrain_atlas_.add(get_surface(i_locator, HEXED));
+	i_locator.add_to_cache(terrain_textures_, res);
+	enforce_texture_budget();
+	return res;
+}
+
 } // end namespace image
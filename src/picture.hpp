@@ -252,6 +252,19 @@ enum class scale_quality { nearest, linear };
 surface get_surface(const locator& i_locator, TYPE type = UNSCALED,
 	bool skip_cache = false);
 
+/**
+ * Fills the surface cache for the given images ahead of time.
+ *
+ * Building a modified surface (team color, flips, blits...) on first sight
+ * of a sprite causes a visible hitch mid-game; warming the cache during the
+ * loading screen moves that cost to where a delay is expected. Images
+ * already cached are skipped, and failures to load are ignored just as they
+ * would be on first use.
+ *
+ * @param locators             Image paths, including any modifications.
+ */
+void precache_surfaces(const std::vector<locator>& locators);
+
 /**
  * Returns an image texture suitable for hardware-accelerated rendering.
  *
@@ -284,6 +297,20 @@ texture get_texture(const image::locator& i_locator, scale_quality quality,
 surface get_lighted_image(const image::locator& i_locator, const light_string& ls);
 texture get_lighted_texture(const image::locator& i_locator, const light_string& ls);
 
+/**
+ * Returns a texture for a terrain tile, packed into a shared atlas page.
+ *
+ * Images will always be HEXED type. Because many tiles reference the same
+ * underlying SDL_Texture, the renderer can batch consecutive terrain blits
+ * into far fewer draw calls than with one texture per tile. For the same
+ * reason the returned handle must be drawn as-is: setting texture properties
+ * (alpha, color or blend modifiers) on it would affect every tile sharing
+ * the page.
+ *
+ * @param i_locator            Image path.
+ */
+texture get_terrain_texture(const image::locator& i_locator);
+
 /**
  * Retrieves the standard hexagonal tile mask.
  */
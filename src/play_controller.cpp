@@ -22,6 +22,7 @@
 #include "play_controller.hpp"
 
 #include "actions/advancement.hpp"
+#include "actions/attack.hpp"
 #include "actions/create.hpp"
 #include "actions/heal.hpp"
 #include "actions/undo.hpp"
@@ -44,7 +45,9 @@
 #include "hotkey/hotkey_item.hpp"
 #include "log.hpp"
 #include "map/label.hpp"
+#include "map/map.hpp"
 #include "pathfind/teleport.hpp"
+#include "picture.hpp"
 #include "preferences/credentials.hpp"
 #include "preferences/display.hpp"
 #include "preferences/game.hpp"
@@ -61,6 +64,7 @@
 #include "soundsource.hpp"
 #include "statistics.hpp"
 #include "synced_context.hpp"
+#include "terrain/terrain.hpp"
 #include "tooltips.hpp"
 #include "units/id.hpp"
 #include "units/types.hpp"
@@ -120,6 +124,99 @@ static void copy_persistent(const config& src, config& dst)
 	}
 }
 
+/**
+ * Warms the image cache with the sprites each side can field, so that the
+ * first sight of a unit mid-game doesn't stall on building its team-colored
+ * surface. Covers the units already on the board, every side's recruit
+ * list, and the minimap images of the terrains the map uses.
+ */
+static void precache_unit_sprites(const game_board& board)
+{
+	if(video::headless()) {
+		return;
+	}
+
+	std::vector<image::locator> sprites;
+	std::set<std::string> seen;
+
+	const auto add = [&](const std::string& filename, const std::string& mods) {
+		if(!filename.empty() && seen.insert(filename + mods).second) {
+			sprites.emplace_back(filename, mods);
+		}
+	};
+
+	for(const unit& u : board.units()) {
+		add(u.absolute_image(), u.image_mods());
+	}
+
+	for(const team& t : board.teams()) {
+		for(const std::string& recruit : t.recruits()) {
+			if(const unit_type* type = unit_types.find(recruit)) {
+				add(type->image(), "~RC(" + type->flag_rgb() + ">" + team::get_side_color_id(t.side()) + ")");
+			}
+		}
+	}
+
+	for(const t_translation::terrain_code& t : board.map().get_terrain_list()) {
+		const terrain_type& info = board.map().get_terrain_info(t);
+		if(!info.minimap_image().empty()) {
+			add("terrain/" + info.minimap_image() + ".png", "");
+		}
+		if(!info.minimap_image_overlay().empty()) {
+			add("terrain/" + info.minimap_image_overlay() + ".png", "");
+		}
+	}
+
+	image::precache_surfaces(sprites);
+}
+
+/** Collects every "sound" attribute in @a cfg and its subtags. */
+static void collect_sound_attributes(const config& cfg, std::set<std::string>& out)
+{
+	if(const config::attribute_value* sound = cfg.get("sound")) {
+		if(!sound->blank() && !sound->str().empty()) {
+			out.insert(sound->str());
+		}
+	}
+
+	for(const config::any_child child : cfg.all_children_range()) {
+		collect_sound_attributes(child.cfg, out);
+	}
+}
+
+/**
+ * The audio counterpart of precache_unit_sprites(): loads the animation
+ * sounds of the unit types each side fields into the chunk cache, so the
+ * first hits and deaths of the game aren't accompanied by disk seeks.
+ */
+static void precache_unit_sounds(const game_board& board)
+{
+	if(video::headless()) {
+		return;
+	}
+
+	std::set<std::string> sounds;
+	std::set<const unit_type*> seen;
+
+	const auto add_type = [&](const unit_type* type) {
+		if(type && seen.insert(type).second) {
+			collect_sound_attributes(type->get_cfg(), sounds);
+		}
+	};
+
+	for(const unit& u : board.units()) {
+		add_type(&u.type());
+	}
+
+	for(const team& t : board.teams()) {
+		for(const std::string& recruit : t.recruits()) {
+			add_type(unit_types.find(recruit));
+		}
+	}
+
+	sound::preload_sound_effects(sounds);
+}
+
 static void clear_resources()
 {
 	resources::controller = nullptr;
@@ -157,11 +254,13 @@ play_controller::play_controller(const config& level, saved_game& state_of_game,
 	, soundsources_manager_()
 	, persist_()
 	, gui_()
+	, battle_context_cache_(new battle_context_cache())
 	, xp_mod_(new unit_experience_accelerator(level["experience_modifier"].to_int(100)))
 	, statistics_context_(new statistics::scenario_context(level["name"]))
 	, replay_(new replay(state_of_game.get_replay()))
 	, skip_replay_(skip_replay)
 	, skip_story_(state_of_game.skip_story())
+	, catching_up_(false)
 	, did_autosave_this_turn_(true)
 	, did_tod_sound_this_turn_(false)
 	, map_start_()
@@ -244,6 +343,8 @@ void play_controller::init(const config& level)
 		LOG_NG << "loading units..." << (SDL_GetTicks() - ticks());
 		gui2::dialogs::loading_screen::progress(loading_stage::load_units);
 		preferences::encounter_all_content(gamestate().board_);
+		precache_unit_sprites(gamestate().board_);
+		precache_unit_sounds(gamestate().board_);
 
 		LOG_NG << "initializing theme... " << (SDL_GetTicks() - ticks());
 		gui2::dialogs::loading_screen::progress(loading_stage::init_theme);
@@ -295,6 +396,11 @@ void play_controller::init(const config& level)
 			}
 		}
 
+		LOG_NG << "precaching terrain textures... " << (SDL_GetTicks() - ticks());
+		// Stream the terrain textures to the GPU in batches while the loading
+		// screen is still up, so the first draw doesn't stall on them.
+		gui_->precache_textures(map_start_);
+
 		init_managers();
 		gui2::dialogs::loading_screen::progress(loading_stage::start_game);
 		// loadscreen_manager->reset();
@@ -816,6 +922,11 @@ std::shared_ptr<wb::manager> play_controller::get_whiteboard() const
 	return whiteboard_manager_;
 }
 
+battle_context_cache& play_controller::get_battle_context_cache()
+{
+	return *battle_context_cache_;
+}
+
 const mp_game_settings& play_controller::get_mp_settings()
 {
 	return saved_game_.mp_settings();
@@ -1126,6 +1237,23 @@ bool play_controller::is_browsing() const
 	return !t.is_local_human() || !t.is_proxy_human();
 }
 
+void play_controller::play_slice(bool is_delay_enabled)
+{
+	controller_base::play_slice(is_delay_enabled);
+
+	// Resolve the route preview the latest mouse motion asked for. Doing it
+	// here instead of in the motion handler keeps cursor events cheap and
+	// coalesces a sweep across several hexes into one pathfind.
+	mouse_handler_.process_route_preview();
+
+	// A pass of the main loop is an idle point, so pay off some Lua garbage
+	// collection debt here in a bounded step rather than letting the
+	// collector pick its own moment in the middle of an animation.
+	if(gamestate().lua_kernel_) {
+		gamestate().lua_kernel_->run_gc_slice();
+	}
+}
+
 void play_controller::play_slice_catch()
 {
 	if(should_return_to_play_side()) {
@@ -29,6 +29,7 @@
 
 #include <set>
 
+class battle_context_cache;
 class game_display;
 class game_data;
 class team;
@@ -231,6 +232,16 @@ public:
 
 	bool is_skipping_replay() const { return skip_replay_; }
 	void toggle_skipping_replay();
+
+	/**
+	 * Whether a backlog of network commands is being replayed in a batch.
+	 *
+	 * While set, per-command display refreshes (such as the minimap rebuild
+	 * in do_replay()) are skipped; the batch performs them once at the end.
+	 * Managed by turn_info::process_network_data_from_reader().
+	 */
+	bool is_catching_up() const { return catching_up_; }
+	void set_catching_up(bool value) { catching_up_ = value; }
 	void do_autosave();
 
 	bool is_skipping_story() const { return skip_story_; }
@@ -241,6 +252,8 @@ public:
 	events::menu_handler& get_menu_handler() { return menu_handler_; }
 
 	std::shared_ptr<wb::manager> get_whiteboard() const;
+	/** Cached attack previews for the UI, see battle_context_cache. */
+	battle_context_cache& get_battle_context_cache();
 	const mp_game_settings& get_mp_settings();
 	game_classification& get_classification();
 	int get_server_request_number() const { return gamestate().server_request_number_; }
@@ -263,6 +276,13 @@ public:
 	virtual replay_controller * get_replay_controller() const { return nullptr; }
 	bool is_replay() const { return get_replay_controller() != nullptr; }
 
+	/**
+	 * Restarts the scenario from the hot-start snapshot captured after its
+	 * initialization, skipping the full controller teardown and setup.
+	 * @returns false if no snapshot is available (e.g. in networked games).
+	 */
+	virtual bool restart_from_hotstart() { return false; }
+
 	t_string get_scenario_name() const
 	{
 		return level_["name"].t_str();
@@ -327,6 +347,8 @@ public:
 	bool is_during_turn() const;
 	bool is_linger_mode() const;
 
+	void play_slice(bool is_delay_enabled = true) override;
+
 protected:
 	friend struct scoped_savegame_snapshot;
 	void play_slice_catch();
@@ -384,6 +406,7 @@ protected:
 
 	//other objects
 	std::unique_ptr<game_display> gui_;
+	const std::unique_ptr<battle_context_cache> battle_context_cache_;
 	const std::unique_ptr<unit_experience_accelerator> xp_mod_;
 	const std::unique_ptr<const statistics::scenario_context> statistics_context_;
 	actions::undo_list& undo_stack() { return *gamestate().undo_stack_; }
@@ -392,6 +415,8 @@ protected:
 
 	bool skip_replay_;
 	bool skip_story_;
+	/** Whether a network catch-up batch is in progress; see is_catching_up(). */
+	bool catching_up_;
 	/**
 	 * Whether we did init sides in this session
 	 * (false = we did init sides before we reloaded the game).
@@ -180,6 +180,15 @@ void playsingle_controller::play_scenario_init(const config& level)
 		init_side_end();
 	}
 
+	// Snapshot the fully initialized state, including the results of the
+	// preload/prestart/start events, so that a restart can resume from here.
+	// Resetting to this snapshot reuses the display and terrain caches of
+	// this controller, which is what makes the restart fast.
+	if(!is_networked_mp() && hotstart_level_ == nullptr) {
+		hotstart_level_ = std::make_shared<config>(to_config());
+		(*hotstart_level_)["replay_pos"] = saved_game_.get_replay().get_pos();
+	}
+
 	if(!saved_game_.classification().random_mode.empty() && is_networked_mp()) {
 		// This won't cause errors later but we should notify the user about it in case he didn't knew it.
 		gui2::show_transient_message(
@@ -322,12 +331,19 @@ void playsingle_controller::play_scenario_main_loop()
 
 			play_scenario_init(*ex.level);
 
-			if(replay_controller_ == nullptr) {
-				replay_controller_ = std::make_unique<replay_controller>(*this, false, ex.level, [this]() { on_replay_end(false); });
-			}
+			if(ex.is_restart) {
+				// A hot start is not a replay: drop everything recorded after
+				// the snapshot and hand control straight back to the player.
+				replay_controller_.reset();
+				get_replay().delete_upcoming_commands();
+			} else {
+				if(replay_controller_ == nullptr) {
+					replay_controller_ = std::make_unique<replay_controller>(*this, false, ex.level, [this]() { on_replay_end(false); });
+				}
 
-			if(ex.start_replay) {
-				replay_controller_->play_replay();
+				if(ex.start_replay) {
+					replay_controller_->play_replay();
+				}
 			}
 		}
 	} // end for loop
@@ -461,7 +477,11 @@ void playsingle_controller::play_idle_loop()
 {
 	while(!should_return_to_play_side()) {
 		play_slice_catch();
-		SDL_Delay(10);
+		// The draw manager already paces each slice to the display refresh;
+		// only sleep by hand when running headless, where it doesn't.
+		if(video::headless()) {
+			SDL_Delay(10);
+		}
 	}
 }
 
@@ -783,6 +803,15 @@ void playsingle_controller::update_viewing_player()
 	}
 }
 
+bool playsingle_controller::restart_from_hotstart()
+{
+	if(hotstart_level_ == nullptr || is_networked_mp()) {
+		return false;
+	}
+
+	throw reset_gamestate_exception(hotstart_level_, {}, false, true);
+}
+
 void playsingle_controller::reset_replay()
 {
 	if(replay_controller_ && replay_controller_->allow_reset_replay()) {
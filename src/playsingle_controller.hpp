@@ -31,10 +31,12 @@ class saved_game;
 
 struct reset_gamestate_exception : public lua_jailbreak_exception, public std::exception
 {
-	reset_gamestate_exception(std::shared_ptr<config> l, std::shared_ptr<config> stats, bool s = true) : level(l), stats_(stats), start_replay(s) {}
+	reset_gamestate_exception(std::shared_ptr<config> l, std::shared_ptr<config> stats, bool s = true, bool r = false) : level(l), stats_(stats), start_replay(s), is_restart(r) {}
 	std::shared_ptr<config> level;
 	std::shared_ptr<config> stats_;
 	bool start_replay;
+	/** True when restarting from a hot-start snapshot rather than entering a replay. */
+	bool is_restart;
 	const char * what() const noexcept { return "reset_gamestate_exception"; }
 private:
 
@@ -75,6 +77,7 @@ public:
 	replay_controller * get_replay_controller() const override { return replay_controller_.get(); }
 	void enable_replay(bool is_unit_test = false);
 	void on_replay_end(bool is_unit_test);
+	bool restart_from_hotstart() override;
 protected:
 	virtual void play_side_impl() override;
 	void before_human_turn();
@@ -106,6 +109,9 @@ protected:
 	bool ai_fallback_;
 	/// non-null when replay mode in active, is used in singleplayer and for the "back to turn" feature in multiplayer.
 	std::unique_ptr<replay_controller> replay_controller_;
+	/// Snapshot of the fully initialized scenario state, used to restart the
+	/// scenario without tearing down this controller (see restart_from_hotstart).
+	std::shared_ptr<config> hotstart_level_;
 	void linger();
 	void update_gui_linger();
 	void sync_end_turn() override;
@@ -58,6 +58,12 @@ turn_info::~turn_info()
 {
 }
 
+namespace
+{
+/** How long one catch-up batch may run before yielding back to the UI. */
+const uint32_t catch_up_time_budget_ms = 100;
+}
+
 turn_info::PROCESS_DATA_RESULT turn_info::sync_network()
 {
 	//there should be nothing left on the replay and we should get turn_info::PROCESS_CONTINUE back.
@@ -112,17 +118,46 @@ void turn_info::do_save()
 
 turn_info::PROCESS_DATA_RESULT turn_info::process_network_data_from_reader()
 {
+	// An observer rejoining (or returning after a lag spike) has many
+	// commands buffered. Those are processed as a catch-up batch: the
+	// per-command minimap rebuild is suppressed until the batch is done,
+	// and the loop yields once its time budget runs out so the UI stays
+	// responsive; the remaining backlog is picked up on the next poll.
+	const uint32_t start_ticks = SDL_GetTicks();
+	const bool was_catching_up = resources::controller->is_catching_up();
+	bool batching = was_catching_up;
+
+	PROCESS_DATA_RESULT res = PROCESS_CONTINUE;
+
 	config cfg;
 	while(this->network_reader_.read(cfg))
 	{
-		PROCESS_DATA_RESULT res = process_network_data(cfg);
+		if(!batching && !network_reader_.is_at_end()) {
+			batching = true;
+			resources::controller->set_catching_up(true);
+		}
+
+		res = process_network_data(cfg);
 		if(res != PROCESS_CONTINUE)
 		{
-			return res;
+			break;
 		}
 		cfg.clear();
+
+		if(batching && SDL_GetTicks() - start_ticks > catch_up_time_budget_ms) {
+			break;
+		}
 	}
-	return PROCESS_CONTINUE;
+
+	if(batching && !was_catching_up) {
+		resources::controller->set_catching_up(false);
+
+		if(!resources::controller->is_skipping_replay()) {
+			display::get_singleton()->recalculate_minimap();
+		}
+	}
+
+	return res;
 }
 
 turn_info::PROCESS_DATA_RESULT turn_info::process_network_data(const config& cfg, bool chat_only)
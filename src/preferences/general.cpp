@@ -140,26 +140,34 @@ void prefs_event_handler::handle_window_event(const SDL_Event& event)
 
 void write_preferences()
 {
-#ifndef _WIN32
-	bool prefs_file_existed = access(filesystem::get_prefs_file().c_str(), F_OK) == 0;
-#endif
+	// The new contents go to a scratch file first and replace the real one
+	// only by rename once they are complete, so a crash or full disk during
+	// the write leaves the previous preferences intact.
+	const std::string prefs_path = filesystem::get_prefs_file();
+	const std::string temp_path = prefs_path + ".new";
+
+	bool written = false;
 
 	try {
-		filesystem::scoped_ostream prefs_file = filesystem::ostream_file(filesystem::get_prefs_file());
+		filesystem::scoped_ostream prefs_file = filesystem::ostream_file(temp_path);
 		write(*prefs_file, prefs);
+		written = prefs_file->good();
 	} catch(const filesystem::io_exception&) {
-		ERR_FS << "error writing to preferences file '" << filesystem::get_prefs_file() << "'";
+		ERR_FS << "error writing to preferences file '" << temp_path << "'";
 	}
 
-	preferences::save_credentials();
-
+	if(written) {
 #ifndef _WIN32
-	if(!prefs_file_existed) {
-		if(chmod(filesystem::get_prefs_file().c_str(), 0600) == -1) {
-			ERR_FS << "error setting permissions of preferences file '" << filesystem::get_prefs_file() << "'";
+		if(chmod(temp_path.c_str(), 0600) == -1) {
+			ERR_FS << "error setting permissions of preferences file '" << temp_path << "'";
 		}
-	}
 #endif
+		if(!filesystem::rename_file(temp_path, prefs_path)) {
+			ERR_FS << "error replacing preferences file '" << prefs_path << "'";
+		}
+	}
+
+	preferences::save_credentials();
 }
 
 void set(const std::string &key, bool value)
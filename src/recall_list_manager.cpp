@@ -23,11 +23,33 @@
 
 #include <functional>
 
+void recall_list_manager::ensure_index() const
+{
+	if (!index_dirty_) {
+		return;
+	}
+
+	id_index_.clear();
+	uid_index_.clear();
+	for (const unit_ptr & ptr : recall_list_) {
+		id_index_.emplace(ptr->id(), ptr);
+		uid_index_.emplace(ptr->underlying_id(), ptr);
+	}
+	index_dirty_ = false;
+}
+
 /**
  * Used to find units in vectors by their ID.
  */
 unit_ptr recall_list_manager::find_if_matches_id(const std::string &unit_id)
 {
+	ensure_index();
+	const auto hit = id_index_.find(unit_id);
+	if (hit != id_index_.end() && hit->second->id() == unit_id) {
+		return hit->second;
+	}
+
+	// The index can miss a unit that was renamed in place; rescan for those.
 	std::vector<unit_ptr >::iterator it = std::find_if(recall_list_.begin(), recall_list_.end(),
 		[&unit_id](const unit_ptr & ptr) { return ptr->id() == unit_id; });
 	if (it != recall_list_.end()) {
@@ -42,6 +64,12 @@ unit_ptr recall_list_manager::find_if_matches_id(const std::string &unit_id)
  */
 unit_const_ptr recall_list_manager::find_if_matches_id(const std::string &unit_id) const
 {
+	ensure_index();
+	const auto hit = id_index_.find(unit_id);
+	if (hit != id_index_.end() && hit->second->id() == unit_id) {
+		return hit->second;
+	}
+
 	std::vector<unit_ptr >::const_iterator it = std::find_if(recall_list_.begin(), recall_list_.end(),
 		[&unit_id](const unit_ptr & ptr) { return ptr->id() == unit_id; });
 	if (it != recall_list_.end()) {
@@ -61,6 +89,7 @@ void recall_list_manager::erase_if_matches_id(const std::string &unit_id)
 	recall_list_.erase(std::remove_if(recall_list_.begin(), recall_list_.end(),
 		[unit_id](const unit_ptr & ptr) { return ptr->id() == unit_id; }),
 	                       recall_list_.end());
+	index_dirty_ = true;
 }
 
 void recall_list_manager::add(const unit_ptr & ptr, int pos)
@@ -71,6 +100,7 @@ void recall_list_manager::add(const unit_ptr & ptr, int pos)
 	else {
 		recall_list_.insert(recall_list_.begin() + pos, ptr);
 	}
+	index_dirty_ = true;
 }
 
 std::size_t recall_list_manager::find_index(const std::string & unit_id) const
@@ -91,6 +121,7 @@ unit_ptr recall_list_manager::extract_if_matches_id(const std::string &unit_id,
 			*pos = it - recall_list_.begin();
 		}
 		recall_list_.erase(it);
+		index_dirty_ = true;
 		return ret;
 	} else {
 		return unit_ptr();
@@ -99,24 +130,16 @@ unit_ptr recall_list_manager::extract_if_matches_id(const std::string &unit_id,
 
 unit_ptr recall_list_manager::find_if_matches_underlying_id(std::size_t uid)
 {
-	std::vector<unit_ptr >::iterator it = std::find_if(recall_list_.begin(), recall_list_.end(),
-		[uid](const unit_ptr & ptr) { return ptr->underlying_id() == uid; });
-	if (it != recall_list_.end()) {
-		return *it;
-	} else {
-		return unit_ptr();
-	}
+	ensure_index();
+	const auto hit = uid_index_.find(uid);
+	return hit != uid_index_.end() ? hit->second : unit_ptr();
 }
 
 unit_const_ptr recall_list_manager::find_if_matches_underlying_id(std::size_t uid) const
 {
-	std::vector<unit_ptr >::const_iterator it = std::find_if(recall_list_.begin(), recall_list_.end(),
-		[uid](const unit_ptr & ptr) { return ptr->underlying_id() == uid; });
-	if (it != recall_list_.end()) {
-		return *it;
-	} else {
-		return unit_ptr();
-	}
+	ensure_index();
+	const auto hit = uid_index_.find(uid);
+	return hit != uid_index_.end() ? hit->second : unit_ptr();
 }
 
 void recall_list_manager::erase_by_underlying_id(std::size_t uid)
@@ -124,6 +147,7 @@ void recall_list_manager::erase_by_underlying_id(std::size_t uid)
 	recall_list_.erase(std::remove_if(recall_list_.begin(), recall_list_.end(),
 		[uid](const unit_ptr & ptr) { return ptr->underlying_id() == uid; }),
 	                       recall_list_.end());
+	index_dirty_ = true;
 }
 
 unit_ptr recall_list_manager::extract_if_matches_underlying_id(std::size_t uid)
@@ -133,6 +157,7 @@ unit_ptr recall_list_manager::extract_if_matches_underlying_id(std::size_t uid)
 	if (it != recall_list_.end()) {
 		unit_ptr ret = *it;
 		recall_list_.erase(it);
+		index_dirty_ = true;
 		return ret;
 	} else {
 		return unit_ptr();
@@ -141,9 +166,11 @@ unit_ptr recall_list_manager::extract_if_matches_underlying_id(std::size_t uid)
 
 std::vector<unit_ptr>::iterator recall_list_manager::erase_index(std::size_t idx) {
 	assert(idx < recall_list_.size());
+	index_dirty_ = true;
 	return recall_list_.erase(recall_list_.begin()+idx);
 }
 
 std::vector<unit_ptr>::iterator recall_list_manager::erase(std::vector<unit_ptr>::iterator it) {
+	index_dirty_ = true;
 	return recall_list_.erase(it);
 }
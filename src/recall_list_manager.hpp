@@ -18,6 +18,7 @@
 #include "units/ptr.hpp"
 
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace ai {
@@ -85,9 +86,24 @@ public:
 	void add(const unit_ptr & ptr, int pos = -1);
 
 private:
+	/** Rebuilds the lookup indexes if a mutation has invalidated them. */
+	void ensure_index() const;
+
 	/**
 	 * The underlying data struture.
 	 * TODO: Should this be a map based on underlying id instead?
 	 */
 	std::vector<unit_ptr > recall_list_;
+
+	/**
+	 * Lazily built lookup indexes, so [recall]/[filter_recall] matching and
+	 * the recall dialog don't scan a long veteran list per query. Rebuilt on
+	 * the first lookup after any mutation of the list. A unit's id can be
+	 * renamed in place behind our back, so id lookups verify their hit and
+	 * fall back to the linear scan; underlying ids are stable for a unit's
+	 * lifetime and need neither.
+	 */
+	mutable std::unordered_map<std::string, unit_ptr> id_index_;
+	mutable std::unordered_map<std::size_t, unit_ptr> uid_index_;
+	mutable bool index_dirty_ = true;
 };
@@ -32,6 +32,7 @@
 #include "map/label.hpp"
 #include "map/location.hpp"
 #include "play_controller.hpp"
+#include "synced_checkup.hpp"
 #include "synced_context.hpp"
 #include "resources.hpp"
 #include "statistics.hpp"
@@ -199,6 +200,10 @@ void replay::process_error(const std::string& msg)
 {
 	ERR_REPLAY << msg;
 
+	// Dump the per-action state checkpoints; diffing them against the other
+	// client's dump locates the first action after which the states diverged.
+	oos_checkpoints::log_all();
+
 	resources::controller->process_oos(msg); // might throw quit_game_exception()
 }
 
@@ -684,7 +689,7 @@ REPLAY_RETURN do_replay(bool one_move)
 {
 	log_scope("do replay");
 
-	if (!resources::controller->is_skipping_replay()) {
+	if (!resources::controller->is_skipping_replay() && !resources::controller->is_catching_up()) {
 		display::get_singleton()->recalculate_minimap();
 	}
 
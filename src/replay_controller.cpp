@@ -61,6 +61,9 @@ struct replay_play_side : public replay_controller::replay_stop_condition
 	virtual void new_side_turn(int , int) { next_side_ = true; }
 	virtual bool should_stop() { return next_side_; }
 };
+
+/** How long one fast-forward batch may run before the display gets a slice. */
+const uint32_t fast_forward_slice_ms = 50;
 }
 
 replay_controller::replay_controller(play_controller& controller, bool control_view, const std::shared_ptr<config>& reset_state, const std::function<void()>& on_end_replay)
@@ -161,20 +164,38 @@ void replay_controller::play_side_impl()
 	{
 		if(!stop_condition_->should_stop())
 		{
-			if(resources::recorder->at_end()) {
-				//Gather more replay data
-				on_end_replay_();
+			// With animations skipped there is no point in drawing between
+			// every action either: execute commands in a batch on a time
+			// budget, suppressing per-command display refreshes, and give
+			// the display one slice afterwards. Reviewing long games at
+			// max speed is then bounded by command execution, not drawing.
+			const bool fast_forward = controller_.is_skipping_replay();
+			const uint32_t batch_start = SDL_GetTicks();
+
+			bool exit_player = false;
+
+			if(fast_forward) {
+				controller_.set_catching_up(true);
 			}
-			else {
+
+			do {
+				if(resources::recorder->at_end()) {
+					//Gather more replay data
+					on_end_replay_();
+					break;
+				}
+
 				REPLAY_RETURN res = do_replay(true);
 				if(res == REPLAY_FOUND_END_MOVE) {
 					stop_condition_->move_done();
 				}
 				if(controller_.is_regular_game_end()) {
-					return;
+					exit_player = true;
+					break;
 				}
 				if(res == REPLAY_FOUND_END_TURN) {
-					return;
+					exit_player = true;
+					break;
 				}
 				// TODO: how can this be the case when we just checked for "resources::recorder->at_end()" above?
 				if(res == REPLAY_RETURN_AT_END) {
@@ -184,7 +205,17 @@ void replay_controller::play_side_impl()
 				{
 					stop_condition_->new_side_turn(controller_.current_side(), controller_.gamestate().tod_manager_.turn());
 				}
+			} while(fast_forward && !stop_condition_->should_stop()
+					&& SDL_GetTicks() - batch_start < fast_forward_slice_ms);
+
+			if(fast_forward) {
+				controller_.set_catching_up(false);
 			}
+
+			if(exit_player) {
+				return;
+			}
+
 			controller_.play_slice(false);
 
 			// Update the buttons once, on the transition from not-stopped to stopped.
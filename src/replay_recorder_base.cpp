@@ -18,6 +18,7 @@
 replay_recorder_base::replay_recorder_base(void)
 	: upload_log_()
 	, commands_()
+	, rendered_commands_()
 	, pos_(0)
 {
 
@@ -32,6 +33,7 @@ replay_recorder_base::~replay_recorder_base(void)
 void replay_recorder_base::swap(replay_recorder_base& other)
 {
 	commands_.swap(other.commands_);
+	rendered_commands_.swap(other.rendered_commands_);
 	std::swap(pos_, other.pos_);
 	upload_log_.swap(other.upload_log_);
 }
@@ -49,6 +51,9 @@ int replay_recorder_base::size() const
 config& replay_recorder_base::get_command_at(int pos)
 {
 	assert(pos < size());
+	// The caller may modify the command through the returned reference, so
+	// any cached serialization of it is no longer trustworthy.
+	rendered_commands_[pos].clear();
 	return commands_[pos];
 }
 
@@ -56,6 +61,7 @@ config& replay_recorder_base::add_child()
 {
 	assert(pos_ <= size());
 	commands_.insert(commands_.begin() + pos_, new config());
+	rendered_commands_.insert(rendered_commands_.begin() + pos_, std::string());
 	++pos_;
 	return commands_[pos_ - 1];
 }
@@ -77,6 +83,7 @@ void replay_recorder_base::remove_command(int index)
 {
 	assert(index < size());
 	commands_.erase(commands_.begin() + index);
+	rendered_commands_.erase(rendered_commands_.begin() + index);
 	if(index < pos_)
 	{
 		--pos_;
@@ -90,6 +97,7 @@ config& replay_recorder_base::insert_command(int index)
 	{
 		++pos_;
 	}
+	rendered_commands_.insert(rendered_commands_.begin() + index, std::string());
 	return *commands_.insert(commands_.begin() + index, new config());
 }
 
@@ -103,6 +111,7 @@ void replay_recorder_base::append_config(const config& data)
 	for(const config& command : data.child_range("command"))
 	{
 		commands_.push_back(new config(command));
+		rendered_commands_.emplace_back();
 	}
 }
 
@@ -117,17 +126,20 @@ void replay_recorder_base::append_config(config& data)
 		config* new_config = new config();
 		new_config->swap(command);
 		commands_.push_back(new_config);
-
-
+		rendered_commands_.emplace_back();
 	}
 }
 
 void replay_recorder_base::write(config_writer& out) const
 {
 	out.write_child("upload_log", upload_log_);
+	// All save formats write [replay] at the same depth, so a command's text
+	// is identical from one save to the next as long as the command itself is
+	// untouched; only commands recorded or modified since the previous save
+	// actually get serialized here.
 	for(int i = 0; i < pos_; ++i)
 	{
-		out.write_child("command", commands_[i]);
+		out.write_child_cached("command", commands_[i], rendered_commands_[i]);
 	}
 }
 
@@ -142,6 +154,7 @@ void replay_recorder_base::write(config& out) const
 void replay_recorder_base::delete_upcoming_commands()
 {
 	commands_.resize(pos_);
+	rendered_commands_.resize(pos_);
 }
 
 bool replay_recorder_base::is_ancestor(const config& other_replay) const
@@ -14,6 +14,8 @@
 
 #pragma once
 #include <cassert>
+#include <string>
+#include <vector>
 #include <boost/ptr_container/ptr_vector.hpp>
 
 #include "config.hpp"
@@ -31,6 +33,12 @@ public:
 
 	int size() const;
 
+	/**
+	 * Mutable access to a recorded command.
+	 *
+	 * This discards the cached serialization of that command, so don't use it
+	 * for read-only lookups in a loop over the whole journal.
+	 */
 	config& get_command_at(int pos);
 
 	config& add_child();
@@ -61,6 +69,16 @@ public:
 protected:
 	config upload_log_;
 	boost::ptr_vector<config> commands_;
+	/**
+	 * Serialized text of each command, kept aligned with @ref commands_.
+	 *
+	 * Filled lazily by write(config_writer&) and reused on the next save, so
+	 * that writing a long campaign's journal only serializes the commands
+	 * recorded since the previous save. An empty entry means "not rendered
+	 * yet"; handing out a mutable reference through get_command_at() empties
+	 * the corresponding entry again.
+	 */
+	mutable std::vector<std::string> rendered_commands_;
 	int pos_;
 };
 
@@ -27,6 +27,7 @@
 #include "mouse_events.hpp"
 #include "pathfind/pathfind.hpp"
 #include "picture.hpp"
+#include "play_controller.hpp"
 #include "reports.hpp"
 #include "resources.hpp"
 #include "color.hpp"
@@ -97,18 +98,49 @@ static std::string flush(std::ostringstream &s)
 	return r;
 }
 
-static const time_of_day get_visible_time_of_day_at(reports::context & rc, const map_location & hex)
+const unit* reports::context::visible_unit()
 {
-	const team &viewing_team = rc.teams()[rc.screen().viewing_team()];
-	if (viewing_team.shrouded(hex)) {
-		// Don't show time on shrouded tiles.
-		return rc.tod().get_time_of_day();
-	} else if (viewing_team.fogged(hex)) {
-		// Don't show illuminated time on fogged tiles.
-		return rc.tod().get_time_of_day(hex);
-	} else {
-		return rc.tod().get_illuminated_time_of_day(rc.units(), rc.map(), hex);
+	if(!visible_unit_cached_) {
+		visible_unit_ = dc_.get_visible_unit(disp_.displayed_unit_hex(),
+			teams()[disp_.viewing_team()], disp_.show_everything());
+		visible_unit_cached_ = true;
+	}
+	return visible_unit_;
+}
+
+const unit* reports::context::selected_unit()
+{
+	if(!selected_unit_cached_) {
+		selected_unit_ = dc_.get_visible_unit(disp_.selected_hex(),
+			teams()[disp_.viewing_team()], disp_.show_everything());
+		selected_unit_cached_ = true;
+	}
+	return selected_unit_;
+}
+
+const time_of_day& reports::context::visible_tod_at(const map_location& hex)
+{
+	auto it = visible_tod_cache_.find(hex);
+	if(it == visible_tod_cache_.end()) {
+		const team& viewing_team = teams()[disp_.viewing_team()];
+		time_of_day tod;
+		if(viewing_team.shrouded(hex)) {
+			// Don't show time on shrouded tiles.
+			tod = tod_.get_time_of_day();
+		} else if(viewing_team.fogged(hex)) {
+			// Don't show illuminated time on fogged tiles.
+			tod = tod_.get_time_of_day(hex);
+		} else {
+			tod = tod_.get_illuminated_time_of_day(units(), map(), hex, 0, true);
+		}
+		it = visible_tod_cache_.emplace(hex, tod).first;
 	}
+	return it->second;
+}
+
+static const time_of_day get_visible_time_of_day_at(reports::context & rc, const map_location & hex)
+{
+	return rc.visible_tod_at(hex);
 }
 
 typedef std::map<std::string, reports::generator_function> static_report_generators;
@@ -131,16 +163,12 @@ static char const *naps = "</span>";
 
 static const unit *get_visible_unit(reports::context & rc)
 {
-	return rc.dc().get_visible_unit(rc.screen().displayed_unit_hex(),
-		rc.teams()[rc.screen().viewing_team()],
-		rc.screen().show_everything());
+	return rc.visible_unit();
 }
 
 static const unit *get_selected_unit(reports::context & rc)
 {
-	return rc.dc().get_visible_unit(rc.screen().selected_hex(),
-		rc.teams()[rc.screen().viewing_team()],
-		rc.screen().show_everything());
+	return rc.selected_unit();
 }
 
 static unit_const_ptr get_selected_unit_ptr(reports::context & rc)
@@ -1033,20 +1061,36 @@ static config unit_weapons(reports::context & rc, unit_const_ptr attacker, const
 	std::ostringstream str, tooltip;
 	config res;
 
-	std::vector<battle_context> weapons;
+	// This report is regenerated on every mouse motion and both the selected
+	// and the highlighted unit panes need the same matchups, so take the
+	// contexts from the play_controller's cache when one is around.
+	battle_context_cache* bc_cache =
+		resources::controller ? &resources::controller->get_battle_context_cache() : nullptr;
+
+	std::vector<battle_context> local_weapons;
+	std::vector<battle_context*> weapons;
 	for (unsigned int i = 0; i < attacker->attacks().size(); i++) {
 		// skip weapons with attack_weight=0
 		if (attacker->attacks()[i].attack_weight() > 0) {
-			weapons.emplace_back(rc.units(), attacker_pos, defender->get_location(), i, -1, 0.0, nullptr, attacker);
+			if (bc_cache) {
+				weapons.push_back(&bc_cache->get(rc.units(), resources::controller->turn(),
+					attacker_pos, defender->get_location(), i, -1, attacker));
+			} else {
+				local_weapons.emplace_back(rc.units(), attacker_pos, defender->get_location(), i, -1, 0.0, nullptr, attacker);
+			}
 		}
 	}
+	for (battle_context& local_weapon : local_weapons) {
+		weapons.push_back(&local_weapon);
+	}
 
-	for (const battle_context& weapon : weapons) {
+	for (battle_context* weapon_ptr : weapons) {
+		battle_context& weapon = *weapon_ptr;
 
-		// Predict the battle outcome.
-		combatant attacker_combatant(weapon.get_attacker_stats());
-		combatant defender_combatant(weapon.get_defender_stats());
-		attacker_combatant.fight(defender_combatant);
+		// Predict the battle outcome; the simulation is kept in the context,
+		// so cached entries only ever pay for it once.
+		const combatant& attacker_combatant = weapon.get_attacker_combatant();
+		const combatant& defender_combatant = weapon.get_defender_combatant();
 
 		const battle_context_unit_stats& context_unit_stats =
 				show_attacker ? weapon.get_attacker_stats() : weapon.get_defender_stats();
@@ -1095,7 +1139,7 @@ static config unit_weapons(reports::context & rc, unit_const_ptr attacker, const
 		std::vector<std::pair<double, int>> prob_hp_vector;
 		int i;
 
-		combatant* c = show_attacker ? &attacker_combatant : &defender_combatant;
+		const combatant* c = show_attacker ? &attacker_combatant : &defender_combatant;
 
 		for(i = 0; i < static_cast<int>(c->hp_dist.size()); i++) {
 			double prob = c->hp_dist[i];
@@ -16,7 +16,10 @@
 #pragma once
 
 #include "display_context.hpp"
+#include "map/location.hpp"
+#include "time_of_day.hpp"
 
+#include <map>
 #include <vector>
 
 #include "utils/optional_reference.hpp"
@@ -27,6 +30,7 @@
 class gamemap;
 class team;
 class tod_manager;
+class unit;
 class unit_map;
 
 class display;
@@ -58,12 +62,37 @@ public:
 		std::shared_ptr<wb::manager> wb() { return wb_; }
 		utils::optional_reference<events::mouse_handler> mhb() { return mhb_; }
 
+		/**
+		 * The unit the sidebar should display (mouseover or selection),
+		 * resolved at most once per context. Most unit reports start with
+		 * this lookup, so sharing one context across a sidebar rebuild
+		 * turns dozens of unit_map searches into one. A context never
+		 * outlives the rebuild it was made for, so the cache can't go stale.
+		 */
+		const unit* visible_unit();
+
+		/** The selected unit, resolved at most once per context. */
+		const unit* selected_unit();
+
+		/**
+		 * The time of day the viewer sees at @a hex, computed at most once
+		 * per hex per context. The unshrouded case scans nearby units for
+		 * illumination, which several reports would otherwise repeat.
+		 */
+		const time_of_day& visible_tod_at(const map_location& hex);
+
 	private:
 		const display_context & dc_;
 		display & disp_;
 		const tod_manager & tod_;
 		std::shared_ptr<wb::manager> wb_;
 		utils::optional_reference<events::mouse_handler> mhb_;
+
+		bool visible_unit_cached_ = false;
+		const unit* visible_unit_ = nullptr;
+		bool selected_unit_cached_ = false;
+		const unit* selected_unit_ = nullptr;
+		std::map<map_location, time_of_day> visible_tod_cache_;
 	};
 
 	struct generator
@@ -64,14 +64,14 @@ void save_index_class::rebuild(const std::string& name, const std::time_t& modif
 	}
 
 	summary["mod_time"] = std::to_string(static_cast<int>(modified));
-	write_save_index();
+	dirty_ = true;
 }
 
 void save_index_class::remove(const std::string& name)
 {
 	config& root = data();
 	root.remove_children("save", [&name](const config& d) { return name == d["save"]; });
-	write_save_index();
+	dirty_ = true;
 }
 
 void save_index_class::set_modified(const std::string& name, const std::time_t& modified)
@@ -105,9 +105,10 @@ void save_index_class::clean_up_index()
 	filesystem::get_files_in_dir(dir(), &filenames);
 
 	if(root.all_children_count() > filenames.size()) {
-		root.remove_children("save", [&filenames](const config& d)
+		const std::set<std::string> existing(filenames.begin(), filenames.end());
+		root.remove_children("save", [&existing](const config& d)
 			{
-				return std::find(filenames.begin(), filenames.end(), d["save"]) == filenames.end();
+				return existing.count(d["save"].str()) == 0;
 			}
 		);
 	}
@@ -122,6 +123,11 @@ void save_index_class::write_save_index()
 		return;
 	}
 
+	if(!dirty_) {
+		LOG_SAVE << "no-op: index unchanged";
+		return;
+	}
+
 	if(clean_up_index_) {
 		clean_up_index();
 		clean_up_index_ = false;
@@ -136,6 +142,8 @@ void save_index_class::write_save_index()
 		} else {
 			write(*stream, data());
 		}
+
+		dirty_ = false;
 	} catch(const filesystem::io_exception& e) {
 		ERR_SAVE << "error writing to save index file: '" << e.what() << "'";
 	}
@@ -148,9 +156,16 @@ save_index_class::save_index_class(const std::string& dir)
 	, dir_(dir)
 	, read_only_(true)
 	, clean_up_index_(true)
+	, dirty_(false)
 {
 }
 
+save_index_class::~save_index_class()
+{
+	// Entries rebuilt lazily from get() may not have hit a flush point yet.
+	write_save_index();
+}
+
 save_index_class::save_index_class(create_for_default_saves_dir)
 	: save_index_class(filesystem::get_saves_dir())
 {
@@ -374,6 +389,8 @@ void save_index_class::delete_old_auto_saves(const int autosavemax, const int in
 			delete_game(i->name());
 		}
 	}
+
+	write_save_index();
 }
 
 void save_index_class::delete_game(const std::string& name)
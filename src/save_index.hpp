@@ -87,6 +87,9 @@ public:
 	enum class create_for_default_saves_dir { yes };
 	explicit save_index_class(create_for_default_saves_dir);
 
+	/** Writes out any index changes that have not been flushed yet. */
+	~save_index_class();
+
 	/** Returns an instance for managing saves in filesystem::get_saves_dir() */
 	static std::shared_ptr<save_index_class> default_saves_dir();
 
@@ -108,7 +111,14 @@ public:
 	/** Delete autosaves that are no longer needed (according to the autosave policy in the preferences). */
 	void delete_old_auto_saves(const int autosavemax, const int infinite_auto_saves);
 
-	/** Sync to disk, no-op if read_only_ is set */
+	/**
+	 * Sync to disk, no-op if read_only_ is set or nothing changed.
+	 *
+	 * Updating or removing entries only marks the index dirty; actually
+	 * serializing and compressing it scales with the total number of saves,
+	 * so batch operations call this once at the end instead of paying that
+	 * price per entry.
+	 */
 	void write_save_index();
 
 	/**
@@ -138,5 +148,7 @@ private:
 	bool read_only_;
 	/** Flag to only run the clean_up_index method once. */
 	bool clean_up_index_;
+	/** True when data_ has changes that write_save_index() has not written yet. */
+	bool dirty_;
 };
 } // end of namespace savegame
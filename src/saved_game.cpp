@@ -123,6 +123,7 @@ saved_game::saved_game()
 	: has_carryover_expanded_(false)
 	, carryover_(carryover_info().to_config())
 	, replay_start_()
+	, rendered_replay_start_()
 	, classification_()
 	, mp_settings_()
 	, starting_point_type_(starting_point::NONE)
@@ -136,6 +137,7 @@ saved_game::saved_game(config cfg)
 	: has_carryover_expanded_(false)
 	, carryover_()
 	, replay_start_()
+	, rendered_replay_start_()
 	, classification_(cfg)
 	, mp_settings_()
 	, starting_point_type_(starting_point::NONE)
@@ -150,6 +152,7 @@ saved_game::saved_game(const saved_game& state)
 	: has_carryover_expanded_(state.has_carryover_expanded_)
 	, carryover_(state.carryover_)
 	, replay_start_(state.replay_start_)
+	, rendered_replay_start_(state.rendered_replay_start_)
 	, classification_(state.classification_)
 	, mp_settings_(state.mp_settings_)
 	, starting_point_type_(state.starting_point_type_)
@@ -177,13 +180,18 @@ void saved_game::set_random_seed()
 	carryover_["random_calls"] = 0;
 }
 
+void saved_game::write_replay_start(config_writer& out) const
+{
+	out.write_child_cached("replay_start", replay_start_, rendered_replay_start_);
+}
+
 void saved_game::write_config(config_writer& out) const
 {
 	write_general_info(out);
 	write_starting_point(out);
 
 	if(!replay_start_.empty()) {
-		out.write_child("replay_start", replay_start_);
+		write_replay_start(out);
 	}
 
 	out.open_child("replay");
@@ -240,11 +248,16 @@ void saved_game::set_defaults()
 		}
 
 		if(side["save_id"].empty()) {
-			side["save_id"] = side["id"];
+			// Copy before assigning: operator[] on the left may insert into
+			// the flat attribute map and invalidate a reference returned on
+			// the right.
+			const config::attribute_value id = side["id"];
+			side["save_id"] = id;
 		}
 
 		if(!is_multiplayer_tag && side["side_name"].blank()) {
-			side["side_name"] = side["name"];
+			const config::attribute_value name = side["name"];
+			side["side_name"] = name;
 		}
 
 		if(!is_loaded_game && !side["current_player"].empty()) {
@@ -268,6 +281,7 @@ void saved_game::set_defaults()
 
 void saved_game::expand_scenario()
 {
+	log_scope2(log_engine, "expand_scenario");
 	if(starting_point_type_ == starting_point::NONE && !has_carryover_expanded_) {
 		game_config_manager::get()->load_game_config_for_game(classification(), carryover_["next_scenario"]);
 
@@ -371,6 +385,7 @@ void saved_game::load_non_scenario(const std::string& type, const std::string& i
 // attribute of the mp_settings.
 void saved_game::expand_mp_events()
 {
+	log_scope2(log_engine, "expand_mp_events");
 	expand_scenario();
 
 	if(starting_point_type_ == starting_point::SCENARIO && !starting_point_["has_mod_events"].to_bool(false)) {
@@ -476,6 +491,7 @@ void saved_game::expand_map_file(config& scenario)
 
 void saved_game::expand_random_scenario()
 {
+	log_scope2(log_engine, "expand_random_scenario");
 	expand_scenario();
 
 	if(starting_point_type_ == starting_point::SCENARIO) {
@@ -537,9 +553,12 @@ void saved_game::post_scenario_generation(const config& old_scenario, config& ge
 
 void saved_game::expand_carryover()
 {
+	log_scope2(log_engine, "expand_carryover");
 	expand_scenario();
 	if(starting_point_type_ == starting_point::SCENARIO && !has_carryover_expanded_) {
-		carryover_info sides(carryover_);
+		// carryover_ is rebuilt from sides below, so its units can be moved
+		// rather than reparsed through config copies.
+		carryover_info sides(std::move(carryover_));
 
 		sides.transfer_to(get_starting_point());
 		for(config& side_cfg : get_starting_point().child_range("side")) {
@@ -608,9 +627,11 @@ void saved_game::convert_to_start_save()
 {
 	assert(starting_point_type_ == starting_point::SNAPSHOT);
 
-	carryover_info sides(starting_point_, true);
+	// Both the snapshot and the old carryover are discarded below, so their
+	// recall units are moved into the new carryover instead of being copied.
+	carryover_info sides(std::move(starting_point_), true);
 
-	sides.merge_old_carryover(carryover_info(carryover_));
+	sides.merge_old_carryover(carryover_info(std::move(carryover_)));
 	sides.rng().rotate_random();
 
 	carryover_ = sides.to_config();
@@ -619,6 +640,7 @@ void saved_game::convert_to_start_save()
 
 	replay_data_ = replay_recorder_base();
 	replay_start_.clear();
+	rendered_replay_start_.clear();
 
 	remove_snapshot();
 }
@@ -723,6 +745,7 @@ void saved_game::swap(saved_game& other)
 
 	replay_data_.swap(other.replay_data_);
 	replay_start_.swap(other.replay_start_);
+	rendered_replay_start_.swap(other.rendered_replay_start_);
 	starting_point_.swap(other.starting_point_);
 
 	std::swap(starting_point_type_, other.starting_point_type_);
@@ -748,6 +771,7 @@ void saved_game::set_data(config& cfg)
 	} else {
 		replay_start_.clear();
 	}
+	rendered_replay_start_.clear();
 
 	replay_data_ = replay_recorder_base();
 
@@ -790,6 +814,7 @@ void saved_game::clear()
 	mp_settings_ = {};
 	replay_data_.swap({});
 	replay_start_.clear();
+	rendered_replay_start_.clear();
 	starting_point_.clear();
 	starting_point_type_ = starting_point::NONE;
 }
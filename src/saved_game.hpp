@@ -120,9 +120,12 @@ public:
 	/** @return the config from which the game will be started. (this is [scenario] or [snapshot] in the savefile) */
 	config& get_starting_point();
 	const config& get_starting_point() const { return starting_point_; }
-	config& replay_start() { return replay_start_; }
+	config& replay_start() { rendered_replay_start_.clear(); return replay_start_; }
 	const config& replay_start() const { return replay_start_; }
 
+	/** Writes [replay_start], reusing the text rendered by an earlier save. */
+	void write_replay_start(config_writer& out) const;
+
 	bool not_corrupt() const;
 	/** sets classification().label to the correct value. */
 	void update_label();
@@ -149,6 +152,12 @@ private:
 	config carryover_;
 	/** snapshot made before the start event. To be used as a starting pos for replays */
 	config replay_start_;
+	/**
+	 * Serialized text of replay_start_, rendered on the first save and reused
+	 * until the config is touched again. The start-of-scenario snapshot never
+	 * changes while a scenario is played, yet every autosave writes it out.
+	 */
+	mutable std::string rendered_replay_start_;
 	/** some general information of the game that doesn't change during the game */
 	game_classification classification_;
 	mp_game_settings mp_settings_;
@@ -13,6 +13,7 @@
 	See the COPYING file for more details.
 */
 
+#include <boost/iostreams/filter/bzip2.hpp>
 #include <boost/iostreams/filter/gzip.hpp>
 
 #include "savegame.hpp"
@@ -48,7 +49,11 @@
 #include "video.hpp" // only for faked
 
 #include <algorithm>
+#include <condition_variable>
+#include <deque>
 #include <iomanip>
+#include <mutex>
+#include <thread>
 
 static lg::log_domain log_engine("engine");
 #define LOG_SAVE LOG_STREAM(info, log_engine)
@@ -78,6 +83,8 @@ void clean_saves(const std::string& label)
 			manager->delete_game(save.name());
 		}
 	}
+
+	manager->write_save_index();
 }
 
 loadgame::loadgame(const std::shared_ptr<save_index_class>& index, saved_game& gamestate)
@@ -482,6 +489,7 @@ bool savegame::save_game(const std::string& filename)
 		// only be available within that specific binary context (when playing another game from
 		// the came campaign, for example).
 		save_index_manager_->rebuild(filename_);
+		save_index_manager_->write_save_index();
 
 		end = SDL_GetTicks();
 		LOG_SAVE << "Milliseconds to save " << filename_ << ": " << end - start;
@@ -501,6 +509,146 @@ bool savegame::save_game(const std::string& filename)
 	};
 }
 
+namespace
+{
+/**
+ * Stream buffer that compresses and writes on a background thread.
+ *
+ * Serializing the game state has to happen on the main thread because it
+ * reads live objects, but compressing the text and pushing it to disk does
+ * not. This buffer collects the serialized WML in chunks and hands them to a
+ * worker thread running the compressor, so the compressor works on the text
+ * already produced while the serializer is still producing the rest instead
+ * of the two running back to back.
+ */
+class threaded_compress_buf : public std::streambuf
+{
+public:
+	threaded_compress_buf(std::ostream& file, compression::format compress)
+		: chunk_()
+		, queue_()
+		, mutex_()
+		, ready_()
+		, done_(false)
+		, failed_(false)
+		, worker_(&threaded_compress_buf::run, this, std::ref(file), compress)
+	{
+		chunk_.reserve(chunk_size);
+	}
+
+	~threaded_compress_buf()
+	{
+		// Normally finish() has run already; this only cleans up after an
+		// exception thrown while serializing.
+		if(worker_.joinable()) {
+			finish();
+		}
+	}
+
+	/** Flushes pending text, waits for the worker and reports success. */
+	bool finish()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			if(!chunk_.empty()) {
+				queue_.push_back(std::move(chunk_));
+				chunk_.clear();
+			}
+			done_ = true;
+		}
+		ready_.notify_one();
+		worker_.join();
+		return !failed_;
+	}
+
+protected:
+	int overflow(int c) override
+	{
+		if(c != traits_type::eof()) {
+			chunk_.push_back(traits_type::to_char_type(c));
+			if(chunk_.size() >= chunk_size) {
+				push_chunk();
+			}
+		}
+		return c;
+	}
+
+	std::streamsize xsputn(const char* s, std::streamsize n) override
+	{
+		chunk_.append(s, n);
+		if(chunk_.size() >= chunk_size) {
+			push_chunk();
+		}
+		return n;
+	}
+
+private:
+	static constexpr std::size_t chunk_size = 64 * 1024;
+
+	void push_chunk()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			queue_.push_back(std::move(chunk_));
+		}
+		ready_.notify_one();
+		chunk_.clear();
+	}
+
+	void run(std::ostream& file, compression::format compress)
+	{
+		try {
+			{
+				boost::iostreams::filtering_stream<boost::iostreams::output> filter;
+				if(compress == compression::format::gzip) {
+					filter.push(boost::iostreams::gzip_compressor(boost::iostreams::gzip_params(9)));
+				} else if(compress == compression::format::bzip2) {
+					filter.push(boost::iostreams::bzip2_compressor(boost::iostreams::bzip2_params()));
+				}
+				filter.push(file);
+
+				for(;;) {
+					std::deque<std::string> batch;
+					{
+						std::unique_lock<std::mutex> lock(mutex_);
+						ready_.wait(lock, [this] { return !queue_.empty() || done_; });
+						if(queue_.empty()) {
+							break;
+						}
+						batch.swap(queue_);
+					}
+
+					for(const std::string& chunk : batch) {
+						filter.write(chunk.data(), chunk.size());
+					}
+				}
+
+				if(compress != compression::format::none) {
+					// prevent empty gz files because of https://svn.boost.org/trac/boost/ticket/5237
+					filter << "\n";
+				}
+				// Leaving this scope flushes the compressor's trailer.
+			}
+
+			if(!file.good()) {
+				failed_ = true;
+			}
+		} catch(...) {
+			failed_ = true;
+		}
+	}
+
+	std::string chunk_;
+	std::deque<std::string> queue_;
+	std::mutex mutex_;
+	std::condition_variable ready_;
+	bool done_;
+	bool failed_;
+	std::thread worker_;
+};
+
+} // anonymous namespace
+
 void savegame::write_game_to_disk(const std::string& filename)
 {
 	LOG_SAVE << "savegame::save_game";
@@ -508,17 +656,32 @@ void savegame::write_game_to_disk(const std::string& filename)
 	filename_ = filename;
 	filename_ += compression::format_extension(compress_saves_);
 
-	std::stringstream ss;
+	// Write to a scratch file and rename it over the target only once the
+	// whole save is on disk, so that a crash halfway through cannot leave a
+	// truncated file where a good save (or no save at all) used to be.
+	const std::string temp_filename = filename_ + ".tmp";
+	bool written;
 	{
-		config_writer out(ss, compress_saves_);
-		write_game(out);
-		finish_save_game(out);
+		filesystem::scoped_ostream os(open_save_game(temp_filename));
+		threaded_compress_buf buf(*os, compress_saves_);
+		std::ostream buf_stream(&buf);
+		{
+			config_writer out(buf_stream, compression::format::none);
+			write_game(out);
+			finish_save_game(out);
+		}
+
+		written = buf.finish() && os->good();
 	}
 
-	filesystem::scoped_ostream os(open_save_game(filename_));
-	(*os) << ss.str();
+	if(!written) {
+		filesystem::delete_file(save_index_manager_->dir() + "/" + temp_filename);
+		throw game::save_game_failed(_("Could not write to file"));
+	}
 
-	if(!os->good()) {
+	if(!filesystem::rename_file(
+		save_index_manager_->dir() + "/" + temp_filename, save_index_manager_->dir() + "/" + filename_))
+	{
 		throw game::save_game_failed(_("Could not write to file"));
 	}
 }
@@ -593,7 +756,7 @@ void replay_savegame::write_game(config_writer& out)
 	savegame::write_game(out);
 
 	gamestate().write_carryover(out);
-	out.write_child("replay_start", gamestate().replay_start());
+	gamestate().write_replay_start(out);
 
 	out.open_child("replay");
 	gamestate().get_replay().write(out);
@@ -674,7 +837,7 @@ void ingame_savegame::write_game(config_writer& out)
 
 	gamestate().write_carryover(out);
 	out.write_child("snapshot", gamestate().get_starting_point());
-	out.write_child("replay_start", gamestate().replay_start());
+	gamestate().write_replay_start(out);
 	out.open_child("replay");
 	gamestate().get_replay().write(out);
 	out.close_child("replay");
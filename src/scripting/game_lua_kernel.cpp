@@ -522,6 +522,72 @@ int game_lua_kernel::intf_get_units(lua_State *L)
 	return 1;
 }
 
+/**
+ * Gets a packed summary of all the units matching a given filter.
+ * - Arg 1: optional table containing a filter
+ * - Arg 2: optional location (to find all units that would match on that location)
+ *          OR unit (to find all units that would match adjacent to that unit)
+ * - Ret 1: table of parallel arrays (id, x, y, side, hitpoints, max_hitpoints),
+ *          entry i of every array describing the same unit.
+ *
+ * One crossing and six plain tables, instead of the full userdata per unit
+ * that find_on_map builds. AI scripts scanning hundreds of units to shortlist
+ * a few can work from these arrays and fetch real unit proxies with
+ * wesnoth.units.get for the shortlist only.
+ */
+int game_lua_kernel::intf_get_unit_stats(lua_State *L)
+{
+	vconfig filter = luaW_checkvconfig(L, 1, true);
+	unit_filter filt(filter);
+	std::vector<const unit*> units;
+
+	if(unit* u_adj = luaW_tounit(L, 2)) {
+		units = filt.all_matches_with_unit(*u_adj);
+	} else if(!lua_isnoneornil(L, 2)) {
+		map_location loc;
+		luaW_tolocation(L, 2, loc);
+		if(!loc.valid()) {
+			return luaL_argerror(L, 2, "invalid location");
+		}
+		units = filt.all_matches_at(loc);
+	} else {
+		units = filt.all_matches_on_map();
+	}
+
+	// Stack layout while filling: 1: return table, 2-7: the arrays.
+	static const char* const fields[] {"id", "x", "y", "side", "hitpoints", "max_hitpoints"};
+	constexpr int num_fields = 6;
+
+	lua_settop(L, 0);
+	lua_createtable(L, 0, num_fields);
+	for(int f = 0; f < num_fields; ++f) {
+		lua_createtable(L, units.size(), 0);
+	}
+
+	int i = 1;
+	for(const unit* u : units) {
+		lua_pushlstring(L, u->id().c_str(), u->id().size());
+		lua_rawseti(L, 2, i);
+		lua_pushinteger(L, u->get_location().wml_x());
+		lua_rawseti(L, 3, i);
+		lua_pushinteger(L, u->get_location().wml_y());
+		lua_rawseti(L, 4, i);
+		lua_pushinteger(L, u->side());
+		lua_rawseti(L, 5, i);
+		lua_pushinteger(L, u->hitpoints());
+		lua_rawseti(L, 6, i);
+		lua_pushinteger(L, u->max_hitpoints());
+		lua_rawseti(L, 7, i);
+		++i;
+	}
+
+	// lua_setfield() pops, so assign the arrays top-down.
+	for(int f = num_fields - 1; f >= 0; --f) {
+		lua_setfield(L, 1, fields[f]);
+	}
+	return 1;
+}
+
 /**
  * Matches a unit against the given filter.
  * - Arg 1: full userdata.
@@ -644,10 +710,10 @@ int game_lua_kernel::intf_fire_event(lua_State *L, const bool by_id)
 	bool b = false;
 
 	if (by_id) {
-	  b = std::get<0>(play_controller_.pump().fire("", m, l1, l2, data));
+	  b = std::get<0>(play_controller_.pump().fire("", m, l1, l2, std::move(data)));
 	}
 	else {
-	  b = std::get<0>(play_controller_.pump().fire(m, l1, l2, data));
+	  b = std::get<0>(play_controller_.pump().fire(m, l1, l2, std::move(data)));
 	}
 	lua_pushboolean(L, b);
 	return 1;
@@ -2589,11 +2655,34 @@ int game_lua_kernel::intf_put_unit(lua_State *L)
 	// Fire event if using the deprecated version or if the final argument is not false
 	// If the final boolean argument is omitted, the actual final argument (the unit or location) will always yield true.
 	if(luaW_toboolean(L, -1)) {
-		play_controller_.pump().fire("unit_placed", loc);
+		if(board().in_unit_placement_batch()) {
+			board().defer_unit_placed_event(loc);
+		} else {
+			play_controller_.pump().fire("unit_placed", loc);
+		}
 	}
 	return 0;
 }
 
+/**
+ * Runs a function with unit placement batched.
+ * The unit_placed events raised by wesnoth.units.to_map calls inside the
+ * function are deferred and pumped together after the function returns.
+ * - Arg 1: function.
+ * - Args 2+: arguments passed through to the function.
+ * - Rets: the function's return values.
+ */
+int game_lua_kernel::intf_place_units_batch(lua_State *L)
+{
+	luaL_checktype(L, 1, LUA_TFUNCTION);
+
+	unit_placement_batch batch(board(), play_controller_.pump());
+	lua_call(L, lua_gettop(L) - 1, LUA_MULTRET);
+	batch.commit();
+
+	return lua_gettop(L);
+}
+
 /**
  * Erases a unit from the map
  * - Arg 1: Unit to erase OR Location to erase unit
@@ -4097,6 +4186,29 @@ int game_lua_kernel::intf_delay(lua_State *L)
 	return 0;
 }
 
+/**
+ * Hands one slice of the game loop to the engine if the current frame has
+ * used up its time budget, and is a cheap no-op otherwise. Heavy Lua can
+ * therefore call this (or coroutine.yield() from an event handler, which
+ * funnels into the same budget) as often as convenient without paying a
+ * frame per call.
+ */
+int game_lua_kernel::intf_yield(lua_State *)
+{
+	if(gamedata().phase() == game_data::PRELOAD || gamedata().phase() == game_data::PRESTART || gamedata().phase() == game_data::INITIAL) {
+		//don't call play_slice if the game ui is not active yet.
+		return 0;
+	}
+	const unsigned now = SDL_GetTicks();
+	if(now < next_frame_slice_) {
+		return 0;
+	}
+	events::command_disabler command_disabler;
+	play_controller_.play_slice(false);
+	next_frame_slice_ = SDL_GetTicks() + 20;
+	return 0;
+}
+
 int game_lua_kernel::intf_add_label(lua_State *L)
 {
 	// TODO: Support color = {r = 0, g = 0, b = 0}
@@ -4805,6 +4917,7 @@ game_lua_kernel::game_lua_kernel(game_state & gs, play_controller & pc, reports
 	, level_lua_()
 	, EVENT_TABLE(LUA_NOREF)
 	, queued_events_()
+	, next_frame_slice_(0)
 	, map_locked_(0)
 {
 	static game_events::queued_event default_queued_event("_from_lua", "", map_location(), map_location(), config());
@@ -4957,6 +5070,7 @@ game_lua_kernel::game_lua_kernel(game_state & gs, play_controller & pc, reports
 		{"matches", &dispatch<&game_lua_kernel::intf_match_unit>},
 		{"select", &dispatch<&game_lua_kernel::intf_select_unit>},
 		{"to_map", &dispatch<&game_lua_kernel::intf_put_unit>},
+		{"to_map_batch", &dispatch<&game_lua_kernel::intf_place_units_batch>},
 		{"to_recall", &dispatch<&game_lua_kernel::intf_put_recall_unit>},
 		{"transform", &intf_transform_unit},
 		{"teleport", &dispatch<&game_lua_kernel::intf_teleport>},
@@ -4974,6 +5088,7 @@ game_lua_kernel::game_lua_kernel(game_state & gs, play_controller & pc, reports
 		{"create", &intf_create_unit},
 		{"find_on_map", &dispatch<&game_lua_kernel::intf_get_units>},
 		{"find_on_recall", &dispatch<&game_lua_kernel::intf_get_recall_units>},
+		{"find_stats", &dispatch<&game_lua_kernel::intf_get_unit_stats>},
 		{"get", &dispatch<&game_lua_kernel::intf_get_unit>},
 		{"get_hovered", &dispatch<&game_lua_kernel::intf_get_displayed_unit>},
 		{"create_animator", &dispatch<&game_lua_kernel::intf_create_animator>},
@@ -5034,6 +5149,7 @@ game_lua_kernel::game_lua_kernel(game_state & gs, play_controller & pc, reports
 		{"color_adjust", &dispatch<&game_lua_kernel::intf_color_adjust>},
 		{"screen_fade", &dispatch<&game_lua_kernel::intf_screen_fade>},
 		{"delay", &dispatch<&game_lua_kernel::intf_delay>},
+		{"yield", &dispatch<&game_lua_kernel::intf_yield>},
 		{"deselect_hex", &dispatch<&game_lua_kernel::intf_deselect_hex>},
 		{"highlight_hex", &dispatch<&game_lua_kernel::intf_highlight_hex>},
 		{"float_label", &dispatch<&game_lua_kernel::intf_float_label>},
@@ -5642,6 +5758,44 @@ void game_lua_kernel::clear_wml_event(int ref)
 	lua_pop(L, 1);
 }
 
+/**
+ * Drives an event handler body as a coroutine, stack: [function, args].
+ *
+ * Yielded values are discarded; each yield gives the game loop a frame
+ * through the same budget as @ref intf_yield before resuming, so a
+ * handler can spread heavy computation over frames with plain
+ * coroutine.yield() while the event as a whole still runs to completion
+ * inside its synced context.
+ */
+int game_lua_kernel::impl_run_event_coroutine(lua_State* L)
+{
+	lua_State* co = lua_newthread(L);
+	lua_insert(L, 1);
+	lua_xmove(L, co, 2);
+
+	int nres = 0;
+	int status = lua_resume(co, L, 1, &nres);
+	while(status == LUA_YIELD) {
+		lua_pop(co, nres);
+		intf_yield(L);
+		status = lua_resume(co, L, 0, &nres);
+	}
+
+	if(status != LUA_OK) {
+		// Reraise in this state, with the handler's own traceback so
+		// luaW_pcall reports the error as if the body ran inline.
+		if(lua_isstring(co, -1)) {
+			luaL_traceback(L, co, lua_tostring(co, -1), 0);
+		} else {
+			lua_xmove(co, L, 1);
+		}
+		return lua_error(L);
+	}
+
+	lua_xmove(co, L, nres);
+	return nres;
+}
+
 bool game_lua_kernel::run_wml_event(int ref, const vconfig& args, const game_events::queued_event& ev, bool* out)
 {
 	lua_State* L = mState;
@@ -5651,9 +5805,11 @@ bool game_lua_kernel::run_wml_event(int ref, const vconfig& args, const game_eve
 	};
 	lua_geti(L, -1, ref);
 	if(lua_isnil(L, -1)) return false;
+	lua_pushcfunction(L, &dispatch<&game_lua_kernel::impl_run_event_coroutine>);
+	lua_insert(L, -2);
 	luaW_pushvconfig(L, args);
 	queued_event_context dummy(&ev, queued_events_);
-	if(luaW_pcall(L, 1, out ? 1 : 0, true)) {
+	if(luaW_pcall(L, 2, out ? 1 : 0, true)) {
 		if(out) {
 			*out = luaW_toboolean(L, -1);
 			lua_pop(L, 1);
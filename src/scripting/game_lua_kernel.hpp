@@ -63,6 +63,9 @@ class game_lua_kernel : public lua_kernel_base
 
 	std::stack<game_events::queued_event const * > queued_events_;
 
+	/** Earliest tick at which @ref intf_yield will pump the game loop again. */
+	unsigned next_frame_slice_;
+
 	const game_events::queued_event & get_event_info();
 
 	static void extract_preload_scripts(const game_config_view& game_config);
@@ -84,6 +87,7 @@ class game_lua_kernel : public lua_kernel_base
 	int intf_create_animator(lua_State *);
 	int intf_get_unit(lua_State *);
 	int intf_get_units(lua_State *);
+	int intf_get_unit_stats(lua_State *);
 	int intf_get_displayed_unit(lua_State*);
 	int intf_match_unit(lua_State *L);
 	int intf_get_recall_units(lua_State *L);
@@ -128,6 +132,7 @@ class game_lua_kernel : public lua_kernel_base
 	int intf_move_floating_label(lua_State* L);
 	void put_unit_helper(const map_location& loc);
 	int intf_put_unit(lua_State *L);
+	int intf_place_units_batch(lua_State *L);
 	int intf_erase_unit(lua_State *L);
 	int intf_put_recall_unit(lua_State *L);
 	int intf_extract_unit(lua_State *L);
@@ -164,6 +169,8 @@ class game_lua_kernel : public lua_kernel_base
 	int intf_get_color_adjust(lua_State *L);
 	int intf_screen_fade(lua_State *L);
 	int intf_delay(lua_State *L);
+	int intf_yield(lua_State *L);
+	int impl_run_event_coroutine(lua_State *L);
 	int intf_add_label(lua_State *L);
 	int intf_remove_label(lua_State *L);
 	int intf_get_label(lua_State* L);
@@ -18,6 +18,7 @@
 #include "filesystem.hpp"
 #include "game_config.hpp" //for game_config::debug_lua
 #include "game_errors.hpp"
+#include "hash.hpp"
 #include "log.hpp"
 #include "scripting/lua_common.hpp"	// for chat_message, luaW_pcall
 #include "scripting/push_check.hpp"
@@ -27,6 +28,7 @@
 
 #include <algorithm>
 #include <exception>
+#include <sstream>
 #include <string>
 
 static lg::log_domain log_scripting_lua("scripting/lua");
@@ -246,47 +248,67 @@ int intf_read_file(lua_State *L)
 	return 1;
 }
 
-class lua_filestream
+/** Returns the cache file holding the compiled form of the given chunk. */
+static std::string bytecode_cache_path(std::string_view source, const char* chunkname)
 {
-public:
-	lua_filestream(const std::string& fname)
-		: buff_()
-		, pistream_(filesystem::istream_file(fname))
-	{
+	// The chunk name takes part in the key because it is baked into the
+	// bytecode's debug information, and the Lua version because bytecode is
+	// only loadable by the VM flavor that produced it.
+	std::ostringstream key;
+	key << LUA_VERSION << '\0' << chunkname << '\0' << source;
+	return filesystem::get_cache_dir() + "/lua/" + utils::md5(key.str()).hex_digest();
+}
 
-	}
+static int append_bytecode(lua_State* /*L*/, const void* chunk, std::size_t size, void* out)
+{
+	static_cast<std::string*>(out)->append(static_cast<const char*>(chunk), size);
+	return 0;
+}
 
-	static const char * lua_read_data(lua_State * /*L*/, void *data, std::size_t *size)
-	{
-		lua_filestream* lfs = static_cast<lua_filestream*>(data);
+int load_buffer_cached(lua_State* L, std::string_view source, const char* chunkname)
+{
+	std::string cache_path;
+	try {
+		cache_path = bytecode_cache_path(source, chunkname);
+		if(filesystem::file_exists(cache_path)) {
+			const std::string bytecode = filesystem::read_file(cache_path);
+			if(luaL_loadbufferx(L, bytecode.data(), bytecode.size(), chunkname, "b") == LUA_OK) {
+				return LUA_OK;
+			}
 
-		//int startpos = lfs->pistream_->tellg();
-		lfs->pistream_->read(lfs->buff_, luaL_buffersize);
-		//int newpos = lfs->pistream_->tellg();
-		*size = lfs->pistream_->gcount();
-#if 0
-		ERR_LUA << "read bytes from " << startpos << " to " << newpos << " in total " *size << " from steam";
-		ERR_LUA << "streamstate being "
-			<< " goodbit:" << lfs->pistream_->good()
-			<< " endoffile:" << lfs->pistream_->eof()
-			<< " badbit:" <<  lfs->pistream_->bad()
-			<< " failbit:" << lfs->pistream_->fail();
-#endif
-		return lfs->buff_;
+			// A cache file that no longer loads is just a miss; recompile
+			// the source below.
+			LOG_LUA << "discarding unloadable bytecode cache for " << chunkname;
+			lua_pop(L, 1);
+		}
+	} catch(const filesystem::io_exception&) {
+		// Unreadable cache, same treatment.
 	}
 
-	static int lua_loadfile(lua_State *L, const std::string& fname, const std::string& relativename)
-	{
-		lua_filestream lfs(fname);
-		//lua uses '@' to know that this is a file (as opposed to something loaded via loadstring )
-		std::string chunkname = '@' + relativename;
-		LOG_LUA << "starting to read from " << fname;
-		return  lua_load(L, &lua_filestream::lua_read_data, &lfs, chunkname.c_str(), "t");
+	const int res = luaL_loadbufferx(L, source.data(), source.size(), chunkname, "t");
+
+	if(res == LUA_OK && !cache_path.empty()) {
+		std::string bytecode;
+		if(lua_dump(L, &append_bytecode, &bytecode, 0) == 0) {
+			// Write to a temporary file and move it into place: loading
+			// bytecode skips the usual syntax checks, so a file torn by a
+			// crash or full disk would not reliably fail to load — it could
+			// take down the VM on the next launch instead of missing.
+			const std::string temp_path = cache_path + ".tmp";
+			try {
+				filesystem::write_file(temp_path, bytecode);
+				if(!filesystem::rename_file(temp_path, cache_path)) {
+					LOG_LUA << "could not move the Lua bytecode cache into place";
+					filesystem::delete_file(temp_path);
+				}
+			} catch(const filesystem::io_exception& e) {
+				LOG_LUA << "could not write the Lua bytecode cache: " << e.what();
+			}
+		}
 	}
-private:
-	char buff_[luaL_buffersize];
-	const std::unique_ptr<std::istream> pistream_;
-};
+
+	return res;
+}
 
 /**
  * Loads a Lua file and pushes the contents on the stack.
@@ -304,7 +326,10 @@ int load_file(lua_State *L)
 
 	try
 	{
-		if(lua_filestream::lua_loadfile(L, p, rel)) {
+		//lua uses '@' to know that this is a file (as opposed to something loaded via loadstring )
+		const std::string chunkname = '@' + rel;
+		LOG_LUA << "starting to read from " << p;
+		if(load_buffer_cached(L, filesystem::read_file(p), chunkname.c_str())) {
 			return lua_error(L);
 		}
 	}
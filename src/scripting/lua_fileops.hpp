@@ -21,12 +21,27 @@
 
 struct lua_State;
 
+#include <string_view>
+
 namespace lua_fileops {
 
 int intf_have_file(lua_State*);
 int intf_read_file(lua_State*);
 int intf_canonical_path(lua_State*);
 int load_file(lua_State*);
+
+/**
+ * Loads a Lua chunk through the persistent bytecode cache.
+ *
+ * The cache keeps one file per chunk under the cache dir, keyed by a hash of
+ * the chunk name and source, so a script that has not changed skips the Lua
+ * compiler on later loads. Source text is still compiled in text-only mode;
+ * the only bytecode ever loaded is what an earlier compile of the identical
+ * source dumped, so this does not open the bytecode sandbox escape to add-ons.
+ * Returns the same codes as lua_load(), with the chunk or the error message
+ * pushed on the stack.
+ */
+int load_buffer_cached(lua_State* L, std::string_view source, const char* chunkname);
 int luaW_open(lua_State *L);
 
 } // end namespace lua_fileops
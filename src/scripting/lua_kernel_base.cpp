@@ -15,6 +15,7 @@
 
 #include "scripting/lua_kernel_base.hpp"
 
+#include "frame_profiler.hpp"
 #include "game_config.hpp"
 #include "game_errors.hpp"
 #include "gui/core/gui_definition.hpp" // for remove_single_widget_definition
@@ -51,6 +52,7 @@
 #include "utils/context_free_grammar_generator.hpp"
 #include "utils/scope_exit.hpp"
 
+#include <chrono>
 #include <cstring>
 #include <exception>
 #include <new>
@@ -987,6 +989,10 @@ bool lua_kernel_base::protected_call(int nArgs, int nRets, error_handler e_h)
 
 bool lua_kernel_base::protected_call(lua_State * L, int nArgs, int nRets, error_handler e_h)
 {
+	// Every Lua entry point funnels through here, so this one scope
+	// covers WML action handlers, GUI2 callbacks and plugin slices.
+	frame_profiler::scope profile(frame_profiler::subsystem::lua);
+
 	int errcode = luaW_pcall_internal(L, nArgs, nRets);
 
 	if (errcode != LUA_OK) {
@@ -1020,8 +1026,10 @@ bool lua_kernel_base::protected_call(lua_State * L, int nArgs, int nRets, error_
 
 bool lua_kernel_base::load_string(char const * prog, const std::string& name, error_handler e_h)
 {
-	// pass 't' to prevent loading bytecode which is unsafe and can be used to escape the sandbox.
-	int errcode = luaL_loadbufferx(mState, prog, strlen(prog), name.empty() ? prog : name.c_str(), "t");
+	// The cached loader still compiles source in text-only mode, so untrusted
+	// bytecode that could escape the sandbox is never accepted; the only
+	// bytecode it loads is what a previous compile of the same source dumped.
+	int errcode = lua_fileops::load_buffer_cached(mState, prog, name.empty() ? prog : name.c_str());
 	if (errcode != LUA_OK) {
 		char const * msg = lua_tostring(mState, -1);
 		std::string message = msg ? msg : "null string";
@@ -1354,3 +1362,23 @@ uint32_t lua_kernel_base::get_random_seed()
 {
 	return seed_rng::next_seed();
 }
+
+void lua_kernel_base::run_gc_slice()
+{
+	const auto start = std::chrono::steady_clock::now();
+
+	// The step size is in kilobytes of allocation debt to work off. Small
+	// enough that one slice stays far below a frame even on weak hardware,
+	// large enough that per-frame calls outpace the garbage a busy scenario
+	// produces, which keeps the collector's own automatic trigger from ever
+	// having a large backlog to chew through mid-animation.
+	lua_gc(mState, LUA_GCSTEP, 128);
+
+	const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+		std::chrono::steady_clock::now() - start);
+	if(elapsed.count() >= 8) {
+		WRN_LUA << "Lua GC slice took " << elapsed.count() << "ms";
+	} else {
+		DBG_LUA << "Lua GC slice took " << elapsed.count() << "ms";
+	}
+}
@@ -76,6 +76,17 @@ public:
 	}
 
 	virtual uint32_t get_random_seed();
+
+	/**
+	 * Runs one bounded increment of garbage collection.
+	 *
+	 * Intended for idle points in the frame loop, so that collection debt is
+	 * paid off in small slices there instead of by the collector stopping the
+	 * world mid-script once enough garbage has piled up. Slices that overrun
+	 * their time budget are reported to the scripting log.
+	 */
+	void run_gc_slice();
+
 	lua_State * get_state() { return mState; }
 	void add_widget_definition(const std::string& type, const std::string& id) { registered_widget_definitions_.emplace_back(type, id); }
 protected:
@@ -266,8 +266,8 @@ static void impl_merge_terrain(lua_State* L, gamemap_base& map, map_location loc
 				t.fix_villages(*gm);
 			}
 
-			if(resources::controller) {
-				resources::controller->get_display().needs_rebuild(result);
+			if(result && resources::controller) {
+				resources::controller->get_display().needs_rebuild(loc);
 			}
 		}
 	} else map.set_terrain(loc, ter, mode, replace_if_failed);
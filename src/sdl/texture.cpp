@@ -26,6 +26,12 @@ static lg::log_domain log_sdl("SDL");
 namespace
 {
 // The default pixel format to create textures with.
+//
+// This is the only realistic choice: SDL_render exposes no compressed pixel
+// formats, so GPU formats such as BC7 or ETC2 would require bypassing the
+// renderer abstraction with a native GL/Vulkan backend. Until such a backend
+// exists, VRAM pressure has to be addressed by keeping fewer and smaller
+// textures resident, not by packing the ones we upload.
 const int default_texture_format = SDL_PIXELFORMAT_ARGB8888;
 
 void cleanup_texture(SDL_Texture* t)
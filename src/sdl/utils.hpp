@@ -112,6 +112,20 @@ surface scale_surface_legacy(const surface &surf, int w, int h);
  */
 surface scale_surface_sharp(const surface& surf, int w, int h);
 
+/**
+ *  Re-renders a sub-area of an already sharp-scaled surface.
+ *
+ *  Produces exactly the pixels scale_surface_sharp(src, dst->w, dst->h)
+ *  would, but only for @a area of @a dst, reading the full @a src. Used to
+ *  patch a scaled-down image in place after a small part of its source
+ *  changed.
+ *
+ *  @param src               The source at its original size.
+ *  @param dst               The scaled destination, modified in place.
+ *  @param area              The destination pixels to re-render.
+ */
+void scale_surface_sharp_region(const surface& src, surface& dst, const SDL_Rect& area);
+
 surface adjust_surface_color(const surface &surf, int r, int g, int b);
 surface greyscale_image(const surface &surf);
 surface monochrome_image(const surface &surf, const int threshold);
@@ -29,9 +29,266 @@
 #include <boost/iostreams/filter/bzip2.hpp>
 #include <boost/iostreams/filter/gzip.hpp>
 
+#include <sstream>
+
 static lg::log_domain log_config("config");
 #define ERR_CF LOG_STREAM(err, log_config)
 
+/* ** binary WML ** */
+
+namespace
+{
+const char binary_wml_magic[4] = {'W', 'M', 'L', 'B'};
+const uint8_t binary_wml_version = 1;
+
+/** Attribute value encodings. */
+const uint8_t binary_attr_string = 0;
+const uint8_t binary_attr_tstring = 1;
+
+/**
+ * Strings whose length is at most this many bytes enter the dictionary and
+ * are written once; longer strings (scenario text, unit descriptions) are
+ * unlikely to repeat and would only bloat the lookup structures.
+ */
+const std::size_t binary_dictionary_max_string = 128;
+/** Upper bound on dictionary entries, to keep corrupt input from exhausting memory. */
+const std::size_t binary_dictionary_max_entries = 1 << 20;
+
+/**
+ * Emits varints, strings and nodes. Every string is length-prefixed with
+ * the low bit of the prefix distinguishing a literal (0, followed by the
+ * bytes, which may also define a new dictionary entry) from a dictionary
+ * reference (1).
+ */
+class binary_wml_writer
+{
+public:
+	explicit binary_wml_writer(std::ostream& out)
+		: out_(out)
+		, dictionary_()
+	{
+	}
+
+	void write_varint(uint64_t v)
+	{
+		while(v >= 0x80) {
+			out_.put(static_cast<char>((v & 0x7f) | 0x80));
+			v >>= 7;
+		}
+
+		out_.put(static_cast<char>(v));
+	}
+
+	void write_string(std::string_view s)
+	{
+		auto it = dictionary_.find(s);
+		if(it != dictionary_.end()) {
+			write_varint((uint64_t(it->second) << 1) | 1);
+			return;
+		}
+
+		write_varint(uint64_t(s.size()) << 1);
+		out_.write(s.data(), s.size());
+
+		// The reader mirrors this admission rule exactly.
+		if(s.size() <= binary_dictionary_max_string && dictionary_.size() < binary_dictionary_max_entries) {
+			dictionary_.emplace(s, dictionary_.size());
+		}
+	}
+
+	void write_node(const config& cfg)
+	{
+		write_attributes(cfg);
+
+		write_varint(cfg.all_children_count());
+		for(const config::any_child item : cfg.all_children_range()) {
+			write_string(item.key);
+			write_node(item.cfg);
+		}
+	}
+
+	/**
+	 * Writes a root node holding only the child range [first, last).
+	 * Root attributes belong to the first shard.
+	 */
+	void write_root_shard(const config& cfg, std::size_t first, std::size_t last)
+	{
+		if(first == 0) {
+			write_attributes(cfg);
+		} else {
+			write_varint(0);
+		}
+
+		write_varint(last - first);
+
+		std::size_t index = 0;
+		for(const config::any_child item : cfg.all_children_range()) {
+			if(index >= last) {
+				break;
+			}
+
+			if(index >= first) {
+				write_string(item.key);
+				write_node(item.cfg);
+			}
+
+			++index;
+		}
+	}
+
+private:
+	struct is_translatable_visitor
+	{
+		bool operator()(const t_string&) const { return true; }
+
+		template<typename T>
+		bool operator()(const T&) const { return false; }
+	};
+
+	void write_attributes(const config& cfg)
+	{
+		write_varint(cfg.attribute_count());
+		for(const config::attribute& a : cfg.attribute_range()) {
+			write_string(a.first);
+
+			if(a.second.apply_visitor(is_translatable_visitor())) {
+				out_.put(static_cast<char>(binary_attr_tstring));
+				write_string(a.second.t_str().to_serialized());
+			} else {
+				out_.put(static_cast<char>(binary_attr_string));
+				write_string(a.second.str());
+			}
+		}
+	}
+
+	std::ostream& out_;
+	std::map<std::string, uint32_t, std::less<>> dictionary_;
+};
+
+class binary_wml_reader
+{
+public:
+	explicit binary_wml_reader(std::istream& in)
+		: in_(in)
+		, dictionary_()
+	{
+	}
+
+	uint64_t read_varint()
+	{
+		uint64_t v = 0;
+
+		for(unsigned shift = 0; shift < 64; shift += 7) {
+			const int c = in_.get();
+			if(c == std::char_traits<char>::eof()) {
+				throw config::error("binary WML: truncated varint");
+			}
+
+			v |= uint64_t(c & 0x7f) << shift;
+			if((c & 0x80) == 0) {
+				return v;
+			}
+		}
+
+		throw config::error("binary WML: overlong varint");
+	}
+
+	std::string read_string()
+	{
+		const uint64_t prefix = read_varint();
+
+		if(prefix & 1) {
+			const uint64_t index = prefix >> 1;
+			if(index >= dictionary_.size()) {
+				throw config::error("binary WML: bad dictionary reference");
+			}
+
+			return dictionary_[index];
+		}
+
+		const uint64_t size = prefix >> 1;
+		std::string s(size, '\0');
+		if(size > 0 && !in_.read(&s[0], size)) {
+			throw config::error("binary WML: truncated string");
+		}
+
+		if(s.size() <= binary_dictionary_max_string && dictionary_.size() < binary_dictionary_max_entries) {
+			dictionary_.push_back(s);
+		}
+
+		return s;
+	}
+
+	void read_node(config& cfg)
+	{
+		const uint64_t nattr = read_varint();
+		for(uint64_t i = 0; i < nattr; ++i) {
+			const std::string key = read_string();
+			const int tag = in_.get();
+
+			if(tag == binary_attr_tstring) {
+				cfg[key] = t_string::from_serialized(read_string());
+			} else if(tag == binary_attr_string) {
+				cfg[key] = read_string();
+			} else {
+				throw config::error("binary WML: unknown attribute encoding");
+			}
+		}
+
+		const uint64_t nchildren = read_varint();
+		for(uint64_t i = 0; i < nchildren; ++i) {
+			const std::string key = read_string();
+			if(!config::valid_tag(key)) {
+				throw config::error("binary WML: invalid tag name");
+			}
+
+			read_node(cfg.add_child(key));
+		}
+	}
+
+private:
+	std::istream& in_;
+	std::vector<std::string> dictionary_;
+};
+
+} // namespace
+
+void write_binary_wml(std::ostream& out, const config& cfg)
+{
+	out.write(binary_wml_magic, sizeof(binary_wml_magic));
+	out.put(static_cast<char>(binary_wml_version));
+
+	binary_wml_writer writer(out);
+	writer.write_node(cfg);
+}
+
+void write_binary_wml_shard(std::ostream& out, const config& cfg, std::size_t first, std::size_t last)
+{
+	out.write(binary_wml_magic, sizeof(binary_wml_magic));
+	out.put(static_cast<char>(binary_wml_version));
+
+	binary_wml_writer writer(out);
+	writer.write_root_shard(cfg, first, last);
+}
+
+void read_binary_wml(config& cfg, std::istream& in)
+{
+	cfg.clear();
+
+	char magic[sizeof(binary_wml_magic)];
+	if(!in.read(magic, sizeof(magic)) || !std::equal(magic, magic + sizeof(magic), binary_wml_magic)) {
+		throw config::error("binary WML: bad magic");
+	}
+
+	const int version = in.get();
+	if(version != binary_wml_version) {
+		throw config::error("binary WML: unsupported version");
+	}
+
+	binary_wml_reader reader(in);
+	reader.read_node(cfg);
+}
+
 config_writer::config_writer(std::ostream& out, compression::format compress)
 	: filter_()
 	, out_ptr_(compress != compression::format::none ? &filter_ : &out) // ternary indirection creates a temporary
@@ -89,6 +346,19 @@ void config_writer::write_child(const std::string& key, const config& cfg)
 	close_child(key);
 }
 
+void config_writer::write_child_cached(const std::string& key, const config& cfg, std::string& rendered)
+{
+	if(rendered.empty()) {
+		std::ostringstream ss;
+		::write_open_child(ss, key, level_);
+		::write(ss, cfg, level_ + 1);
+		::write_close_child(ss, key, level_);
+		rendered = ss.str();
+	}
+
+	out_ << rendered;
+}
+
 void config_writer::open_child(const std::string& key)
 {
 	::write_open_child(out_, key, level_++);
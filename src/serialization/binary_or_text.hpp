@@ -23,6 +23,37 @@
 
 #include <boost/iostreams/filtering_stream.hpp>
 
+/**
+ * Writes @a cfg to @a out in the versioned binary WML format.
+ *
+ * The format stores the tree structure directly (counts instead of
+ * open/close tags) and pools repeated strings in an implicit dictionary, so
+ * reading it back skips the preprocessor and tokenizer entirely. It is
+ * intended for machine-written data such as the game config cache, not for
+ * files a user might edit.
+ */
+void write_binary_wml(std::ostream& out, const config& cfg);
+
+/**
+ * Writes one shard of @a cfg in the binary WML format.
+ *
+ * The shard covers the top-level children with index in [@a first, @a last);
+ * root attributes are included only when @a first is zero. Each shard is a
+ * complete stream readable with read_binary_wml(); reading the shards into
+ * separate configs and appending those in index order reproduces the
+ * original. The string dictionary is per stream, so shards can be read
+ * independently and concurrently.
+ */
+void write_binary_wml_shard(std::ostream& out, const config& cfg, std::size_t first, std::size_t last);
+
+/**
+ * Reads a config written by write_binary_wml().
+ *
+ * @throws config::error if the data has the wrong magic or version, or is
+ * truncated or otherwise malformed.
+ */
+void read_binary_wml(config& cfg, std::istream& in);
+
 /** Class for writing a config out to a file in pieces. */
 class config_writer
 {
@@ -35,6 +66,20 @@ public:
 	void write(const config &cfg);
 
 	void write_child(const std::string &key, const config &cfg);
+
+	/**
+	 * Variant of write_child() that caches the rendered text.
+	 *
+	 * If @a rendered is empty, it is filled with the text that writing @a cfg
+	 * at the current depth produces; otherwise its contents are written out
+	 * verbatim and @a cfg is not touched. The text of a child block depends
+	 * only on the config and the nesting depth, so a caller that writes a
+	 * long, mostly-unchanging sequence of children on every save (the replay
+	 * command journal) can keep the strings across saves and pay only for the
+	 * children that changed since the last one.
+	 */
+	void write_child_cached(const std::string &key, const config &cfg, std::string &rendered);
+
 	void open_child(const std::string &key);
 	void close_child(const std::string &key);
 	bool good() const;
@@ -341,7 +341,7 @@ void parser::parse_variable()
 				if(buffer.translatable()) {
 					cfg[*curvar] = t_string(buffer);
 				} else {
-					cfg[*curvar] = buffer.value();
+					cfg[*curvar] = buffer.extract_value();
 				}
 
 				if(validator_) {
@@ -397,7 +397,7 @@ void parser::parse_variable()
 			break;
 
 		case token::QSTRING:
-			buffer += tok_.current_token().value;
+			buffer += tok_.take_value();
 			break;
 
 		case token::UNTERMINATED_QSTRING:
@@ -424,7 +424,7 @@ finish:
 	if(buffer.translatable()) {
 		cfg[*curvar] = t_string(buffer);
 	} else {
-		cfg[*curvar] = buffer.value();
+		cfg[*curvar] = buffer.extract_value();
 	}
 
 	if(validator_) {
@@ -644,7 +644,10 @@ void read_compressed(config& cfg, std::istream& file, abstract_validator* valida
 	}
 
 	boost::iostreams::filtering_stream<boost::iostreams::input> filter;
-	filter.push(decompressor());
+	// The default 4KB buffer means a large campaign save crosses the
+	// decompressor tens of thousands of times; 64KB chunks keep the
+	// streaming behavior with far fewer round trips.
+	filter.push(decompressor(), 64 * 1024);
 	filter.push(file);
 
 	/* This causes gzip_error (and the corresponding bz2 error, std::ios_base::failure) to be
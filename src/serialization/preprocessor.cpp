@@ -31,8 +31,12 @@
 #include "wesconfig.h"
 #include "deprecation.hpp"
 
-#include <stdexcept>
 #include <deque>
+#include <future>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <thread>
 
 static lg::log_domain log_preprocessor("preprocessor");
 #define ERR_PREPROC LOG_STREAM(err, log_preprocessor)
@@ -127,6 +131,20 @@ static std::string get_location(const std::string& loc)
 	return res;
 }
 
+/**
+ * Macro bodies expanded on the buffered (slow) path, keyed by the macro's
+ * definition site, the active textdomain and the exact argument text. Output
+ * captured there is position-independent — its line markers are rooted at the
+ * definition, not at the call site — so it can be replayed verbatim wherever
+ * the same invocation appears again. The table is flushed whenever the define
+ * map changes, since a call nested in a body could then resolve differently,
+ * and at the start of each preprocessing run.
+ */
+static std::map<std::string, std::string> macro_expansion_cache;
+
+/** Bound on cached expansions; the whole table is dropped when exceeded. */
+static const std::size_t macro_expansion_cache_max = 2048;
+
 
 // ==================================================================================
 // PREPROC_DEFINE IMPLEMENTATION
@@ -310,6 +328,142 @@ private:
  * Target for sending preprocessed output.
  * Objects of this class can be plugged into an STL stream.
  */
+/**
+ * Reads the files of directory inclusions into memory ahead of the
+ * preprocessor reaching them.
+ *
+ * Macro expansion is inherently ordered (a define made by one file is
+ * visible to every later one), so include subtrees cannot be *expanded* in
+ * parallel without changing semantics. What can safely run concurrently is
+ * the file I/O: when '{~add-ons/...}' lists a directory, its .cfg files are
+ * known up front and worker threads read them into memory while the
+ * preprocessor is still chewing on earlier files. Expansion order and
+ * output are bit-identical to the serial path.
+ */
+class include_prefetcher
+{
+public:
+	include_prefetcher()
+		: mutex_()
+		, contents_()
+		, workers_()
+	{
+	}
+
+	/** Blocks until all outstanding reads are done. */
+	~include_prefetcher()
+	{
+		for(std::future<void>& worker : workers_) {
+			worker.wait();
+		}
+	}
+
+	/** Queues the .cfg files of an included directory for background reading. */
+	void enqueue(const std::vector<std::string>& files)
+	{
+		std::vector<std::pair<std::string, std::promise<std::string>>> batch;
+
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+
+			for(const std::string& name : files) {
+				unsigned sz = name.size();
+				if(sz < 5 || !std::equal(name.rbegin(), name.rbegin() + 4, "gfc.")) {
+					continue;
+				}
+
+				if(contents_.find(name) != contents_.end()) {
+					continue;
+				}
+
+				std::promise<std::string> promise;
+				contents_.emplace(name, promise.get_future());
+				batch.emplace_back(name, std::move(promise));
+			}
+		}
+
+		if(batch.size() < 2) {
+			// Reading a single file ahead of time gains nothing.
+			abandon(batch);
+			return;
+		}
+
+		static const std::size_t max_workers = std::max(1u, std::thread::hardware_concurrency());
+
+		const std::size_t nworkers = std::min(max_workers, (batch.size() + min_files_per_worker - 1) / min_files_per_worker);
+
+		// Hand out contiguous slices so each worker reads files in disk order.
+		const std::size_t per_worker = (batch.size() + nworkers - 1) / nworkers;
+
+		auto chunk_begin = std::make_move_iterator(batch.begin());
+		for(std::size_t w = 0; w < nworkers; ++w) {
+			const std::size_t count = std::min(per_worker, batch.size() - w * per_worker);
+			std::vector<std::pair<std::string, std::promise<std::string>>> chunk(chunk_begin, chunk_begin + count);
+			chunk_begin += count;
+
+			workers_.push_back(std::async(std::launch::async, [chunk = std::move(chunk)]() mutable {
+				for(auto& [name, promise] : chunk) {
+					try {
+						promise.set_value(filesystem::read_file(name));
+					} catch(...) {
+						promise.set_exception(std::current_exception());
+					}
+				}
+			}));
+		}
+
+		// Completed workers can be forgotten; doing it here keeps the vector
+		// from growing over a long preprocessing run.
+		workers_.erase(std::remove_if(workers_.begin(), workers_.end(),
+			[](const std::future<void>& f) { return f.wait_for(std::chrono::seconds(0)) == std::future_status::ready; }),
+			workers_.end());
+	}
+
+	/**
+	 * Returns the prefetched contents of @a name, or an empty optional if the
+	 * file was never queued or could not be read (the caller then falls back
+	 * to a plain synchronous read and its usual error reporting).
+	 */
+	std::optional<std::string> fetch(const std::string& name)
+	{
+		std::future<std::string> future;
+
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+
+			auto it = contents_.find(name);
+			if(it == contents_.end()) {
+				return std::nullopt;
+			}
+
+			future = std::move(it->second);
+			contents_.erase(it);
+		}
+
+		try {
+			return future.get();
+		} catch(...) {
+			return std::nullopt;
+		}
+	}
+
+private:
+	/** Fulfills queued promises that no worker was started for. */
+	void abandon(std::vector<std::pair<std::string, std::promise<std::string>>>& batch)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		for(auto& [name, promise] : batch) {
+			contents_.erase(name);
+		}
+	}
+
+	static const std::size_t min_files_per_worker = 4;
+
+	std::mutex mutex_;
+	std::map<std::string, std::future<std::string>> contents_;
+	std::vector<std::future<void>> workers_;
+};
+
 class preprocessor_streambuf : public std::streambuf
 {
 public:
@@ -324,7 +478,11 @@ public:
 		, location_("")
 		, linenum_(0)
 		, quoted_(false)
+		, prefetcher_()
 	{
+		// Each run starts from its own define map, so nothing cached from a
+		// previous run can be trusted.
+		macro_expansion_cache.clear();
 	}
 
 	/** Decodes the filenames placed in a location. */
@@ -367,6 +525,7 @@ private:
 		, location_("")
 		, linenum_(0)
 		, quoted_(t.quoted_)
+		, prefetcher_()
 	{
 	}
 
@@ -398,6 +557,9 @@ private:
 	 */
 	bool quoted_;
 
+	/** Overlaps reading of directory-included files with expansion. */
+	include_prefetcher prefetcher_;
+
 	friend class preprocessor;
 	friend class preprocessor_file;
 	friend class preprocessor_data;
@@ -788,6 +950,8 @@ preprocessor_file::preprocessor_file(preprocessor_streambuf& t, const std::strin
 			filesystem::reorder_mode::DO_REORDER
 		);
 
+		parent_.prefetcher_.enqueue(files_);
+
 		for(const std::string& fname : files_) {
 			std::size_t cpos = fname.rfind(" ");
 
@@ -815,6 +979,15 @@ void preprocessor_file::init()
 		return;
 	}
 
+	if(std::optional<std::string> contents = parent_.prefetcher_.fetch(name_)) {
+		parent_.add_preprocessor<preprocessor_data>(
+			filesystem::scoped_istream(new std::istringstream(std::move(*contents))), "",
+			filesystem::get_short_wml_path(name_), 1,
+			filesystem::directory_name(name_), parent_.textdomain_, nullptr
+		);
+		return;
+	}
+
 	filesystem::scoped_istream file_stream = filesystem::istream_file(name_);
 
 	if(!file_stream->good()) {
@@ -1318,6 +1491,7 @@ bool preprocessor_data::get_chunk()
 						deprecation_detail, deprecation_level, deprecation_version);
 
 				LOG_PREPROC << "defining macro " << symbol << " (location " << get_location(parent_.location_) << ")";
+				macro_expansion_cache.clear();
 			}
 		} else if(command == "ifdef" || command == "ifndef") {
 			const bool negate = command[2] == 'n';
@@ -1409,6 +1583,7 @@ bool preprocessor_data::get_chunk()
 			if(!skipping_) {
 				parent_.defines_->erase(symbol);
 				LOG_PREPROC << "undefine macro " << symbol << " (location " << get_location(parent_.location_) << ")";
+				macro_expansion_cache.clear();
 			}
 		} else if(command == "error") {
 			if(!skipping_) {
@@ -1604,6 +1779,19 @@ bool preprocessor_data::get_chunk()
 					parent_.error(error.str(), linenum_);
 				}
 
+				// Key for macro_expansion_cache; built while strings_ still
+				// holds the raw argument text.
+				std::string expansion_key;
+				if(slowpath_) {
+					std::ostringstream k;
+					k << val.location << ' ' << val.linenum << ' ' << parent_.textdomain_;
+					for(std::size_t i = 0; i < nb_arg; ++i) {
+						k << OUTPUT_SEPARATOR << strings_[token.stack_pos + i + 1];
+					}
+
+					expansion_key = k.str();
+				}
+
 				filesystem::scoped_istream buffer{new std::istringstream(val.value)};
 
 				pop_token();
@@ -1613,6 +1801,10 @@ bool preprocessor_data::get_chunk()
 
 					parent_.add_preprocessor<preprocessor_data>(
 						std::move(buffer), val.location, "", val.linenum, dir, val.textdomain, std::move(defines), true);
+				} else if(const auto cached = macro_expansion_cache.find(expansion_key); cached != macro_expansion_cache.end()) {
+					DBG_PREPROC << "substituting (cached) macro " << symbol;
+
+					put(cached->second);
 				} else {
 					DBG_PREPROC << "substituting (slow) macro " << symbol;
 
@@ -1631,6 +1823,11 @@ bool preprocessor_data::get_chunk()
 						res << in.rdbuf();
 					}
 
+					if(macro_expansion_cache.size() >= macro_expansion_cache_max) {
+						macro_expansion_cache.clear();
+					}
+
+					macro_expansion_cache.emplace(expansion_key, res.str());
 					put(res.str());
 				}
 			} else if(parent_.depth() < 40) {
@@ -184,6 +184,15 @@ static void wrong_type_error(const std::string & file, int line,
 
 schema_validator::~schema_validator()
 {
+	if(matcher_.joinable()) {
+		{
+			std::lock_guard<std::mutex> lock(matcher_mutex_);
+			matcher_exit_ = true;
+		}
+
+		matcher_cond_.notify_all();
+		matcher_.join();
+	}
 }
 
 schema_validator::schema_validator(const std::string& config_file_name, bool validate_schema)
@@ -191,6 +200,8 @@ schema_validator::schema_validator(const std::string& config_file_name, bool val
 	, create_exceptions_(strict_validation_enabled)
 	, config_read_(false)
 	, validate_schema_(validate_schema)
+	, keys_pending_(0)
+	, matcher_exit_(false)
 {
 	if(!read_config_file(config_file_name)) {
 		ERR_VL << "Schema file " << config_file_name << " was not read.";
@@ -289,8 +300,81 @@ void schema_validator::close_tag()
 	}
 }
 
+void schema_validator::enqueue_key(pending_key&& job)
+{
+	{
+		std::lock_guard<std::mutex> lock(matcher_mutex_);
+
+		if(!matcher_.joinable()) {
+			matcher_ = std::thread(&schema_validator::matcher_loop, this);
+		}
+
+		key_queue_.push_back(std::move(job));
+		++keys_pending_;
+	}
+
+	matcher_cond_.notify_all();
+}
+
+void schema_validator::drain_keys()
+{
+	if(!matcher_.joinable()) {
+		return;
+	}
+
+	std::unique_lock<std::mutex> lock(matcher_mutex_);
+	matcher_cond_.wait(lock, [this]() { return keys_pending_ == 0; });
+
+	for(pending_key& job : failed_keys_) {
+		(*job.scope)[job.cfg].emplace_back(
+			WRONG_VALUE, job.file, job.line, 0, job.tag, job.key, job.value.str(), job.type);
+	}
+
+	failed_keys_.clear();
+}
+
+void schema_validator::matcher_loop()
+{
+	std::unique_lock<std::mutex> lock(matcher_mutex_);
+
+	for(;;) {
+		matcher_cond_.wait(lock, [this]() { return matcher_exit_ || !key_queue_.empty(); });
+
+		if(key_queue_.empty()) {
+			// Implies matcher_exit_; a drain has collected everything.
+			return;
+		}
+
+		pending_key job = std::move(key_queue_.front());
+		key_queue_.pop_front();
+		lock.unlock();
+
+		// Only immutable schema state (types_) is touched from here on.
+		bool matched = false;
+		for(auto& possible_type : utils::split(job.type)) {
+			if(auto type = find_type(possible_type)) {
+				if(type->matches(job.value, types_)) {
+					matched = true;
+					break;
+				}
+			}
+		}
+
+		lock.lock();
+		if(!matched) {
+			failed_keys_.push_back(std::move(job));
+		}
+
+		if(--keys_pending_ == 0) {
+			matcher_cond_.notify_all();
+		}
+	}
+}
+
 void schema_validator::print_cache()
 {
+	drain_keys();
+
 	for(auto& m : cache_.top()) {
 		for(auto& list : m.second) {
 			print(list);
@@ -353,18 +437,11 @@ void schema_validator::validate_key(
 		// checking existing keys
 		const wml_key* key = active_tag().find_key(name, cfg);
 		if(key) {
-			bool matched = false;
-			for(auto& possible_type : utils::split(key->get_type())) {
-				if(auto type = find_type(possible_type)) {
-					if(type->matches(value, types_)) {
-						matched = true;
-						break;
-					}
-				}
-			}
-			if(!matched) {
-				queue_message(cfg, WRONG_VALUE, file, start_line, 0, active_tag().get_name(), name, value, key->get_type());
-			}
+			// The type match itself only needs copies of the strings
+			// involved, so it runs on the matcher thread while the parser
+			// carries on. Failures surface as messages in drain_keys().
+			enqueue_key(pending_key{
+				&cache_.top(), &cfg, file, start_line, active_tag().get_name(), name, value, key->get_type()});
 		} else {
 			queue_message(cfg, EXTRA_KEY, file, start_line, 0, active_tag().get_name(), name);
 		}
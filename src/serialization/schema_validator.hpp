@@ -22,9 +22,12 @@
 #include "serialization/schema/key.hpp"
 #include "serialization/validator.hpp"
 
+#include <condition_variable>
+#include <mutex>
 #include <queue>
 #include <stack>
 #include <string>
+#include <thread>
 
 class config;
 
@@ -123,6 +126,36 @@ private:
 	typedef std::deque<message_info> message_list;
 	typedef std::map<const config*, message_list> message_map;
 
+	/**
+	 * A key value waiting for type matching on the matcher thread.
+	 *
+	 * Everything the match needs is copied in, so the matcher never touches
+	 * the config tree the parser is still building; the config address is
+	 * only kept for keying the resulting message.
+	 */
+	struct pending_key
+	{
+		message_map* scope;
+		const config* cfg;
+		std::string file;
+		int line;
+		std::string tag;
+		std::string key;
+		config_attribute_value value;
+		std::string type;
+	};
+
+	/** Hands @a job to the matcher thread, starting the thread on first use. */
+	void enqueue_key(pending_key&& job);
+
+	/**
+	 * Waits until the matcher thread has caught up and files the failures it
+	 * found as messages. Must be called before reading or popping cache_.
+	 */
+	void drain_keys();
+
+	void matcher_loop();
+
 	/** Reads config from input. */
 	bool read_config_file(const std::string& filename);
 
@@ -145,6 +178,22 @@ private:
 
 	bool validate_schema_;
 
+	/**
+	 * Matches key values against their schema types off-thread.
+	 *
+	 * Type matching is the expensive part of validation (most types boil
+	 * down to regex matches), so validate_key() queues it here and parsing
+	 * continues; drain_keys() joins the results back in before messages are
+	 * printed.
+	 */
+	std::thread matcher_;
+	std::mutex matcher_mutex_;
+	std::condition_variable matcher_cond_;
+	std::deque<pending_key> key_queue_;
+	std::deque<pending_key> failed_keys_;
+	std::size_t keys_pending_;
+	bool matcher_exit_;
+
 protected:
 	template<typename... T>
 	void queue_message(const config& cfg, T&&... args)
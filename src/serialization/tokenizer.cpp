@@ -59,6 +59,7 @@ const token &tokenizer::next_token()
 	while(true)
 	{
 		while (is_space(current_)) {
+			consume_run([this](unsigned char c) { return is_space(c); }, false);
 			next_char_fast();
 		}
 		if (current_ != 254)
@@ -97,6 +98,10 @@ const token &tokenizer::next_token()
 				break;
 			}
 			token_.value += current_;
+			consume_run([this](unsigned char c) {
+				if (c == '\n') ++lineno_;
+				return c != '>' && c != '\r';
+			}, true);
 		}
 		break;
 
@@ -118,6 +123,10 @@ const token &tokenizer::next_token()
 				continue;
 			}
 			token_.value += current_;
+			consume_run([this](unsigned char c) {
+				if (c == '\n') ++lineno_;
+				return c != '"' && c != 254 && c != '\r';
+			}, true);
 		}
 		break;
 
@@ -139,6 +148,7 @@ const token &tokenizer::next_token()
 			token_.type = token::STRING;
 			do {
 				token_.value += current_;
+				consume_run([this](unsigned char c) { return is_alnum(c) || c == '$'; }, true);
 				next_char_fast();
 				while (current_ == 254) {
 					skip_comment();
@@ -197,6 +207,7 @@ void tokenizer::skip_comment()
 	else
 	{
 		fail:
+		consume_run([](unsigned char c) { return c != '\n'; }, false);
 		while (current_ != '\n' && current_ != EOF) {
 			next_char_fast();
 		}
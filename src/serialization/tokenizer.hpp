@@ -66,6 +66,18 @@ public:
 		return token_;
 	}
 
+	/**
+	 * Moves the current token's value out of the tokenizer.
+	 *
+	 * The token keeps its type but its value becomes unspecified. This lets
+	 * the parser take over large string payloads (long quoted strings,
+	 * << >> blocks) without copying them a second time.
+	 */
+	std::string take_value()
+	{
+		return std::move(token_.value);
+	}
+
 #ifdef DEBUG_TOKENIZER
 	const token &previous_token() const
 	{
@@ -158,6 +170,45 @@ private:
 		return (char_type(c) & (TOK_ALPHA | TOK_NUMERIC)) != TOK_NONE;
 	}
 
+	/**
+	 * Consumes the longest run of buffered characters for which @a is_plain
+	 * holds, appending it to the current token if @a collect is set.
+	 *
+	 * This scans the input buffer directly, one table lookup per byte,
+	 * instead of going through next_char_fast() with its carriage-return
+	 * test per character. The predicate sees each consumed character, so it
+	 * can count newlines; it must reject '\r' (and anything else needing
+	 * special treatment) to hand control back to the caller. #current_ is
+	 * left untouched: the caller still owns the character it already read.
+	 */
+	template<typename F>
+	void consume_run(F is_plain, bool collect)
+	{
+		for(;;) {
+			const char* data = in_.buffer_data();
+			if(!data) {
+				return;
+			}
+
+			const unsigned available = in_.buffer_available();
+			unsigned run = 0;
+			while(run < available && is_plain(static_cast<unsigned char>(data[run]))) {
+				++run;
+			}
+
+			if(run > 0) {
+				if(collect) {
+					token_.value.append(data, run);
+				}
+				in_.consume(run);
+			}
+
+			if(run < available) {
+				return;
+			}
+		}
+	}
+
 	void skip_comment();
 
 	/**
@@ -86,6 +86,8 @@ const std::set<std::string> cap_defaults = {
 	"auth:legacy",
 	// Delta WML packs
 	"delta",
+	// Paged [request_campaign_list] responses
+	"list:paging",
 };
 
 /**
@@ -400,6 +402,7 @@ void server::load_config()
 
 	//Loading addons
 	addons_.clear();
+	campaign_list_cache_.reset();
 	std::vector<std::string> legacy_addons, dirs;
 	filesystem::get_files_in_dir("data", &legacy_addons, &dirs);
 	config meta;
@@ -915,6 +918,7 @@ void server::delete_addon(const std::string& id)
 	}
 
 	addons_.erase(id);
+	campaign_list_cache_.reset();
 	write_config();
 
 	fire("hook_post_erase", id);
@@ -987,6 +991,23 @@ void server::handle_request_campaign_list(const server::request& req)
 	const std::string& name = req.cfg["name"];
 	const std::string& lang = req.cfg["language"];
 
+	const std::size_t offset = req.cfg["offset"].to_size_t();
+	const std::size_t limit = req.cfg["limit"].to_size_t();
+
+	// Filterless requests all produce the same payload until an add-on
+	// changes, so serve those from the cache built below. Sending clones
+	// the document, and clones share one compressed buffer.
+	const bool cacheable = !before_flag && !after_flag && name.empty() && lang.empty()
+			&& offset == 0 && limit == 0;
+
+	if(cacheable && campaign_list_cache_) {
+		utils::visit([this](auto&& sock) { async_send_doc_queued(sock, *campaign_list_cache_); }, req.sock);
+		return;
+	}
+
+	std::size_t total = 0;
+	std::size_t listed = 0;
+
 	for(const auto& addon : addons_)
 	{
 		if(!name.empty() && name != addon.first) {
@@ -1024,9 +1045,20 @@ void server::handle_request_campaign_list(const server::request& req)
 			}
 		}
 
+		++total;
+
+		// Serve only the requested slice, but keep counting the matches so
+		// paging clients know when they have the full list.
+		if(total <= offset || (limit != 0 && listed >= limit)) {
+			continue;
+		}
+
 		addons_list.add_child("campaign", i);
+		++listed;
 	}
 
+	addons_list["total"] = total;
+
 	for(config& j : addons_list.child_range("campaign"))
 	{
 		// Remove attributes containing information that's considered sensitive
@@ -1053,10 +1085,14 @@ void server::handle_request_campaign_list(const server::request& req)
 	std::ostringstream ostr;
 	write(ostr, response);
 	std::string wml = ostr.str();
-	simple_wml::document doc(wml.c_str(), simple_wml::INIT_STATIC);
-	doc.compress();
+	auto doc = std::make_unique<simple_wml::document>(wml.c_str(), simple_wml::INIT_STATIC);
+	doc->compress();
 
-	utils::visit([this, &doc](auto&& sock) { async_send_doc_queued(sock, doc); }, req.sock);
+	utils::visit([this, &doc](auto&& sock) { async_send_doc_queued(sock, *doc); }, req.sock);
+
+	if(cacheable) {
+		campaign_list_cache_ = std::move(doc);
+	}
 }
 
 void server::handle_request_campaign(const server::request& req)
@@ -1120,7 +1156,36 @@ void server::handle_request_campaign(const server::request& req)
 			force_use_full = true;
 		}
 
-		for(auto iter = start_point; !force_use_full && std::distance(iter, end_point) > 1;) {
+		// A single-step update -- the common case of a client tracking the
+		// latest version -- needs no merging at all. The matching update pack
+		// on disk already holds the exact gzipped WML payload the client
+		// expects, so stream it like a full pack instead of decompressing and
+		// recompressing it for every downloader.
+		if(!force_use_full && std::distance(start_point, end_point) == 2) {
+			for(const config& pack : addon->child_range("update_pack")) {
+				if(pack["from"].str() != from || pack["to"].str() != to) {
+					continue;
+				}
+
+				const auto& update_pack_path = addon["filename"].str() + '/' + pack["filename"].str();
+				const int pack_size = filesystem::file_size(update_pack_path);
+
+				// No point in sending an overlarge delta update.
+				if(pack_size > 0 && !(pack_size > full_pack_size && full_pack_size > 0)) {
+					LOG_CS << req << "Sending add-on '" << name << "' version: " << from << " -> " << to << " (delta)";
+
+					utils::visit([this, &req, &update_pack_path](auto&& sock) {
+						coro_send_file(sock, update_pack_path, req.yield);
+					}, req.sock);
+
+					full_pack_path.clear();
+				}
+
+				break;
+			}
+		}
+
+		for(auto iter = start_point; !force_use_full && !full_pack_path.empty() && std::distance(iter, end_point) > 1;) {
 			const auto& prev_version_cfg = iter->second;
 			const auto& next_version_cfg = (++iter)->second;
 
@@ -1158,7 +1223,7 @@ void server::handle_request_campaign(const server::request& req)
 			}
 		}
 
-		if(!force_use_full && !delta.empty()) {
+		if(!force_use_full && !full_pack_path.empty() && !delta.empty()) {
 			std::ostringstream ostr;
 			write(ostr, delta);
 			const auto& wml_text = ostr.str();
@@ -109,6 +109,15 @@ private:
 	/**The set of unique addon names with pending metadata updates*/
 	std::unordered_set<std::string> dirty_addons_;
 
+	/**
+	 * Pre-compressed response for filterless [request_campaign_list] requests.
+	 *
+	 * Those identical requests vastly outnumber everything else this server
+	 * handles, yet each one serialized and gzipped the whole add-ons list
+	 * from scratch. Reset whenever any add-on metadata changes.
+	 */
+	std::unique_ptr<simple_wml::document> campaign_list_cache_;
+
 	/**Server config*/
 	config cfg_;
 	const std::string cfg_file_;
@@ -185,6 +194,7 @@ private:
 	void mark_dirty(const std::string& addon)
 	{
 		dirty_addons_.emplace(addon);
+		campaign_list_cache_.reset();
 	}
 
 	/**
@@ -39,6 +39,7 @@ namespace {
 
 fuh::fuh(const config& c)
 	: conn_(c)
+	, write_conn_(c)
 	, db_users_table_(c["db_users_table"].str())
 	, db_extra_table_(c["db_extra_table"].str())
 	, mp_mod_group_(0)
@@ -50,6 +51,13 @@ fuh::fuh(const config& c)
 	}
 }
 
+fuh::~fuh() {
+	// Wait for queued stat writes instead of letting the pool's destructor
+	// abandon them, so a game that ends right before a shutdown still makes
+	// it into the database.
+	db_write_pool_.join();
+}
+
 bool fuh::login(const std::string& name, const std::string& password) {
 	// Retrieve users' password as hash
 	try {
@@ -99,7 +107,10 @@ std::string fuh::extract_salt(const std::string& name) {
 }
 
 void fuh::user_logged_in(const std::string& name) {
-	conn_.write_user_int("user_lastvisit", name, static_cast<int>(std::time(nullptr)));
+	const int now = static_cast<int>(std::time(nullptr));
+	boost::asio::post(db_write_pool_, [this, name, now] {
+		write_conn_.write_user_int("user_lastvisit", name, now);
+	});
 }
 
 bool fuh::user_exists(const std::string& name) {
@@ -216,23 +227,35 @@ void fuh::async_get_and_send_game_history(boost::asio::io_service& io_service, w
 }
 
 void fuh::db_insert_game_info(const std::string& uuid, int game_id, const std::string& version, const std::string& name, int reload, int observers, int is_public, int has_password){
-	conn_.insert_game_info(uuid, game_id, version, name, reload, observers, is_public, has_password);
+	boost::asio::post(db_write_pool_, [this, uuid, game_id, version, name, reload, observers, is_public, has_password] {
+		write_conn_.insert_game_info(uuid, game_id, version, name, reload, observers, is_public, has_password);
+	});
 }
 
 void fuh::db_update_game_end(const std::string& uuid, int game_id, const std::string& replay_location){
-	conn_.update_game_end(uuid, game_id, replay_location);
+	boost::asio::post(db_write_pool_, [this, uuid, game_id, replay_location] {
+		write_conn_.update_game_end(uuid, game_id, replay_location);
+	});
 }
 
 void fuh::db_insert_game_player_info(const std::string& uuid, int game_id, const std::string& username, int side_number, int is_host, const std::string& faction, const std::string& version, const std::string& source, const std::string& current_user){
-	conn_.insert_game_player_info(uuid, game_id, username, side_number, is_host, faction, version, source, current_user);
+	boost::asio::post(db_write_pool_, [this, uuid, game_id, username, side_number, is_host, faction, version, source, current_user] {
+		write_conn_.insert_game_player_info(uuid, game_id, username, side_number, is_host, faction, version, source, current_user);
+	});
 }
 
-unsigned long long fuh::db_insert_game_content_info(const std::string& uuid, int game_id, const std::string& type, const std::string& name, const std::string& id, const std::string& addon_id, const std::string& addon_version){
-	return conn_.insert_game_content_info(uuid, game_id, type, name, id, addon_id, addon_version);
+void fuh::db_insert_game_content_info(const std::string& uuid, int game_id, const std::string& type, const std::string& name, const std::string& id, const std::string& addon_id, const std::string& addon_version){
+	boost::asio::post(db_write_pool_, [this, uuid, game_id, type, name, id, addon_id, addon_version] {
+		if(write_conn_.insert_game_content_info(uuid, game_id, type, name, id, addon_id, addon_version) == 0) {
+			WRN_UH << "Did not insert content row for game content with uuid '" << uuid << "', game ID '" << game_id << "', type '" << type << "', and content ID '" << id << "'";
+		}
+	});
 }
 
 void fuh::db_set_oos_flag(const std::string& uuid, int game_id){
-	conn_.set_oos_flag(uuid, game_id);
+	boost::asio::post(db_write_pool_, [this, uuid, game_id] {
+		write_conn_.set_oos_flag(uuid, game_id);
+	});
 }
 
 void fuh::async_test_query(boost::asio::io_service& io_service, int limit) {
@@ -256,7 +279,9 @@ unsigned long long fuh::db_insert_login(const std::string& username, const std::
 }
 
 void fuh::db_update_logout(unsigned long long login_id) {
-	conn_.update_logout(login_id);
+	boost::asio::post(db_write_pool_, [this, login_id] {
+		write_conn_.update_logout(login_id);
+	});
 }
 
 void fuh::get_users_for_ip(const std::string& ip, std::ostringstream* out) {
@@ -18,6 +18,8 @@
 #include "server/common/user_handler.hpp"
 #include "server/common/dbconn.hpp"
 
+#include <boost/asio/thread_pool.hpp>
+
 #include <vector>
 #include <memory>
 #include <ctime>
@@ -33,6 +35,9 @@ public:
 	 */
 	fuh(const config& c);
 
+	/** Waits for any queued stat writes to reach the database. */
+	~fuh();
+
 	/**
 	 * Retrieves the player's hashed password from the phpbb forum database and checks if it matches the hashed password sent by the client.
 	 *
@@ -180,9 +185,8 @@ public:
 	 * @param id The id of the content.
 	 * @param addon_id The id of the addon that the content is from.
 	 * @param addon_version The version of the add-on.
-	 * @return The number of rows inserted which should always be 1.
 	 */
-	unsigned long long db_insert_game_content_info(const std::string& uuid, int game_id, const std::string& type, const std::string& name, const std::string& id, const std::string& addon_id, const std::string& addon_version);
+	void db_insert_game_content_info(const std::string& uuid, int game_id, const std::string& type, const std::string& name, const std::string& id, const std::string& addon_id, const std::string& addon_version);
 
 	/**
 	 * Sets the OOS flag in the database if wesnothd is told by a client it has detected an OOS error.
@@ -323,6 +327,19 @@ public:
 private:
 	/** An instance of the class responsible for executing the queries and handling the database connection. */
 	dbconn conn_;
+	/**
+	 * Connection used exclusively by the thread of @ref db_write_pool_, so
+	 * the queued writes never race the synchronous queries that keep running
+	 * through @ref conn_ on the io thread.
+	 */
+	dbconn write_conn_;
+	/**
+	 * Runs the fire-and-forget stat writes so a database hiccup no longer
+	 * stalls every connection on the io thread. A single thread executes the
+	 * writes in submission order, which matters because the insert of a
+	 * game's info row has to reach the database before its game-end update.
+	 */
+	boost::asio::thread_pool db_write_pool_{1};
 	/** The name of the phpbb users table */
 	std::string db_users_table_;
 	/** The name of the extras custom table, not part of a phpbb database */
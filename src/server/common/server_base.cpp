@@ -37,18 +37,22 @@
 #endif
 
 #include <boost/asio/ip/v6_only.hpp>
+#include <boost/asio/post.hpp>
 #include <boost/asio/read.hpp>
+#include <boost/asio/steady_timer.hpp>
 #ifndef _WIN32
 #include <boost/asio/read_until.hpp>
 #endif
 #include <boost/asio/write.hpp>
 
 #include <array>
+#include <chrono>
 #include <ctime>
 #include <functional>
 #include <queue>
 #include <sstream>
 #include <string>
+#include <type_traits>
 #include <iostream>
 
 
@@ -310,7 +314,11 @@ template<class SocketPtr> void server_base::coro_send_doc(SocketPtr socket, simp
 	}
 
 	try {
+		const auto compress_started = std::chrono::steady_clock::now();
 		simple_wml::string_span s = doc.output_compressed();
+		compress_time_us_ += std::chrono::duration_cast<std::chrono::microseconds>(
+			std::chrono::steady_clock::now() - compress_started).count();
+		++compress_calls_;
 
 		union DataSize
 		{
@@ -515,7 +523,7 @@ void server_base::coro_send_file(socket_ptr socket, const std::string& filename,
 
 #endif
 
-template<class SocketPtr> std::unique_ptr<simple_wml::document> server_base::coro_receive_doc(SocketPtr socket, boost::asio::yield_context yield)
+template<class SocketPtr> std::unique_ptr<simple_wml::document> server_base::coro_receive_doc(SocketPtr socket, boost::asio::yield_context yield, receive_limits* limits)
 {
 	union DataSize
 	{
@@ -540,13 +548,73 @@ template<class SocketPtr> std::unique_ptr<simple_wml::document> server_base::cor
 		return {};
 	}
 
+	if(limits) {
+		// Charge one message and the wire size before anything is read or
+		// decompressed; parse debt left behind by the previous document is
+		// settled here too. A connection so deep in debt that it would
+		// have to stall past the limit is cut instead.
+		const double delay = std::max({
+			limits->messages.consume(1),
+			limits->bytes.consume(size),
+			limits->parse.consume(0)});
+
+		if(delay > receive_limits::max_delay) {
+			ERR_SERVER <<
+				log_address(socket) <<
+				"\tdisconnecting: receive budget exhausted (would need a " << delay << "s stall)";
+			return {};
+		}
+
+		if(delay > 0) {
+			boost::asio::steady_timer timer(io_service_);
+			timer.expires_after(std::chrono::microseconds(static_cast<long>(delay * 1e6)));
+			timer.async_wait(yield[ec]);
+		}
+	}
+
 	boost::shared_array<char> buffer{ new char[size] };
 	async_read(*socket, boost::asio::buffer(buffer.get(), size), yield[ec]);
 	if(check_error(ec, socket)) return {};
 
+	/*
+	 * The zlib pass is the expensive part of receiving a document, so run
+	 * it on the worker pool; anything shared (sockets, player state, the
+	 * document accounting) is only touched after hopping back onto the
+	 * io thread, which is also where the buffer is parsed.
+	 */
+	const simple_wml::string_span compressed_buf(buffer.get(), size);
+	char* uncompressed = nullptr;
+	simple_wml::string_span uncompressed_span;
+	std::string uncompress_error;
+
+	boost::asio::post(worker_pool_, yield);
+	const auto uncompress_started = std::chrono::steady_clock::now();
+	try {
+		uncompressed = simple_wml::uncompress_buffer(compressed_buf, &uncompressed_span);
+	} catch (simple_wml::error& e) {
+		uncompress_error = e.message;
+	}
+	uncompress_time_us_ += std::chrono::duration_cast<std::chrono::microseconds>(
+		std::chrono::steady_clock::now() - uncompress_started).count();
+	++uncompress_calls_;
+	boost::asio::post(io_service_, yield);
+
+	if(uncompressed == nullptr) {
+		ERR_SERVER <<
+			log_address(socket) <<
+			"\tsimple_wml error in received data: " << uncompress_error;
+		async_send_error(socket, "Invalid WML received: " + uncompress_error);
+		return {};
+	}
+
+	if(limits) {
+		// The parse and document accounting cost scales with the
+		// uncompressed size, so that is what the parse bucket tracks.
+		limits->parse.consume(uncompressed_span.size());
+	}
+
 	try {
-		simple_wml::string_span compressed_buf(buffer.get(), size);
-		return std::make_unique<simple_wml::document>(compressed_buf);
+		return std::make_unique<simple_wml::document>(uncompressed, simple_wml::INIT_TAKE_OWNERSHIP);
 	}  catch (simple_wml::error& e) {
 		ERR_SERVER <<
 			log_address(socket) <<
@@ -555,23 +623,64 @@ template<class SocketPtr> std::unique_ptr<simple_wml::document> server_base::cor
 		return {};
 	}
 }
-template std::unique_ptr<simple_wml::document> server_base::coro_receive_doc<socket_ptr>(socket_ptr socket, boost::asio::yield_context yield);
-template std::unique_ptr<simple_wml::document> server_base::coro_receive_doc<tls_socket_ptr>(tls_socket_ptr socket, boost::asio::yield_context yield);
+template std::unique_ptr<simple_wml::document> server_base::coro_receive_doc<socket_ptr>(socket_ptr socket, boost::asio::yield_context yield, receive_limits* limits);
+template std::unique_ptr<simple_wml::document> server_base::coro_receive_doc<tls_socket_ptr>(tls_socket_ptr socket, boost::asio::yield_context yield, receive_limits* limits);
+
+template<> std::map<socket_ptr, std::queue<std::unique_ptr<simple_wml::document>>>& server_base::send_queues<socket_ptr>()
+{
+	return send_queues_;
+}
+
+template<> std::map<tls_socket_ptr, std::queue<std::unique_ptr<simple_wml::document>>>& server_base::send_queues<tls_socket_ptr>()
+{
+	return tls_send_queues_;
+}
+
+std::size_t server_base::send_queue_depth(const any_socket_ptr& socket)
+{
+	return utils::visit([this](const auto& s) -> std::size_t {
+		const auto& queues = send_queues<std::decay_t<decltype(s)>>();
+		const auto iter = queues.find(s);
+		return iter != queues.end() ? iter->second.size() : 0;
+	}, socket);
+}
+
+namespace {
+
+/**
+ * How many documents may pile up for one connection before it is
+ * considered a lost cause. Queued documents reference shared compressed
+ * frames so the backlog itself is cheap; the cap is about cutting
+ * consumers that are not draining at all, since dropping individual
+ * documents would desync them.
+ */
+constexpr std::size_t max_send_queue_depth = 2048;
+
+} // namespace
 
 template<class SocketPtr> void server_base::send_doc_queued(SocketPtr socket, std::unique_ptr<simple_wml::document>& doc_ptr, boost::asio::yield_context yield)
 {
-	static std::map<SocketPtr, std::queue<std::unique_ptr<simple_wml::document>>> queues;
+	auto& queues = send_queues<SocketPtr>();
+
+	if(queues[socket].size() >= max_send_queue_depth) {
+		// Closing the socket makes the draining coroutine's sends fail,
+		// which unwinds the whole queue and the receive loop with it.
+		ERR_SERVER << log_address(socket) << "\tdisconnecting: send queue backed up with "
+				   << queues[socket].size() << " pending documents";
+		socket->lowest_layer().close();
+		return;
+	}
 
 	queues[socket].push(std::move(doc_ptr));
 	if(queues[socket].size() > 1) {
 		return;
 	}
 
-	ON_SCOPE_EXIT(socket) { queues.erase(socket); };
+	ON_SCOPE_EXIT(&queues, socket) { queues.erase(socket); };
 
 	while(queues[socket].size() > 0) {
 		coro_send_doc(socket, *(queues[socket].front()), yield);
-		ON_SCOPE_EXIT(socket) { queues[socket].pop(); };
+		ON_SCOPE_EXIT(&queues, socket) { queues[socket].pop(); };
 	}
 }
 
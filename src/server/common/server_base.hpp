@@ -39,8 +39,16 @@
 #include <boost/asio/streambuf.hpp>
 #include <boost/asio/ssl.hpp>
 #include <boost/asio/spawn.hpp>
+#include <boost/asio/thread_pool.hpp>
 #include <boost/shared_array.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <queue>
+#include <thread>
+
 #include <map>
 
 extern bool dump_wml;
@@ -57,6 +65,63 @@ struct server_shutdown : public game::error
 	server_shutdown(const std::string& msg, boost::system::error_code ec = {}) : game::error(msg), ec(ec) {}
 };
 
+/**
+ * A token bucket for rate limiting a connection.
+ *
+ * Tokens accrue at @a rate per second up to @a burst. Consuming is allowed
+ * to drive the balance negative; the caller learns how long the connection
+ * has to stay idle before the balance is level again and can suspend its
+ * read loop for that long.
+ */
+class token_bucket
+{
+public:
+	token_bucket(double rate, double burst)
+		: rate_(rate)
+		, burst_(burst)
+		, tokens_(burst)
+		, last_refill_(std::chrono::steady_clock::now())
+	{
+	}
+
+	/**
+	 * Takes @a cost tokens out of the bucket.
+	 * @return how many seconds the caller should stall before consuming more.
+	 */
+	double consume(double cost)
+	{
+		const auto now = std::chrono::steady_clock::now();
+		tokens_ = std::min(burst_, tokens_ + rate_ * std::chrono::duration<double>(now - last_refill_).count());
+		last_refill_ = now;
+		tokens_ -= cost;
+		return tokens_ < 0 ? -tokens_ / rate_ : 0;
+	}
+
+private:
+	double rate_;
+	double burst_;
+	double tokens_;
+	std::chrono::steady_clock::time_point last_refill_;
+};
+
+/**
+ * The receive budgets of one connection, owned by its handler coroutine.
+ *
+ * The message and wire byte buckets are charged as soon as a payload
+ * header arrives, before anything is decompressed; the parse bucket is
+ * charged with the uncompressed size afterwards, so oversized documents
+ * take their toll on the next read.
+ */
+struct receive_limits
+{
+	token_bucket messages;
+	token_bucket bytes;
+	token_bucket parse;
+
+	/** A connection that would need to stall longer than this is dropped. */
+	static constexpr double max_delay = 30.0;
+};
+
 /**
  * Base class for implementing servers that use gzipped-WML network protocol
  *
@@ -104,9 +169,10 @@ public:
 	 * Receive WML document from a coroutine
 	 * @param socket
 	 * @param yield The function will suspend on read operation using this yield context
+	 * @param limits Optional receive budgets; exceeding them stalls the read, exhausting them drops the connection
 	 * @return unique_ptr with doc deceived. In case of error empty unique_ptr
 	 */
-	template<class SocketPtr> std::unique_ptr<simple_wml::document> coro_receive_doc(SocketPtr socket, boost::asio::yield_context yield);
+	template<class SocketPtr> std::unique_ptr<simple_wml::document> coro_receive_doc(SocketPtr socket, boost::asio::yield_context yield, receive_limits* limits = nullptr);
 
 	/**
 	 * High level wrapper for sending a WML document
@@ -147,10 +213,47 @@ public:
 	 */
 	std::string hash_password(const std::string& pw, const std::string& salt, const std::string& username);
 
+	/**
+	 * How many queued documents are waiting to be sent on a socket.
+	 * Stats surfaces use this to spot connections that cannot keep up
+	 * with what is being relayed to them.
+	 */
+	std::size_t send_queue_depth(const any_socket_ptr& socket);
+
 protected:
 	unsigned short port_;
 	bool keep_alive_;
 	boost::asio::io_service io_service_;
+
+	/**
+	 * Worker threads for the zlib passes of the WML protocol.
+	 *
+	 * All game and lobby state is only ever touched from the io_service_
+	 * thread; coroutines hop onto this pool for the pure compression and
+	 * decompression calls and hop back before touching anything shared,
+	 * so one player's big payload no longer stalls every other
+	 * connection. A full io_context-per-core design would need the whole
+	 * handler state (player lists, games, simple_wml's document
+	 * accounting) made thread-safe first.
+	 */
+	boost::asio::thread_pool worker_pool_ { std::max(1u, std::thread::hardware_concurrency()) };
+
+	/**
+	 * Wall time spent in the zlib passes of the WML protocol, for the
+	 * stats surfaces of derived servers. Updated from the worker pool,
+	 * hence atomic.
+	 */
+	std::atomic<uint64_t> compress_calls_ {0};
+	std::atomic<uint64_t> compress_time_us_ {0};
+	std::atomic<uint64_t> uncompress_calls_ {0};
+	std::atomic<uint64_t> uncompress_time_us_ {0};
+
+	/** The pending outgoing documents of every connection, per socket type. */
+	template<class SocketPtr> std::map<SocketPtr, std::queue<std::unique_ptr<simple_wml::document>>>& send_queues();
+
+	std::map<socket_ptr, std::queue<std::unique_ptr<simple_wml::document>>> send_queues_;
+	std::map<tls_socket_ptr, std::queue<std::unique_ptr<simple_wml::document>>> tls_send_queues_;
+
 	boost::asio::ssl::context tls_context_ { boost::asio::ssl::context::sslv23 };
 	bool tls_enabled_ { false };
 	boost::asio::ip::tcp::acceptor acceptor_v6_;
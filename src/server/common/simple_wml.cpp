@@ -13,6 +13,8 @@
 	See the COPYING file for more details.
 */
 
+#include <algorithm>
+#include <new>
 #include <sstream>
 
 #include <boost/iostreams/copy.hpp>
@@ -36,10 +38,26 @@ std::size_t document::document_size_limit = 40000000;
 
 namespace {
 
+//nodes are placement-constructed in their document's arena, so tearing
+//one down runs the destructor only; the memory is reclaimed with the
+//document.
 void debug_delete(node* n) {
-	delete n;
+	if(n != nullptr) {
+		n->~node();
+	}
+}
+
+//granularity of the per-document arenas. Anything larger than a chunk
+//gets a dedicated buffer of its own.
+const std::size_t arena_chunk_size = 4096;
+
+std::size_t arena_align(std::size_t size)
+{
+	return (size + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
 }
 
+}  // namespace
+
 char* uncompress_buffer(const string_span& input, string_span* span)
 {
 	int nalloc = input.size();
@@ -49,7 +67,9 @@ char* uncompress_buffer(const string_span& input, string_span* span)
 		state = 1;
 		boost::iostreams::filtering_stream<boost::iostreams::input> filter;
 		state = 2;
-		if (!span->empty() && *span->begin() == 'B') {
+		//pick the decompressor from the payload's own magic bytes; the
+		//output span is still empty at this point.
+		if (input.size() >= 3 && input.begin()[0] == 'B' && input.begin()[1] == 'Z' && input.begin()[2] == 'h') {
 			filter.push(boost::iostreams::bzip2_decompressor());
 		} else {
 			filter.push(boost::iostreams::gzip_decompressor());
@@ -101,6 +121,8 @@ char* uncompress_buffer(const string_span& input, string_span* span)
 	}
 }
 
+namespace {
+
 char* compress_buffer(const char* input, string_span* span, bool bzip2)
 {
 	int nalloc = strlen(input);
@@ -115,7 +137,10 @@ char* compress_buffer(const char* input, string_span* span, bool bzip2)
 		if (bzip2) {
 			filter.push(boost::iostreams::bzip2_compressor());
 		} else {
-			filter.push(boost::iostreams::gzip_compressor());
+			//interactive relay traffic: favour compression speed over
+			//ratio, the documents are small and sent once per broadcast.
+			filter.push(boost::iostreams::gzip_compressor(
+				boost::iostreams::gzip_params(boost::iostreams::zlib::best_speed)));
 		}
 		state = 4;
 		nalloc = in.size()*2 + 80;
@@ -259,7 +284,7 @@ node::node(document& doc, node* parent, const char** str, int depth) :
 
 			s = end + 1;
 
-			children_[list_index].second.push_back(new node(doc, this, str, depth+1));
+			children_[list_index].second.push_back(doc.create_node(this, str, depth+1));
 			ordered_children_.emplace_back(list_index, children_[list_index].second.size() - 1);
 			check_ordered_children();
 
@@ -433,9 +458,7 @@ node& node::set_attr_dup(const char* key, const char* value)
 
 node& node::set_attr_dup(const char* key, const string_span& value)
 {
-	char* buf = value.duplicate();
-	doc_->take_ownership_of_buffer(buf);
-	return set_attr(key, buf);
+	return set_attr(key, doc_->dup_string(value));
 }
 
 node& node::set_attr_int(const char* key, int value)
@@ -455,7 +478,7 @@ node& node::add_child_at(const char* name, std::size_t index)
 	}
 
 	check_ordered_children();
-	list.insert(list.begin() + index, new node(*doc_, this));
+	list.insert(list.begin() + index, doc_->create_node(this));
 	insert_ordered_child(list_index, index);
 
 	check_ordered_children();
@@ -470,7 +493,7 @@ node& node::add_child(const char* name)
 	const int list_index = get_children(name);
 	check_ordered_children();
 	child_list& list = children_[list_index].second;
-	list.push_back(new node(*doc_, this));
+	list.push_back(doc_->create_node(this));
 	ordered_children_.emplace_back(list_index, list.size() - 1);
 	check_ordered_children();
 	return *list.back();
@@ -808,19 +831,14 @@ void node::copy_into(node& n) const
 {
 	n.set_dirty();
 	for(attribute_list::const_iterator i = attr_.begin(); i != attr_.end(); ++i) {
-		char* key = i->key.duplicate();
-		char* value = i->value.duplicate();
-		n.doc_->take_ownership_of_buffer(key);
-		n.doc_->take_ownership_of_buffer(value);
-		n.set_attr(key, value);
+		n.set_attr(n.doc_->dup_string(i->key), n.doc_->dup_string(i->value));
 	}
 
 	for(std::vector<node_pos>::const_iterator i = ordered_children_.begin();
 	    i != ordered_children_.end(); ++i) {
 		assert(i->child_map_index < children_.size());
 		assert(i->child_list_index < children_[i->child_map_index].second.size());
-		char* buf = children_[i->child_map_index].first.duplicate();
-		n.doc_->take_ownership_of_buffer(buf);
+		const char* buf = n.doc_->dup_string(children_[i->child_map_index].first);
 		children_[i->child_map_index].second[i->child_list_index]->copy_into(n.add_child(buf));
 	}
 }
@@ -831,11 +849,7 @@ void node::apply_diff(const node& diff)
 	const node* inserts = diff.child("insert");
 	if(inserts != nullptr) {
 		for(attribute_list::const_iterator i = inserts->attr_.begin(); i != inserts->attr_.end(); ++i) {
-			char* name = i->key.duplicate();
-			char* value = i->value.duplicate();
-			set_attr(name, value);
-			doc_->take_ownership_of_buffer(name);
-			doc_->take_ownership_of_buffer(value);
+			set_attr(doc_->dup_string(i->key), doc_->dup_string(i->value));
 		}
 	}
 
@@ -872,9 +886,7 @@ void node::apply_diff(const node& diff)
 		for(child_map::const_iterator j = (*i)->children_.begin(); j != (*i)->children_.end(); ++j) {
 			const string_span& name = j->first;
 			for(child_list::const_iterator k = j->second.begin(); k != j->second.end(); ++k) {
-				char* buf = name.duplicate();
-				doc_->take_ownership_of_buffer(buf);
-				(*k)->copy_into(add_child_at(buf, index));
+				(*k)->copy_into(add_child_at(doc_->dup_string(name), index));
 			}
 		}
 	}
@@ -938,9 +950,15 @@ void node::set_dirty()
 
 document::document() :
 	compressed_buf_(),
+	shared_compressed_storage_(),
 	output_(nullptr),
 	buffers_(),
-	root_(new node(*this, nullptr)),
+	string_arena_ptr_(nullptr),
+	string_arena_space_(0),
+	node_chunks_(),
+	node_arena_ptr_(nullptr),
+	node_arena_space_(0),
+	root_(create_node(nullptr)),
 	prev_(nullptr),
 	next_(nullptr)
 {
@@ -949,8 +967,14 @@ document::document() :
 
 document::document(char* buf, INIT_BUFFER_CONTROL control) :
 	compressed_buf_(),
+	shared_compressed_storage_(),
 	output_(buf),
 	buffers_(),
+	string_arena_ptr_(nullptr),
+	string_arena_space_(0),
+	node_chunks_(),
+	node_arena_ptr_(nullptr),
+	node_arena_space_(0),
 	root_(nullptr),
 	prev_(nullptr),
 	next_(nullptr)
@@ -959,15 +983,31 @@ document::document(char* buf, INIT_BUFFER_CONTROL control) :
 		buffers_.push_back(buf);
 	}
 	const char* cbuf = buf;
-	root_ = new node(*this, nullptr, &cbuf);
+	try {
+		root_ = create_node(nullptr, &cbuf);
+	} catch(...) {
+		ERR_SWML << "Caught exception creating a new simple_wml node: " << utils::get_unknown_exception_type();
+		for(char* buffer : buffers_) {
+			delete [] buffer;
+		}
+		buffers_.clear();
+		release_node_arena();
+		throw;
+	}
 
 	attach_list();
 }
 
 document::document(const char* buf, INIT_STATE state) :
 	compressed_buf_(),
+	shared_compressed_storage_(),
 	output_(buf),
 	buffers_(),
+	string_arena_ptr_(nullptr),
+	string_arena_space_(0),
+	node_chunks_(),
+	node_arena_ptr_(nullptr),
+	node_arena_space_(0),
 	root_(nullptr),
 	prev_(nullptr),
 	next_(nullptr)
@@ -976,7 +1016,7 @@ document::document(const char* buf, INIT_STATE state) :
 		output_compressed();
 		output_ = nullptr;
 	} else {
-		root_ = new node(*this, nullptr, &buf);
+		root_ = create_node(nullptr, &buf);
 	}
 
 	attach_list();
@@ -984,8 +1024,14 @@ document::document(const char* buf, INIT_STATE state) :
 
 document::document(string_span compressed_buf) :
 	compressed_buf_(compressed_buf),
+	shared_compressed_storage_(),
 	output_(nullptr),
 	buffers_(),
+	string_arena_ptr_(nullptr),
+	string_arena_space_(0),
+	node_chunks_(),
+	node_arena_ptr_(nullptr),
+	node_arena_space_(0),
 	root_(nullptr),
 	prev_(nullptr),
 	next_(nullptr)
@@ -995,17 +1041,35 @@ document::document(string_span compressed_buf) :
 	output_ = uncompressed_buf.begin();
 	const char* cbuf = output_;
 	try {
-		root_ = new node(*this, nullptr, &cbuf);
+		root_ = create_node(nullptr, &cbuf);
 	} catch(...) {
 		ERR_SWML << "Caught exception creating a new simple_wml node: " << utils::get_unknown_exception_type();
 		delete [] buffers_.front();
 		buffers_.clear();
+		release_node_arena();
 		throw;
 	}
 
 	attach_list();
 }
 
+document::document(const string_span& compressed_buf, const std::shared_ptr<char>& storage) :
+	compressed_buf_(compressed_buf),
+	shared_compressed_storage_(storage),
+	output_(nullptr),
+	buffers_(),
+	string_arena_ptr_(nullptr),
+	string_arena_space_(0),
+	node_chunks_(),
+	node_arena_ptr_(nullptr),
+	node_arena_space_(0),
+	root_(nullptr),
+	prev_(nullptr),
+	next_(nullptr)
+{
+	attach_list();
+}
+
 document::~document()
 {
 	for(std::vector<char*>::iterator i = buffers_.begin(); i != buffers_.end(); ++i) {
@@ -1014,6 +1078,7 @@ document::~document()
 
 	buffers_.clear();
 	debug_delete(root_);
+	release_node_arena();
 
 	detach_list();
 }
@@ -1021,12 +1086,77 @@ document::~document()
 const char* document::dup_string(const char* str)
 {
 	const int len = strlen(str);
-	char* res = new char[len+1];
+	char* res = allocate_string(len + 1);
 	memcpy(res, str, len + 1);
-	buffers_.push_back(res);
 	return res;
 }
 
+const char* document::dup_string(const string_span& str)
+{
+	char* res = allocate_string(str.size() + 1);
+	memcpy(res, str.begin(), str.size());
+	res[str.size()] = 0;
+	return res;
+}
+
+char* document::allocate_string(std::size_t size)
+{
+	size = arena_align(size);
+	if(size > arena_chunk_size) {
+		char* buf = new char[size];
+		buffers_.push_back(buf);
+		return buf;
+	}
+
+	if(size > string_arena_space_) {
+		string_arena_ptr_ = new char[arena_chunk_size];
+		buffers_.push_back(string_arena_ptr_);
+		string_arena_space_ = arena_chunk_size;
+	}
+
+	char* res = string_arena_ptr_;
+	string_arena_ptr_ += size;
+	string_arena_space_ -= size;
+	return res;
+}
+
+node* document::create_node(node* parent)
+{
+	return new(allocate_node()) node(*this, parent);
+}
+
+node* document::create_node(node* parent, const char** str, int depth)
+{
+	return new(allocate_node()) node(*this, parent, str, depth);
+}
+
+char* document::allocate_node()
+{
+	const std::size_t size = arena_align(sizeof(node));
+	static_assert(sizeof(node) <= arena_chunk_size, "node does not fit in an arena chunk");
+	if(size > node_arena_space_) {
+		node_chunks_.push_back(new char[arena_chunk_size]);
+		node_arena_ptr_ = node_chunks_.back();
+		node_arena_space_ = arena_chunk_size;
+	}
+
+	char* res = node_arena_ptr_;
+	node_arena_ptr_ += size;
+	node_arena_space_ -= size;
+	return res;
+}
+
+void document::release_node_arena()
+{
+	for(char* chunk : node_chunks_) {
+		delete [] chunk;
+	}
+
+	node_chunks_.clear();
+	node_arena_ptr_ = nullptr;
+	node_arena_space_ = 0;
+}
+
 const char* document::output()
 {
 	if(output_ && (!root_ || root_->is_dirty() == false)) {
@@ -1041,11 +1171,18 @@ const char* document::output()
 	}
 
 	//we're dirty, so the compressed buf must also be dirty; clear it.
+	//clones keep the old bytes alive through their own storage handles.
 	compressed_buf_ = string_span();
+	shared_compressed_storage_.reset();
 
 	std::vector<char*> bufs;
 	bufs.swap(buffers_);
 
+	//the string arena chunks left with bufs; after REFRESH_CACHE below
+	//every span points into the new output buffer, so they can go.
+	string_arena_ptr_ = nullptr;
+	string_arena_space_ = 0;
+
 	const int buf_size = root_->output_size() + 1;
 	char* buf;
 	try {
@@ -1090,6 +1227,7 @@ void document::compress()
 	output_compressed();
 	debug_delete(root_);
 	root_ = nullptr;
+	release_node_arena();
 	output_ = nullptr;
 	std::vector<char*> new_buffers;
 	for(std::vector<char*>::iterator i = buffers_.begin(); i != buffers_.end(); ++i) {
@@ -1101,7 +1239,11 @@ void document::compress()
 	}
 
 	buffers_.swap(new_buffers);
-	assert(buffers_.size() == 1);
+	string_arena_ptr_ = nullptr;
+	string_arena_space_ = 0;
+	//the compressed buffer either lives in buffers_ or, after a clone,
+	//in the shared storage handle.
+	assert(buffers_.size() == 1 || shared_compressed_storage_ != nullptr);
 }
 
 void document::generate_root()
@@ -1115,21 +1257,53 @@ void document::generate_root()
 
 	assert(root_ == nullptr);
 	const char* cbuf = output_;
-	root_ = new node(*this, nullptr, &cbuf);
+	root_ = create_node(nullptr, &cbuf);
 }
 
 std::unique_ptr<document> document::clone()
 {
-	char* buf = new char[strlen(output())+1];
-	strcpy(buf, output());
-	return std::make_unique<document>(buf);
+	/*
+	 * A clone is nearly always an identical snapshot handed to a
+	 * recipient's send queue, which only ever asks for the compressed
+	 * bytes. So instead of serializing, copying and reparsing the whole
+	 * tree per clone, compress once and let every clone share one
+	 * immutable compressed buffer; a clone only generates its node tree
+	 * if it is actually inspected or modified.
+	 */
+	output_compressed();
+
+	if(shared_compressed_storage_ == nullptr) {
+		char* buf = const_cast<char*>(compressed_buf_.begin());
+		const auto i = std::find(buffers_.begin(), buffers_.end(), buf);
+		if(i != buffers_.end()) {
+			// Move ownership out of buffers_ into a reference-counted
+			// handle, so clones can safely outlive this document.
+			buffers_.erase(i);
+			shared_compressed_storage_ = std::shared_ptr<char>(buf, std::default_delete<char[]>());
+		} else {
+			// The compressed buffer is owned by someone else (see the
+			// string_span constructor); share a private copy instead.
+			char* copy = new char[compressed_buf_.size()];
+			memcpy(copy, compressed_buf_.begin(), compressed_buf_.size());
+			shared_compressed_storage_ = std::shared_ptr<char>(copy, std::default_delete<char[]>());
+			compressed_buf_ = string_span(copy, compressed_buf_.size());
+		}
+	}
+
+	return std::unique_ptr<document>(new document(compressed_buf_, shared_compressed_storage_));
 }
 
 void document::swap(document& o)
 {
 	std::swap(compressed_buf_, o.compressed_buf_);
+	std::swap(shared_compressed_storage_, o.shared_compressed_storage_);
 	std::swap(output_, o.output_);
 	buffers_.swap(o.buffers_);
+	std::swap(string_arena_ptr_, o.string_arena_ptr_);
+	std::swap(string_arena_space_, o.string_arena_space_);
+	node_chunks_.swap(o.node_chunks_);
+	std::swap(node_arena_ptr_, o.node_arena_ptr_);
+	std::swap(node_arena_space_, o.node_arena_space_);
 	std::swap(root_, o.root_);
 
 	root_->set_doc(this);
@@ -1139,14 +1313,18 @@ void document::swap(document& o)
 void document::clear()
 {
 	compressed_buf_ = string_span();
+	shared_compressed_storage_.reset();
 	output_ = nullptr;
 	debug_delete(root_);
-	root_ = new node(*this, nullptr);
+	release_node_arena();
+	root_ = create_node(nullptr);
 	for(std::vector<char*>::iterator i = buffers_.begin(); i != buffers_.end(); ++i) {
 		delete [] *i;
 	}
 
 	buffers_.clear();
+	string_arena_ptr_ = nullptr;
+	string_arena_space_ = 0;
 }
 
 namespace {
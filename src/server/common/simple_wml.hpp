@@ -228,6 +228,15 @@ private:
 
 std::string node_to_string(const node& n);
 
+/**
+ * Decompresses @a input into a freshly allocated, null-terminated buffer
+ * and points @a span at the text. The caller owns the returned buffer.
+ *
+ * This is a pure function touching no shared state, so servers may run it
+ * on a worker thread and build the document from the result afterwards.
+ */
+char* uncompress_buffer(const string_span& input, string_span* span);
+
 enum INIT_BUFFER_CONTROL { INIT_TAKE_OWNERSHIP };
 
 enum INIT_STATE { INIT_COMPRESSED, INIT_STATIC };
@@ -241,6 +250,23 @@ public:
 	explicit document(string_span compressed_buf);
 	~document();
 	const char* dup_string(const char* str);
+	const char* dup_string(const string_span& str);
+
+	/**
+	 * Allocates @a size writable bytes which live exactly as long as the
+	 * document's other string storage. Small requests are carved out of
+	 * chunked arena buffers instead of hitting the heap individually.
+	 */
+	char* allocate_string(std::size_t size);
+
+	/**
+	 * Constructs a node in the document's node arena. The node is
+	 * destroyed with @ref node's destructor as usual, but its memory is
+	 * only reclaimed together with the document.
+	 */
+	node* create_node(node* parent);
+	node* create_node(node* parent, const char** str, int depth = 0);
+
 	node& root() { if(!root_) { generate_root(); } return *root_; }
 	const node& root() const { if(!root_) { const_cast<document*>(this)->generate_root(); } return *root_; }
 
@@ -294,9 +320,44 @@ private:
 	document(const document&) = delete;
 	document& operator=(const document&) = delete;
 
+	/**
+	 * Constructs a document from a compressed buffer owned by @a storage.
+	 *
+	 * Used by @ref clone so all clones of a document share one immutable
+	 * compressed buffer instead of each reparsing and recompressing the
+	 * whole tree. The node tree is only generated if the clone is
+	 * actually inspected or modified.
+	 */
+	document(const string_span& compressed_buf, const std::shared_ptr<char>& storage);
+
 	string_span compressed_buf_;
+
+	/**
+	 * Keeps the bytes behind @ref compressed_buf_ alive when they are
+	 * shared with clones of this document and therefore cannot live in
+	 * @ref buffers_. Null when the compressed buffer was never shared.
+	 */
+	std::shared_ptr<char> shared_compressed_storage_;
+
 	const char* output_;
 	std::vector<char*> buffers_;
+
+	/**
+	 * Bump cursors of the arenas behind @ref allocate_string and
+	 * @ref create_node. String chunks are owned through @ref buffers_, so
+	 * they are released whenever the string storage as a whole is; node
+	 * chunks live in @ref node_chunks_ since nodes must survive the buffer
+	 * reshuffling done by @ref output.
+	 */
+	char* string_arena_ptr_;
+	std::size_t string_arena_space_;
+	std::vector<char*> node_chunks_;
+	char* node_arena_ptr_;
+	std::size_t node_arena_space_;
+
+	char* allocate_node();
+	void release_node_arena();
+
 	node* root_;
 
 	//linked list of documents for accounting purposes
@@ -96,6 +96,7 @@ game::game(wesnothd::server& server, player_connections& player_connections,
 	, started_(false)
 	, level_()
 	, history_()
+	, history_journal_()
 	, description_(nullptr)
 	, current_turn_(0)
 	, current_side_index_(0)
@@ -1722,29 +1723,38 @@ void game::send_observerquit(player_iterator observer)
 
 void game::send_history(player_iterator player) const
 {
-	if(history_.empty()) {
+	if(history_.empty() && !history_journal_) {
 		return;
 	}
 
-	// we make a new document based on converting to plain text and
-	// concatenating the buffers.
+	// Fold commands recorded since the last join into the journal. This
+	// makes a new document by converting to plain text and concatenating
+	// the buffers, so each command is only decompressed once no matter how
+	// many observers join; with no new commands the cached journal is sent
+	// as-is and the send just shares its compressed buffer.
 	// TODO: Work out how to concentate buffers without decompressing.
-	std::string buf;
-	for(auto& h : history_) {
-		buf += h->output();
-	}
-
-	try {
-		auto doc = std::make_unique<simple_wml::document>(buf.c_str(), simple_wml::INIT_STATIC);
-		doc->compress();
+	if(!history_.empty()) {
+		std::string buf;
+		if(history_journal_) {
+			buf += history_journal_->output();
+		}
+		for(auto& h : history_) {
+			buf += h->output();
+		}
 
-		server.send_to_player(player, *doc);
+		try {
+			auto doc = std::make_unique<simple_wml::document>(buf.c_str(), simple_wml::INIT_STATIC);
+			doc->compress();
 
-		history_.clear();
-		history_.push_back(std::move(doc));
-	} catch(const simple_wml::error& e) {
-		WRN_CONFIG << __func__ << ": simple_wml error: " << e.message;
+			history_journal_ = std::move(doc);
+			history_.clear();
+		} catch(const simple_wml::error& e) {
+			WRN_CONFIG << __func__ << ": simple_wml error: " << e.message;
+			return;
+		}
 	}
+
+	server.send_to_player(player, *history_journal_);
 }
 
 static bool is_invalid_filename_char(char c)
@@ -1779,11 +1789,16 @@ std::string game::get_replay_filename()
 
 void game::save_replay()
 {
-	if(!save_replays_ || !started_ || history_.empty()) {
+	if(!save_replays_ || !started_ || (history_.empty() && !history_journal_)) {
 		return;
 	}
 
 	std::string replay_commands;
+	if(history_journal_) {
+		for(const simple_wml::node* turn : history_journal_->root().children("turn")) {
+			replay_commands += simple_wml::node_to_string(*turn);
+		}
+	}
 	for(const auto& h : history_) {
 		const simple_wml::node::child_list& turn_list = h->root().children("turn");
 
@@ -1792,6 +1807,7 @@ void game::save_replay()
 		}
 	}
 
+	history_journal_.reset();
 	history_.clear();
 
 	std::stringstream replay_data;
@@ -1842,6 +1858,7 @@ void game::record_data(std::unique_ptr<simple_wml::document> data)
 void game::clear_history()
 {
 	history_.clear();
+	history_journal_.reset();
 }
 
 void game::set_description(simple_wml::node* desc)
@@ -856,9 +856,20 @@ private:
 	*/
 	simple_wml::document level_;
 
-	/** Replay data. */
+	/** Replay commands recorded since the journal was last collapsed. */
 	mutable std::vector<std::unique_ptr<simple_wml::document>> history_;
 
+	/**
+	 * Running journal of all replay commands sent so far, kept compressed.
+	 *
+	 * Whenever an observer joins mid-game the pending entries of @ref
+	 * history_ are folded into this document once and the cached result is
+	 * sent; further joiners with no new commands just get another
+	 * reference to the same compressed buffer instead of the server
+	 * rebuilding the whole journal per join.
+	 */
+	mutable std::unique_ptr<simple_wml::document> history_journal_;
+
 	/** Pointer to the game's description in the games_and_users_list_. */
 	simple_wml::node* description_;
 
@@ -32,10 +32,30 @@ struct compare_samples_to_stringspan {
 
 struct compare_samples_by_time {
 	bool operator()(const metrics::sample& a, const metrics::sample& b) const {
-		return a.processing_time < b.processing_time;
+		return a.processing_us < b.processing_us;
 	}
 };
 
+namespace {
+
+/** Escapes a string for use inside a Prometheus label value. */
+std::string prometheus_escape(const std::string& str)
+{
+	std::string result;
+	result.reserve(str.size());
+	for(const char c : str) {
+		switch(c) {
+		case '\\': result += "\\\\"; break;
+		case '"': result += "\\\""; break;
+		case '\n': result += "\\n"; break;
+		default: result += c;
+		}
+	}
+	return result;
+}
+
+}
+
 metrics::metrics()
 	: samples_()
 	, most_consecutive_requests_(0)
@@ -74,8 +94,12 @@ void metrics::no_requests()
 	current_requests_ = 0;
 }
 
-void metrics::record_sample(const simple_wml::string_span& name, clock_t parsing_time, clock_t processing_time)
+void metrics::record_sample(const simple_wml::string_span& name, const std::chrono::microseconds& processing)
 {
+	if(name.empty()) {
+		return;
+	}
+
 	auto isample = std::lower_bound(samples_.begin(), samples_.end(), name,compare_samples_to_stringspan());
 	if(isample == samples_.end() || isample->name != name) {
 		//protect against DoS with memory exhaustion
@@ -91,11 +115,17 @@ void metrics::record_sample(const simple_wml::string_span& name, clock_t parsing
 		isample = samples_.begin() + index;
 	}
 
+	const uint64_t us = processing.count();
+
 	isample->nsamples++;
-	isample->parsing_time += parsing_time;
-	isample->processing_time += processing_time;
-	isample->max_parsing_time = std::max(parsing_time,isample->max_parsing_time);
-	isample->max_processing_time = std::max(processing_time,isample->max_processing_time);
+	isample->processing_us += us;
+	isample->max_processing_us = std::max(us, isample->max_processing_us);
+
+	std::size_t bucket = 0;
+	while(bucket < latency_bucket_bounds_us.size() && us > latency_bucket_bounds_us[bucket]) {
+		++bucket;
+	}
+	isample->latency_counts[bucket]++;
 }
 
 void metrics::game_terminated(const std::string& reason)
@@ -128,19 +158,48 @@ std::ostream& metrics::requests(std::ostream& out) const
 	out << "\nSampled request types:\n";
 
 	std::size_t n = 0;
-	std::size_t pa = 0;
-	std::size_t pr = 0;
+	uint64_t pr = 0;
 	for(const auto& s : ordered_samples) {
-		out << "'" << s.name << "' called " << s.nsamples << " times "
-			<< s.parsing_time << "("<< s.max_parsing_time <<") parsing time, "
-			<< s.processing_time << "("<<s.max_processing_time<<") processing time\n";
+		out << "'" << s.name << "' called " << s.nsamples << " times, "
+			<< s.processing_us / 1000 << " ms processing time (max "
+			<< s.max_processing_us / 1000 << " ms)\n";
 		n += s.nsamples;
-		pa += s.parsing_time;
-		pr += s.processing_time;
+		pr += s.processing_us;
 	}
 	out << "Total number of request samples = " << n << "\n"
-		<< "Total parsing time = " << pa << "\n"
-		<< "Total processing time = " << pr;
+		<< "Total processing time = " << pr / 1000 << " ms";
+
+	return out;
+}
+
+std::ostream& metrics::prometheus(std::ostream& out) const
+{
+	out << "# HELP wesnothd_uptime_seconds Seconds since the server started.\n"
+		<< "# TYPE wesnothd_uptime_seconds gauge\n"
+		<< "wesnothd_uptime_seconds " << (std::time(nullptr) - started_at_) << "\n";
+
+	out << "# HELP wesnothd_request_duration_seconds Request processing time by message type.\n"
+		<< "# TYPE wesnothd_request_duration_seconds histogram\n";
+	for(const auto& s : samples_) {
+		const std::string type = prometheus_escape(s.name.to_string());
+
+		uint64_t cumulative = 0;
+		for(std::size_t b = 0; b != latency_bucket_bounds_us.size(); ++b) {
+			cumulative += s.latency_counts[b];
+			out << "wesnothd_request_duration_seconds_bucket{type=\"" << type
+				<< "\",le=\"" << latency_bucket_bounds_us[b] / 1e6 << "\"} " << cumulative << "\n";
+		}
+		cumulative += s.latency_counts.back();
+		out << "wesnothd_request_duration_seconds_bucket{type=\"" << type << "\",le=\"+Inf\"} " << cumulative << "\n"
+			<< "wesnothd_request_duration_seconds_sum{type=\"" << type << "\"} " << s.processing_us / 1e6 << "\n"
+			<< "wesnothd_request_duration_seconds_count{type=\"" << type << "\"} " << cumulative << "\n";
+	}
+
+	out << "# HELP wesnothd_game_terminations_total Ended games by termination reason.\n"
+		<< "# TYPE wesnothd_game_terminations_total counter\n";
+	for(const auto& t : terminations_) {
+		out << "wesnothd_game_terminations_total{reason=\"" << prometheus_escape(t.first) << "\"} " << t.second << "\n";
+	}
 
 	return out;
 }
@@ -17,10 +17,14 @@
 
 #include "server/common/simple_wml.hpp"
 
+#include <array>
+#include <chrono>
+#include <cstdint>
 #include <ctime>
 #include <iosfwd>
 #include <map>
 #include <string>
+#include <vector>
 
 class metrics
 {
@@ -31,30 +35,42 @@ public:
 	void service_request();
 	void no_requests();
 
-	void record_sample(const simple_wml::string_span& name, clock_t parsing_time, clock_t processing_time);
+	/**
+	 * Records how long one request took to process, keyed by its message
+	 * type. Besides the running totals, each sample feeds a latency
+	 * histogram, so a slowly degrading daemon shows up as a shifting
+	 * distribution rather than just a creeping average.
+	 */
+	void record_sample(const simple_wml::string_span& name, const std::chrono::microseconds& processing);
 
 	void game_terminated(const std::string& reason);
 
 	std::ostream& games(std::ostream& out) const;
 	std::ostream& requests(std::ostream& out) const;
+
+	/**
+	 * Writes uptime, the per-message-type latency histograms and the game
+	 * termination counters in Prometheus text exposition format.
+	 */
+	std::ostream& prometheus(std::ostream& out) const;
+
 	friend std::ostream& operator<<(std::ostream& out, metrics& met);
 
+	/**
+	 * Upper bounds of the latency histogram buckets, in microseconds.
+	 * A final unbounded bucket catches everything beyond the last bound.
+	 */
+	static constexpr std::array<uint64_t, 5> latency_bucket_bounds_us {{1000, 10000, 100000, 1000000, 10000000}};
+
 	struct sample
 	{
-		sample()
-			: name()
-			, nsamples(0)
-			, parsing_time(0)
-			, processing_time(0)
-			, max_parsing_time(0)
-			, max_processing_time(0)
-		{
-		}
-
-		simple_wml::string_span name;
-		int nsamples;
-		clock_t parsing_time, processing_time;
-		clock_t max_parsing_time, max_processing_time;
+		simple_wml::string_span name {};
+		int nsamples = 0;
+		/** Total and peak processing wall time, in microseconds. */
+		uint64_t processing_us = 0;
+		uint64_t max_processing_us = 0;
+		/** Samples per latency bucket; the last slot is the unbounded bucket. */
+		std::array<uint64_t, latency_bucket_bounds_us.size() + 1> latency_counts {};
 
 		operator const simple_wml::string_span&()
 		{
@@ -31,6 +31,7 @@
 #include "serialization/unicode.hpp"
 #include "utils/general.hpp"
 #include "utils/iterable_pair.hpp"
+#include "utils/scope_exit.hpp"
 #include "game_version.hpp"
 
 #include "server/wesnothd/ban.hpp"
@@ -46,10 +47,13 @@
 #endif
 
 #include <boost/algorithm/string.hpp>
+#include <boost/asio/write.hpp>
 #include <boost/scope_exit.hpp>
 
 #include <algorithm>
+#include <array>
 #include <cassert>
+#include <chrono>
 #include <cerrno>
 #include <csignal>
 #include <cstdlib>
@@ -256,6 +260,8 @@ server::server(int port,
 	, login_response_("[mustlogin]\n[/mustlogin]\n", simple_wml::INIT_COMPRESSED)
 	, games_and_users_list_("[gamelist]\n[/gamelist]\n", simple_wml::INIT_STATIC)
 	, metrics_()
+	, metrics_port_(0)
+	, metrics_acceptor_(io_service_)
 	, dump_stats_timer_(io_service_)
 	, tournaments_timer_(io_service_)
 	, cmd_handlers_()
@@ -269,6 +275,7 @@ server::server(int port,
 	ban_manager_.read();
 
 	start_server();
+	start_metrics_endpoint();
 
 	start_dump_stats();
 	start_tournaments_timer();
@@ -463,6 +470,8 @@ void server::load_config()
 
 	allow_remote_shutdown_ = cfg_["allow_remote_shutdown"].to_bool();
 
+	metrics_port_ = cfg_["metrics_port"].to_int();
+
 	for(const std::string& source : utils::split(cfg_["client_sources"].str())) {
 		client_sources_.insert(source);
 	}
@@ -608,6 +617,110 @@ void server::dump_stats(const boost::system::error_code& ec)
 	start_dump_stats();
 }
 
+void server::start_metrics_endpoint()
+{
+	if(metrics_port_ <= 0) {
+		return;
+	}
+
+	boost::asio::spawn(io_service_, [this](boost::asio::yield_context yield) { serve_metrics(yield); });
+}
+
+void server::serve_metrics(boost::asio::yield_context yield)
+{
+	// Loopback only: the exporter speaks plaintext and has no authentication.
+	boost::asio::ip::tcp::endpoint endpoint(boost::asio::ip::address_v4::loopback(), metrics_port_);
+
+	try {
+		metrics_acceptor_.open(endpoint.protocol());
+		metrics_acceptor_.set_option(boost::asio::ip::tcp::acceptor::reuse_address(true));
+		metrics_acceptor_.bind(endpoint);
+		metrics_acceptor_.listen();
+	} catch(const boost::system::system_error& e) {
+		ERR_SERVER << "Could not bind metrics endpoint on port " << metrics_port_ << ": " << e.code().message();
+		return;
+	}
+
+	LOG_SERVER << "Metrics endpoint listening on 127.0.0.1:" << metrics_port_;
+
+	// Scrapes are rare and cheap, so one connection at a time is plenty.
+	while(true) {
+		boost::asio::ip::tcp::socket socket(io_service_);
+		boost::system::error_code error;
+
+		metrics_acceptor_.async_accept(socket, yield[error]);
+		if(error) {
+			ERR_SERVER << "Metrics accept failed: " << error.message();
+			return;
+		}
+
+		// The request itself does not matter; every path gets the full report.
+		std::array<char, 1024> request;
+		socket.async_read_some(boost::asio::buffer(request), yield[error]);
+		if(error) {
+			continue;
+		}
+
+		const std::string body = metrics_report();
+
+		std::ostringstream response;
+		response << "HTTP/1.0 200 OK\r\n"
+				 << "Content-Type: text/plain; version=0.0.4; charset=utf-8\r\n"
+				 << "Content-Length: " << body.size() << "\r\n"
+				 << "Connection: close\r\n\r\n"
+				 << body;
+		const std::string response_str = response.str();
+
+		async_write(socket, boost::asio::buffer(response_str), yield[error]);
+		socket.shutdown(boost::asio::ip::tcp::socket::shutdown_both, error);
+	}
+}
+
+std::string server::metrics_report()
+{
+	std::ostringstream out;
+	metrics_.prometheus(out);
+
+	out << "# HELP wesnothd_players Connected players.\n"
+		<< "# TYPE wesnothd_players gauge\n"
+		<< "wesnothd_players " << player_connections_.size() << "\n";
+
+	const auto current_games = games();
+	out << "# HELP wesnothd_games Running games.\n"
+		<< "# TYPE wesnothd_games gauge\n"
+		<< "wesnothd_games " << current_games.size() << "\n";
+
+	out << "# HELP wesnothd_game_players Players and observers in each game.\n"
+		<< "# TYPE wesnothd_game_players gauge\n";
+	for(const auto& g : current_games) {
+		out << "wesnothd_game_players{game=\"" << g->id() << "\"} " << g->nplayers() + g->nobservers() << "\n";
+	}
+
+	// A game whose members cannot drain their send queues is the usual
+	// culprit when the daemon degrades: relayed turns pile up per socket.
+	out << "# HELP wesnothd_game_send_queue_depth Relayed documents queued towards members of each game.\n"
+		<< "# TYPE wesnothd_game_send_queue_depth gauge\n";
+	for(const auto& g : current_games) {
+		std::size_t depth = 0;
+		for(const auto& member : g->all_game_users()) {
+			depth += send_queue_depth(member->socket());
+		}
+		out << "wesnothd_game_send_queue_depth{game=\"" << g->id() << "\"} " << depth << "\n";
+	}
+
+	out << "# HELP wesnothd_compression_cpu_seconds_total Wall time spent in the zlib passes of the WML protocol.\n"
+		<< "# TYPE wesnothd_compression_cpu_seconds_total counter\n"
+		<< "wesnothd_compression_cpu_seconds_total{direction=\"compress\"} " << compress_time_us_.load() / 1e6 << "\n"
+		<< "wesnothd_compression_cpu_seconds_total{direction=\"uncompress\"} " << uncompress_time_us_.load() / 1e6 << "\n";
+
+	out << "# HELP wesnothd_compression_calls_total Documents compressed and uncompressed.\n"
+		<< "# TYPE wesnothd_compression_calls_total counter\n"
+		<< "wesnothd_compression_calls_total{direction=\"compress\"} " << compress_calls_.load() << "\n"
+		<< "wesnothd_compression_calls_total{direction=\"uncompress\"} " << uncompress_calls_.load() << "\n";
+
+	return out.str();
+}
+
 void server::start_dummy_player_updates()
 {
 	dummy_player_timer_.expires_after(std::chrono::seconds(dummy_player_timer_interval_));
@@ -1090,10 +1203,32 @@ template<class SocketPtr> void server::handle_player(boost::asio::yield_context
 	make_add_diff(games_and_users_list_.root(), nullptr, "user", diff);
 	send_to_lobby(diff, player);
 
+	// Receive budgets for this connection. The bursts are sized so that a
+	// game creator uploading a large initial scenario never trips them;
+	// only a client sending sustained garbage ends up stalled or dropped.
+	receive_limits limits {
+		{20.0, 200.0},                      // messages per second
+		{512.0 * 1024, 8.0 * 1024 * 1024},  // wire bytes per second
+		{2.0 * 1024 * 1024, 32.0 * 1024 * 1024} // uncompressed bytes per second
+	};
+
 	while(true) {
-		auto doc { coro_receive_doc(socket, yield) };
+		auto doc { coro_receive_doc(socket, yield, &limits) };
 		if(!doc) return;
 
+		// Feed the latency histograms, keyed by the message's root tag.
+		// The admin 'sample' command still controls how often; the default
+		// of 1 measures every message.
+		static unsigned message_count = 0;
+		const bool sample_this = request_sample_frequency > 0 && message_count++ % request_sample_frequency == 0;
+		const auto processing_started = std::chrono::steady_clock::now();
+		ON_SCOPE_EXIT(this, &doc, sample_this, processing_started) {
+			if(sample_this) {
+				metrics_.record_sample(doc->root().first_child(),
+					std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - processing_started));
+			}
+		};
+
 		// DBG_SERVER << client_address(socket) << "\tWML received:\n" << doc->output();
 		if(doc->child("refresh_lobby")) {
 			async_send_doc_queued(socket, games_and_users_list_);
@@ -1710,10 +1845,7 @@ void server::handle_player_in_game(player_iterator p, simple_wml::document& data
 					std::string key = uuid_+"-"+std::to_string(g.db_id())+"-"+content->attr("type").to_string()+"-"+content->attr("id").to_string()+"-"+addon->attr("id").to_string();
 					if(primary_keys.count(key) == 0) {
 						primary_keys.emplace(key);
-						unsigned long long rows_inserted = user_handler_->db_insert_game_content_info(uuid_, g.db_id(), content->attr("type").to_string(), content->attr("name").to_string(), content->attr("id").to_string(), addon->attr("id").to_string(), addon->attr("version").to_string());
-						if(rows_inserted == 0) {
-							WRN_SERVER << "Did not insert content row for [addon] data with uuid '" << uuid_ << "', game ID '" << g.db_id() << "', type '" << content->attr("type").to_string() << "', and content ID '" << content->attr("id").to_string() << "'";
-						}
+						user_handler_->db_insert_game_content_info(uuid_, g.db_id(), content->attr("type").to_string(), content->attr("name").to_string(), content->attr("id").to_string(), addon->attr("id").to_string(), addon->attr("version").to_string());
 					}
 				}
 			}
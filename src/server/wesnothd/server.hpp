@@ -180,6 +180,18 @@ private:
 
 	metrics metrics_;
 
+	/**
+	 * Port for the Prometheus text metrics endpoint, bound on the loopback
+	 * interface only. 0 disables the endpoint. Unlike most of the config,
+	 * changing it requires a restart.
+	 */
+	int metrics_port_;
+	boost::asio::ip::tcp::acceptor metrics_acceptor_;
+
+	void start_metrics_endpoint();
+	void serve_metrics(boost::asio::yield_context yield);
+	std::string metrics_report();
+
 	player_connections player_connections_;
 
 	std::deque<std::shared_ptr<game>> games() const
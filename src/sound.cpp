@@ -79,6 +79,12 @@ const std::size_t n_reserved_channels = UI_sound_channel_last + 1; // sources, b
 // Keep this above number of available channels to avoid busy-looping
 unsigned max_cached_chunks = 256;
 
+// Memory budget for the decoded chunks. Decoded PCM is much bigger than the
+// files on disk, so sessions with add-on soundscapes can otherwise pile up
+// hundreds of megabytes behind the chunk count limit alone.
+std::size_t max_cached_bytes = 64 * 1024 * 1024;
+std::size_t cached_chunk_bytes = 0;
+
 std::map<Mix_Chunk*, int> chunk_usage;
 } // end anon namespace
 
@@ -164,8 +170,33 @@ private:
 
 std::list<sound_cache_chunk> sound_cache;
 typedef std::list<sound_cache_chunk>::iterator sound_cache_iterator;
+// Index of sound_cache by filename so that playing a cached effect does not
+// scan the whole LRU list. Kept in sync with every cache mutation; splicing
+// within the list does not invalidate the stored iterators.
+std::map<std::string, sound_cache_iterator> sound_cache_index;
 std::map<std::string, std::shared_ptr<Mix_Music>> music_cache;
 
+/** Decoded size of a cached chunk, for the memory budget accounting. */
+std::size_t chunk_bytes(const sound_cache_chunk& chunk)
+{
+	return chunk.get_data() != nullptr ? chunk.get_data()->alen : 0;
+}
+
+/** Removes chunks matching @a pred from the cache and its filename index. */
+template<typename Predicate>
+void purge_sound_cache(const Predicate& pred)
+{
+	for(sound_cache_iterator it = sound_cache.begin(); it != sound_cache.end();) {
+		if(pred(*it)) {
+			cached_chunk_bytes -= chunk_bytes(*it);
+			sound_cache_index.erase(it->file);
+			it = sound_cache.erase(it);
+		} else {
+			++it;
+		}
+	}
+}
+
 std::vector<std::string> played_before;
 
 //
@@ -195,6 +226,8 @@ namespace sound
 void flush_cache()
 {
 	sound_cache.clear();
+	sound_cache_index.clear();
+	cached_chunk_bytes = 0;
 	music_cache.clear();
 }
 
@@ -502,6 +535,8 @@ void close_sound()
 		stop_UI_sound();
 		stop_sound();
 		sound_cache.clear();
+		sound_cache_index.clear();
+		cached_chunk_bytes = 0;
 		stop_music();
 		mix_ok = false;
 
@@ -568,7 +603,7 @@ void stop_sound()
 		Mix_HaltGroup(SOUND_SOURCES);
 		Mix_HaltGroup(SOUND_FX);
 
-		sound_cache.remove_if([](const sound_cache_chunk& c) {
+		purge_sound_cache([](const sound_cache_chunk& c) {
 			return c.group == SOUND_SOURCES || c.group == SOUND_FX;
 		});
 	}
@@ -583,7 +618,7 @@ void stop_bell()
 		Mix_HaltGroup(SOUND_BELL);
 		Mix_HaltGroup(SOUND_TIMER);
 
-		sound_cache.remove_if([](const sound_cache_chunk& c) {
+		purge_sound_cache([](const sound_cache_chunk& c) {
 			return c.group == SOUND_BELL || c.group == SOUND_TIMER;
 		});
 	}
@@ -594,7 +629,7 @@ void stop_UI_sound()
 	if(mix_ok) {
 		Mix_HaltGroup(SOUND_UI);
 
-		sound_cache.remove_if([](const sound_cache_chunk& c) {
+		purge_sound_cache([](const sound_cache_chunk& c) {
 			return c.group == SOUND_UI;
 		});
 	}
@@ -638,17 +673,14 @@ void play_track(unsigned int i)
 	play_music();
 }
 
-static void play_new_music()
+/**
+ * Opens the file behind @a track and caches the decoder handle for it.
+ * @returns nullptr (and logs the problem) if the track cannot be loaded.
+ */
+static Mix_Music* load_music_track(const music_track& track)
 {
-	music_start_time = 0; // reset status: no start time
-	want_new_music = true;
-
-	if(!preferences::music_on() || !mix_ok || !current_track || !current_track->valid()) {
-		return;
-	}
-
-	const std::string localized = filesystem::get_localized_path(current_track->file_path());
-	const std::string& filename = localized.empty() ? current_track->file_path() : localized;
+	const std::string localized = filesystem::get_localized_path(track.file_path());
+	const std::string& filename = localized.empty() ? track.file_path() : localized;
 
 	auto itor = music_cache.find(filename);
 	if(itor == music_cache.end()) {
@@ -660,13 +692,44 @@ static void play_new_music()
 
 		if(music == nullptr) {
 			ERR_AUDIO << "Could not load music file '" << filename << "': " << Mix_GetError();
-			return;
+			return nullptr;
 		}
 
 		itor = music_cache.emplace(filename, music).first;
 	}
 
-	LOG_AUDIO << "Playing track '" << filename << "'";
+	return itor->second.get();
+}
+
+/**
+ * Ensures @a track is in the music cache, so that a later switch to it only
+ * starts the already-opened decoder instead of hitting the disk in the middle
+ * of a frame.
+ */
+static void preload_music_track(const music_track& track)
+{
+	if(!mix_ok || !preferences::music_on() || !track.valid()) {
+		return;
+	}
+
+	load_music_track(track);
+}
+
+static void play_new_music()
+{
+	music_start_time = 0; // reset status: no start time
+	want_new_music = true;
+
+	if(!preferences::music_on() || !mix_ok || !current_track || !current_track->valid()) {
+		return;
+	}
+
+	Mix_Music* music = load_music_track(*current_track);
+	if(music == nullptr) {
+		return;
+	}
+
+	LOG_AUDIO << "Playing track '" << current_track->file_path() << "'";
 	int fading_time = current_track->ms_before();
 	if(no_fading) {
 		fading_time = 0;
@@ -680,9 +743,9 @@ static void play_new_music()
 	Mix_HaltMusic();
 
 	// Fade in the new music
-	const int res = Mix_FadeInMusic(itor->second.get(), 1, fading_time);
+	const int res = Mix_FadeInMusic(music, 1, fading_time);
 	if(res < 0) {
-		ERR_AUDIO << "Could not play music: " << Mix_GetError() << " " << filename << " ";
+		ERR_AUDIO << "Could not play music: " << Mix_GetError() << " " << current_track->file_path() << " ";
 	}
 
 	want_new_music = false;
@@ -702,6 +765,10 @@ void play_music_repeatedly(const std::string& id)
 	current_track = current_track_list.back();
 	current_track_index = 0;
 
+	// Open the decoder now, while we are still setting the scenario up,
+	// rather than when the music thinker starts the track mid-frame.
+	preload_music_track(*current_track);
+
 	// If we're already playing it, don't interrupt.
 	if(!last_track || !current_track || *last_track != *current_track) {
 		play_music();
@@ -757,6 +824,10 @@ void play_music_config(const config& music_node, bool allow_interrupt_current_tr
 				current_track_index++;
 			}
 		}
+
+		// Cache the decoder as soon as the track joins the playlist, so
+		// the later transition to it costs no frame time.
+		preload_music_track(**iter);
 	} else {
 		ERR_AUDIO << "tried to add duplicate track '" << track.file_path() << "'";
 	}
@@ -906,38 +977,20 @@ struct chunk_load_exception
 
 static Mix_Chunk* load_chunk(const std::string& file, channel_group group)
 {
-	sound_cache_iterator it_bgn, it_end;
-	sound_cache_iterator it;
-
-	sound_cache_chunk temp_chunk(file); // search the sound cache on this key
-	it_bgn = sound_cache.begin();
-	it_end = sound_cache.end();
-	it = std::find(it_bgn, it_end, temp_chunk);
+	const auto index_it = sound_cache_index.find(file);
 
-	if(it != it_end) {
+	if(index_it != sound_cache_index.end()) {
+		sound_cache_iterator it = index_it->second;
 		if(it->group != group) {
 			// cached item has been used in multiple sound groups
 			it->group = NULL_CHANNEL;
 		}
 
-		// splice the most recently used chunk to the front of the cache
-		sound_cache.splice(it_bgn, sound_cache, it);
+		// splice the most recently used chunk to the front of the cache;
+		// the iterator stored in the index stays valid
+		sound_cache.splice(sound_cache.begin(), sound_cache, it);
 	} else {
-		// remove the least recently used chunk from cache if it's full
-		bool cache_full = (sound_cache.size() == max_cached_chunks);
-		while(cache_full && it != it_bgn) {
-			// make sure this chunk is not being played before freeing it
-			std::vector<Mix_Chunk*>::iterator ch_end = channel_chunks.end();
-			if(std::find(channel_chunks.begin(), ch_end, (--it)->get_data()) == ch_end) {
-				sound_cache.erase(it);
-				cache_full = false;
-			}
-		}
-
-		if(cache_full) {
-			LOG_AUDIO << "Maximum sound cache size reached and all are busy, skipping.";
-			throw chunk_load_exception();
-		}
+		sound_cache_chunk temp_chunk(file);
 
 		temp_chunk.group = group;
 		const std::string& filename = filesystem::get_binary_file_location("sounds", file);
@@ -956,7 +1009,33 @@ static Mix_Chunk* load_chunk(const std::string& file, channel_group group)
 			throw chunk_load_exception();
 		}
 
+		// Evict least recently used chunks until both the chunk count and the
+		// memory budget have room for the new one.
+		const std::size_t new_bytes = chunk_bytes(temp_chunk);
+		sound_cache_iterator it = sound_cache.end();
+		while((sound_cache.size() >= max_cached_chunks || cached_chunk_bytes + new_bytes > max_cached_bytes)
+			&& it != sound_cache.begin())
+		{
+			// make sure this chunk is not being played before freeing it
+			std::vector<Mix_Chunk*>::iterator ch_end = channel_chunks.end();
+			if(std::find(channel_chunks.begin(), ch_end, (--it)->get_data()) == ch_end) {
+				cached_chunk_bytes -= chunk_bytes(*it);
+				sound_cache_index.erase(it->file);
+				it = sound_cache.erase(it);
+			}
+		}
+
+		if(sound_cache.size() >= max_cached_chunks) {
+			LOG_AUDIO << "Maximum sound cache size reached and all are busy, skipping.";
+			throw chunk_load_exception();
+		}
+
+		// If every cached chunk is currently playing, the byte budget may be
+		// exceeded temporarily; dropping the sound instead would be audible.
+
 		sound_cache.push_front(temp_chunk);
+		sound_cache_index.emplace(file, sound_cache.begin());
+		cached_chunk_bytes += new_bytes;
 	}
 
 	return sound_cache.begin()->get_data();
@@ -1070,6 +1149,38 @@ void play_UI_sound(const std::string& files)
 	}
 }
 
+void preload_sound_effects(const std::set<std::string>& files)
+{
+	if(!mix_ok || !preferences::sound_on()) {
+		return;
+	}
+
+	audio_lock lock;
+
+	// Fill at most half the cache, so a preload can neither evict what a
+	// previous scenario is still playing nor get evicted by its own tail.
+	std::size_t budget = max_cached_chunks / 2;
+
+	for(const std::string& entry : files) {
+		for(const std::string& file : utils::split(entry)) {
+			if(budget == 0) {
+				return;
+			}
+
+			if(sound_cache_index.count(file) != 0) {
+				continue;
+			}
+
+			try {
+				load_chunk(file, NULL_CHANNEL);
+				--budget;
+			} catch(const chunk_load_exception&) {
+				// Missing files are reported again when something tries to play them.
+			}
+		}
+	}
+}
+
 int get_music_volume()
 {
 	if(mix_ok) {
@@ -19,6 +19,7 @@
 #include "sound_music_track.hpp"
 #include <optional>
 
+#include <set>
 #include <string>
 
 class config;
@@ -97,6 +98,10 @@ void play_timer(const std::string& files, int loop_ticks, int fadein_ticks);
 // Play user-interface sound, or random one of comma-separated sounds.
 void play_UI_sound(const std::string& files);
 
+// Load the given sounds (each entry may be a comma-separated list) into the
+// chunk cache without playing them, so their first real play doesn't hit the disk.
+void preload_sound_effects(const std::set<std::string>& files);
+
 // A class to periodically check for new music that needs to be played
 class music_thinker : public events::pump_monitor {
 	void process(events::pump_info &info);
@@ -28,6 +28,18 @@ const unsigned DEFAULT_DELAY            = 1000;
 
 unsigned int positional_source::last_id = 0;
 
+namespace {
+
+// The hex in the middle of the viewport. All sources measure their distance
+// from it, so it is computed once per batch instead of once per location.
+map_location viewport_center(const display &disp)
+{
+	const SDL_Rect area = disp.map_area();
+	return disp.hex_clicked_on(area.x + area.w / 2, area.y + area.h / 2);
+}
+
+} // end anon namespace
+
 manager::manager(const display &disp) :
 	observer(),
 	sources_(),
@@ -81,19 +93,29 @@ bool manager::contains(const std::string& id)
 
 void manager::update()
 {
+	if(sources_.empty()) {
+		return;
+	}
+
 	unsigned int time = SDL_GetTicks();
+	const map_location center = viewport_center(disp_);
 
 	for(positional_source_iterator it = sources_.begin(); it != sources_.end(); ++it) {
-		(*it).second->update(time, disp_);
+		(*it).second->update(time, disp_, center);
 	}
 }
 
 void manager::update_positions()
 {
+	if(sources_.empty()) {
+		return;
+	}
+
 	unsigned int time = SDL_GetTicks();
+	const map_location center = viewport_center(disp_);
 
 	for(positional_source_iterator it = sources_.begin(); it != sources_.end(); ++it) {
-		(*it).second->update_positions(time, disp_);
+		(*it).second->update_positions(time, disp_, center);
 	}
 }
 
@@ -135,7 +157,7 @@ bool positional_source::is_global() const
 	return locations_.empty();
 }
 
-void positional_source::update(unsigned int time, const display &disp)
+void positional_source::update(unsigned int time, const display &disp, const map_location &center)
 {
 	if (time - last_played_ < static_cast<unsigned>(min_delay_) || sound::is_sound_playing(id_))
 		return;
@@ -154,7 +176,7 @@ void positional_source::update(unsigned int time, const display &disp)
 
 		int distance_volume = DISTANCE_SILENT;
 		for(const map_location& l : locations_) {
-			int v = calculate_volume(l, disp);
+			int v = calculate_volume(l, disp, center);
 			if(v < distance_volume) {
 				distance_volume = v;
 			}
@@ -167,7 +189,7 @@ void positional_source::update(unsigned int time, const display &disp)
 	}
 }
 
-void positional_source::update_positions(unsigned int time, const display &disp)
+void positional_source::update_positions(unsigned int time, const display &disp, const map_location &center)
 {
 	if(is_global()) {
 		return;
@@ -175,7 +197,7 @@ void positional_source::update_positions(unsigned int time, const display &disp)
 
 	int distance_volume = DISTANCE_SILENT;
 	for(std::vector<map_location>::iterator i = locations_.begin(); i != locations_.end(); ++i) {
-		int v = calculate_volume(*i, disp);
+		int v = calculate_volume(*i, disp, center);
 		if(v < distance_volume) {
 			distance_volume = v;
 		}
@@ -184,11 +206,11 @@ void positional_source::update_positions(unsigned int time, const display &disp)
 	if(sound::is_sound_playing(id_)) {
 		sound::reposition_sound(id_, distance_volume);
 	} else {
-		update(time, disp);
+		update(time, disp, center);
 	}
 }
 
-int positional_source::calculate_volume(const map_location &loc, const display &disp)
+int positional_source::calculate_volume(const map_location &loc, const display &disp, const map_location &center)
 {
 	assert(range_ > 0);
 	assert(faderange_ > 0);
@@ -196,8 +218,6 @@ int positional_source::calculate_volume(const map_location &loc, const display &
 	if((check_shrouded_ && disp.shrouded(loc)) || (check_fogged_ && disp.fogged(loc)))
 		return DISTANCE_SILENT;
 
-	SDL_Rect area = disp.map_area();
-	map_location center = disp.hex_clicked_on(area.x + area.w / 2, area.y + area.h / 2);
 	int distance = distance_between(loc, center);
 
 	if(distance <= range_) {
@@ -62,10 +62,10 @@ public:
 
 	bool is_global() const;
 
-	void update(unsigned int time, const display &disp);
-	void update_positions(unsigned int time, const display &disp);
+	void update(unsigned int time, const display &disp, const map_location &center);
+	void update_positions(unsigned int time, const display &disp, const map_location &center);
 
-	int calculate_volume(const map_location &loc, const display &disp);
+	int calculate_volume(const map_location &loc, const display &disp, const map_location &center);
 
 	/**
 	 * Serializes attributes as WML config.
@@ -14,9 +14,18 @@
 */
 
 #include "synced_checkup.hpp"
+#include "game_board.hpp"
+#include "game_classification.hpp"
+#include "game_data.hpp"
 #include "log.hpp"
+#include "random.hpp"
 #include "replay.hpp"
+#include "resources.hpp"
 #include "synced_user_choice.hpp"
+#include "units/unit.hpp"
+
+#include <cstdint>
+#include <vector>
 
 static lg::log_domain log_replay("replay");
 #define DBG_REPLAY LOG_STREAM(debug, log_replay)
@@ -121,3 +130,80 @@ bool mp_debug_checkup::local_checkup(const config& expected_data, config& real_d
 	real_data = get_user_choice("mp_checkup", checkup_choice(expected_data));
 	return real_data == expected_data;
 }
+
+namespace
+{
+	struct oos_checkpoint
+	{
+		/** Running index of the synced command this checkpoint was taken after. */
+		unsigned action;
+		std::string command;
+		/** Total number of draws from the synced rng so far. */
+		unsigned rng_calls;
+		uint64_t units_hash;
+		std::string variables_hash;
+	};
+
+	const std::size_t checkpoint_ring_size = 256;
+
+	std::vector<oos_checkpoint> checkpoint_ring;
+	unsigned next_action_number = 0;
+
+	void hash_combine(uint64_t& seed, uint64_t value)
+	{
+		seed ^= value + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2);
+	}
+
+	uint64_t units_digest()
+	{
+		uint64_t digest = 0;
+		for(const unit& u : resources::gameboard->units()) {
+			uint64_t h = u.underlying_id();
+			hash_combine(h, static_cast<uint64_t>(static_cast<uint32_t>(u.get_location().x)) << 32
+				| static_cast<uint32_t>(u.get_location().y));
+			hash_combine(h, static_cast<uint32_t>(u.hitpoints()));
+			hash_combine(h, static_cast<uint32_t>(u.experience()));
+			hash_combine(h, static_cast<uint32_t>(u.side()));
+			// xor, so that the digest does not depend on the iteration order of the unit map.
+			digest ^= h;
+		}
+
+		return digest;
+	}
+}
+
+void oos_checkpoints::checkpoint(const std::string& commandname)
+{
+	oos_checkpoint cp;
+	cp.action = next_action_number++;
+	cp.command = commandname;
+	cp.rng_calls = randomness::generator->get_random_calls();
+	cp.units_hash = units_digest();
+	// Hashing the variables walks every WML array the scenario keeps around,
+	// so this is only paid for when oos debugging was explicitly requested.
+	cp.variables_hash = resources::classification->oos_debug
+		? resources::gamedata->get_variables().hash()
+		: std::string();
+
+	if(checkpoint_ring.size() < checkpoint_ring_size) {
+		checkpoint_ring.push_back(std::move(cp));
+	} else {
+		checkpoint_ring[cp.action % checkpoint_ring_size] = std::move(cp);
+	}
+}
+
+void oos_checkpoints::log_all()
+{
+	if(checkpoint_ring.empty()) {
+		return;
+	}
+
+	ERR_REPLAY << "state checkpoints of the last " << checkpoint_ring.size() << " synced actions:";
+	for(unsigned a = next_action_number - checkpoint_ring.size(); a != next_action_number; ++a) {
+		const oos_checkpoint& cp = checkpoint_ring[a % checkpoint_ring_size];
+		ERR_REPLAY << "  action " << cp.action << " [" << cp.command << "]"
+			<< " rng_calls=" << cp.rng_calls
+			<< " units=" << std::hex << cp.units_hash << std::dec
+			<< (cp.variables_hash.empty() ? "" : " variables=" + cp.variables_hash);
+	}
+}
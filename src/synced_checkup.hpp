@@ -16,6 +16,9 @@
 #pragma once
 
 class config;
+
+#include <string>
+
 /**
 	A class to check whether the results that were calculated in the replay match the results calculated during the original game.
 	note, that you shouldn't add new checkups to existent user actions or you might break replay compatibility by bringing the [checkups] tag of older saves in unorder.
@@ -77,3 +80,26 @@ public:
 */
 
 extern checkup* checkup_instance;
+
+/**
+	A compact ring log of per-action state checkpoints for hunting down OOS errors.
+
+	After every synced command a digest of the unit state and the number of synced
+	rng draws is recorded (plus a hash of the WML variables when oos_debug is on).
+	When a desync is detected the whole ring is written to the replay log domain,
+	so diffing the logs of two clients pinpoints the first action after which
+	their game states diverged, instead of only the much later action at which a
+	checksum comparison happened to fail.
+*/
+namespace oos_checkpoints
+{
+	/**
+		Records a checkpoint for the synced command that just finished executing.
+	*/
+	void checkpoint(const std::string& commandname);
+
+	/**
+		Writes the recorded checkpoints to the replay log domain.
+	*/
+	void log_all();
+}
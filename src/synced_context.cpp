@@ -34,6 +34,7 @@
 #include "synced_checkup.hpp"
 #include "syncmp_handler.hpp"
 #include "units/id.hpp"
+#include "video.hpp"
 #include "whiteboard/manager.hpp"
 
 #include <cassert>
@@ -75,6 +76,8 @@ bool synced_context::run(const std::string& commandname,
 
 	sync.do_final_checkup();
 
+	oos_checkpoints::checkpoint(commandname);
+
 	// TODO: It would be nice if this could automaticially detect that
 	//       no entry was pushed to the undo stack for this action
 	//       and always clear the undo stack in that case.
@@ -310,7 +313,12 @@ config synced_context::ask_server_choice(const server_choice& sch)
 				did_require = true;
 			}
 
-			SDL_Delay(10);
+			// play_slice() above is paced to the display refresh, so an
+			// extra sleep is only needed when running headless.
+			if(video::headless()) {
+				SDL_Delay(10);
+			}
+
 			continue;
 
 		} else if(!is_replay_end) {
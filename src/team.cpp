@@ -771,8 +771,8 @@ int shroud_map::height() const
 {
 	if(data_.size() == 0) return 0;
 	return std::max_element(data_.begin(), data_.end(), [](const auto& a, const auto& b) {
-		return a.size() < b.size();
-	})->size();
+		return a.size < b.size;
+	})->size;
 }
 
 bool shroud_map::clear(int x, int y)
@@ -785,12 +785,13 @@ bool shroud_map::clear(int x, int y)
 		data_.resize(x + 1);
 	}
 
-	if(y >= static_cast<int>(data_[x].size())) {
-		data_[x].resize(y + 1);
+	column& col = data_[x];
+	if(y >= static_cast<int>(col.size)) {
+		col.resize(y + 1);
 	}
 
-	if(data_[x][y] == false) {
-		data_[x][y] = true;
+	if(!col.test(y)) {
+		col.set(y);
 		return true;
 	}
 
@@ -806,11 +807,11 @@ void shroud_map::place(int x, int y)
 	if(x >= static_cast<int>(data_.size())) {
 		DBG_NG << "Couldn't place shroud on invalid x coordinate: (" << x << ", " << y
 			   << ") - max x: " << data_.size() - 1;
-	} else if(y >= static_cast<int>(data_[x].size())) {
+	} else if(y >= static_cast<int>(data_[x].size)) {
 		DBG_NG << "Couldn't place shroud on invalid y coordinate: (" << x << ", " << y
-			   << ") - max y: " << data_[x].size() - 1;
+			   << ") - max y: " << data_[x].size - 1;
 	} else {
-		data_[x][y] = false;
+		data_[x].unset(y);
 	}
 }
 
@@ -820,8 +821,8 @@ void shroud_map::reset()
 		return;
 	}
 
-	for(auto& i : data_) {
-		std::fill(i.begin(), i.end(), false);
+	for(column& col : data_) {
+		std::fill(col.words.begin(), col.words.end(), 0);
 	}
 }
 
@@ -836,13 +837,13 @@ bool shroud_map::value(int x, int y) const
 		return true;
 	}
 
-	if(y < 0 || y >= static_cast<int>(data_[x].size())) {
+	if(y < 0 || y >= static_cast<int>(data_[x].size)) {
 		return true;
 	}
 
 	// data_ stores whether or not a location has been cleared, while
 	// we want to return whether or not a location is covered.
-	return !data_[x][y];
+	return !data_[x].test(y);
 }
 
 bool shroud_map::shared_value(const std::vector<const shroud_map*>& maps, int x, int y) const
@@ -869,11 +870,11 @@ bool shroud_map::shared_value(const std::vector<const shroud_map*>& maps, int x,
 std::string shroud_map::write() const
 {
 	std::stringstream shroud_str;
-	for(const auto& sh : data_) {
+	for(const column& col : data_) {
 		shroud_str << '|';
 
-		for(bool i : sh) {
-			shroud_str << (i ? '1' : '0');
+		for(std::size_t y = 0; y != col.size; ++y) {
+			shroud_str << (col.test(y) ? '1' : '0');
 		}
 
 		shroud_str << '\n';
@@ -929,11 +930,27 @@ bool shroud_map::copy_from(const std::vector<const shroud_map*>& maps)
 			continue;
 		}
 
-		const std::vector<std::vector<bool>>& v = m->data_;
-		for(std::size_t x = 0; x != v.size(); ++x) {
-			for(std::size_t y = 0; y != v[x].size(); ++y) {
-				if(v[x][y]) {
-					cleared |= clear(x, y);
+		for(std::size_t x = 0; x != m->data_.size(); ++x) {
+			const column& src = m->data_[x];
+			if(src.size == 0) {
+				continue;
+			}
+
+			if(x >= data_.size()) {
+				data_.resize(x + 1);
+			}
+
+			column& dst = data_[x];
+			if(dst.size < src.size) {
+				dst.resize(src.size);
+			}
+
+			// Merge a word (64 hexes) at a time.
+			for(std::size_t w = 0; w != src.words.size(); ++w) {
+				const uint64_t newly_cleared = src.words[w] & ~dst.words[w];
+				if(newly_cleared) {
+					dst.words[w] |= newly_cleared;
+					cleared = true;
 				}
 			}
 		}
@@ -64,8 +64,41 @@ public:
 	int width() const;
 	int height() const;
 private:
+	/**
+	 * The cleared bits of one map column, packed 64 hexes to a word.
+	 *
+	 * value() is probed for every hex the renderer draws and every hex
+	 * pathfinding looks at, so the bits are kept in plain words that a
+	 * probe can index with a shift and a mask, and copy_from() can merge
+	 * allied vision a word at a time instead of a hex at a time.
+	 */
+	struct column
+	{
+		/** Number of valid bits; trailing bits of the last word are zero. */
+		std::size_t size = 0;
+		std::vector<uint64_t> words;
+
+		bool test(std::size_t y) const { return (words[y / 64] >> (y % 64)) & 1; }
+		void set(std::size_t y) { words[y / 64] |= uint64_t(1) << (y % 64); }
+		void unset(std::size_t y) { words[y / 64] &= ~(uint64_t(1) << (y % 64)); }
+
+		void resize(std::size_t new_size)
+		{
+			words.resize((new_size + 63) / 64, 0);
+			size = new_size;
+		}
+
+		void push_back(bool value)
+		{
+			resize(size + 1);
+			if(value) {
+				set(size - 1);
+			}
+		}
+	};
+
 	bool enabled_;
-	std::vector<std::vector<bool>> data_;
+	std::vector<column> data_;
 };
 
 /**
@@ -308,6 +341,9 @@ public:
 	bool clear_shroud(const map_location& loc) { return shroud_.clear(loc.wml_x(),loc.wml_y()); }
 	void place_shroud(const map_location& loc) { shroud_.place(loc.wml_x(),loc.wml_y()); }
 	bool clear_fog(const map_location& loc) { return fog_.clear(loc.wml_x(),loc.wml_y()); }
+	void place_fog(const map_location& loc) { fog_.place(loc.wml_x(),loc.wml_y()); }
+	/** Raw fog state of this side alone, ignoring allied vision and fog overrides. */
+	bool fog_value(const map_location& loc) const { return fog_.value(loc.wml_x(),loc.wml_y()); }
 	void reshroud() { shroud_.reset(); }
 	void refog() { fog_.reset(); }
 	void set_shroud(bool shroud) { shroud_.set_enabled(shroud); }
@@ -18,15 +18,19 @@
 #include "actions/create.hpp"
 #include "game_board.hpp"
 #include "game_errors.hpp"
+#include "game_events/manager.hpp"
+#include "game_events/pump.hpp"
 #include "gettext.hpp"
 #include "log.hpp"
 #include "map/map.hpp"
+#include "resources.hpp"
 #include "serialization/string_utils.hpp"
 #include "team.hpp"
 #include "units/map.hpp"
 #include "units/type_error.hpp"
 #include "units/unit.hpp"
 
+#include <optional>
 #include <vector>
 
 static lg::log_domain log_engine_tc("engine/team_construction");
@@ -257,6 +261,13 @@ void team_builder::place_units()
 		.allow_rename_side(true)
 		.allow_show(false);
 
+	// Batch the placements so that one pump run handles the whole side's
+	// unit_placed events instead of pumping once per placed unit.
+	std::optional<unit_placement_batch> batch;
+	if(resources::game_events != nullptr) {
+		batch.emplace(board_, resources::game_events->pump());
+	}
+
 	for(const config* u : unit_configs_) {
 		try {
 			uc.add_unit(*u);
@@ -264,4 +275,8 @@ void team_builder::place_units()
 			ERR_NG_TC << e.what();
 		}
 	}
+
+	if(batch) {
+		batch->commit();
+	}
 }
@@ -28,6 +28,10 @@
 #include "serialization/string_utils.hpp"
 #include "game_config_view.hpp"
 
+#include <atomic>
+#include <future>
+#include <thread>
+
 static lg::log_domain log_engine("engine");
 #define ERR_NG LOG_STREAM(err, log_engine)
 #define WRN_NG LOG_STREAM(warn, log_engine)
@@ -391,6 +395,67 @@ void terrain_builder::rebuild_all()
 	build_terrains();
 }
 
+std::set<map_location> terrain_builder::rebuild_region(const std::set<map_location>& locs)
+{
+	// The maximum distance, in tiles, between a rule's anchor and any hex
+	// it reads or draws to. legacy_sum() can shift the row by one extra
+	// hex on odd columns, hence the extra tile.
+	int radius = 1;
+	for(const building_rule& rule : building_rules_) {
+		for(const terrain_constraint& constraint : rule.constraints) {
+			radius = std::max({radius, std::abs(constraint.loc.x) + 1, std::abs(constraint.loc.y) + 1});
+		}
+	}
+
+	// A changed hex can alter the match of any rule reading it, and such a
+	// rule draws up to a full radius beyond its anchor; images and flags
+	// are thus stale within twice the radius of the change. Anchors one
+	// more radius out can draw into that area and must be re-matched.
+	std::set<map_location> region;
+	std::set<map_location> anchors;
+
+	for(const map_location& loc : locs) {
+		for(int x = loc.x - 3 * radius; x <= loc.x + 3 * radius; ++x) {
+			for(int y = loc.y - 3 * radius; y <= loc.y + 3 * radius; ++y) {
+				const map_location to(x, y);
+				anchors.insert(to);
+				if(std::abs(x - loc.x) <= 2 * radius && std::abs(y - loc.y) <= 2 * radius && tile_map_.on_map(to)) {
+					region.insert(to);
+				}
+			}
+		}
+	}
+
+	for(const map_location& loc : region) {
+		tile& btile = tile_map_[loc];
+		btile.clear();
+
+		// Restore the border flags, as build_terrains() sets them.
+		if(draw_border_ && !map().on_board(loc)) {
+			btile.flags.insert("_border");
+		} else {
+			btile.flags.insert("_board");
+		}
+	}
+
+	// Re-match every rule that can reach into the cleared region, in the
+	// same precedence order as a full build. Matching may read flags of
+	// tiles outside the region; those carry the flags of the complete
+	// ruleset rather than of the rules run so far, so a flag-dependent
+	// rule can in principle resolve differently near the edge of the
+	// region than it would under rebuild_all(). The padding keeps any
+	// such difference away from the changed hexes themselves.
+	for(const building_rule& rule : building_rules_) {
+		for(const map_location& loc : anchors) {
+			if(rule_matches(rule, loc, nullptr)) {
+				apply_rule(rule, loc, &region);
+			}
+		}
+	}
+
+	return region;
+}
+
 static bool image_exists(const std::string& name)
 {
 	bool precached = name.find("..") == std::string::npos;
@@ -1017,6 +1082,13 @@ void terrain_builder::add_off_map_rule(const std::string& image)
 bool terrain_builder::rule_matches(const terrain_builder::building_rule& rule,
 		const map_location& loc,
 		const terrain_constraint* type_checked) const
+{
+	return rule_matches_static(rule, loc, type_checked) && rule_matches_flags(rule, loc);
+}
+
+bool terrain_builder::rule_matches_static(const terrain_builder::building_rule& rule,
+		const map_location& loc,
+		const terrain_constraint* type_checked) const
 {
 	// Don't match if the location isn't a multiple of mod_x and mod_y
 	if(rule.modulo_constraints.x > 0 && (loc.x % rule.modulo_constraints.x != 0)) {
@@ -1051,8 +1123,16 @@ bool terrain_builder::rule_matches(const terrain_builder::building_rule& rule,
 		if(&cons != type_checked && !terrain_matches(map().get_terrain(tloc), cons.terrain_types_match)) {
 			return false;
 		}
+	}
 
-		const std::set<std::string>& flags = tile_map_[tloc].flags;
+	return true;
+}
+
+bool terrain_builder::rule_matches_flags(const terrain_builder::building_rule& rule, const map_location& loc) const
+{
+	for(const terrain_constraint& cons : rule.constraints) {
+		// Translated location; on the tile map, as the static checks established.
+		const std::set<std::string>& flags = tile_map_[legacy_sum(loc, cons.loc)].flags;
 
 		for(const std::string& s : cons.no_flag) {
 			// If a flag listed in "no_flag" is present, the rule does not match
@@ -1071,7 +1151,7 @@ bool terrain_builder::rule_matches(const terrain_builder::building_rule& rule,
 	return true;
 }
 
-void terrain_builder::apply_rule(const terrain_builder::building_rule& rule, const map_location& loc)
+void terrain_builder::apply_rule(const terrain_builder::building_rule& rule, const map_location& loc, const std::set<map_location>* clip)
 {
 	unsigned int rand_seed = get_noise(loc, rule.get_hash());
 
@@ -1081,6 +1161,12 @@ void terrain_builder::apply_rule(const terrain_builder::building_rule& rule, con
 			return;
 		}
 
+		// During a regional rebuild, tiles outside the region keep the
+		// images and flags they already have.
+		if(clip && clip->count(tloc) == 0) {
+			continue;
+		}
+
 		tile& btile = tile_map_[tloc];
 
 		if(!constraint.no_draw) {
@@ -1150,7 +1236,26 @@ void terrain_builder::build_terrains()
 		}
 	}
 
+	// The map terrain never changes while the rules run, so everything in
+	// the matching except the flag checks can be decided for every rule up
+	// front, and that is where nearly all of the time goes. Shard the rules
+	// across workers, each recording the anchors that pass the static
+	// checks. Flags are both read and written while rules are applied, so
+	// the flag checks and the application itself run serially afterwards,
+	// in the same rule and anchor order as a fully serial build.
+	std::vector<const building_rule*> rules;
+	rules.reserve(building_rules_.size());
 	for(const building_rule& rule : building_rules_) {
+		// The hash is computed lazily; force it now so the workers only read.
+		rule.get_hash();
+		rules.push_back(&rule);
+	}
+
+	std::vector<std::vector<map_location>> candidates(rules.size());
+
+	const auto match_rule = [&](std::size_t r) {
+		const building_rule& rule = *rules[r];
+
 		// Find the constraint that contains the less terrain of all terrain rules.
 		// We will keep a track of the matching terrains of this constraint
 		// and later try to apply the rule only on them
@@ -1166,7 +1271,7 @@ void terrain_builder::build_terrains()
 			t_translation::ter_list matching_types;
 			std::size_t constraint_size = 0;
 
-			for(terrain_by_type_map::iterator type_it = terrain_by_type_.begin(); type_it != terrain_by_type_.end();
+			for(terrain_by_type_map::const_iterator type_it = terrain_by_type_.begin(); type_it != terrain_by_type_.end();
 					++type_it) {
 				const t_translation::terrain_code t = type_it->first;
 				if(terrain_matches(t, match)) {
@@ -1195,16 +1300,49 @@ void terrain_builder::build_terrains()
 
 		// NOTE: if min_types is not empty, we have found a valid min_constraint;
 		for(t_translation::ter_list::const_iterator t = min_types.begin(); t != min_types.end(); ++t) {
-			const std::vector<map_location>* locations = &terrain_by_type_[*t];
+			const std::vector<map_location>& locations = terrain_by_type_.find(*t)->second;
 
-			for(std::vector<map_location>::const_iterator itor = locations->begin(); itor != locations->end(); ++itor) {
+			for(std::vector<map_location>::const_iterator itor = locations.begin(); itor != locations.end(); ++itor) {
 				const map_location loc = legacy_difference(*itor, min_constraint->loc);
 
-				if(rule_matches(rule, loc, min_constraint)) {
-					apply_rule(rule, loc);
+				if(rule_matches_static(rule, loc, min_constraint)) {
+					candidates[r].push_back(loc);
 				}
 			}
 		}
+	};
+
+	const std::size_t num_workers =
+		std::min<std::size_t>(std::thread::hardware_concurrency(), rules.size());
+
+	std::atomic<std::size_t> next(0);
+	const auto work = [&]() {
+		for(std::size_t r; (r = next.fetch_add(1)) < rules.size();) {
+			match_rule(r);
+		}
+	};
+
+	if(num_workers < 2) {
+		work();
+	} else {
+		std::vector<std::future<void>> workers;
+		workers.reserve(num_workers - 1);
+		for(std::size_t w = 1; w < num_workers; ++w) {
+			workers.push_back(std::async(std::launch::async, work));
+		}
+		work();
+
+		for(std::future<void>& worker : workers) {
+			worker.get();
+		}
+	}
+
+	for(std::size_t r = 0; r < rules.size(); ++r) {
+		for(const map_location& loc : candidates[r]) {
+			if(rule_matches_flags(*rules[r], loc)) {
+				apply_rule(*rules[r], loc);
+			}
+		}
 	}
 }
 
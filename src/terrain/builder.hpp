@@ -151,6 +151,17 @@ public:
 	 */
 	void rebuild_all();
 
+	/** Performs a rebuild limited to the surroundings of the given
+	 * locations. Rules are re-matched only within the maximum rule
+	 * radius of a change, so this stays cheap on large maps.
+	 *
+	 * @param locs  the locations whose terrain has changed
+	 *
+	 * @return      the set of locations whose images were rebuilt, all of
+	 *              which need to be redrawn.
+	 */
+	std::set<map_location> rebuild_region(const std::set<map_location>& locs);
+
 	void rebuild_cache_all();
 
 	void set_draw_border(bool do_draw)
@@ -818,6 +829,21 @@ private:
 	 */
 	bool rule_matches(const building_rule& rule, const map_location& loc, const terrain_constraint* type_checked) const;
 
+	/**
+	 * The part of rule_matches() that only depends on the map terrain:
+	 * modulo, location and probability constraints plus the terrain of
+	 * every constrained hex. Reads no tile flags, so it is safe to call
+	 * from several threads at once while no rule is being applied.
+	 */
+	bool rule_matches_static(const building_rule& rule, const map_location& loc, const terrain_constraint* type_checked) const;
+
+	/**
+	 * The flag checks of rule_matches(). Must only be called for
+	 * locations that passed rule_matches_static(), since those checks
+	 * also establish that every constrained hex is on the tile map.
+	 */
+	bool rule_matches_flags(const building_rule& rule, const map_location& loc) const;
+
 	/**
 	 * Applies a rule at a given location: applies the result of a
 	 * matching rule at a given location: attachs the images corresponding
@@ -825,8 +851,9 @@ private:
 	 *
 	 * @param rule      The rule to apply
 	 * @param loc       The location to which to apply the rule.
+	 * @param clip      If non-null, only tiles within this set are modified.
 	 */
-	void apply_rule(const building_rule& rule, const map_location& loc);
+	void apply_rule(const building_rule& rule, const map_location& loc, const std::set<map_location>* clip = nullptr);
 
 	/**
 	 * Calculates the list of terrains, and fills the tile_map_ member,
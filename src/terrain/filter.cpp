@@ -37,6 +37,8 @@
 
 #include <boost/range/adaptor/transformed.hpp>
 
+#include <sstream>
+
 static lg::log_domain log_engine("engine");
 #define ERR_NG LOG_STREAM(err, log_engine)
 #define WRN_NG LOG_STREAM(warn, log_engine)
@@ -511,7 +513,84 @@ struct cfg_to_loc
 	map_location operator()(const config& cfg) const { return map_location(cfg, nullptr); }
 	typedef map_location result_type;
 };
+
+namespace
+{
+	/**
+	 * Shared cache of get_locations() results for filters that read nothing
+	 * but the map itself. WML that re-checks static terrain masks every turn
+	 * then pays the full-map scan once per map revision instead of once per
+	 * call. Entries are keyed by the variable-substituted filter text and are
+	 * only served while the map version they were computed against is still
+	 * current; see gamemap::version().
+	 */
+	struct cached_location_set
+	{
+		unsigned long long map_version;
+		std::set<map_location> locs;
+	};
+
+	std::map<std::string, cached_location_set> static_filter_cache;
+
+	// WML can generate filter text in unbounded variety; start over rather
+	// than letting a pathological scenario grow the cache without limit.
+	const std::size_t static_filter_cache_max = 64;
+
+	/** Whether every key in the filter only ever reads the map itself. */
+	bool filter_is_static(const config& cfg)
+	{
+		static const std::set<std::string> static_attrs {
+			"terrain", "x", "y", "include_borders", "gives_income", "radius", "adjacent", "count"};
+		static const std::set<std::string> static_tags {
+			"and", "or", "not", "filter_radius", "filter_adjacent_location"};
+
+		for(const auto& attr : cfg.attribute_range()) {
+			if(static_attrs.count(attr.first) == 0) {
+				return false;
+			}
+		}
+		for(const config::any_child child : cfg.all_children_range()) {
+			if(static_tags.count(child.key) == 0 || !filter_is_static(child.cfg)) {
+				return false;
+			}
+		}
+
+		return true;
+	}
+}
+
 void terrain_filter::get_locs_impl(std::set<map_location>& locs, const unit* ref_unit, bool with_border) const
+{
+	if(!filter_is_static(cfg_.get_config())) {
+		get_locs_uncached(locs, ref_unit, with_border);
+		return;
+	}
+
+	// The raw filter text may still reference WML variables, so key on the
+	// substituted form to keep results for distinct variable values apart.
+	std::ostringstream key_stream;
+	key_stream << with_border << cfg_.get_parsed_config();
+	const std::string key = key_stream.str();
+
+	const unsigned long long map_version = fc_->get_disp_context().map().version();
+	const auto hit = static_filter_cache.find(key);
+	if(hit != static_filter_cache.end() && hit->second.map_version == map_version) {
+		locs.insert(hit->second.locs.begin(), hit->second.locs.end());
+		return;
+	}
+
+	if(static_filter_cache.size() >= static_filter_cache_max) {
+		static_filter_cache.clear();
+	}
+
+	cached_location_set& entry = static_filter_cache[key];
+	entry.map_version = map_version;
+	entry.locs.clear();
+	get_locs_uncached(entry.locs, ref_unit, with_border);
+	locs.insert(entry.locs.begin(), entry.locs.end());
+}
+
+void terrain_filter::get_locs_uncached(std::set<map_location>& locs, const unit* ref_unit, bool with_border) const
 {
 	std::unique_ptr<scoped_wml_variable> ref_unit_var;
 	if(ref_unit) {
@@ -82,6 +82,8 @@ public:
 private:
 	bool match_impl(const map_location& loc, const unit* ref_unit) const;
 	void get_locs_impl(std::set<map_location>& locs, const unit* ref_unit, bool with_border) const;
+	/** The uncached evaluation behind get_locs_impl(); see the result cache in filter.cpp. */
+	void get_locs_uncached(std::set<map_location>& locs, const unit* ref_unit, bool with_border) const;
 	bool match_internal(const map_location& loc, const unit* ref_unit, const bool ignore_xy) const;
 
 	const vconfig cfg_; //config contains WML for a Standard Location Filter
@@ -89,6 +89,9 @@ namespace t_translation {
 		terrain_code& get(int x, int y) { std::size_t index = x * h + y; return data.at(index); }
 		const terrain_code& get(int x, int y) const { std::size_t index = x * h + y; return data.at(index); }
 
+		/** Like get(), but without the range check; for callers that have already validated x and y. */
+		const terrain_code& get_unchecked(int x, int y) const { return data[x * h + y]; }
+
 		std::vector<terrain_code> data;
 		int w;
 		int h;
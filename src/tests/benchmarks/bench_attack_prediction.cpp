@@ -0,0 +1,89 @@
+/*
+	Copyright (C) 2022
+	Part of the Battle for Wesnoth Project https://www.wesnoth.org/
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY.
+
+	See the COPYING file for more details.
+*/
+
+/**
+ * Benchmarks for combatant::fight, using the same nasty-to-calculate unit
+ * mix as the standalone harness inside attack_prediction.cpp.
+ */
+
+#include "tests/benchmarks/benchmark.hpp"
+
+// Enables the hand-rolled battle_context_unit_stats constructor used by the
+// stand-alone harness; it is defined inline in the header, so the library
+// does not need to be rebuilt with this define.
+#define BENCHMARK
+
+// The test constructor needs round_damage() in scope.
+#include "utils/math.hpp"
+
+#include "actions/attack.hpp"
+#include "attack_prediction.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace
+{
+
+/** Stat mix covering drain/slow/berserk/firststrike/swarm combinations. */
+std::vector<std::unique_ptr<battle_context_unit_stats>> make_fighters(unsigned count)
+{
+	std::vector<std::unique_ptr<battle_context_unit_stats>> stats;
+	stats.reserve(count);
+
+	for(unsigned i = 0; i < count; ++i) {
+		const unsigned alt = i + 74; // To offset some cycles.
+		const unsigned max_hp = (i * 2) % 23 + (i * 3) % 14 + 25;
+		const unsigned hp = (alt * 5) % max_hp + 1;
+
+		stats.push_back(std::make_unique<battle_context_unit_stats>(
+			alt % 8 + 2,       // damage
+			(alt % 19 + 3) / 4, // number of strikes
+			hp, max_hp,
+			(i % 6) * 10 + 30, // hit chance
+			(i % 13) % 3 == 0, // drains
+			(i % 11) % 3 == 0, // slows
+			false,             // slowed
+			i % 7 == 0,        // berserk
+			(i % 17) / 2 == 0, // firststrike
+			i % 5 == 0));      // swarm
+	}
+
+	return stats;
+}
+
+} // anonymous namespace
+
+BENCHMARK_CASE(attack_prediction_fight)
+{
+	const auto stats = make_fighters(16);
+
+	std::size_t done = 0;
+	while(done < benchmark_iterations) {
+		for(std::size_t a = 0; a < stats.size() && done < benchmark_iterations; ++a) {
+			for(std::size_t d = 0; d < stats.size() && done < benchmark_iterations; ++d) {
+				if(a == d) {
+					continue;
+				}
+
+				combatant attacker(*stats[a]);
+				combatant defender(*stats[d]);
+				attacker.fight(defender);
+				benchmark::do_not_optimize(defender);
+
+				++done;
+			}
+		}
+	}
+}
@@ -0,0 +1,136 @@
+/*
+	Copyright (C) 2022
+	Part of the Battle for Wesnoth Project https://www.wesnoth.org/
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY.
+
+	See the COPYING file for more details.
+*/
+
+/**
+ * Benchmarks for config construction, the text WML parser/writer and the
+ * binary WML cache format.
+ */
+
+#include "tests/benchmarks/benchmark.hpp"
+
+#include "config.hpp"
+#include "serialization/binary_or_text.hpp"
+#include "serialization/parser.hpp"
+
+#include <sstream>
+
+namespace
+{
+
+/**
+ * A config shaped roughly like carryover unit data: many children sharing
+ * attribute names, with a mix of short repeated and longer unique values.
+ */
+config make_sample_config()
+{
+	config cfg;
+	cfg["version"] = "1.17";
+	cfg["next_scenario"] = "some_scenario_id";
+
+	for(int s = 0; s < 4; ++s) {
+		config& side = cfg.add_child("side");
+		side["save_id"] = "side_" + std::to_string(s);
+		side["gold"] = 100 + s;
+
+		for(int u = 0; u < 100; ++u) {
+			config& unit = side.add_child("unit");
+			unit["type"] = u % 2 ? "Elvish Fighter" : "Elvish Archer";
+			unit["id"] = "unit-" + std::to_string(s) + "-" + std::to_string(u);
+			unit["name"] = "Veteran " + std::to_string(u);
+			unit["hitpoints"] = 30 + u % 20;
+			unit["experience"] = u % 40;
+			unit["moves"] = 6;
+			unit["resting"] = true;
+
+			config& mods = unit.add_child("modifications");
+			config& trait = mods.add_child("trait");
+			trait["id"] = u % 2 ? "strong" : "intelligent";
+			trait["description"] = "A longer, per-unit trait description string for unit "
+				+ std::to_string(u) + " that will not hit any dictionary.";
+		}
+	}
+
+	return cfg;
+}
+
+std::string sample_wml_text()
+{
+	std::ostringstream out;
+	write(out, make_sample_config());
+	return out.str();
+}
+
+std::string sample_binary_wml()
+{
+	std::ostringstream out;
+	write_binary_wml(out, make_sample_config());
+	return out.str();
+}
+
+} // anonymous namespace
+
+BENCHMARK_CASE(config_parse_text_wml)
+{
+	const std::string doc = sample_wml_text();
+
+	for(std::size_t i = 0; i < benchmark_iterations; ++i) {
+		config cfg;
+		read(cfg, doc);
+		benchmark::do_not_optimize(cfg);
+	}
+}
+
+BENCHMARK_CASE(config_write_text_wml)
+{
+	const config cfg = make_sample_config();
+
+	for(std::size_t i = 0; i < benchmark_iterations; ++i) {
+		std::ostringstream out;
+		write(out, cfg);
+		benchmark::do_not_optimize(out);
+	}
+}
+
+BENCHMARK_CASE(config_copy)
+{
+	const config cfg = make_sample_config();
+
+	for(std::size_t i = 0; i < benchmark_iterations; ++i) {
+		config copy = cfg;
+		benchmark::do_not_optimize(copy);
+	}
+}
+
+BENCHMARK_CASE(config_read_binary_wml)
+{
+	const std::string doc = sample_binary_wml();
+
+	for(std::size_t i = 0; i < benchmark_iterations; ++i) {
+		config cfg;
+		std::istringstream in(doc);
+		read_binary_wml(cfg, in);
+		benchmark::do_not_optimize(cfg);
+	}
+}
+
+BENCHMARK_CASE(config_write_binary_wml)
+{
+	const config cfg = make_sample_config();
+
+	for(std::size_t i = 0; i < benchmark_iterations; ++i) {
+		std::ostringstream out;
+		write_binary_wml(out, cfg);
+		benchmark::do_not_optimize(out);
+	}
+}
@@ -0,0 +1,137 @@
+/*
+	Copyright (C) 2022
+	Part of the Battle for Wesnoth Project https://www.wesnoth.org/
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY.
+
+	See the COPYING file for more details.
+*/
+
+#include "tests/benchmarks/benchmark.hpp"
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+
+namespace benchmark
+{
+
+namespace
+{
+
+/** A case is rerun with a growing iteration count until it takes this long. */
+constexpr double min_case_seconds = 0.5;
+
+double time_body(const body_function& body, std::size_t iterations)
+{
+	const auto start = std::chrono::steady_clock::now();
+	body(iterations);
+	const auto end = std::chrono::steady_clock::now();
+
+	return std::chrono::duration<double>(end - start).count();
+}
+
+} // anonymous namespace
+
+std::vector<std::pair<std::string, body_function>>& all_cases()
+{
+	static std::vector<std::pair<std::string, body_function>> cases;
+	return cases;
+}
+
+registrar::registrar(const std::string& name, body_function body)
+{
+	all_cases().emplace_back(name, std::move(body));
+}
+
+std::vector<result> run_cases(const std::string& filter, std::ostream& log)
+{
+	std::vector<result> results;
+
+	for(const auto& [name, body] : all_cases()) {
+		if(!filter.empty() && name.find(filter) == std::string::npos) {
+			continue;
+		}
+
+		log << name << "... " << std::flush;
+
+		// One untimed pass warms caches and one-time lazy initialization.
+		body(1);
+
+		std::size_t iterations = 1;
+		double elapsed = time_body(body, iterations);
+
+		while(elapsed < min_case_seconds) {
+			// Aim past the threshold in one step, but at most 10x at a time
+			// so a mismeasured fast first pass cannot overshoot badly.
+			const double factor = std::min(10.0, 1.2 * min_case_seconds / std::max(elapsed, 1e-9));
+			iterations = static_cast<std::size_t>(iterations * factor) + 1;
+			elapsed = time_body(body, iterations);
+		}
+
+		const double ns_per_iteration = elapsed * 1e9 / iterations;
+		results.push_back(result{name, iterations, ns_per_iteration, elapsed});
+
+		log << ns_per_iteration << " ns/iter (" << iterations << " iterations)" << std::endl;
+	}
+
+	return results;
+}
+
+void write_json(const std::vector<result>& results, std::ostream& out)
+{
+	out << "[\n";
+
+	for(std::size_t i = 0; i < results.size(); ++i) {
+		const result& r = results[i];
+		out << "  {\"name\": \"" << r.name << "\""
+			<< ", \"iterations\": " << r.iterations
+			<< ", \"ns_per_iteration\": " << r.ns_per_iteration
+			<< ", \"total_seconds\": " << r.total_seconds
+			<< "}" << (i + 1 < results.size() ? "," : "") << "\n";
+	}
+
+	out << "]\n";
+}
+
+} // namespace benchmark
+
+int main(int argc, char** argv)
+{
+	std::string filter;
+	std::string output;
+
+	for(int i = 1; i < argc; ++i) {
+		const std::string arg = argv[i];
+
+		if(arg == "--filter" && i + 1 < argc) {
+			filter = argv[++i];
+		} else if(arg == "--output" && i + 1 < argc) {
+			output = argv[++i];
+		} else {
+			std::cerr << "Usage: " << argv[0] << " [--filter <substring>] [--output <file.json>]\n";
+			return 1;
+		}
+	}
+
+	const std::vector<benchmark::result> results = benchmark::run_cases(filter, std::cerr);
+
+	if(output.empty()) {
+		benchmark::write_json(results, std::cout);
+	} else {
+		std::ofstream out(output);
+		if(!out) {
+			std::cerr << "Could not open '" << output << "' for writing\n";
+			return 1;
+		}
+
+		benchmark::write_json(results, out);
+	}
+
+	return 0;
+}
@@ -0,0 +1,91 @@
+/*
+	Copyright (C) 2022
+	Part of the Battle for Wesnoth Project https://www.wesnoth.org/
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY.
+
+	See the COPYING file for more details.
+*/
+
+/**
+ * @file
+ * Minimal micro-benchmark harness for the wesnoth_benchmarks target.
+ *
+ * Each case registers itself with BENCHMARK_CASE and receives an iteration
+ * count; the harness calibrates that count until a case runs long enough to
+ * measure, then reports nanoseconds per iteration. Results are printed as
+ * JSON so the numbers can be tracked per commit by external tooling.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <iosfwd>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace benchmark
+{
+
+/** Timing results of a single benchmark case. */
+struct result
+{
+	std::string name;
+	std::size_t iterations;
+	double ns_per_iteration;
+	double total_seconds;
+};
+
+using body_function = std::function<void(std::size_t)>;
+
+/** All registered cases, in registration order. */
+std::vector<std::pair<std::string, body_function>>& all_cases();
+
+/**
+ * Runs every case whose name contains @a filter (all of them if empty),
+ * logging progress to @a log.
+ */
+std::vector<result> run_cases(const std::string& filter, std::ostream& log);
+
+/** Writes @a results as a JSON array to @a out. */
+void write_json(const std::vector<result>& results, std::ostream& out);
+
+/** Registers a case; used through BENCHMARK_CASE. */
+struct registrar
+{
+	registrar(const std::string& name, body_function body);
+};
+
+/**
+ * Keeps the compiler from optimizing away a computed value whose only
+ * purpose is being measured.
+ */
+template<typename T>
+inline void do_not_optimize(const T& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	asm volatile("" : : "g"(&value) : "memory");
+#else
+	static volatile const void* sink;
+	sink = &value;
+#endif
+}
+
+} // namespace benchmark
+
+/**
+ * Defines and registers a benchmark case. The body runs with a
+ * benchmark_iterations parameter and must perform exactly that many
+ * iterations of the measured operation.
+ */
+#define BENCHMARK_CASE(name) \
+	static void name(std::size_t benchmark_iterations); \
+	static const benchmark::registrar name##_registrar(#name, &name); \
+	static void name(std::size_t benchmark_iterations)
@@ -16,11 +16,15 @@
 #define GETTEXT_DOMAIN "wesnoth-test"
 
 #include <array>
+#include <sstream>
 #include <vector>
 #include <string>
+#include "config.hpp"
 #include "serialization/base64.hpp"
+#include "serialization/binary_or_text.hpp"
 #include "serialization/string_utils.hpp"
 #include "serialization/unicode.hpp"
+#include "tstring.hpp"
 #include <boost/test/unit_test.hpp>
 
 namespace std {
@@ -637,3 +641,96 @@ BOOST_AUTO_TEST_CASE( test_base64_encodings )
 }
 
 BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE ( test_binary_wml )
+
+namespace {
+
+/** Writes @a cfg in the binary WML format and reads it back. */
+config binary_round_trip(const config& cfg)
+{
+	std::ostringstream out;
+	write_binary_wml(out, cfg);
+
+	std::istringstream in(out.str());
+	config res;
+	read_binary_wml(res, in);
+	return res;
+}
+
+}
+
+BOOST_AUTO_TEST_CASE( binary_wml_round_trip )
+{
+	config empty;
+	BOOST_CHECK(binary_round_trip(empty) == empty);
+
+	config cfg;
+	cfg["plain"] = "string value";
+	cfg["empty"] = "";
+	cfg["number"] = 42;
+	cfg["text"] = t_string("Sighted", "wesnoth-test");
+
+	// Deep nesting, with repeated keys and values so dictionary references
+	// are exercised along with the literals that defined them.
+	config* child = &cfg;
+	for(int i = 0; i < 40; ++i) {
+		child = &child->add_child("nested");
+		(*child)["depth"] = i;
+		(*child)["terrain"] = "Gg^Fds";
+	}
+
+	// Repeated strings past the 128-byte dictionary admission bound are
+	// written as literals every time; they must still read back intact.
+	const std::string long_string(200, 'x');
+	cfg["long_one"] = long_string;
+	cfg["long_two"] = long_string;
+
+	const config clone = binary_round_trip(cfg);
+	BOOST_CHECK(clone == cfg);
+	BOOST_CHECK(clone["text"].t_str().translatable());
+	BOOST_CHECK(!clone["plain"].t_str().translatable());
+	BOOST_CHECK_EQUAL(clone["long_two"].str(), long_string);
+}
+
+BOOST_AUTO_TEST_CASE( binary_wml_shards )
+{
+	config cfg;
+	cfg["root"] = "attribute";
+	for(int i = 0; i < 10; ++i) {
+		config& child = cfg.add_child(i % 2 == 0 ? "even_tag" : "odd_tag");
+		child["index"] = i;
+	}
+
+	// Each shard is a complete stream with its own dictionary; reading them
+	// independently and appending in index order reproduces the original.
+	std::ostringstream first, second;
+	write_binary_wml_shard(first, cfg, 0, 4);
+	write_binary_wml_shard(second, cfg, 4, cfg.all_children_count());
+
+	std::istringstream first_in(first.str()), second_in(second.str());
+	config res, tail;
+	read_binary_wml(res, first_in);
+	read_binary_wml(tail, second_in);
+	res.append(std::move(tail));
+	BOOST_CHECK(res == cfg);
+}
+
+BOOST_AUTO_TEST_CASE( binary_wml_rejects_garbage )
+{
+	config res;
+	std::istringstream bad_magic("not binary WML at all");
+	BOOST_CHECK_THROW(read_binary_wml(res, bad_magic), config::error);
+
+	config cfg;
+	cfg.add_child("tag")["key"] = "value";
+	std::ostringstream out;
+	write_binary_wml(out, cfg);
+
+	// Any proper prefix is missing a count, string or attribute tag.
+	const std::string stream = out.str();
+	std::istringstream truncated(stream.substr(0, stream.size() / 2));
+	BOOST_CHECK_THROW(read_binary_wml(res, truncated), config::error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
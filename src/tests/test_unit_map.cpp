@@ -25,7 +25,10 @@
 #include "units/types.hpp"
 #include "units/unit.hpp"
 
+#include <algorithm>
 #include <functional>
+#include <random>
+#include <set>
 
 
 /*
@@ -270,5 +273,67 @@ BOOST_AUTO_TEST_CASE( track_fake_unit_by_iterator ) {
 	BOOST_CHECK(unit_iterator == unit_iterator2);
 }
 
+BOOST_AUTO_TEST_CASE( find_in_radius_matches_full_scan ) {
+	config game_config(test_utils::get_test_config());
+
+	config orc_config;
+	orc_config["id"]="Orcish Grunt";
+	orc_config["random_traits"] = false;
+	orc_config["animate"]=false;
+	unit_type orc_type(orc_config);
+
+	unit_types.build_unit_type(orc_type, unit_type::FULL);
+
+	unit_map unit_map;
+
+	// Seeded so a failure reproduces; spread wide enough to span many of the
+	// 8x8 buckets backing the spatial index.
+	std::mt19937 gen(42);
+	std::uniform_int_distribution<int> coord(0, 39);
+
+	std::set<map_location> occupied;
+	while(occupied.size() < 60) {
+		occupied.emplace(coord(gen), coord(gen));
+	}
+
+	for(const map_location& loc : occupied) {
+		unit_ptr orc = unit::create(orc_type, 0, false);
+		BOOST_REQUIRE(unit_map.add(loc, *orc).second);
+	}
+
+	// Shake the index through the mutating operations it must track.
+	for(int i = 0; i < 20; ++i) {
+		const map_location src(coord(gen), coord(gen));
+		const map_location dst(coord(gen), coord(gen));
+
+		if(i % 4 == 0 && unit_map.find(src) != unit_map.end()) {
+			unit_map.erase(src);
+		} else if(unit_map.find(src) != unit_map.end() && unit_map.find(dst) == unit_map.end()) {
+			unit_map.move(src, dst);
+		}
+	}
+
+	for(int trial = 0; trial < 50; ++trial) {
+		const map_location center(coord(gen), coord(gen));
+		const std::size_t radius = trial % 11;
+
+		std::vector<std::size_t> found;
+		for(const unit_map::unit_iterator& ui : unit_map.find_in_radius(center, radius)) {
+			found.push_back(ui->underlying_id());
+		}
+
+		std::vector<std::size_t> expected;
+		for(const unit& u : unit_map) {
+			if(distance_between(u.get_location(), center) <= radius) {
+				expected.push_back(u.underlying_id());
+			}
+		}
+
+		std::sort(found.begin(), found.end());
+		std::sort(expected.begin(), expected.end());
+		BOOST_CHECK_EQUAL_COLLECTIONS(found.begin(), found.end(), expected.begin(), expected.end());
+	}
+}
+
 /* vim: set ts=4 sw=4: */
 BOOST_AUTO_TEST_SUITE_END()
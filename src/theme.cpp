@@ -670,6 +670,7 @@ bool theme::set_resolution(const SDL_Rect& screen)
 			a->set_title(title_stash_actions[a->get_id()]);
 	}
 
+	++generation_;
 	theme_reset_event_.notify_observers();
 
 	return result;
@@ -859,6 +860,8 @@ void theme::modify(const config& cfg)
 		if(title_stash.find(a->get_id()) != title_stash.end())
 			a->set_title(title_stash[a->get_id()]);
 	}
+
+	++generation_;
 }
 
 theme::object& theme::find_element(const std::string& id)
@@ -973,6 +976,7 @@ void theme::modify_label(const std::string& id, const std::string& text)
 		return;
 	}
 	label->set_text(text);
+	++generation_;
 }
 
 void theme::set_known_themes(const game_config_view* cfg)
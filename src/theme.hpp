@@ -283,6 +283,12 @@ public:
 
 	events::generic_event& theme_reset_event() { return theme_reset_event_; }
 
+	/**
+	 * A counter incremented whenever the theme's visible elements may have
+	 * changed, so renderers can tell when cached output needs recomposing.
+	 */
+	std::size_t generation() const { return generation_; }
+
 private:
 	theme::object& find_element(const std::string& id);
 	void add_object(std::size_t sw, std::size_t sh, const config& cfg);
@@ -313,6 +319,8 @@ private:
 	SDL_Rect screen_dimensions_;
 	std::size_t cur_spec_width_, cur_spec_height_;
 
+	std::size_t generation_ = 0;
+
 	static inline std::map<std::string, config> known_themes{};
 
 public:
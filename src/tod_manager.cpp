@@ -46,6 +46,9 @@ tod_manager::tod_manager(const config& scenario_cfg)
 	, has_turn_event_fired_(!scenario_cfg["it_is_a_new_turn"].to_bool(true))
 	, has_tod_bonus_changed_(false)
 	, has_cfg_liminal_bonus_(false)
+	, illumination_cache_()
+	, illumination_units_version_(0)
+	, illumination_map_version_(0)
 {
 	// ? : operator doesn't work in this case.
 	if(scenario_cfg["current_time"].to_int(-17403) == -17403) {
@@ -216,12 +219,51 @@ const time_of_day& tod_manager::get_area_time_of_day(int area_i, int n_turn) con
 }
 
 const time_of_day tod_manager::get_illuminated_time_of_day(
-	const unit_map& units, const gamemap& map, const map_location& loc, int for_turn) const
+	const unit_map& units, const gamemap& map, const map_location& loc, int for_turn, bool for_display) const
 {
 	// get ToD ignoring illumination
 	time_of_day tod = get_time_of_day(loc, for_turn);
 
 	if(map.on_board_with_border(loc)) {
+		// Only the hex itself and its six neighbors can illuminate it.
+		std::array<map_location, 7> locs;
+		locs[0] = loc;
+		get_adjacent_tiles(loc, locs.data() + 1); // start at [1]
+
+		// Drawing probes this for every visible hex, and walking the
+		// [illuminates] abilities of the nearby units is by far the
+		// expensive part, so display callers may ask for the result to be
+		// memoized. The stamp captures the base time of day plus the
+		// identity and status of the units that could illuminate the hex,
+		// but it cannot see in-place ability changes ([object] granting or
+		// removing illuminates) or state consulted by activation filters,
+		// and entries appear whenever a client happens to draw. Cached
+		// results must therefore never feed synced calculations such as
+		// damage — only rendering, where a briefly stale value is harmless.
+		std::size_t stamp = 0;
+		const std::pair<map_location, int> key(loc, for_turn ? for_turn : turn_);
+		if(for_display) {
+			if(units.version() != illumination_units_version_ || map.version() != illumination_map_version_) {
+				illumination_cache_.clear();
+				illumination_units_version_ = units.version();
+				illumination_map_version_ = map.version();
+			}
+
+			stamp = std::hash<std::string>()(tod.id);
+			stamp = stamp * 97 + tod.lawful_bonus;
+			for(const map_location& l : locs) {
+				const auto itor = units.find(l);
+				if(itor != units.end()) {
+					stamp = stamp * 131 + itor->underlying_id() * 2 + (itor->incapacitated() ? 1 : 0);
+				}
+			}
+
+			const auto cached = illumination_cache_.find(key);
+			if(cached != illumination_cache_.end() && cached->second.first == stamp) {
+				return cached->second.second;
+			}
+		}
+
 		// Now add terrain illumination.
 		const int terrain_light = map.get_terrain_info(loc).light_bonus(tod.lawful_bonus);
 
@@ -232,10 +274,6 @@ const time_of_day tod_manager::get_illuminated_time_of_day(
 		int most_sub = 0;
 
 		// Find the "illuminates" effects from units that can affect loc.
-		std::array<map_location, 7> locs;
-		locs[0] = loc;
-		get_adjacent_tiles(loc, locs.data() + 1); // start at [1]
-
 		for(std::size_t i = 0; i < locs.size(); ++i) {
 			const auto itor = units.find(locs[i]);
 			if(itor != units.end() && !itor->incapacitated()) {
@@ -276,6 +314,10 @@ const time_of_day tod_manager::get_illuminated_time_of_day(
 		// Update the object we will return.
 		tod.bonus_modified = best_result - tod.lawful_bonus;
 		tod.lawful_bonus = best_result;
+
+		if(for_display) {
+			illumination_cache_[key] = std::make_pair(stamp, tod);
+		}
 	}
 
 	return tod;
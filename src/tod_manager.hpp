@@ -75,9 +75,14 @@ class tod_manager
 		 * Returns time of day object for the passed turn at a location.
 		 * tod areas matter, for_turn = 0 means current turn
 		 * taking account of illumination caused by units
+		 *
+		 * for_display enables a per-hex memo whose invalidation cannot track
+		 * every way the result can change (in-place ability grants, statuses
+		 * consulted by activation filters), so it may only be set by
+		 * rendering code, never by anything feeding the synced game state.
 		 */
 		const time_of_day get_illuminated_time_of_day(const unit_map & units, const gamemap & map, const map_location& loc,
-				int for_turn = 0) const;
+				int for_turn = 0, bool for_display = false) const;
 
 		const time_of_day& get_previous_time_of_day() const;
 
@@ -276,4 +281,17 @@ class tod_manager
 		bool has_cfg_liminal_bonus_;
 		//
 		config::attribute_value random_tod_;
+
+		/**
+		 * Memoized results of get_illuminated_time_of_day() for display
+		 * callers only, keyed by hex and turn. Entries are dropped whenever
+		 * the unit map or the terrain changes; each one additionally carries
+		 * a stamp of the base time of day and of the identity and status of
+		 * the units around the hex. The stamp is best effort — it misses
+		 * in-place ability changes — which is why synced calculations bypass
+		 * the memo entirely.
+		 */
+		mutable std::map<std::pair<map_location, int>, std::pair<std::size_t, time_of_day>> illumination_cache_;
+		mutable unsigned long long illumination_units_version_;
+		mutable unsigned long long illumination_map_version_;
 };
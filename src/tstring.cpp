@@ -38,6 +38,15 @@ static unsigned language_counter = 0;
 
 namespace
 {
+/**
+ * Guards the shared translation cache in str() as well as language_counter
+ * and the per-instance translated_value_/translation_timestamp_ members.
+ * str() is not main-thread-only: the loading screen's worker resolves
+ * t_strings while the main thread keeps drawing, and two threads can share
+ * one t_string_base through t_string's copy-on-write handle.
+ */
+std::mutex translation_mutex;
+
 const char TRANSLATABLE_PART = 0x01;
 const char UNTRANSLATABLE_PART = 0x02;
 const char TEXTDOMAIN_SEPARATOR = 0x03;
@@ -401,7 +410,18 @@ t_string_base& t_string_base::operator=(const t_string_base& string)
 t_string_base& t_string_base::operator=(const std::string& string)
 {
 	value_ = string;
-	translated_value_ = "";
+	translated_value_.reset();
+	translation_timestamp_ = 0;
+	translatable_ = false;
+	last_untranslatable_ = false;
+
+	return *this;
+}
+
+t_string_base& t_string_base::operator=(std::string&& string)
+{
+	value_ = std::move(string);
+	translated_value_.reset();
 	translation_timestamp_ = 0;
 	translatable_ = false;
 	last_untranslatable_ = false;
@@ -412,7 +432,7 @@ t_string_base& t_string_base::operator=(const std::string& string)
 t_string_base& t_string_base::operator=(const char* string)
 {
 	value_ = string;
-	translated_value_ = "";
+	translated_value_.reset();
 	translation_timestamp_ = 0;
 	translatable_ = false;
 	last_untranslatable_ = false;
@@ -420,6 +440,18 @@ t_string_base& t_string_base::operator=(const char* string)
 	return *this;
 }
 
+std::string t_string_base::extract_value()
+{
+	std::string res = std::move(value_);
+	value_.clear();
+	translated_value_.reset();
+	translation_timestamp_ = 0;
+	translatable_ = false;
+	last_untranslatable_ = false;
+
+	return res;
+}
+
 t_string_base t_string_base::operator+(const t_string_base& string) const
 {
 	t_string_base res(*this);
@@ -458,7 +490,7 @@ t_string_base& t_string_base::operator+=(const t_string_base& string)
 			translatable_ = true;
 			last_untranslatable_ = true;
 		} else {
-			translated_value_ = "";
+			translated_value_.reset();
 		}
 
 		if(string.translatable_) {
@@ -502,7 +534,7 @@ t_string_base& t_string_base::operator+=(const std::string& string)
 		}
 
 		value_ += string;
-		translated_value_ = "";
+		translated_value_.reset();
 	} else {
 		value_ += string;
 	}
@@ -510,6 +542,22 @@ t_string_base& t_string_base::operator+=(const std::string& string)
 	return *this;
 }
 
+t_string_base& t_string_base::operator+=(std::string&& string)
+{
+	if(string.empty()) {
+		return *this;
+	}
+
+	if(value_.empty()) {
+		// Take over the buffer instead of copying it; this is where the
+		// payload of a plain quoted attribute lands.
+		*this = std::move(string);
+		return *this;
+	}
+
+	return *this += string;
+}
+
 t_string_base& t_string_base::operator+=(const char* string)
 {
 	if(string[0] == 0) {
@@ -528,7 +576,7 @@ t_string_base& t_string_base::operator+=(const char* string)
 		}
 
 		value_ += string;
-		translated_value_ = "";
+		translated_value_.reset();
 	} else {
 		value_ += string;
 	}
@@ -562,31 +610,57 @@ const std::string& t_string_base::str() const
 		return value_;
 	}
 
-	if(translatable_ && !translated_value_.empty() && translation_timestamp_ == language_counter) {
-		return translated_value_;
+	const std::lock_guard<std::mutex> lock(translation_mutex);
+
+	if(translated_value_ && translation_timestamp_ == language_counter) {
+		return *translated_value_;
 	}
 
-	translated_value_.clear();
+	// Equal raw values resolve to the same text, so all such instances share
+	// one translation through this cache. When the language changes, the old
+	// strings are parked rather than freed: like the per-instance buffer they
+	// replace, they may still be referenced through earlier str() calls.
+	static std::map<std::string, std::shared_ptr<const std::string>> cache;
+	static std::vector<std::shared_ptr<const std::string>> stale;
+	static unsigned cache_timestamp = language_counter;
+
+	if(cache_timestamp != language_counter) {
+		for(auto& entry : cache) {
+			stale.push_back(std::move(entry.second));
+		}
 
-	for(walker w(*this); !w.eos(); w.next()) {
-		std::string part(w.begin(), w.end());
+		cache.clear();
+		cache_timestamp = language_counter;
+	}
 
-		if(w.translatable()) {
-			if(w.countable()) {
-				std::string plural(w.plural_begin(), w.plural_end());
-				translated_value_ +=
-					translation::dsngettext(w.textdomain().c_str(), part.c_str(), plural.c_str(), w.count());
+	auto cached = cache.find(value_);
+
+	if(cached == cache.end()) {
+		std::string translated;
+
+		for(walker w(*this); !w.eos(); w.next()) {
+			std::string part(w.begin(), w.end());
+
+			if(w.translatable()) {
+				if(w.countable()) {
+					std::string plural(w.plural_begin(), w.plural_end());
+					translated +=
+						translation::dsngettext(w.textdomain().c_str(), part.c_str(), plural.c_str(), w.count());
+				} else {
+					translated +=
+						translation::dsgettext(w.textdomain().c_str(), part.c_str());
+				}
 			} else {
-				translated_value_ +=
-					translation::dsgettext(w.textdomain().c_str(), part.c_str());
+				translated += part;
 			}
-		} else {
-			translated_value_ += part;
 		}
+
+		cached = cache.emplace(value_, std::make_shared<const std::string>(std::move(translated))).first;
 	}
 
+	translated_value_ = cached->second;
 	translation_timestamp_ = language_counter;
-	return translated_value_;
+	return *translated_value_;
 }
 
 t_string::t_string()
@@ -651,6 +725,7 @@ void t_string::add_textdomain(const std::string& name, const std::string& path)
 
 void t_string::reset_translations()
 {
+	const std::lock_guard<std::mutex> lock(translation_mutex);
 	++language_counter;
 }
 
@@ -75,6 +75,7 @@ public:
 	/** Default implementation, but defined out-of-line for efficiency reasons. */
 	t_string_base& operator=(const t_string_base&);
 	t_string_base& operator=(const std::string&);
+	t_string_base& operator=(std::string&&);
 	t_string_base& operator=(const char*);
 
 	t_string_base operator+(const t_string_base&) const;
@@ -83,6 +84,7 @@ public:
 
 	t_string_base& operator+=(const t_string_base&);
 	t_string_base& operator+=(const std::string&);
+	t_string_base& operator+=(std::string&&);
 	t_string_base& operator+=(const char*);
 
 	bool operator==(const t_string_base &) const;
@@ -109,13 +111,19 @@ public:
 	// Warning: value() may contain platform dependent prefix bytes !
 	// Consider base_str() for a more reliable untranslated string
 	const std::string& value() const                 { return value_; }
+	/** Moves the raw value out of the string, leaving this string empty. */
+	std::string extract_value();
 	std::string base_str() const;
 
 	std::size_t hash_value() const;
 
 private:
 	std::string value_;
-	mutable std::string translated_value_;
+	/**
+	 * The resolved translation, shared with every other instance that has
+	 * the same raw value through the cache in tstring.cpp.
+	 */
+	mutable std::shared_ptr<const std::string> translated_value_;
 	mutable unsigned translation_timestamp_;
 	bool translatable_, last_untranslatable_;
 	static inline std::vector<std::string> id_to_textdomain;
@@ -179,6 +179,21 @@ bool affects_side(const config& cfg, std::size_t side, std::size_t other_side)
 
 }
 
+bool unit::has_adjacent_ability(const std::string& tag_name) const
+{
+	if(!adjacent_ability_tags_built_) {
+		adjacent_ability_tags_.clear();
+		for(const config::any_child ab : abilities_.all_children_range()) {
+			if(!ab.cfg.child_range("affect_adjacent").empty()) {
+				adjacent_ability_tags_.insert(ab.key);
+			}
+		}
+		adjacent_ability_tags_built_ = true;
+	}
+
+	return adjacent_ability_tags_.count(tag_name) != 0;
+}
+
 bool unit::get_ability_bool(const std::string& tag_name, const map_location& loc) const
 {
 	for (const config &i : this->abilities_.child_range(tag_name)) {
@@ -203,6 +218,10 @@ bool unit::get_ability_bool(const std::string& tag_name, const map_location& loc
 		// ourself.
 		if ( &*it == this )
 			continue;
+		// Without [affect_adjacent] nothing can reach us; skip the costly
+		// activation filters below.
+		if (!it->has_adjacent_ability(tag_name))
+			continue;
 		for (const config &j : it->abilities_.child_range(tag_name)) {
 			if (affects_side(j, side(), it->side()) &&
 			    it->ability_active(tag_name, j, adjacent[i]) &&
@@ -243,6 +262,8 @@ unit_ability_list unit::get_abilities(const std::string& tag_name, const map_loc
 		// ourself.
 		if ( &*it == this )
 			continue;
+		if (!it->has_adjacent_ability(tag_name))
+			continue;
 		for(const config& j : it->abilities_.child_range(tag_name)) {
 			if(affects_side(j, side(), it->side())
 				&& it->ability_active(tag_name, j, adjacent[i])
@@ -563,7 +584,7 @@ T get_single_ability_value(const config::attribute_value& v, T def, const unit_a
 				if (auto uptr = units.find_unit_ptr(receiver_loc)) {
 					callable.add("other", wfl::variant(std::make_shared<wfl::unit_callable>(*uptr)));
 				}
-				return formula_handler(wfl::formula(s, new wfl::gamestate_function_symbol_table), callable);
+				return formula_handler(*wfl::cached_gamestate_formula(s), callable);
 			} catch(const wfl::formula_error& e) {
 				lg::log_to_chat() << "Formula error in ability or weapon special: " << e.type << " at " << e.filename << ':' << e.line << ")\n";
 				ERR_WML << "Formula error in ability or weapon special: " << e.type << " at " << e.filename << ':' << e.line << ")";
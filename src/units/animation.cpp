@@ -698,7 +698,11 @@ void unit_animation::add_anims( std::vector<unit_animation> & animations, const
 	for(const animation_branch& ab : prepare_animation(cfg, "healing_anim")) {
 		config anim = ab.merge();
 		anim["apply_to"] = "healing";
-		anim["value"] = anim["damage"];
+
+		// Copy before assigning: operator[] on the left may insert into the
+		// flat attribute map and invalidate a reference returned on the right.
+		const config::attribute_value damage = anim["damage"];
+		anim["value"] = damage;
 
 		if(anim["layer"].empty()) {
 			anim["layer"] = default_layer;
@@ -710,7 +714,9 @@ void unit_animation::add_anims( std::vector<unit_animation> & animations, const
 	for(const animation_branch& ab : prepare_animation(cfg, "healed_anim")) {
 		config anim = ab.merge();
 		anim["apply_to"] = "healed";
-		anim["value"] = anim["healing"];
+
+		const config::attribute_value healing = anim["healing"];
+		anim["value"] = healing;
 
 		if(anim["layer"].empty()) {
 			anim["layer"] = default_layer;
@@ -726,7 +732,9 @@ void unit_animation::add_anims( std::vector<unit_animation> & animations, const
 	for(const animation_branch &ab : prepare_animation(cfg, "poison_anim")) {
 		config anim = ab.merge();
 		anim["apply_to"] = "poisoned";
-		anim["value"] = anim["damage"];
+
+		const config::attribute_value damage = anim["damage"];
+		anim["value"] = damage;
 
 		if(anim["layer"].empty()) {
 			anim["layer"] = default_layer;
@@ -765,7 +773,8 @@ void unit_animation::add_anims( std::vector<unit_animation> & animations, const
 		}
 
 		if(!anim["damage"].empty() && anim["value"].empty()) {
-			anim["value"] = anim["damage"];
+			const config::attribute_value damage = anim["damage"];
+			anim["value"] = damage;
 		}
 
 		if(anim["hits"].empty()) {
@@ -861,7 +870,9 @@ void unit_animation::add_anims( std::vector<unit_animation> & animations, const
 
 	for(const animation_branch& ab : prepare_animation(cfg, "extra_anim")) {
 		config anim = ab.merge();
-		anim["apply_to"] = anim["flag"];
+
+		const config::attribute_value flag = anim["flag"];
+		anim["apply_to"] = flag;
 
 		if(anim["layer"].empty()) {
 			anim["layer"] = default_layer;
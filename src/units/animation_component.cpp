@@ -127,7 +127,8 @@ void unit_animation_component::refresh()
 	}
 	display &disp = *display::get_singleton();
 	if (state_ != STATE_STANDING || get_current_animation_tick() < next_idling_ ||
-	    !disp.tile_nearly_on_screen(u_.loc_) || u_.incapacitated())
+	    !disp.tile_nearly_on_screen(u_.loc_) || u_.incapacitated() ||
+	    display::get_zoom_factor() < display::animation_lod_zoom)
 	{
 		return;
 	}
@@ -18,6 +18,7 @@
 #pragma once
 
 #include "halo.hpp"
+#include "sdl/texture.hpp"
 #include "units/animation.hpp" //Note: only needed for enum
 
 class config;
@@ -44,7 +45,8 @@ public:
 		frame_begin_time_(0),
 		draw_bars_(false),
 		refreshing_(false),
-		unit_halo_() {}
+		unit_halo_(),
+		ellipse_cache_() {}
 
 	/** Copy construct a unit animation component, for use when copy constructing a unit. */
 	unit_animation_component(unit & my_unit, const unit_animation_component & o) :
@@ -56,7 +58,8 @@ public:
 		frame_begin_time_(o.frame_begin_time_),
 		draw_bars_(o.draw_bars_),
 		refreshing_(o.refreshing_),
-		unit_halo_() {}
+		unit_halo_(),
+		ellipse_cache_() {}
 
 	/** Chooses an appropriate animation from the list of known animations. */
 	const unit_animation* choose_animation(
@@ -105,6 +108,12 @@ public:
 	/** Get a pointer to the current animation. */
 	unit_animation* get_animation() const { return anim_.get(); }
 
+	/**
+	 * Whether the current animation is purely cosmetic (standing or idling),
+	 * i.e. may be frozen without losing game-relevant motion.
+	 */
+	bool is_cosmetic_animation() const { return state_ == STATE_STANDING || state_ == STATE_FORGET; }
+
 	/** Get the flags of all registered animations. */
 	std::vector<std::string> get_flags();
 
@@ -134,4 +143,22 @@ private:
 
 	/** handle to the halo of this unit */
 	halo::handle unit_halo_;
+
+	/**
+	 * The team-colored ellipse textures resolved for the current combination
+	 * of inputs, kept so the drawer does not rebuild two image path strings
+	 * and run two texture cache lookups for every visible unit on every
+	 * frame; see unit_drawer::redraw_unit().
+	 */
+	struct ellipse_cache
+	{
+		std::string base;
+		bool leader = false;
+		bool nozoc = false;
+		bool selected = false;
+		int side = 0;
+		texture back;
+		texture front;
+	};
+	ellipse_cache ellipse_cache_;
 };
@@ -33,6 +33,7 @@
 #include "utils/math.hpp"
 
 #include <cassert>
+#include <map>
 
 static lg::log_domain log_config("config");
 #define ERR_CF LOG_STREAM(err, log_config)
@@ -97,48 +98,78 @@ std::string attack_type::accuracy_parry_description() const
 	return s.str();
 }
 
+namespace
+{
+	/**
+	 * Value-keyed caches of the parsed forms of [filter_attack] attributes.
+	 * The same few filter texts are evaluated over and over during strike
+	 * calculations, so the list splitting and range parsing is done once per
+	 * distinct attribute value rather than once per query. Keying on the text
+	 * itself means no invalidation is ever needed.
+	 */
+	const std::vector<std::string>& cached_split(const std::string& value)
+	{
+		static std::map<std::string, std::vector<std::string>> cache;
+		auto it = cache.find(value);
+		if(it == cache.end()) {
+			it = cache.emplace(value, utils::split(value)).first;
+		}
+		return it->second;
+	}
+
+	const std::vector<std::pair<int, int>>& cached_ranges(const std::string& value)
+	{
+		static std::map<std::string, std::vector<std::pair<int, int>>> cache;
+		auto it = cache.find(value);
+		if(it == cache.end()) {
+			it = cache.emplace(value, utils::parse_ranges(value)).first;
+		}
+		return it->second;
+	}
+}
+
 /**
  * Returns whether or not *this matches the given @a filter, ignoring the
  * complexities introduced by [and], [or], and [not].
  */
 static bool matches_simple_filter(const attack_type & attack, const config & filter)
 {
-	const std::vector<std::string>& filter_range = utils::split(filter["range"]);
+	const std::vector<std::string>& filter_range = cached_split(filter["range"].str());
 	const std::string& filter_damage = filter["damage"];
 	const std::string& filter_attacks = filter["number"];
 	const std::string& filter_accuracy = filter["accuracy"];
 	const std::string& filter_parry = filter["parry"];
 	const std::string& filter_movement = filter["movement_used"];
 	const std::string& filter_attacks_used = filter["attacks_used"];
-	const std::vector<std::string> filter_name = utils::split(filter["name"]);
-	const std::vector<std::string> filter_type = utils::split(filter["type"]);
-	const std::vector<std::string> filter_special = utils::split(filter["special"]);
-	const std::vector<std::string> filter_special_id = utils::split(filter["special_id"]);
-	const std::vector<std::string> filter_special_type = utils::split(filter["special_type"]);
-	const std::vector<std::string> filter_special_active = utils::split(filter["special_active"]);
-	const std::vector<std::string> filter_special_id_active = utils::split(filter["special_id_active"]);
-	const std::vector<std::string> filter_special_type_active = utils::split(filter["special_type_active"]);
+	const std::vector<std::string>& filter_name = cached_split(filter["name"].str());
+	const std::vector<std::string>& filter_type = cached_split(filter["type"].str());
+	const std::vector<std::string>& filter_special = cached_split(filter["special"].str());
+	const std::vector<std::string>& filter_special_id = cached_split(filter["special_id"].str());
+	const std::vector<std::string>& filter_special_type = cached_split(filter["special_type"].str());
+	const std::vector<std::string>& filter_special_active = cached_split(filter["special_active"].str());
+	const std::vector<std::string>& filter_special_id_active = cached_split(filter["special_id_active"].str());
+	const std::vector<std::string>& filter_special_type_active = cached_split(filter["special_type_active"].str());
 	const std::string filter_formula = filter["formula"];
 
 	if ( !filter_range.empty() && std::find(filter_range.begin(), filter_range.end(), attack.range()) == filter_range.end() )
 		return false;
 
-	if ( !filter_damage.empty() && !in_ranges(attack.damage(), utils::parse_ranges(filter_damage)) )
+	if ( !filter_damage.empty() && !in_ranges(attack.damage(), cached_ranges(filter_damage)) )
 		return false;
 
-	if (!filter_attacks.empty() && !in_ranges(attack.num_attacks(), utils::parse_ranges(filter_attacks)))
+	if (!filter_attacks.empty() && !in_ranges(attack.num_attacks(), cached_ranges(filter_attacks)))
 		return false;
 
-	if (!filter_accuracy.empty() && !in_ranges(attack.accuracy(), utils::parse_ranges(filter_accuracy)))
+	if (!filter_accuracy.empty() && !in_ranges(attack.accuracy(), cached_ranges(filter_accuracy)))
 		return false;
 
-	if (!filter_parry.empty() && !in_ranges(attack.parry(), utils::parse_ranges(filter_parry)))
+	if (!filter_parry.empty() && !in_ranges(attack.parry(), cached_ranges(filter_parry)))
 		return false;
 
-	if (!filter_movement.empty() && !in_ranges(attack.movement_used(), utils::parse_ranges(filter_movement)))
+	if (!filter_movement.empty() && !in_ranges(attack.movement_used(), cached_ranges(filter_movement)))
 		return false;
 
-	if (!filter_attacks_used.empty() && !in_ranges(attack.attacks_used(), utils::parse_ranges(filter_attacks_used)))
+	if (!filter_attacks_used.empty() && !in_ranges(attack.attacks_used(), cached_ranges(filter_attacks_used)))
 		return false;
 
 	if ( !filter_name.empty() && std::find(filter_name.begin(), filter_name.end(), attack.id()) == filter_name.end() )
@@ -226,8 +257,8 @@ static bool matches_simple_filter(const attack_type & attack, const config & fil
 	if (!filter_formula.empty()) {
 		try {
 			const wfl::attack_type_callable callable(attack);
-			const wfl::formula form(filter_formula, new wfl::gamestate_function_symbol_table);
-			if(!form.evaluate(callable).as_bool()) {
+			const wfl::const_formula_ptr form = wfl::cached_gamestate_formula(filter_formula);
+			if(!form->evaluate(callable).as_bool()) {
 				return false;
 			}
 		} catch(const wfl::formula_error& e) {
@@ -164,6 +164,18 @@ unit_drawer::unit_drawer(display& thedisp)
 	assert(disp.team_valid());
 }
 
+texture unit_drawer::orb_texture(bool two_color_ally, orb_status os) const
+{
+	auto [iter, fresh] = orb_cache_.try_emplace({two_color_ally, os});
+	if(fresh) {
+		auto locator = two_color_ally ? get_playing_ally_orb_image(os) : get_orb_image(os);
+		if(locator != nullptr) {
+			iter->second = image::get_texture(*locator);
+		}
+	}
+	return iter->second;
+}
+
 void unit_drawer::redraw_unit(const unit& u) const
 {
 	unit_animation_component & ac = u.anim_comp();
@@ -301,17 +313,35 @@ void unit_drawer::redraw_unit(const unit& u) const
 
 		if(ellipse != "none") {
 			// check if the unit has a ZoC or can recruit
-			const std::string nozoc    = !emit_zoc      ? "nozoc-"    : "";
-			const std::string leader   = can_recruit    ? "leader-"   : "";
-			const std::string selected = is_selected_hex? "selected-" : "";
-			const std::string tc       = team::get_side_color_id(side);
-
-			const std::string ellipse_top = formatter() << ellipse << "-" << leader << nozoc << selected << "top.png~RC(ellipse_red>" << tc << ")";
-			const std::string ellipse_bot = formatter() << ellipse << "-" << leader << nozoc << selected << "bottom.png~RC(ellipse_red>" << tc << ")";
+			const bool nozoc = !emit_zoc;
+
+			// The composed paths and the cache lookups are the same frame
+			// after frame, so the resolved textures are kept on the animation
+			// component until one of their inputs changes.
+			auto& ec = ac.ellipse_cache_;
+			if(!ec.back || ec.base != ellipse || ec.leader != can_recruit || ec.nozoc != nozoc
+				|| ec.selected != is_selected_hex || ec.side != side)
+			{
+				const std::string nozoc_s  = nozoc          ? "nozoc-"    : "";
+				const std::string leader   = can_recruit    ? "leader-"   : "";
+				const std::string selected = is_selected_hex? "selected-" : "";
+				const std::string tc       = team::get_side_color_id(side);
+
+				const std::string ellipse_top = formatter() << ellipse << "-" << leader << nozoc_s << selected << "top.png~RC(ellipse_red>" << tc << ")";
+				const std::string ellipse_bot = formatter() << ellipse << "-" << leader << nozoc_s << selected << "bottom.png~RC(ellipse_red>" << tc << ")";
+
+				// Load the ellipse parts recolored to match team color
+				ec.base = ellipse;
+				ec.leader = can_recruit;
+				ec.nozoc = nozoc;
+				ec.selected = is_selected_hex;
+				ec.side = side;
+				ec.back = image::get_texture(image::locator(ellipse_top));
+				ec.front = image::get_texture(image::locator(ellipse_bot));
+			}
 
-			// Load the ellipse parts recolored to match team color
-			ellipse_back = image::get_texture(image::locator(ellipse_top));
-			ellipse_front = image::get_texture(image::locator(ellipse_bot));
+			ellipse_back = ec.back;
+			ellipse_front = ec.front;
 		}
 	}
 
@@ -346,12 +376,11 @@ void unit_drawer::redraw_unit(const unit& u) const
 			yoff = cfg_offset_y.to_int();
 		}
 
-		using namespace orb_status_helper;
-		std::unique_ptr<image::locator> orb_img = nullptr;
+		texture orb_tex;
 
 		if(viewing_team_ref.is_enemy(side)) {
 			if(!u.incapacitated())
-				orb_img = get_orb_image(orb_status::enemy);
+				orb_tex = orb_texture(false, orb_status::enemy);
 		} else if(static_cast<std::size_t>(side) != playing_team + 1) {
 			// We're looking at either the player's own unit or an ally's unit, but either way it
 			// doesn't belong to the playing_team and isn't expected to move until after its next
@@ -359,22 +388,20 @@ void unit_drawer::redraw_unit(const unit& u) const
 			auto os = orb_status::moved;
 			if(static_cast<std::size_t>(side) != viewing_team + 1)
 				os = orb_status::allied;
-			orb_img = get_orb_image(os);
+			orb_tex = orb_texture(false, os);
 		} else if(static_cast<std::size_t>(side) != viewing_team + 1) {
 			// We're looking at an ally's unit, during that ally's turn.
-			auto os = dc.unit_orb_status(u);
-			orb_img = get_playing_ally_orb_image(os);
+			orb_tex = orb_texture(true, dc.unit_orb_status(u));
 		} else {
 			// We're looking at the player's own unit, during the player's turn.
-			auto os = dc.unit_orb_status(u);
-			orb_img = get_orb_image(os);
+			orb_tex = orb_texture(false, dc.unit_orb_status(u));
 		}
 
 		// All the various overlay textures to draw with the HP/XP bars
 		std::vector<texture> textures;
 
-		if(orb_img != nullptr) {
-			textures.push_back(image::get_texture(*orb_img));
+		if(orb_tex) {
+			textures.push_back(std::move(orb_tex));
 		}
 
 		if(can_recruit) {
@@ -26,6 +26,8 @@
 
 #include "map/location.hpp"
 #include "sdl/rect.hpp"
+#include "sdl/texture.hpp"
+#include "units/orb_status.hpp"
 #include "utils/math.hpp"
 
 #include <map>
@@ -68,6 +70,19 @@ private:
 	int hex_size;
 	int hex_size_by_2;
 
+	/**
+	 * Orb textures resolved so far during this draw pass, keyed by the orb
+	 * status and whether the two-color ally variant was requested. In a big
+	 * battle most units show one of a handful of orbs, so the image path
+	 * composition and texture lookup run per distinct orb instead of per
+	 * unit; since the drawer lives for a single pass, preference changes
+	 * are picked up on the next frame.
+	 */
+	mutable std::map<std::pair<bool, orb_status>, texture> orb_cache_;
+
+	/** Resolves an orb texture through orb_cache_. Empty if the orb is hidden. */
+	texture orb_texture(bool two_color_ally, orb_status os) const;
+
 public:
 	/** draw a unit.  */
 	void redraw_unit(const unit & u) const;
@@ -114,6 +114,11 @@ struct unit_filter_xy : public unit_filter_base
 		}
 	}
 
+	virtual int matches_cost() const override
+	{
+		return cost_interpolated;
+	}
+
 	const std::string x_;
 	const std::string y_;
 };
@@ -156,6 +161,11 @@ struct unit_filter_adjacent : public unit_filter_base
 		return in_ranges(match_count, !i_count.blank() ? utils::parse_ranges(i_count) : default_counts);
 	}
 
+	virtual int matches_cost() const override
+	{
+		return cost_subfilter;
+	}
+
 	const unit_filter_compound child_;
 	const vconfig cfg_;
 };
@@ -169,6 +179,10 @@ struct unit_filter_child_literal : public unit_filter_base
 	{
 		return f_(v_, args);
 	}
+	virtual int matches_cost() const override
+	{
+		return cost_subfilter;
+	}
 	vconfig v_;
 	F f_;
 };
@@ -176,28 +190,38 @@ struct unit_filter_child_literal : public unit_filter_base
 template<typename T, typename F>
 struct unit_filter_attribute_parsed : public unit_filter_base
 {
-	unit_filter_attribute_parsed(T&& v, F&& f) : v_(std::move(v)), f_(std::move(f)) {}
+	unit_filter_attribute_parsed(T&& v, F&& f, int cost) : v_(std::move(v)), f_(std::move(f)), cost_(cost) {}
 	virtual bool matches(const unit_filter_args& args) const override
 	{
 		return f_(v_, args);
 	}
+	virtual int matches_cost() const override
+	{
+		return cost_;
+	}
 	T v_;
 	F f_;
+	int cost_;
 };
 
 template<typename C, typename F>
 struct unit_filter_attribute_literal : public unit_filter_base
 {
-	unit_filter_attribute_literal(std::string&& v, C&& c, F&& f) : v_(std::move(v)), c_(std::move(c)), f_(std::move(f)) {}
+	unit_filter_attribute_literal(std::string&& v, C&& c, F&& f, int cost) : v_(std::move(v)), c_(std::move(c)), f_(std::move(f)), cost_(cost) {}
 	virtual bool matches(const unit_filter_args& args) const override
 	{
 		config::attribute_value v;
 		v = utils::interpolate_variables_into_string(v_, *(resources::gamedata));
 		return f_(c_(v), args);
 	}
+	virtual int matches_cost() const override
+	{
+		return cost_;
+	}
 	std::string v_;
 	C c_;
 	F f_;
+	int cost_;
 };
 
 class contains_dollar_visitor
@@ -282,15 +306,16 @@ void unit_filter_compound::create_child(const vconfig& c, F func)
 }
 
 template<typename C, typename F>
-void unit_filter_compound::create_attribute(const config::attribute_value v, C conv, F func)
+void unit_filter_compound::create_attribute(const config::attribute_value v, C conv, F func, int cost)
 {
 	if(v.blank()) {
 	}
 	else if(v.apply_visitor(contains_dollar_visitor())) {
-		children_.emplace_back(new unit_filter_attribute_literal<C, F>(std::move(v.str()), std::move(conv), std::move(func)));
+		// Interpolation happens on every match, so the predicate can never rank cheaper than that.
+		children_.emplace_back(new unit_filter_attribute_literal<C, F>(std::move(v.str()), std::move(conv), std::move(func), std::max<int>(cost, cost_interpolated)));
 	}
 	else {
-		children_.emplace_back(new unit_filter_attribute_parsed<decltype(conv(v)), F>(std::move(conv(v)), std::move(func)));
+		children_.emplace_back(new unit_filter_attribute_parsed<decltype(conv(v)), F>(std::move(conv(v)), std::move(func), cost));
 	}
 }
 
@@ -358,7 +383,8 @@ void unit_filter_compound::fill(vconfig cfg)
 					}
 				}
 				return types_expanded.find(args.u.type_id()) != types_expanded.end();
-			}
+			},
+			cost_derived
 		);
 
 		create_attribute(literal["variation"],
@@ -445,7 +471,8 @@ void unit_filter_compound::fill(vconfig cfg)
 					}
 				}
 				return false;
-			}
+			},
+			cost_subfilter
 		);
 
 		create_attribute(literal["ability_type_active"],
@@ -458,7 +485,8 @@ void unit_filter_compound::fill(vconfig cfg)
 					}
 				}
 				return false;
-			}
+			},
+			cost_subfilter
 		);
 
 		create_attribute(literal["trait"],
@@ -477,7 +505,8 @@ void unit_filter_compound::fill(vconfig cfg)
 				std::sort(have_traits.begin(), have_traits.end());
 				std::set_intersection(check_traits.begin(), check_traits.end(), have_traits.begin(), have_traits.end(), std::back_inserter(isect));
 				return !isect.empty();
-			}
+			},
+			cost_derived
 		);
 
 		create_attribute(literal["race"],
@@ -639,7 +668,8 @@ void unit_filter_compound::fill(vconfig cfg)
 					}
 				}
 				return false;
-			}
+			},
+			cost_derived
 		);
 
 		create_attribute(literal["movement_cost"],
@@ -653,7 +683,8 @@ void unit_filter_compound::fill(vconfig cfg)
 					}
 				}
 				return false;
-			}
+			},
+			cost_derived
 		);
 
 		create_attribute(literal["vision_cost"],
@@ -667,7 +698,8 @@ void unit_filter_compound::fill(vconfig cfg)
 					}
 				}
 				return false;
-			}
+			},
+			cost_derived
 		);
 
 		create_attribute(literal["jamming_cost"],
@@ -681,7 +713,8 @@ void unit_filter_compound::fill(vconfig cfg)
 					}
 				}
 				return false;
-			}
+			},
+			cost_derived
 		);
 
 		create_attribute(literal["lua_function"],
@@ -692,14 +725,15 @@ void unit_filter_compound::fill(vconfig cfg)
 					return lk->run_filter(lua_function.c_str(), args.u);
 				}
 				return true;
-			}
+			},
+			cost_subfilter
 		);
 
 		create_attribute(literal["formula"],
 			[](const config::attribute_value& c)
 			{
 				//TODO: catch syntax error.
-				return wfl::formula(c, new wfl::gamestate_function_symbol_table());
+				return *wfl::cached_gamestate_formula(c);
 			},
 			[](const wfl::formula& form, const unit_filter_args& args)
 			{
@@ -721,7 +755,8 @@ void unit_filter_compound::fill(vconfig cfg)
 					// Formulae with syntax errors match nothing
 					return false;
 				}
-			}
+			},
+			cost_subfilter
 		);
 
 		create_attribute(literal["find_in"],
@@ -746,7 +781,8 @@ void unit_filter_compound::fill(vconfig cfg)
 					}
 				}
 				return true;
-			}
+			},
+			cost_derived
 		);
 
 		if (!literal["x"].blank() || !literal["y"].blank()) {
@@ -823,4 +859,15 @@ void unit_filter_compound::fill(vconfig cfg)
 			}
 
 		}
+
+		// The predicates above are all ANDed together, so run the cheap
+		// rejections before formulas, Lua and nested filters ever get
+		// evaluated. The sort is stable to keep the order within each cost
+		// class as written. [and]/[or]/[not] are applied afterwards with
+		// in-order precedence and must not be reordered.
+		std::stable_sort(children_.begin(), children_.end(),
+			[](const std::shared_ptr<unit_filter_base>& a, const std::shared_ptr<unit_filter_base>& b)
+			{
+				return a->matches_cost() < b->matches_cost();
+			});
 	}
@@ -77,9 +77,33 @@ namespace unit_filter_impl
 		{}
 	};
 
+	/** Relative evaluation cost of a predicate, used to test cheap ones first. */
+	enum filter_cost : int
+	{
+		/** A plain comparison against unit data parsed up front. */
+		cost_attribute = 1,
+		/** Needs a terrain lookup or builds temporary containers per match. */
+		cost_derived = 2,
+		/** Re-interpolates $variables into the attribute on every match. */
+		cost_interpolated = 3,
+		/** Nested filters and WFL or Lua evaluation. */
+		cost_subfilter = 4,
+	};
+
 	struct unit_filter_base
 	{
 		virtual bool matches(const unit_filter_args&) const = 0;
+
+		/**
+		 * The cost class of evaluating this predicate once. The compound
+		 * filter runs its cheapest predicates first, so an expensive check
+		 * is only ever reached for units that passed everything cheaper.
+		 */
+		virtual int matches_cost() const
+		{
+			return cost_attribute;
+		}
+
 		virtual ~unit_filter_base() {}
 	};
 
@@ -88,7 +112,7 @@ namespace unit_filter_impl
 		unit_filter_compound(vconfig cfg);
 
 		template<typename C, typename F>
-		void create_attribute(const config::attribute_value c, C conv, F func);
+		void create_attribute(const config::attribute_value c, C conv, F func, int cost = cost_attribute);
 		template<typename F>
 		void create_child(const vconfig& c, F func);
 
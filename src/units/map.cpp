@@ -19,6 +19,7 @@
 #include "units/unit.hpp"
 
 #include "units/map.hpp"
+#include <algorithm>
 #include <functional>
 
 static lg::log_domain log_engine("engine");
@@ -30,12 +31,16 @@ static lg::log_domain log_engine("engine");
 unit_map::unit_map()
 	: umap_()
 	, lmap_()
+	, smap_()
+	, version_(0)
 {
 }
 
 unit_map::unit_map(const unit_map& that)
 	: umap_()
 	, lmap_()
+	, smap_()
+	, version_(0)
 {
 	for(const auto& u : that) {
 		add(u.get_location(), u);
@@ -55,6 +60,11 @@ void unit_map::swap(unit_map& o)
 
 	std::swap(umap_, o.umap_);
 	std::swap(lmap_, o.lmap_);
+	std::swap(smap_, o.smap_);
+
+	// Keep both counters monotonic rather than swapping them, so that stamps
+	// taken before the swap compare stale on either map.
+	version_ = o.version_ = std::max(version_, o.version_) + 1;
 }
 
 unit_map::~unit_map()
@@ -126,6 +136,10 @@ unit_map::umap_retval_pair_t unit_map::move(const map_location& src, const map_l
 		return std::pair(make_unit_iterator(uit), false);
 	}
 
+	bucket_erase(src, uit);
+	bucket_insert(dst, uit);
+
+	++version_;
 	self_check();
 
 	return std::pair(make_unit_iterator(uit), true);
@@ -208,6 +222,9 @@ unit_map::umap_retval_pair_t unit_map::insert(unit_ptr p)
 		return std::pair(make_unit_iterator(umap_.end()), false);
 	}
 
+	bucket_insert(loc, uinsert.first);
+
+	++version_;
 	self_check();
 	return std::pair(make_unit_iterator(uinsert.first), true);
 }
@@ -253,6 +270,8 @@ void unit_map::clear(bool force)
 
 	lmap_.clear();
 	umap_.clear();
+	smap_.clear();
+	++version_;
 }
 
 unit_ptr unit_map::extract(const map_location& loc)
@@ -272,6 +291,11 @@ unit_ptr unit_map::extract(const map_location& loc)
 	DBG_NG << "Extract unit " << uid << " - " << u->id() << " from location: (" << loc << ")";
 
 	assert(uit->first == uit->second.unit->underlying_id());
+
+	// The spatial index holds umap iterators, so drop its entry before the
+	// hard-extraction branch below can erase what it refers to.
+	bucket_erase(loc, uit);
+
 	if(uit->second.ref_count == 0) {
 		umap_.erase(uit);
 	} else {
@@ -280,6 +304,7 @@ unit_ptr unit_map::extract(const map_location& loc)
 	}
 
 	lmap_.erase(i);
+	++version_;
 	self_check();
 
 	return u;
@@ -316,6 +341,71 @@ unit_map::unit_iterator unit_map::find(const map_location& loc)
 	return make_unit_iterator<lmap::iterator>(lmap_.find(loc));
 }
 
+void unit_map::bucket_insert(const map_location& loc, const umap::iterator& uit)
+{
+	smap_[bucket_of(loc)].push_back(uit);
+}
+
+void unit_map::bucket_erase(const map_location& loc, const umap::iterator& uit)
+{
+	const smap::iterator bucket = smap_.find(bucket_of(loc));
+	assert(bucket != smap_.end());
+
+	std::vector<umap::iterator>& entries = bucket->second;
+	const auto pos = std::find(entries.begin(), entries.end(), uit);
+	assert(pos != entries.end());
+
+	// Order within a bucket carries no meaning, so swap with the last entry.
+	*pos = entries.back();
+	entries.pop_back();
+
+	if(entries.empty()) {
+		smap_.erase(bucket);
+	}
+}
+
+std::vector<unit_map::unit_iterator> unit_map::find_in_radius(const map_location& center, std::size_t radius)
+{
+	self_check();
+
+	std::vector<unit_iterator> res;
+
+	// The hex distance is never smaller than the coordinate difference along
+	// either axis, so buckets outside this box cannot contain a match.
+	const int r = static_cast<int>(radius);
+	const int min_bx = (center.x - r) >> bucket_shift, max_bx = (center.x + r) >> bucket_shift;
+	const int min_by = (center.y - r) >> bucket_shift, max_by = (center.y + r) >> bucket_shift;
+
+	for(int bx = min_bx; bx <= max_bx; ++bx) {
+		for(int by = min_by; by <= max_by; ++by) {
+			const smap::const_iterator bucket = smap_.find(map_location(bx, by));
+			if(bucket == smap_.end()) {
+				continue;
+			}
+
+			for(const umap::iterator& uit : bucket->second) {
+				if(distance_between(uit->second.unit->get_location(), center) <= radius) {
+					res.push_back(make_unit_iterator(uit));
+				}
+			}
+		}
+	}
+
+	// Bucket traversal follows hash order, which is not portable; sort by
+	// underlying id so callers see the same order plain iteration gives.
+	std::sort(res.begin(), res.end(), [](const unit_iterator& a, const unit_iterator& b) {
+		return a->underlying_id() < b->underlying_id();
+	});
+
+	return res;
+}
+
+std::vector<unit_map::const_unit_iterator> unit_map::find_in_radius(const map_location& center, std::size_t radius) const
+{
+	const std::vector<unit_iterator>& res = const_cast<unit_map*>(this)->find_in_radius(center, radius);
+	return std::vector<const_unit_iterator>(res.begin(), res.end());
+}
+
 unit_map::unit_iterator unit_map::find_leader(int side)
 {
 	unit_map::iterator i = begin(), i_end = end();
@@ -411,6 +501,26 @@ bool unit_map::self_check() const
 		}
 	}
 
+	std::size_t bucket_entries(0);
+	smap::const_iterator bit(smap_.begin());
+	for(; bit != smap_.end(); ++bit) {
+		if(bit->second.empty()) {
+			good = false;
+			ERR_NG << "unit_map smap keeps an empty bucket ";
+		}
+		bucket_entries += bit->second.size();
+		for(const umap::iterator& uit : bit->second) {
+			if(bucket_of(uit->second.unit->get_location()) != bit->first) {
+				good = false;
+				ERR_NG << "unit_map smap unit filed under the wrong bucket ";
+			}
+		}
+	}
+	if(bucket_entries != lmap_.size()) {
+		good = false;
+		ERR_NG << "unit_map smap entry count != lmap size ";
+	}
+
 	// assert(good);
 	return good;
 #else
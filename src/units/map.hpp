@@ -24,6 +24,7 @@
 #include <list>
 #include <map>
 #include <unordered_map>
+#include <vector>
 
 //#define DEBUG_UNIT_MAP
 
@@ -120,6 +121,14 @@ class unit_map
 	/** Map of location to umap iterator. */
 	typedef std::unordered_map<map_location, umap::iterator> lmap;
 
+	/**
+	 * Map of bucket coordinate to the umap iterators of the units standing
+	 * inside that bucket, see @ref bucket_of. Entries for empty buckets are
+	 * removed, so iterating the buckets overlapping an area only ever visits
+	 * occupied regions of the map.
+	 */
+	typedef std::unordered_map<map_location, std::vector<umap::iterator>> smap;
+
 public:
 	// ~~~ Begin iterator code ~~~
 
@@ -398,6 +407,17 @@ public:
 		return res != end() ? unit_const_ptr(res.get_shared_ptr()) : unit_const_ptr();
 	}
 
+	/**
+	 * Finds all units within @a radius hexes of @a center, including one
+	 * standing on it. Served from a bucketed spatial index kept in sync by
+	 * the mutating operations, so the cost scales with the queried area
+	 * rather than the number of units on the map. The result is ordered by
+	 * underlying id, matching plain iteration order.
+	 */
+	std::vector<unit_iterator> find_in_radius(const map_location& center, std::size_t radius);
+
+	std::vector<const_unit_iterator> find_in_radius(const map_location& center, std::size_t radius) const;
+
 	unit_iterator find_leader(int side);
 
 	const_unit_iterator find_leader(int side) const
@@ -448,6 +468,17 @@ public:
 		return lmap_.empty();
 	}
 
+	/**
+	 * Counter incremented by every successful mutation (insert, move, extract,
+	 * clear and the operations built on top of them). Holders of data derived
+	 * from the unit placement, such as cached cost maps, can compare a stored
+	 * value against this to detect that a rebuild is needed.
+	 */
+	unsigned long long version() const
+	{
+		return version_;
+	}
+
 	void clear(bool force = false);
 
 	using umap_retval_pair_t = std::pair<unit_iterator, bool>;
@@ -543,6 +574,21 @@ public:
 private:
 	umap::iterator begin_core() const;
 
+	/** Width and height of a spatial bucket, as a power of two. */
+	static constexpr int bucket_shift = 3;
+
+	/** The bucket containing @a loc. The arithmetic shift keeps negative coordinates consistent. */
+	static map_location bucket_of(const map_location& loc)
+	{
+		return map_location(loc.x >> bucket_shift, loc.y >> bucket_shift);
+	}
+
+	/** Records @a uit, standing at @a loc, in the spatial index. */
+	void bucket_insert(const map_location& loc, const umap::iterator& uit);
+
+	/** Removes @a uit, standing at @a loc, from the spatial index. */
+	void bucket_erase(const map_location& loc, const umap::iterator& uit);
+
 	bool is_valid(const umap::const_iterator& i) const
 	{
 		return is_found(i) && (i->second.unit != nullptr);
@@ -593,6 +639,14 @@ private:
 	 * location -> umap::iterator.
 	 */
 	lmap lmap_;
+
+	/**
+	 * bucket coordinate -> umap::iterator, see find_in_radius().
+	 */
+	smap smap_;
+
+	/** Incremented on every successful mutation, see version(). */
+	unsigned long long version_;
 };
 
 /** Implement non-member swap function for std::swap (calls @ref unit_map::swap). */
@@ -88,6 +88,7 @@ unit_type::unit_type(const unit_type& o)
 	, do_not_list_(o.do_not_list_)
 	, advances_to_(o.advances_to_)
 	, experience_needed_(o.experience_needed_)
+	, advancement_cache_()
 	, alignment_(o.alignment_)
 	, movement_type_(o.movement_type_)
 	, possible_traits_(o.possible_traits_)
@@ -139,6 +140,7 @@ unit_type::unit_type(defaut_ctor_t, const config& cfg, const std::string & paren
 	, do_not_list_()
 	, advances_to_()
 	, experience_needed_(0)
+	, advancement_cache_()
 	, alignment_(unit_alignments::type::neutral)
 	, movement_type_()
 	, possible_traits_()
@@ -200,12 +202,6 @@ void unit_type::build_full(
 	// Make sure we are built to the preceding build level.
 	build_help_index(mv_types, races, traits);
 
-	for(int i = 0; i < 2; ++i) {
-		if(gender_types_[i]) {
-			gender_types_[i]->build_full(mv_types, races, traits);
-		}
-	}
-
 	if(race_ != &unit_race::null_race) {
 		if(undead_variation_.empty()) {
 			undead_variation_ = race_->undead_variation();
@@ -219,10 +215,8 @@ void unit_type::build_full(
 	hp_bar_scaling_ = get_cfg()["hp_bar_scaling"].to_double(game_config::hp_bar_scaling);
 	xp_bar_scaling_ = get_cfg()["xp_bar_scaling"].to_double(game_config::xp_bar_scaling);
 
-	// Propagate the build to the variations.
-	for(variations_map::value_type& variation : variations_) {
-		variation.second.build_full(mv_types, races, traits);
-	}
+	// The gendered forms and variations are not built here; the accessors
+	// returning them promote each one to our level on first use.
 
 	// Deprecation messages, only seen when unit is parsed for the first time.
 
@@ -271,16 +265,6 @@ void unit_type::build_help_index(
 
 	alignment_ = unit_alignments::get_enum(cfg["alignment"].str()).value_or(unit_alignments::type::neutral);
 
-	for(int i = 0; i < 2; ++i) {
-		if(gender_types_[i]) {
-			gender_types_[i]->build_help_index(mv_types, races, traits);
-		}
-	}
-
-	for(auto& pair : variations_) {
-		pair.second.build_help_index(mv_types, races, traits);
-	}
-
 	const race_map::const_iterator race_it = races.find(cfg["race"]);
 	if(race_it != races.end()) {
 		race_ = &race_it->second;
@@ -380,17 +364,6 @@ void unit_type::build_created()
 	}
 
 
-	for(unsigned i = 0; i < gender_types_.size(); ++i) {
-		if(gender_types_[i]) {
-			gender_types_[i]->build_created();
-		}
-	}
-
-	for(auto& pair : variations_) {
-		pair.second.build_created();
-	}
-
-
 	const config& cfg = get_cfg();
 
 	const std::string& advances_to_val = cfg["advances_to"];
@@ -465,6 +438,8 @@ const unit_type& unit_type::get_gender_unit_type(unit_race::GENDER gender) const
 {
 	const std::size_t i = gender;
 	if(i < gender_types_.size() && gender_types_[i] != nullptr) {
+		// Sub-types are built lazily; catch this one up with us.
+		unit_types.build_unit_type(*gender_types_[i], build_status_);
 		return *gender_types_[i];
 	}
 
@@ -475,12 +450,25 @@ const unit_type& unit_type::get_variation(const std::string& id) const
 {
 	const variations_map::const_iterator i = variations_.find(id);
 	if(i != variations_.end()) {
+		// Sub-types are built lazily; catch this one up with us.
+		unit_types.build_unit_type(i->second, build_status_);
 		return i->second;
 	}
 
 	return *this;
 }
 
+const unit_type::variations_map& unit_type::variation_types() const
+{
+	// Callers iterate the returned map and read from every entry, so this
+	// is the point where all of them have to catch up with our own level.
+	for(const variations_map::value_type& val : variations_) {
+		unit_types.build_unit_type(val.second, build_status_);
+	}
+
+	return variations_;
+}
+
 t_string unit_type::unit_description() const
 {
 	if(description_.empty()) {
@@ -627,26 +615,83 @@ bool unit_type::hide_help() const
 }
 
 
-static void advancement_tree_internal(const std::string& id, std::set<std::string>& tree)
+void unit_type::build_advancement_cache() const
 {
-	const unit_type* ut = unit_types.find(id);
-	if(!ut) {
-		return;
+	advancement_cache_.reset(new advancement_cache());
+
+	// Start from the registered type of our id, like the old recursion
+	// did; for variations this is the base type.
+	const unit_type* start = unit_types.find(id_);
+	if(!start) {
+		start = this;
 	}
 
-	for(const std::string& adv : ut->advances_to()) {
-		if(tree.insert(adv).second) {
-			// insertion succeed, expand the new type
-			advancement_tree_internal(adv, tree);
+	advancement_cache_->max_level = start->level();
+	advancement_cache_->experience = 0;
+
+	// Cheapest cumulative experience to reach each type; advancement
+	// graphs may contain cycles, so only requeue a type when a cheaper
+	// path to it is found.
+	std::map<std::string, int> cheapest;
+	cheapest[start->id()] = 0;
+	std::vector<const unit_type*> queue { start };
+
+	while(!queue.empty()) {
+		const unit_type* ut = queue.back();
+		queue.pop_back();
+		const int gained = cheapest[ut->id()] + ut->experience_needed(false);
+
+		for(const std::string& adv : ut->advances_to()) {
+			advancement_cache_->tree.insert(adv);
+
+			const unit_type* next = unit_types.find(adv);
+			if(!next) {
+				continue;
+			}
+
+			const auto [iter, fresh] = cheapest.emplace(adv, gained);
+			if(!fresh && iter->second <= gained) {
+				continue;
+			}
+
+			iter->second = gained;
+			queue.push_back(next);
+
+			if(next->level() > advancement_cache_->max_level
+				|| (next->level() == advancement_cache_->max_level && gained < advancement_cache_->experience))
+			{
+				advancement_cache_->max_level = next->level();
+				advancement_cache_->experience = gained;
+			}
 		}
 	}
 }
 
-std::set<std::string> unit_type::advancement_tree() const
+const std::set<std::string>& unit_type::advancement_tree() const
+{
+	if(!advancement_cache_) {
+		build_advancement_cache();
+	}
+
+	return advancement_cache_->tree;
+}
+
+int unit_type::advancement_max_level() const
+{
+	if(!advancement_cache_) {
+		build_advancement_cache();
+	}
+
+	return advancement_cache_->max_level;
+}
+
+int unit_type::advancement_experience() const
 {
-	std::set<std::string> tree;
-	advancement_tree_internal(id_, tree);
-	return tree;
+	if(!advancement_cache_) {
+		build_advancement_cache();
+	}
+
+	return advancement_cache_->experience;
 }
 
 const std::vector<std::string> unit_type::advances_from() const
@@ -762,6 +807,8 @@ bool unit_type::has_variation(const std::string& variation_id) const
 bool unit_type::show_variations_in_help() const
 {
 	for(const variations_map::value_type& val : variations_) {
+		// hide_help() needs the variation's race, which means HELP_INDEXED.
+		unit_types.build_unit_type(val.second, HELP_INDEXED);
 		if(!val.second.hide_help()) {
 			return true;
 		}
@@ -1381,15 +1428,15 @@ void unit_type::apply_scenario_fix(const config& cfg)
 		if(!gender_types_[gender]) {
 			continue;
 		}
+		// A later lazy build_created() would overwrite the fix, so make
+		// sure that stage has already run.
+		unit_types.build_unit_type(*gender_types_[gender], CREATED);
 		gender_types_[gender]->apply_scenario_fix(cfg);
 	}
 
-	if(get_cfg().has_child("variation")) {
-		// Make sure the variations are created.
-		unit_types.build_unit_type(*this, VARIATIONS);
-		for(auto& v : variations_) {
-			v.second.apply_scenario_fix(cfg);
-		}
+	for(auto& v : variations_) {
+		unit_types.build_unit_type(v.second, CREATED);
+		v.second.apply_scenario_fix(cfg);
 	}
 }
 
@@ -110,9 +110,21 @@ public:
 
 	/** Get the advancement tree
 	 *  @return A set of ids of all unit_type objects that this unit_type can
-	 *  directly or indirectly advance to.
+	 *  directly or indirectly advance to. Computed once per type and cached,
+	 *  so repeated queries (AI recruitment scoring, help, filters) are
+	 *  indexed reads.
 	 */
-	std::set<std::string> advancement_tree() const;
+	const std::set<std::string>& advancement_tree() const;
+
+	/** The highest level reachable through the advancement tree, including this type's own. */
+	int advancement_max_level() const;
+
+	/**
+	 * The least experience a fresh unit of this type must gain to reach a
+	 * type of advancement_max_level(), without acceleration. Zero if the
+	 * type cannot advance.
+	 */
+	int advancement_experience() const;
 
 	/** A vector of unit_type ids that this unit_type can advance to. */
 	const std::vector<std::string>& advances_to() const { return advances_to_; }
@@ -128,9 +140,14 @@ public:
 	 * @param gender "male" or "female".
 	 */
 	const unit_type& get_gender_unit_type(std::string gender) const;
-	/** Returns a gendered variant of this unit_type based on the given parameter. */
+	/**
+	 * Returns a gendered variant of this unit_type based on the given parameter.
+	 * Gendered forms and variations are built lazily, so the first access to
+	 * one through here pays for its build instead of game start-up.
+	 */
 	const unit_type& get_gender_unit_type(unit_race::GENDER gender) const;
 
+	/** Returns the variation with the given id, built to this type's own level. */
 	const unit_type& get_variation(const std::string& id) const;
 	/** Info on the type of unit that the unit reanimates as. */
 	const std::string& undead_variation() const { return undead_variation_; }
@@ -255,7 +272,8 @@ public:
 	}
 
 	std::vector<std::string> variations() const;
-	const variations_map& variation_types() const {return variations_; }
+	/** Returns all variations, building each to this type's own level. */
+	const variations_map& variation_types() const;
 
 	/**
 	 * @param variation_id		The id of the variation we search for.
@@ -368,6 +386,21 @@ private:
 	std::vector<std::string> advances_to_;
 	int experience_needed_;
 
+	/**
+	 * Everything derived from walking the advancement graph, built once
+	 * by build_advancement_cache() on first use. Lives and dies with the
+	 * unit_type, which is recreated whenever the game config changes.
+	 */
+	struct advancement_cache
+	{
+		std::set<std::string> tree;
+		int max_level;
+		int experience;
+	};
+	mutable std::unique_ptr<advancement_cache> advancement_cache_;
+
+	void build_advancement_cache() const;
+
 
 	unit_alignments::type alignment_;
 
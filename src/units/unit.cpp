@@ -52,6 +52,7 @@
 #include "units/id.hpp"
 #include "units/map.hpp" // for unit_map, etc
 #include "units/types.hpp"
+#include "utils/alloc_tracking.hpp"
 #include "variable.hpp" // for vconfig, etc
 
 #include <cassert>                     // for assert
@@ -266,6 +267,7 @@ unit::unit(const unit& o)
 	, overlays_(o.overlays_)
 	, role_(o.role_)
 	, attacks_(o.attacks_)
+	, attacks_shared_(true)
 	, facing_(o.facing_)
 	, trait_names_(o.trait_names_)
 	, trait_descriptions_(o.trait_descriptions_)
@@ -281,6 +283,8 @@ unit::unit(const unit& o)
 	, xp_bar_scaling_(o.xp_bar_scaling_)
 	, modifications_(o.modifications_)
 	, abilities_(o.abilities_)
+	, adjacent_ability_tags_(o.adjacent_ability_tags_)
+	, adjacent_ability_tags_built_(o.adjacent_ability_tags_built_)
 	, advancements_(o.advancements_)
 	, description_(o.description_)
 	, special_notes_(o.special_notes_)
@@ -295,10 +299,11 @@ unit::unit(const unit& o)
 	, changed_attributes_(o.changed_attributes_)
 	, invisibility_cache_()
 {
-	// Copy the attacks rather than just copying references
-	for(auto& a : attacks_) {
-		a.reset(new attack_type(*a));
-	}
+	// The attack objects stay shared with o until this copy needs to
+	// modify them; see unshare_attacks(). o keeps sole ownership of its
+	// list, so pointers already handed out by o remain attached to it.
+
+	utils::alloc_tracking::track_alloc(utils::alloc_tracking::tag::unit, sizeof(unit));
 }
 
 unit::unit(unit_ctor_t)
@@ -347,6 +352,7 @@ unit::unit(unit_ctor_t)
 	, overlays_()
 	, role_()
 	, attacks_()
+	, attacks_shared_(false)
 	, facing_(map_location::NDIRECTIONS)
 	, trait_names_()
 	, trait_descriptions_()
@@ -362,6 +368,8 @@ unit::unit(unit_ctor_t)
 	, xp_bar_scaling_(0)
 	, modifications_()
 	, abilities_()
+	, adjacent_ability_tags_()
+	, adjacent_ability_tags_built_(false)
 	, advancements_()
 	, description_()
 	, special_notes_()
@@ -374,6 +382,9 @@ unit::unit(unit_ctor_t)
 	, changed_attributes_(0)
 	, invisibility_cache_()
 {
+	// Counted here rather than in an operator new: unit::create() goes
+	// through std::make_shared, which never calls a class-scope operator.
+	utils::alloc_tracking::track_alloc(utils::alloc_tracking::tag::unit, sizeof(unit));
 }
 
 void unit::init(const config& cfg, bool use_traits, const vconfig* vcfg)
@@ -564,6 +575,7 @@ void unit::init(const config& cfg, bool use_traits, const vconfig* vcfg)
 	if(config::const_child_itors cfg_range = cfg.child_range("attack")) {
 		set_attr_changed(UA_ATTACKS);
 		attacks_.clear();
+		attacks_shared_ = false;
 		for(const config& c : cfg_range) {
 			attacks_.emplace_back(new attack_type(c));
 		}
@@ -595,6 +607,7 @@ void unit::init(const config& cfg, bool use_traits, const vconfig* vcfg)
 		for(const config& abilities : cfg_range) {
 			abilities_.append(abilities);
 		}
+		adjacent_ability_tags_built_ = false;
 	}
 
 	if(const config::attribute_value* v = cfg.get("alignment")) {
@@ -709,6 +722,8 @@ void unit::init(const unit_type& u_type, int side, bool real_unit, unit_race::GE
 
 unit::~unit()
 {
+	utils::alloc_tracking::track_free(utils::alloc_tracking::tag::unit, sizeof(unit));
+
 	try {
 		anim_comp_->clear_haloes();
 
@@ -777,6 +792,7 @@ void unit::swap(unit & o)
 	swap(overlays_, o.overlays_);
 	swap(role_, o.role_);
 	swap(attacks_, o.attacks_);
+	swap(attacks_shared_, o.attacks_shared_);
 	swap(facing_, o.facing_);
 	swap(trait_names_, o.trait_names_);
 	swap(trait_descriptions_, o.trait_descriptions_);
@@ -988,6 +1004,7 @@ void unit::advance_to(const unit_type& u_type, bool use_traits)
 
 	generate_name_ &= new_type.generate_name();
 	abilities_ = new_type.abilities_cfg();
+	adjacent_ability_tags_built_ = false;
 	advancements_.clear();
 
 	for(const config& advancement : new_type.advancements()) {
@@ -1026,6 +1043,7 @@ void unit::advance_to(const unit_type& u_type, bool use_traits)
 	movement_type_ = new_type.movement_type();
 	emit_zoc_ = new_type.has_zoc();
 	attacks_.clear();
+	attacks_shared_ = false;
 	std::transform(new_type.attacks().begin(), new_type.attacks().end(), std::back_inserter(attacks_), [](const attack_type& atk) {
 		return std::make_shared<attack_type>(atk);
 	});
@@ -1483,6 +1501,7 @@ void unit::remove_ability_by_id(const std::string& ability)
 			++i;
 		}
 	}
+	adjacent_ability_tags_built_ = false;
 }
 
 bool unit::get_attacks_changed() const
@@ -2025,6 +2044,7 @@ void unit::apply_builtin_effect(std::string apply_to, const config& effect)
 		attacks_.erase(iter, attacks_.end());
 	} else if(apply_to == "attack") {
 		set_attr_changed(UA_ATTACKS);
+		unshare_attacks();
 		for(attack_ptr a : attacks_) {
 			a->apply_modification(effect);
 		}
@@ -2189,6 +2209,7 @@ void unit::apply_builtin_effect(std::string apply_to, const config& effect)
 				}
 			}
 			abilities_.append(to_append);
+			adjacent_ability_tags_built_ = false;
 		}
 	} else if(apply_to == "remove_ability") {
 		if(auto ab_effect = effect.optional_child("abilities")) {
@@ -2699,6 +2720,20 @@ std::string unit::image_mods() const
 	return TC_image_mods();
 }
 
+void unit::unshare_attacks()
+{
+	if(!attacks_shared_) {
+		return;
+	}
+
+	// Resetting the elements in place keeps iterators into attacks_ valid.
+	for(auto& a : attacks_) {
+		a.reset(new attack_type(*a));
+	}
+
+	attacks_shared_ = false;
+}
+
 // Called by the Lua API after resetting an attack pointer.
 bool unit::remove_attack(attack_ptr atk)
 {
@@ -929,6 +929,7 @@ public:
 	/** Gets an iterator over this unit's attacks. */
 	attack_itors attacks()
 	{
+		unshare_attacks();
 		return make_attack_itors(attacks_);
 	}
 
@@ -947,6 +948,7 @@ public:
 	attack_ptr add_attack(attack_itors::iterator position, Args&&... args)
 	{
 		set_attr_changed(UA_ATTACKS);
+		unshare_attacks();
 		return *attacks_.emplace(position.base(), new attack_type(std::forward<Args>(args)...));
 	}
 
@@ -1057,6 +1059,12 @@ public:
 private:
 	bool resistance_filter_matches(const config& cfg, bool attacker, const std::string& damage_name, int res) const;
 
+	/**
+	 * Replaces attacks still shared with the unit this was copied from by
+	 * private copies. No-op when the attacks are already this unit's own.
+	 */
+	void unshare_attacks();
+
 	/**
 	 * @}
 	 * @defgroup unit_trait Trait and upkeep functions
@@ -1797,6 +1805,14 @@ private:
 	 */
 	bool ability_affects_adjacent(const std::string& ability, const config& cfg, int dir, const map_location& loc, const unit& from) const;
 
+	/**
+	 * Check if any ability of type (tag name) @a tag_name could affect adjacent units,
+	 * i.e. has an [affect_adjacent] child. Answered from a cached index of the
+	 * ability WML, so neighbour scans can dismiss this unit without evaluating
+	 * the activation filters of abilities that only ever affect itself.
+	 */
+	bool has_adjacent_ability(const std::string& tag_name) const;
+
 	/**
 	 * Check if an ability affects the owning unit.
 	 * @param ability The type (tag name) of the ability
@@ -1925,6 +1941,15 @@ private:
 	std::string role_;
 	attack_list attacks_;
 
+	/**
+	 * True while the attacks are still the ones shared with the unit this
+	 * was copied from. The copy constructor shares the attack objects
+	 * instead of duplicating them, the same way movetype shares its terrain
+	 * data, so cloning a unit for AI or whiteboard simulation stays cheap.
+	 * @ref unshare_attacks gives this unit its own copies on demand.
+	 */
+	bool attacks_shared_;
+
 protected:
 	// TODO: I think we actually consider this to be part of the gamestate, so it might be better if it's not mutable,
 	// but it's not easy to separate this guy from the animation code right now.
@@ -1952,6 +1977,16 @@ private:
 	config modifications_;
 	config abilities_;
 
+	/**
+	 * The ability tags in abilities_ that have at least one entry with an
+	 * [affect_adjacent] child, see has_adjacent_ability(). Mutable since it
+	 * is a cache, rebuilt on first use after abilities_ changes.
+	 */
+	mutable std::set<std::string> adjacent_ability_tags_;
+
+	/** Whether adjacent_ability_tags_ reflects the current abilities_. */
+	mutable bool adjacent_ability_tags_built_;
+
 	std::vector<config> advancements_;
 
 	t_string description_;
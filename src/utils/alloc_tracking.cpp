@@ -0,0 +1,70 @@
+/*
+	Copyright (C) 2022
+	Part of the Battle for Wesnoth Project https://www.wesnoth.org/
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY.
+
+	See the COPYING file for more details.
+*/
+
+#include "utils/alloc_tracking.hpp"
+
+#include <array>
+#include <iomanip>
+#include <sstream>
+
+namespace utils::alloc_tracking
+{
+
+namespace
+{
+
+constexpr std::size_t num_tags = static_cast<std::size_t>(tag::count);
+
+/** Display names, in enum order. */
+constexpr std::array<const char*, num_tags> tag_names {
+	"config nodes", "units", "gui2 widgets"
+};
+
+std::array<tag_stats, num_tags> all_stats;
+
+} // anonymous namespace
+
+tag_stats& stats(tag t)
+{
+	return all_stats[static_cast<std::size_t>(t)];
+}
+
+std::string report()
+{
+	std::ostringstream out;
+	out << std::left << std::setw(14) << "subsystem"
+		<< std::right << std::setw(12) << "live"
+		<< std::setw(12) << "live KiB"
+		<< std::setw(14) << "total allocs" << "\n";
+
+	for(std::size_t i = 0; i != num_tags; ++i) {
+		const tag_stats& s = all_stats[i];
+
+		// Relaxed reads can momentarily disagree with each other, but for
+		// leak hunting a snapshot that is off by a few objects is fine.
+		const uint64_t allocs = s.allocs.load(std::memory_order_relaxed);
+		const uint64_t frees = s.frees.load(std::memory_order_relaxed);
+		const uint64_t alloc_bytes = s.alloc_bytes.load(std::memory_order_relaxed);
+		const uint64_t freed_bytes = s.freed_bytes.load(std::memory_order_relaxed);
+
+		out << std::left << std::setw(14) << tag_names[i]
+			<< std::right << std::setw(12) << allocs - frees
+			<< std::setw(12) << (alloc_bytes - freed_bytes) / 1024
+			<< std::setw(14) << allocs << "\n";
+	}
+
+	return out.str();
+}
+
+} // namespace utils::alloc_tracking
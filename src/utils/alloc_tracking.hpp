@@ -0,0 +1,74 @@
+/*
+	Copyright (C) 2022
+	Part of the Battle for Wesnoth Project https://www.wesnoth.org/
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY.
+
+	See the COPYING file for more details.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * @file
+ * Allocation accounting for the heap-heavy object families.
+ *
+ * The tracked classes report their allocations and frees under a fixed
+ * subsystem tag; the /mem chat command dumps the totals. Counting is a
+ * pair of relaxed atomic increments next to an actual heap call, cheap
+ * enough to stay on in release builds, which is what makes the numbers
+ * available when a long MP session has already grown.
+ */
+namespace utils::alloc_tracking
+{
+
+enum class tag : std::size_t {
+	/** config nodes, i.e. every child table of every config tree. */
+	config_node,
+	/** unit instances, including fake and whiteboard-planned ones. */
+	unit,
+	/** gui2 widgets, from windows down to single labels. */
+	gui2_widget,
+	/** Number of tags. Keep this last! */
+	count
+};
+
+struct tag_stats
+{
+	std::atomic<uint64_t> allocs{0};
+	std::atomic<uint64_t> frees{0};
+	std::atomic<uint64_t> alloc_bytes{0};
+	std::atomic<uint64_t> freed_bytes{0};
+};
+
+/** The running totals for one tag. */
+tag_stats& stats(tag t);
+
+inline void track_alloc(tag t, std::size_t bytes)
+{
+	tag_stats& s = stats(t);
+	s.allocs.fetch_add(1, std::memory_order_relaxed);
+	s.alloc_bytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+inline void track_free(tag t, std::size_t bytes)
+{
+	tag_stats& s = stats(t);
+	s.frees.fetch_add(1, std::memory_order_relaxed);
+	s.freed_bytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+/** A human-readable table of live objects and bytes per tag. */
+std::string report();
+
+} // namespace utils::alloc_tracking
@@ -62,26 +62,13 @@ typename V::result_t apply_visitor(typename V::param_t state, T&&... args)
 
 using namespace variable_info_implementation;
 
-template<typename V>
-variable_info<V>::variable_info(const std::string& varname, maybe_const_t<config, V>& vars) noexcept
-	: name_(varname)
-	, state_(vars)
-	, valid_(true)
-{
-	try {
-		calculate_value();
-	} catch(const invalid_variablename_exception&) {
-		valid_ = false;
-	}
-}
-
-template<typename V>
-void variable_info<V>::calculate_value()
+variable_path parse_variable_path(const std::string& varname)
 {
-	std::size_t previous_index = 0, name_size = name_.size();
+	variable_path path;
+	std::size_t previous_index = 0, name_size = varname.size();
 
 	for(std::size_t loop_index = 0; loop_index < name_size; loop_index++) {
-		switch(name_[loop_index]) {
+		switch(varname[loop_index]) {
 		case '.':
 		case '[':
 			/* '.' and '[' mark the end of a string key.
@@ -90,19 +77,18 @@ void variable_info<V>::calculate_value()
 			 * is interpreted as  'aaa[9].bbbb.zzz.uu[7]'
 			 * Use is_valid_variable function for stricter variable name checking.
 			 */
-			apply_visitor<get_variable_key_visitor<V>>(
-				state_, name_.substr(previous_index, loop_index - previous_index));
+			path.push_back({varname.substr(previous_index, loop_index - previous_index), 0, false});
 
 			previous_index = loop_index + 1;
 			break;
 		case ']':
 			// ']' marks the end of an integer key.
-			apply_visitor<get_variable_index_visitor<V>>(state_, parse_index(&name_[previous_index]));
+			path.push_back({std::string(), parse_index(&varname[previous_index]), true});
 
 			// After ']' we always expect a '.' or the end of the string
 			// Ignore the next char which is a '.'
 			loop_index++;
-			if(loop_index < name_.length() && name_[loop_index] != '.') {
+			if(loop_index < varname.length() && varname[loop_index] != '.') {
 				throw invalid_variablename_exception();
 			}
 
@@ -113,10 +99,50 @@ void variable_info<V>::calculate_value()
 		}
 	}
 
-	if(previous_index != name_.length() + 1) {
+	if(previous_index != varname.length() + 1) {
 		// The string didn't end with ']'
 		// In this case we still didn't add the key behind the last '.'
-		apply_visitor<get_variable_key_visitor<V>>(state_, name_.substr(previous_index));
+		path.push_back({varname.substr(previous_index), 0, false});
+	}
+
+	return path;
+}
+
+template<typename V>
+variable_info<V>::variable_info(const std::string& varname, maybe_const_t<config, V>& vars) noexcept
+	: name_(varname)
+	, state_(vars)
+	, valid_(true)
+{
+	try {
+		apply_path(parse_variable_path(name_));
+	} catch(const invalid_variablename_exception&) {
+		valid_ = false;
+	}
+}
+
+template<typename V>
+variable_info<V>::variable_info(const std::string& varname, const variable_path& path, maybe_const_t<config, V>& vars) noexcept
+	: name_(varname)
+	, state_(vars)
+	, valid_(true)
+{
+	try {
+		apply_path(path);
+	} catch(const invalid_variablename_exception&) {
+		valid_ = false;
+	}
+}
+
+template<typename V>
+void variable_info<V>::apply_path(const variable_path& path)
+{
+	for(const variable_path_token& token : path) {
+		if(token.is_index) {
+			apply_visitor<get_variable_index_visitor<V>>(state_, token.index);
+		} else {
+			apply_visitor<get_variable_key_visitor<V>>(state_, token.key);
+		}
 	}
 }
 
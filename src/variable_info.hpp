@@ -36,6 +36,31 @@ public:
 // so include this after declaring it.
 #include "variable_info_detail.hpp"
 
+/** A single pre-parsed step of a variable name: either a '.key' or an '[index]'. */
+struct variable_path_token
+{
+	std::string key;
+	int index = 0;
+	bool is_index = false;
+};
+
+/**
+ * The tokenized form of a variable name such as 'a.b[2].c'.
+ *
+ * Parsing a name into this form once and replaying it on each access avoids
+ * re-splitting the string, which adds up in [for]/[while] heavy events.
+ */
+using variable_path = std::vector<variable_path_token>;
+
+/**
+ * Splits @a varname into its tokens.
+ *
+ * @throws invalid_variablename_exception   On malformed index syntax. Other
+ *         errors, such as invalid characters in a key, are only diagnosed
+ *         when the path is applied to actual variable data.
+ */
+variable_path parse_variable_path(const std::string& varname);
+
 /** Information on a WML variable. */
 template<typename V>
 class variable_info
@@ -43,6 +68,9 @@ class variable_info
 public:
 	variable_info(const std::string& varname, maybe_const_t<config, V>& vars) noexcept;
 
+	/** Variant that replays an already tokenized @a path instead of re-parsing @a varname. */
+	variable_info(const std::string& varname, const variable_path& path, maybe_const_t<config, V>& vars) noexcept;
+
 	std::string get_error_message() const;
 
 	bool explicit_index() const;
@@ -84,7 +112,7 @@ protected:
 	bool valid_;
 
 	void throw_on_invalid() const;
-	void calculate_value();
+	void apply_path(const variable_path& path);
 };
 
 /**
@@ -104,6 +132,16 @@ public:
 		);
 	}
 
+	/** Variant that replays an already tokenized @a path instead of re-parsing @a name. */
+	variable_info_mutable(const std::string& name, const variable_path& path, config& game_vars)
+		: variable_info<V>(name, path, game_vars)
+	{
+		static_assert(!std::is_same_v<
+			variable_info_implementation::vi_policy_const, std::remove_const_t<V>>,
+			"variable_info_mutable cannot be specialized with 'vi_policy_const'"
+		);
+	}
+
 	/**
 	 * @returns                 The new appended range.
 	 * @throws                  invalid_variablename_exception
@@ -407,24 +407,28 @@ public:
 			vi_policy_create::get_child_at(child, key, endindex - 1);
 		}
 
-		int size_diff = datasource_.size() - (endindex - startindex);
-
-		// remove configs first
-		while(size_diff < 0) {
-			child.remove_child(key, startindex);
-			++size_diff;
-		}
+		const std::size_t size = datasource_.size();
+		const std::size_t range = endindex - startindex;
 
+		// Swap the payload into the children being overwritten, then settle
+		// the length difference with one bulk insert or erase instead of
+		// shifting the trailing siblings once per element.
 		std::size_t index = 0;
-		for(index = 0; index < static_cast<std::size_t>(size_diff); ++index) {
-			child.add_child_at(key, config(), startindex + index).swap(datasource_[index]);
+		for(; index < std::min(size, range); ++index) {
+			child.mandatory_child(key, startindex + index).swap(datasource_[index]);
 		}
 
-		for(; index < datasource_.size(); ++index) {
-			child.mandatory_child(key, startindex + index).swap(datasource_[index]);
+		if(size > range) {
+			child.insert_children(key,
+				std::vector<config>(
+					std::make_move_iterator(datasource_.begin() + index),
+					std::make_move_iterator(datasource_.end())),
+				startindex + index);
+		} else if(size < range) {
+			child.remove_children(key, startindex + size, range - size);
 		}
 
-		return get_child_range(child, key, startindex, datasource_.size());
+		return get_child_range(child, key, startindex, size);
 	}
 
 private:
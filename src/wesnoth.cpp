@@ -768,6 +768,16 @@ static int do_gameloop(const std::vector<std::string>& args)
 	const auto game = std::make_unique<game_launcher>(cmdline_opts);
 	const int start_ticks = SDL_GetTicks();
 
+	// The stages below form a chain (the language feeds the fonts, the video
+	// feeds the GUI, the GUI feeds the loading screen), so attribute the cold
+	// start cost to individual stages rather than reporting one lump sum.
+	int stage_ticks = start_ticks;
+	const auto log_startup_stage = [&stage_ticks](const char* stage) {
+		const int now = SDL_GetTicks();
+		LOG_CONFIG << "startup stage '" << stage << "' took " << (now - stage_ticks) << " ms";
+		stage_ticks = now;
+	};
+
 	init_locale();
 
 	bool res;
@@ -783,18 +793,24 @@ static int do_gameloop(const std::vector<std::string>& args)
 		return 1;
 	}
 
+	log_startup_stage("fonts");
+
 	res = game->init_language();
 	if(res == false) {
 		PLAIN_LOG << "could not initialize the language";
 		return 1;
 	}
 
+	log_startup_stage("language");
+
 	res = game->init_video();
 	if(res == false) {
 		PLAIN_LOG << "could not initialize display";
 		return 1;
 	}
 
+	log_startup_stage("video");
+
 	check_fpu();
 	const cursor::manager cursor_manager;
 	cursor::set(cursor::WAIT);
@@ -806,6 +822,8 @@ static int do_gameloop(const std::vector<std::string>& args)
 	gui2::init();
 	const gui2::event::manager gui_event_manager;
 
+	log_startup_stage("gui2");
+
 	if(!lg::log_dir_writable()) {
 		utils::string_map symbols;
 		symbols["logdir"] = filesystem::get_logs_dir();
@@ -820,7 +838,7 @@ static int do_gameloop(const std::vector<std::string>& args)
 		gui2::dialogs::migrate_version_selection::execute();
 	}
 
-	gui2::dialogs::loading_screen::display([&res, &config_manager, &cmdline_opts]() {
+	gui2::dialogs::loading_screen::display([&res, &config_manager, &cmdline_opts, &log_startup_stage]() {
 		gui2::dialogs::loading_screen::progress(loading_stage::load_config);
 		res = config_manager.init_game_config(game_config_manager::NO_FORCE_RELOAD);
 
@@ -829,6 +847,8 @@ static int do_gameloop(const std::vector<std::string>& args)
 			return;
 		}
 
+		log_startup_stage("game config");
+
 		gui2::dialogs::loading_screen::progress(loading_stage::init_fonts);
 
 		res = font::load_font_config();
@@ -837,10 +857,14 @@ static int do_gameloop(const std::vector<std::string>& args)
 			return;
 		}
 
+		log_startup_stage("font reload");
+
 		if(!game_config::no_addons && !cmdline_opts.noaddons)  {
 			gui2::dialogs::loading_screen::progress(loading_stage::refresh_addons);
 
 			refresh_addon_version_info_cache();
+
+			log_startup_stage("addon cache");
 		}
 	});
 
@@ -59,6 +59,10 @@ struct mptest_log
 using boost::system::error_code;
 using boost::system::system_error;
 
+// Upper bound on recycled send buffers, so a burst of large transfers
+// (e.g. addon uploads) does not stay allocated for the whole session.
+static const std::size_t send_buffer_pool_max = 4;
+
 using namespace std::chrono_literals; // s, ms, etc
 
 // main thread
@@ -77,6 +81,8 @@ wesnothd_connection::wesnothd_connection(const std::string& host, const std::str
 	, read_buf_()
 	, handshake_response_()
 	, recv_queue_()
+	, send_buffer_pool_()
+	, send_buffer_pool_mutex_()
 	, recv_queue_mutex_()
 	, recv_queue_lock_()
 	, payload_size_(0)
@@ -324,7 +330,19 @@ void wesnothd_connection::send_data(const configr_of& request)
 {
 	MPTEST_LOG;
 
-	auto buf_ptr = std::make_unique<boost::asio::streambuf>();
+	std::unique_ptr<boost::asio::streambuf> buf_ptr;
+
+	{
+		std::scoped_lock lock(send_buffer_pool_mutex_);
+		if(!send_buffer_pool_.empty()) {
+			buf_ptr = std::move(send_buffer_pool_.back());
+			send_buffer_pool_.pop_back();
+		}
+	}
+
+	if(!buf_ptr) {
+		buf_ptr = std::make_unique<boost::asio::streambuf>();
+	}
 
 	std::ostream os(buf_ptr.get());
 	write_gz(os, request);
@@ -400,6 +418,18 @@ void wesnothd_connection::handle_write(const boost::system::error_code& ec, std:
 	MPTEST_LOG;
 	DBG_NW << "Written " << bytes_transferred << " bytes.";
 
+	{
+		// Hand the written buffer back for reuse; its allocation outlives
+		// the message.
+		std::unique_ptr<boost::asio::streambuf>& buf = send_queue_.front();
+		buf->consume(buf->size());
+
+		std::scoped_lock lock(send_buffer_pool_mutex_);
+		if(send_buffer_pool_.size() < send_buffer_pool_max) {
+			send_buffer_pool_.push_back(std::move(buf));
+		}
+	}
+
 	send_queue_.pop();
 
 	if(ec) {
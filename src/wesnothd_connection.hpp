@@ -46,6 +46,7 @@
 #include <mutex>
 #include <queue>
 #include <thread>
+#include <vector>
 
 class config;
 
@@ -190,6 +191,16 @@ private:
 	data_queue<std::unique_ptr<boost::asio::streambuf>> send_queue_;
 	data_queue<config> recv_queue_;
 
+	/**
+	 * Fully written send buffers, kept so send_data() can reuse their
+	 * allocations instead of growing a fresh streambuf per message.
+	 * Guarded by send_buffer_pool_mutex_: buffers are taken on the main
+	 * thread and returned on the worker thread.
+	 */
+	std::vector<std::unique_ptr<boost::asio::streambuf>> send_buffer_pool_;
+
+	std::mutex send_buffer_pool_mutex_;
+
 	std::mutex recv_queue_mutex_;
 
 	std::condition_variable recv_queue_lock_;
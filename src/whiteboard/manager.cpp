@@ -449,6 +449,10 @@ void manager::validate_viewer_actions()
 {
 	LOG_WB << "'gamestate_mutated_' flag dirty, validating actions.";
 	gamestate_mutated_ = false;
+	if(mapbuilder_) {
+		//Validation must actually revalidate, not replay the cached build.
+		mapbuilder_->invalidate();
+	}
 	if(has_planned_unit_map()) {
 		real_map();
 	} else {
@@ -1187,8 +1191,14 @@ void manager::set_planned_unit_map()
 	}
 
 	log_scope2(log_whiteboard, "Building planned unit map");
-	mapbuilder_.reset(new mapbuilder(resources::gameboard->units()));
-	mapbuilder_->build_map();
+	if(!gamestate_mutated_ && mapbuilder_ && mapbuilder_->can_reapply()) {
+		//Neither the game state nor the plans changed since the last build,
+		//so replay the cached modifiers instead of revalidating every action.
+		mapbuilder_->reapply();
+	} else {
+		mapbuilder_.reset(new mapbuilder(resources::gameboard->units()));
+		mapbuilder_->build_map();
+	}
 
 	planned_unit_map_active_ = true;
 }
@@ -1202,7 +1212,9 @@ void manager::set_real_unit_map()
 		if(mapbuilder_)
 		{
 			log_scope2(log_whiteboard, "Restoring regular unit map.");
-			mapbuilder_.reset();
+			//Keep the builder around: if nothing changes before the next
+			//future map is requested, its cache makes that build cheap.
+			mapbuilder_->revert_map();
 		}
 		planned_unit_map_active_ = false;
 	}
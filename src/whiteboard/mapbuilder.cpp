@@ -43,6 +43,10 @@ mapbuilder::mapbuilder(unit_map& unit_map)
 	, acted_this_turn_()
 	, has_invalid_actions_()
 	, invalid_actions_()
+	, replay_cache_()
+	, plan_signature_()
+	, built_for_side_(0)
+	, built_(false)
 {
 }
 
@@ -88,29 +92,41 @@ void mapbuilder::pre_build()
 
 void mapbuilder::build_map()
 {
-	pre_build();
-	if(!wb::has_actions()) {
-		return;
-	}
+	//Discard caches from any previous build of this object
+	replay_cache_.clear();
+	acted_this_turn_.clear();
+	has_invalid_actions_.clear();
+	invalid_actions_.clear();
+	applied_actions_this_turn_.clear();
+	built_ = false;
 
-	bool stop = false;
-	for(std::size_t turn=0; !stop; ++turn) {
-		stop = true;
-		for (team &side : resources::gameboard->teams()) {
-			side_actions &actions = *side.get_side_actions();
-			if(turn < actions.num_turns() && team_has_visible_plan(side)) {
-				stop = false;
-				side_actions::iterator it = actions.turn_begin(turn), next = it, end = actions.turn_end(turn);
-				while(it != end) {
-					std::advance(next, 1);
-					process(actions, it, side.is_local());
-					it = next;
+	pre_build();
+	if(wb::has_actions()) {
+		bool stop = false;
+		for(std::size_t turn=0; !stop; ++turn) {
+			stop = true;
+			for (team &side : resources::gameboard->teams()) {
+				side_actions &actions = *side.get_side_actions();
+				if(turn < actions.num_turns() && team_has_visible_plan(side)) {
+					stop = false;
+					side_actions::iterator it = actions.turn_begin(turn), next = it, end = actions.turn_end(turn);
+					while(it != end) {
+						std::advance(next, 1);
+						process(actions, it, side.is_local());
+						it = next;
+					}
+
+					post_visit_team(turn);
 				}
-
-				post_visit_team(turn);
 			}
 		}
 	}
+
+	//Record what the plans looked like once building (which may have removed
+	//invalid actions) is done, so reapply() can tell whether they changed.
+	plan_signature_ = compute_plan_signature();
+	built_for_side_ = resources::controller->current_side();
+	built_ = true;
 }
 
 void mapbuilder::process(side_actions &sa, side_actions::iterator action_it, bool is_local_side)
@@ -129,6 +145,10 @@ void mapbuilder::process(side_actions &sa, side_actions::iterator action_it, boo
 		acted=true;
 	}
 
+	//Record the MP reset even if the action turns out to be invalid below,
+	//since the reset has already affected the unit map.
+	replay_cache_.push_back(replay_entry{action, acted, false});
+
 	// Validity check
 	action::error erval = action->check_validity();
 	action->redraw();
@@ -170,6 +190,7 @@ void mapbuilder::process(side_actions &sa, side_actions::iterator action_it, boo
 	}
 
 	action->apply_temp_modifier(unit_map_);
+	replay_cache_.back().applied = true;
 	applied_actions_.push_back(action);
 	applied_actions_this_turn_.push_back(action);
 }
@@ -205,4 +226,60 @@ void mapbuilder::restore_normal_map()
 	}
 }
 
+void mapbuilder::revert_map()
+{
+	restore_normal_map();
+	applied_actions_.clear();
+	applied_actions_this_turn_.clear();
+	acted_this_turn_.clear();
+	//Release in the same order the destructor would: units go back on the
+	//map before their movement points are restored.
+	removers_.clear();
+	resetters_.clear();
+}
+
+std::vector<const action*> mapbuilder::compute_plan_signature() const
+{
+	std::vector<const action*> signature;
+	for(team& side : resources::gameboard->teams()) {
+		side_actions& actions = *side.get_side_actions();
+		if(!team_has_visible_plan(side)) {
+			continue;
+		}
+		for(std::size_t turn = 0; turn < actions.num_turns(); ++turn) {
+			for(side_actions::const_iterator it = actions.turn_begin(turn); it != actions.turn_end(turn); ++it) {
+				signature.push_back(it->get());
+			}
+			//Mark turn boundaries, so moving an action to another turn changes the signature
+			signature.push_back(nullptr);
+		}
+	}
+	return signature;
+}
+
+bool mapbuilder::can_reapply() const
+{
+	return built_
+		&& resources::controller->current_side() == built_for_side_
+		&& compute_plan_signature() == plan_signature_;
+}
+
+void mapbuilder::reapply()
+{
+	pre_build();
+	for(const replay_entry& entry : replay_cache_) {
+		unit_ptr unit = entry.action->get_unit();
+		if(!unit) {
+			continue;
+		}
+		if(entry.reset_mp) {
+			unit->set_movement(unit->total_movement());
+		}
+		if(entry.applied) {
+			entry.action->apply_temp_modifier(unit_map_);
+			applied_actions_.push_back(entry.action);
+		}
+	}
+}
+
 } // end namespace wb
@@ -22,6 +22,7 @@
 #include "side_actions.hpp"
 
 #include <list>
+#include <vector>
 
 #include "utility.hpp"
 
@@ -48,6 +49,28 @@ public:
 	 */
 	void build_map();
 
+	/**
+	 * Undoes every modification applied by build_map() or reapply(), but keeps
+	 * the replay cache so the map can later be rebuilt cheaply via reapply().
+	 */
+	void revert_map();
+
+	/**
+	 * Whether reapply() may be used instead of build_map(), i.e. a full build
+	 * completed and the planned actions have not changed since.
+	 */
+	bool can_reapply() const;
+
+	/**
+	 * Replays the unit map modifiers cached by the last full build, skipping
+	 * validity checks, redraws and invalid-action cleanup. Only valid when
+	 * can_reapply() returns true and the game state is unchanged.
+	 */
+	void reapply();
+
+	/** Discards the replay cache, forcing the next build to revalidate everything. */
+	void invalidate() { built_ = false; }
+
 private:
 	/** Function called on each action. */
 	void process(side_actions &sa, side_actions::iterator action_it, bool is_local_side);
@@ -60,6 +83,9 @@ private:
 
 	void restore_normal_map();
 
+	/** Snapshot of every visible plan, used to detect changes between builds. */
+	std::vector<const action*> compute_plan_signature() const;
+
 	unit_map& unit_map_;
 
 	action_queue applied_actions_;
@@ -74,6 +100,24 @@ private:
 	std::set<unit const*> has_invalid_actions_;
 	/** Conserved invalid actions. */
 	std::list<side_actions::iterator> invalid_actions_;
+
+	/** One modifier applied during the full build, with the side effects reapply() must replicate. */
+	struct replay_entry
+	{
+		action_ptr action;
+		/** Whether process() reset the unit's movement points before this action. */
+		bool reset_mp;
+		/** Whether the action passed validation and its temp modifier was applied. */
+		bool applied;
+	};
+	/** Everything the last full build did to the unit map, in order. */
+	std::vector<replay_entry> replay_cache_;
+	/** Flattened view of all visible plans at the end of the last full build. */
+	std::vector<const action*> plan_signature_;
+	/** The side that was current during the last full build; MP resets depend on it. */
+	int built_for_side_;
+	/** True once a full build has completed and its caches are usable. */
+	bool built_;
 };
 
 }